@@ -14,6 +14,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <iostream>
+#include <vector>
 #include <stdlib.h>
 #include <limits.h>
 #include <stdarg.h>
@@ -25,6 +26,21 @@
 extern "C" {
 #include "MGLContext.h"
 }
+#include "../MGL/src/mipmaps.h"
+#include "../MGL/src/pixel_formats.h"
+#include "../MGL/src/depth_stencil_cache.h"
+#include "../MGL/src/pixel_store.h"
+#include "render_pass.h"
+#include "draw_queue.h"
+#include "index_translate.h"
+#include "upload_ring.h"
+#include "multi_draw_indirect.h"
+#include "query_pool.h"
+#include "sync_table.h"
+#include "frame_pacing.h"
+#include "trace.h"
+#include "capture.h"
+#include "glm_context.h"
 #include "MGLRenderer.h"
 
 #import "MGL_test_utils.h"
@@ -41,6 +57,67 @@ extern "C" {
 - (GLuint) winHeight;
 @end
 
+// stands in for the metal backend, records what the planner picked for each pass
+struct RenderPassRecorder {
+    RenderPass pass;
+    std::vector<RenderPassActions> loads;
+    std::vector<RenderPassActions> stores;
+
+    RenderPassRecorder() { initRenderPass(&pass); }
+
+    void begin(GLbitfield attachments)
+    {
+        RenderPassActions actions;
+
+        renderPassBegin(&pass, attachments, &actions);
+        loads.push_back(actions);
+    }
+
+    void end()
+    {
+        RenderPassActions actions;
+
+        renderPassEnd(&pass, &actions);
+        stores.push_back(actions);
+    }
+};
+
+// stands in for the metal backend, records the draws a flush sends
+struct DrawQueueRecorder {
+    DrawQueue queue;
+    std::vector<DrawQueueEntry> draws;
+    std::vector<DrawQueueEntry> batch;
+    GLuint batch_min;           // 0 declines every batch
+
+    DrawQueueRecorder() : batch_min(0) { initDrawQueue(&queue); }
+
+    static void emit(void *user, const DrawQueue *queue, const DrawQueueEntry *entry)
+    {
+        ((DrawQueueRecorder *)user)->draws.push_back(*entry);
+    }
+
+    static GLboolean batchDraws(void *user, const DrawQueue *queue, const DrawQueueEntry *entries, GLuint count)
+    {
+        DrawQueueRecorder *rec = (DrawQueueRecorder *)user;
+
+        if (rec->batch_min == 0 || count < rec->batch_min)
+            return GL_FALSE;
+
+        rec->batch.assign(entries, entries + count);
+
+        return GL_TRUE;
+    }
+
+    GLuint flush() { return drawQueueFlush(&queue, emit, batchDraws, this); }
+};
+
+// byte order reversed per element, what the swap_bytes shuffle should match
+static void swapReference(GLubyte *dst, const GLubyte *src, size_t size, size_t swap_size)
+{
+    for(size_t i=0; i<size; i++)
+        dst[i] = swap_size ? src[(i / swap_size) * swap_size + swap_size - 1 - i % swap_size] : src[i];
+}
+
 @implementation MGL_Tests
 
 - (NSRect) windowFrame
@@ -319,10 +396,21 @@ extern "C" {
     pixels = (uint8_t *)malloc(len);
 
     glReadBuffer(GL_FRONT);
-    glReadPixels(0, 0, [self winWidth], [self winHeight], GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glReadPixels(0, 0, [self winWidth], [self winHeight], GL_BGRA, GL_UNSIGNED_BYTE, pixels);
 
     glFlush();
 
+    // glReadPixels rows are bottom up, the goldens are top left origin tga
+    size_t row_len = [self winWidth] * 4;
+    uint8_t *row = (uint8_t *)malloc(row_len);
+    for (size_t top = 0, bottom = [self winHeight] - 1; top < bottom; top++, bottom--)
+    {
+        memcpy(row, pixels + top * row_len, row_len);
+        memcpy(pixels + top * row_len, pixels + bottom * row_len, row_len);
+        memcpy(pixels + bottom * row_len, row, row_len);
+    }
+    free(row);
+
     NSSize size;
     bool test_passed;
 
@@ -675,6 +763,2199 @@ extern "C" {
     }];
 }
 
+- (void)testCPUMipmapPerf {
+    struct {
+        GLenum internalformat;
+        size_t pixel_size;
+        const char *name;
+    } formats[] = {
+        {GL_RGBA8, 4, "GL_RGBA8"},
+        {GL_SRGB8_ALPHA8, 4, "GL_SRGB8_ALPHA8"},
+        {GL_RG8, 2, "GL_RG8"},
+        {GL_RGBA8UI, 4, "GL_RGBA8UI"},
+        {GL_RGBA16, 8, "GL_RGBA16"},
+        {GL_RGBA16I, 8, "GL_RGBA16I"},
+        {GL_RGBA16F, 8, "GL_RGBA16F"},
+        {GL_RGBA32F, 16, "GL_RGBA32F"},
+        {GL_RGBA32UI, 16, "GL_RGBA32UI"},
+        {GL_RGB565, 2, "GL_RGB565"},
+        {GL_RGB10_A2, 4, "GL_RGB10_A2"},
+        {GL_R11F_G11F_B10F, 4, "GL_R11F_G11F_B10F"},
+        {GL_RGB9_E5, 4, "GL_RGB9_E5"},
+    };
+    const GLuint width = 1024, height = 1024, iterations = 10;
+
+    for(size_t i=0; i<sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        TextureLevel src, dst;
+
+        XCTAssertTrue(mipmapFormatSupported(formats[i].internalformat, formats[i].pixel_size));
+
+        bzero(&src, sizeof(src));
+        src.width = width;
+        src.height = height;
+        src.depth = 1;
+        src.pitch = width * formats[i].pixel_size;
+        src.data = (vm_address_t)malloc(src.pitch * height);
+        memset((void *)src.data, 0x10, src.pitch * height);
+
+        bzero(&dst, sizeof(dst));
+        dst.width = width / 2;
+        dst.height = height / 2;
+        dst.depth = 1;
+        dst.pitch = dst.width * formats[i].pixel_size;
+        dst.data = (vm_address_t)malloc(dst.pitch * dst.height);
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint iter=0; iter<iterations; iter++)
+        {
+            XCTAssertTrue(generateMipmapLevel(formats[i].internalformat, true, false, &src, &dst));
+        }
+
+        CFAbsoluteTime elapsed = (CFAbsoluteTimeGetCurrent() - start) / iterations;
+
+        NSLog(@"testCPUMipmapPerf %s %dx%d -> %dx%d %.3f ms (%.1f MTexels/s)", formats[i].name,
+              width, height, dst.width, dst.height, elapsed * 1000.0, (width * height) / elapsed / 1e6);
+
+        // a constant image filters to itself
+        if (formats[i].internalformat == GL_RGBA8 || formats[i].internalformat == GL_RGBA8UI)
+        {
+            XCTAssertEqual(((GLubyte *)dst.data)[0], 0x10);
+            XCTAssertEqual(((GLubyte *)dst.data)[dst.pitch * dst.height - 1], 0x10);
+        }
+
+        free((void *)src.data);
+        free((void *)dst.data);
+    }
+}
+
+- (void)testPixelFormatLookupPerf {
+    // every descriptor is reachable through its enum
+    for(GLuint id=1; id<pixel_format_count; id++)
+    {
+        XCTAssertEqual(pixelFormatID(pixel_format_table[id].internalformat), id);
+    }
+
+    XCTAssertEqual(pixelFormatID(0), 0u);
+    XCTAssertEqual(pixelFormatID(0x1234), 0u);
+
+    XCTAssertEqual(pixelFormatDesc(GL_RG32F)->pixel_size, 8);
+    XCTAssertEqual(pixelFormatDesc(GL_R8UI)->mtl_format, MTLPixelFormatR8Uint);
+    XCTAssertEqual(pixelFormatDesc(GL_RGBA8I)->mtl_format, MTLPixelFormatRGBA8Sint);
+    XCTAssertEqual(pixelFormatDesc(GL_DEPTH24_STENCIL8)->bits[PIXEL_BITS_STENCIL], 8);
+    XCTAssertTrue(pixelFormatDesc(GL_SRGB8_ALPHA8)->flags & PIXEL_FORMAT_SRGB);
+    XCTAssertEqual(pixelFormatDesc(GL_COMPRESSED_RGBA_ASTC_8x8_KHR)->block_width, 8);
+
+    // a typical upload / bind mix, including misses
+    const GLenum formats[] = {
+        GL_RGBA8, GL_SRGB8_ALPHA8, GL_DEPTH32F_STENCIL8, GL_R8, GL_RGBA16F, GL_RG32UI,
+        GL_RGB565, GL_COMPRESSED_RGBA_BPTC_UNORM, GL_DEPTH_COMPONENT24, GL_RGBA, 0x1234
+    };
+    const GLuint num_formats = sizeof(formats) / sizeof(formats[0]);
+    const GLuint iterations = 10000000;
+    volatile GLuint sink = 0;
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+    for(GLuint iter=0; iter<iterations; iter++)
+    {
+        const PixelFormatDesc *desc = pixelFormatDesc(formats[iter % num_formats]);
+
+        if (desc)
+            sink += desc->pixel_size + desc->mtl_format;
+    }
+
+    CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+    NSLog(@"testPixelFormatLookupPerf %d formats, %u lookups %.3f ms (%.2f ns/lookup)", pixel_format_count - 1,
+          iterations, elapsed * 1000.0, elapsed * 1e9 / iterations);
+}
+
+- (void)testPixelStore {
+    PixelStore store;
+    PixelStoreLayout layout;
+
+    // rgb8 rows of 5 pad to 16 at the default alignment
+    bzero(&store, sizeof(store));
+    store.alignment = 4;
+    XCTAssertTrue(pixelStoreLayout(&store, 2, GL_RGB, GL_UNSIGNED_BYTE, 5, 3, &layout));
+    XCTAssertEqual(layout.pixel_size, 3u);
+    XCTAssertEqual(layout.row_pitch, 16u);
+    XCTAssertEqual(layout.image_pitch, 48u);
+    XCTAssertEqual(layout.skip_bytes, 0u);
+    XCTAssertEqual(pixelStoreSpan(&layout, 5, 3, 1), 2 * 16 + 15u);
+
+    // row_length and the skips, image_height and skip_images only count for 3d
+    store.row_length = 8;
+    store.skip_pixels = 2;
+    store.skip_rows = 1;
+    store.image_height = 6;
+    store.skip_images = 1;
+    XCTAssertTrue(pixelStoreLayout(&store, 2, GL_RGB, GL_UNSIGNED_BYTE, 5, 3, &layout));
+    XCTAssertEqual(layout.row_pitch, 24u);
+    XCTAssertEqual(layout.image_pitch, 72u);
+    XCTAssertEqual(layout.skip_bytes, 2 * 3 + 24u);
+
+    XCTAssertTrue(pixelStoreLayout(&store, 3, GL_RGB, GL_UNSIGNED_BYTE, 5, 3, &layout));
+    XCTAssertEqual(layout.image_pitch, 24 * 6u);
+    XCTAssertEqual(layout.skip_bytes, 2 * 3 + 24 + 144u);
+    XCTAssertEqual(pixelStoreSpan(&layout, 5, 3, 2), 174 + 144 + 2 * 24 + 15u);
+    XCTAssertEqual(pixelStoreSpan(&layout, 0, 3, 2), 0u);
+
+    // 1d ignores skip_rows
+    XCTAssertTrue(pixelStoreLayout(&store, 1, GL_RGB, GL_UNSIGNED_BYTE, 5, 1, &layout));
+    XCTAssertEqual(layout.skip_bytes, 2 * 3u);
+
+    // alignment only pads components smaller than it, swap_bytes swaps whole components
+    bzero(&store, sizeof(store));
+    store.alignment = 8;
+    store.swap_bytes = GL_TRUE;
+    XCTAssertTrue(pixelStoreLayout(&store, 2, GL_RGB, GL_UNSIGNED_SHORT, 3, 2, &layout));
+    XCTAssertEqual(layout.row_pitch, 24u);
+    XCTAssertEqual(layout.swap_size, 2u);
+    XCTAssertTrue(pixelStoreLayout(&store, 2, GL_RGBA, GL_FLOAT, 3, 2, &layout));
+    XCTAssertEqual(layout.row_pitch, 48u);
+    XCTAssertEqual(layout.swap_size, 4u);
+    XCTAssertTrue(pixelStoreLayout(&store, 2, GL_RGBA, GL_UNSIGNED_BYTE, 3, 2, &layout));
+    XCTAssertEqual(layout.swap_size, 0u);
+    XCTAssertFalse(pixelStoreLayout(&store, 2, GL_RGBA, 0, 3, 2, &layout));
+
+    // the vector shuffle and the scalar tail, from an unaligned source
+    std::vector<GLubyte> src(16 * 7 + 8 + 1), dst(src.size()), ref(src.size());
+
+    for(size_t i=0; i<src.size(); i++)
+        src[i] = (GLubyte)(i * 7 + 1);
+
+    const size_t swap_sizes[] = {0, 2, 4, 8};
+
+    for(size_t swap_size : swap_sizes)
+    {
+        size_t size = src.size() - 1;
+
+        std::fill(dst.begin(), dst.end(), 0);
+        copyImage3D(dst.data(), size, size, src.data() + 1, size, size, size, 1, 1, swap_size);
+        swapReference(ref.data(), src.data() + 1, size, swap_size);
+
+        XCTAssertEqual(memcmp(dst.data(), ref.data(), size), 0, @"swap_size %zu", swap_size);
+    }
+
+    // strided 3d copy big enough to go wide, against a row at a time reference
+    const size_t row_bytes = 2048, height = 256, depth = 16;
+    const size_t src_row_pitch = row_bytes + 64, src_image_pitch = src_row_pitch * height;
+    const size_t dst_row_pitch = row_bytes + 32, dst_image_pitch = dst_row_pitch * (height + 1);
+
+    XCTAssertGreaterThanOrEqual(row_bytes * height * depth, (size_t)PIXEL_STORE_THREADED_MIN_BYTES);
+
+    std::vector<GLubyte> image(src_image_pitch * depth);
+    std::vector<GLubyte> out(dst_image_pitch * depth, 0), expect(dst_image_pitch * depth, 0);
+
+    for(size_t i=0; i<image.size(); i++)
+        image[i] = (GLubyte)((i * 2654435761u) >> 13);
+
+    copyImage3D(out.data(), dst_row_pitch, dst_image_pitch, image.data(), src_row_pitch, src_image_pitch,
+                row_bytes, height, depth, 4);
+
+    for(size_t z=0; z<depth; z++)
+    {
+        for(size_t y=0; y<height; y++)
+        {
+            swapReference(expect.data() + z * dst_image_pitch + y * dst_row_pitch,
+                          image.data() + z * src_image_pitch + y * src_row_pitch, row_bytes, 4);
+        }
+    }
+
+    XCTAssertEqual(memcmp(out.data(), expect.data(), out.size()), 0);
+}
+
+- (void)testRenderPassPlanner {
+    const GLbitfield color_depth = 0x1 | RENDER_PASS_DEPTH_BIT;
+    const GLfloat red[4] = {1, 0, 0, 1};
+
+    // clear, draw, invalidate depth before the pass ends
+    RenderPassRecorder rec;
+
+    renderPassClearColor(&rec.pass, RENDER_PASS_COLOR_MASK, red);
+    renderPassClearDepth(&rec.pass, 1.0);
+    XCTAssertTrue(renderPassNeedsRestart(&rec.pass));
+
+    rec.begin(color_depth);
+    XCTAssertFalse(renderPassNeedsRestart(&rec.pass));
+    XCTAssertEqual(rec.loads[0].load[0], RENDER_PASS_LOAD_CLEAR);
+    XCTAssertEqual(rec.loads[0].load[RENDER_PASS_DEPTH], RENDER_PASS_LOAD_CLEAR);
+    XCTAssertEqual(rec.loads[0].clear_color[0][0], 1.0f);
+
+    renderPassDraw(&rec.pass);
+    renderPassInvalidate(&rec.pass, RENDER_PASS_DEPTH_BIT);
+    rec.end();
+    XCTAssertEqual(rec.stores[0].store[0], RENDER_PASS_STORE_STORE);
+    XCTAssertEqual(rec.stores[0].store[RENDER_PASS_DEPTH], RENDER_PASS_STORE_DONT_CARE);
+
+    // the invalidated depth isn't loaded, untouched color is
+    rec.begin(color_depth);
+    XCTAssertEqual(rec.loads[1].load[0], RENDER_PASS_LOAD_LOAD);
+    XCTAssertEqual(rec.loads[1].load[RENDER_PASS_DEPTH], RENDER_PASS_LOAD_DONT_CARE);
+
+    // depth never drawn after the dont care load, nothing to keep
+    rec.end();
+    XCTAssertEqual(rec.stores[1].store[0], RENDER_PASS_STORE_STORE);
+    XCTAssertEqual(rec.stores[1].store[RENDER_PASS_DEPTH], RENDER_PASS_STORE_DONT_CARE);
+
+    // drawing after an invalidate keeps the result
+    rec.begin(color_depth);
+    renderPassInvalidate(&rec.pass, 0x1);
+    renderPassDraw(&rec.pass);
+    rec.end();
+    XCTAssertEqual(rec.stores[2].store[0], RENDER_PASS_STORE_STORE);
+
+    // a clear after an invalidate wins, a clear of a missing attachment is dropped
+    renderPassInvalidate(&rec.pass, 0x1);
+    renderPassClearColor(&rec.pass, 0x1 | 0x2, red);
+    rec.begin(0x1);
+    XCTAssertEqual(rec.loads[3].load[0], RENDER_PASS_LOAD_CLEAR);
+    XCTAssertFalse(renderPassNeedsRestart(&rec.pass));
+
+    // multisample attachments resolve even when the samples are discarded
+    renderPassSetResolve(&rec.pass, 0x1);
+    renderPassDraw(&rec.pass);
+    renderPassInvalidate(&rec.pass, 0x1);
+    rec.end();
+    XCTAssertEqual(rec.stores[3].store[0], RENDER_PASS_STORE_RESOLVE);
+
+    // ending without an active pass picks nothing
+    rec.end();
+    XCTAssertEqual(rec.stores[4].attachments, 0u);
+
+    XCTAssertEqual(rec.pass.passes, 4u);
+    XCTAssertEqual(rec.pass.loads_skipped, 4u);
+    XCTAssertEqual(rec.pass.stores_skipped, 3u);
+}
+
+- (void)testRenderPassRebind {
+    const GLbitfield color_depth = 0x1 | RENDER_PASS_DEPTH_BIT;
+    const GLfloat red[4] = {1, 0, 0, 1};
+    RenderPassRecorder rec;
+
+    // glBindFramebuffer(A) glClear glBindFramebuffer(B) glDraw, the clear gets a pass on A at the rebind
+    renderPassClearColor(&rec.pass, RENDER_PASS_COLOR_MASK, red);
+    renderPassClearDepth(&rec.pass, 1.0);
+    XCTAssertTrue(renderPassNeedsRestart(&rec.pass));
+
+    rec.begin(color_depth);
+    rec.end();
+    renderPassDropPending(&rec.pass);
+    XCTAssertEqual(rec.loads[0].load[0], RENDER_PASS_LOAD_CLEAR);
+    XCTAssertEqual(rec.loads[0].load[RENDER_PASS_DEPTH], RENDER_PASS_LOAD_CLEAR);
+    XCTAssertEqual(rec.stores[0].store[0], RENDER_PASS_STORE_STORE);
+
+    // B loads what it had
+    rec.begin(color_depth);
+    renderPassDraw(&rec.pass);
+    rec.end();
+    XCTAssertEqual(rec.loads[1].load[0], RENDER_PASS_LOAD_LOAD);
+    XCTAssertEqual(rec.loads[1].load[RENDER_PASS_DEPTH], RENDER_PASS_LOAD_LOAD);
+
+    // an invalidate on A doesn't carry over to B either
+    renderPassInvalidate(&rec.pass, color_depth);
+    XCTAssertFalse(renderPassNeedsRestart(&rec.pass));
+    renderPassDropPending(&rec.pass);
+
+    rec.begin(color_depth);
+    XCTAssertEqual(rec.loads[2].load[0], RENDER_PASS_LOAD_LOAD);
+    XCTAssertEqual(rec.loads[2].load[RENDER_PASS_DEPTH], RENDER_PASS_LOAD_LOAD);
+    rec.end();
+}
+
+- (void)testRedundantStatePerf {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        // a typical engine sets the whole material state before every draw, draws sorted by material
+        struct Material {
+            bool depth_test, depth_write, blend, cull;
+            GLenum depth_func, src, dst;
+        } materials[] = {
+            {true, true, false, true, GL_LESS, GL_ONE, GL_ZERO},                           // opaque
+            {true, true, false, false, GL_LEQUAL, GL_ONE, GL_ZERO},                        // foliage
+            {true, false, true, false, GL_LEQUAL, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA},   // transparent
+            {false, false, true, false, GL_ALWAYS, GL_ONE, GL_ONE_MINUS_SRC_ALPHA},        // ui
+        };
+        const GLuint num_materials = sizeof(materials) / sizeof(materials[0]);
+        const GLuint frames = 100, draws_per_frame = 1000, calls_per_draw = 10;
+        const GLuint processed_bits = DIRTY_PASS_BITS | DIRTY_PIPELINE_BITS | DIRTY_DYNAMIC_BITS;
+        GLuint dirty_draws = 0, dirty_groups = 0;
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint frame=0; frame<frames; frame++)
+        {
+            for(GLuint draw=0; draw<draws_per_frame; draw++)
+            {
+                const Material &m = materials[draw * num_materials / draws_per_frame];
+
+                glViewport(0, 0, [self winWidth], [self winHeight]);
+                m.depth_test ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+                glDepthFunc(m.depth_func);
+                glDepthMask(m.depth_write);
+                m.blend ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+                glBlendFunc(m.src, m.dst);
+                m.cull ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+                glCullFace(GL_BACK);
+                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                glDisable(GL_SCISSOR_TEST);
+
+                // stands in for processGLState at the draw
+                GLuint dirty = self->m_glm_ctx->state.dirty_bits & processed_bits;
+
+                if (dirty)
+                {
+                    dirty_draws++;
+                    dirty_groups += __builtin_popcount(dirty);
+                }
+
+                self->m_glm_ctx->state.dirty_bits &= ~dirty;
+            }
+        }
+
+        CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+        GLuint draws = frames * draws_per_frame;
+
+        NSLog(@"testRedundantStatePerf %u draws %.3f ms (%.2f ns/call), %u draws with dirty state (%.3f per draw, %.2f groups each)",
+              draws, elapsed * 1000.0, elapsed * 1e9 / (draws * calls_per_draw),
+              dirty_draws, (double)dirty_draws / draws, dirty_draws ? (double)dirty_groups / dirty_draws : 0.0);
+
+        // only a material change dirties anything
+        XCTAssertLessThanOrEqual(dirty_draws, frames * num_materials + 1);
+
+        self->m_glm_ctx->state.dirty_bits = DIRTY_ALL;
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testDepthStencilCache {
+    DepthStencilDesc desc, unpacked, disabled;
+
+    initDepthStencilDesc(&desc, GL_TRUE, GL_LEQUAL, GL_TRUE, GL_TRUE,
+                         GL_EQUAL, GL_KEEP, GL_INCR_WRAP, GL_REPLACE, 0x1ff, 0xf0,
+                         GL_NOTEQUAL, GL_DECR, GL_INVERT, GL_ZERO, 0x0f, 0xff);
+
+    // the key round trips, values are already in metal terms
+    GLuint64 key = packDepthStencilDesc(&desc);
+    unpackDepthStencilKey(key, &unpacked);
+    XCTAssertEqual(packDepthStencilDesc(&unpacked), key);
+    XCTAssertEqual(unpacked.depth_func, MTLCompareFunctionLessEqual);
+    XCTAssertEqual(unpacked.front.depth_fail, MTLStencilOperationIncrementWrap);
+    XCTAssertEqual(unpacked.back.fail, MTLStencilOperationDecrementClamp);
+    XCTAssertEqual(unpacked.front.read_mask, 0xff);
+
+    // disabled tests share one key whatever else is set
+    initDepthStencilDesc(&unpacked, GL_FALSE, GL_LESS, GL_TRUE, GL_FALSE,
+                         GL_EQUAL, GL_ZERO, GL_ZERO, GL_ZERO, 1, 1,
+                         GL_EQUAL, GL_ZERO, GL_ZERO, GL_ZERO, 1, 1);
+    initDepthStencilDesc(&disabled, GL_FALSE, GL_GREATER, GL_FALSE, GL_FALSE,
+                         GL_NEVER, GL_KEEP, GL_KEEP, GL_KEEP, 2, 2,
+                         GL_NEVER, GL_KEEP, GL_KEEP, GL_KEEP, 2, 2);
+    XCTAssertEqual(packDepthStencilDesc(&unpacked), packDepthStencilDesc(&disabled));
+    XCTAssertEqual(disabled.depth_func, MTLCompareFunctionAlways);
+
+    // a handful of configurations switched every draw only miss once each
+    static DepthStencilCache cache;
+    const GLuint64 keys[] = {key, packDepthStencilDesc(&disabled), key ^ 0x1, key ^ 0x8};
+    const GLuint iterations = 1000000;
+
+    initDepthStencilCache(&cache);
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+    for(GLuint iter=0; iter<iterations; iter++)
+    {
+        GLuint64 k = keys[iter & 3];
+
+        if (depthStencilCacheFind(&cache, k) == NULL)
+            depthStencilCacheInsert(&cache, k, (void *)(uintptr_t)((iter & 3) + 1), NULL);
+    }
+
+    CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+    NSLog(@"testDepthStencilCache %u lookups %.3f ms (%.2f ns/lookup)", iterations, elapsed * 1000.0, elapsed * 1e9 / iterations);
+
+    XCTAssertEqual(cache.misses, 4u);
+    XCTAssertEqual(cache.hits, iterations - 4);
+    XCTAssertEqual(depthStencilCacheFind(&cache, keys[2]), (void *)3);
+
+    depthStencilCacheClear(&cache, NULL);
+    XCTAssertEqual(cache.count, 0u);
+}
+
+- (void)testProgramBindingTables {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec3 position;
+             layout(location = 0) out vec2 out_texcoords;
+
+             void main() {
+                gl_Position = vec4(position, 1.0);
+                out_texcoords = position.xy;
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec2 in_texcords;
+             layout(location = 0) out vec4 frag_colour;
+
+             layout(binding = 2) uniform Material { vec4 tint; };
+             layout(binding = 3) uniform sampler2D base;
+             layout(binding = 70) uniform sampler2D detail;
+
+             void main() {
+                frag_colour = tint * texture(base, in_texcords) * texture(detail, in_texcords);
+            }
+        );
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        Program *program = self->m_glm_ctx->state.program;
+        XCTAssert(program);
+
+        // textures are a mask walk, buffers keep the metal index order
+        const ProgramBindingTable *textures = &program->binding_tables[_FRAGMENT_SHADER][_BINDING_SAMPLED_IMAGE];
+        XCTAssertEqual(textures->count, 2u);
+        XCTAssertEqual(textures->used[0], 0x1ULL << 3);
+        XCTAssertEqual(textures->used[1], 0x1ULL << (70 - 64));
+
+        const ProgramBindingTable *uniforms = &program->binding_tables[_FRAGMENT_SHADER][_BINDING_UNIFORM_BUFFER];
+        XCTAssertEqual(uniforms->count, 1u);
+        XCTAssertEqual(uniforms->slots[0], 2);
+
+        XCTAssertEqual(program->binding_tables[_VERTEX_SHADER][_BINDING_SAMPLED_IMAGE].count, 0u);
+
+        glUseProgram(0);
+        glDeleteProgram(shader_program);
+
+        // a binding past the gl state arrays fails the link
+        const char* bad_fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+
+             layout(binding = 40) uniform Material { vec4 tint; };
+
+             void main() {
+                frag_colour = tint;
+            }
+        );
+
+        GLint status = GL_TRUE, log_length = 0;
+
+        GLuint bad_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, bad_fragment_shader);
+        glGetProgramiv(bad_program, GL_LINK_STATUS, &status);
+        glGetProgramiv(bad_program, GL_INFO_LOG_LENGTH, &log_length);
+        XCTAssertEqual(status, GL_FALSE);
+        XCTAssert(log_length > 1);
+
+        glUseProgram(bad_program);
+        XCTAssertEqual(glGetError(), GL_INVALID_OPERATION);
+
+        glDeleteProgram(bad_program);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testBindingCallsPerDraw {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec3 position;
+             layout(location = 1) in vec2 in_texcords;
+             layout(location = 0) out vec2 out_texcoords;
+
+             void main() {
+                gl_Position = vec4(position, 1.0);
+                out_texcoords = in_texcords;
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec2 in_texcords;
+             layout(location = 0) out vec4 frag_colour;
+
+             uniform sampler2D image;
+
+             void main() {
+                frag_colour = texture(image, in_texcords);
+            }
+        );
+
+        float points[] = {
+            0.0f,  0.5f,  0.0f,
+            0.5f, -0.5f,  0.0f,
+            -0.5f, -0.5f,  0.0f
+        };
+
+        float texcoords[] = {
+            0.5f, 0.0f,
+            0.0f, 1.0f,
+            1.0f, 1.0f,
+        };
+
+        GLuint vbo = bindDataToVBO(GL_ARRAY_BUFFER, 9 * sizeof(float), points, GL_STATIC_DRAW);
+        GLuint tex_vbo = bindDataToVBO(GL_ARRAY_BUFFER, 6 * sizeof(float), texcoords, GL_STATIC_DRAW);
+
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+
+        bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+        bindAttribute(1, GL_ARRAY_BUFFER, tex_vbo, 2, GL_FLOAT, false, 0, NULL);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        GLuint tex[2];
+        tex[0] = createTexture(GL_TEXTURE_2D, 64, 64, 0, genTexturePixels(GL_RGBA, GL_UNSIGNED_INT_8_8_8_8, 0x10, 64, 64));
+        tex[1] = createTexture(GL_TEXTURE_2D, 64, 64, 0, genTexturePixels(GL_RGBA, GL_UNSIGNED_INT_8_8_8_8, 0x20, 64, 64));
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLuint first, repeat, switched, back;
+
+        glBindTexture(GL_TEXTURE_2D, tex[0]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        MGLget(NULL, MGL_BINDING_CALLS, &first);
+
+        // same objects again, the encoder already has all of them
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        MGLget(NULL, MGL_BINDING_CALLS, &repeat);
+
+        // same parameters share a sampler, only the texture changes
+        glBindTexture(GL_TEXTURE_2D, tex[1]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        MGLget(NULL, MGL_BINDING_CALLS, &switched);
+
+        glBindTexture(GL_TEXTURE_2D, tex[0]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        MGLget(NULL, MGL_BINDING_CALLS, &back);
+
+        MGLswapBuffers();
+
+        NSLog(@"testBindingCallsPerDraw binding calls first: %u repeat: %u switched: %u back: %u", first, repeat, switched, back);
+
+        XCTAssertGreaterThanOrEqual(first, 3u);
+        XCTAssertEqual(repeat, 0u);
+        XCTAssertEqual(switched, 1u);
+        XCTAssertEqual(back, 1u);
+
+        glDeleteTextures(2, tex);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testSharedUniformBufferUpdate {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec3 position;
+             layout(binding = 0) uniform Shared { vec4 offset; vec4 color; };
+
+             void main() {
+                gl_Position = vec4(position, 1.0) + offset;
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+             layout(binding = 0) uniform Shared { vec4 offset; vec4 color; };
+
+             void main() {
+                frag_colour = color;
+            }
+        );
+
+        float points[] = {
+            -1.0f, -1.0f,  0.0f,
+             3.0f, -1.0f,  0.0f,
+            -1.0f,  3.0f,  0.0f
+        };
+
+        float shared_data[8] = {0, 0, 0, 0, 1, 0, 0, 1};
+
+        GLuint vbo = bindDataToVBO(GL_ARRAY_BUFFER, sizeof(points), points, GL_STATIC_DRAW);
+
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+
+        bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+
+        GLuint ubo;
+        glGenBuffers(1, &ubo);
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(shared_data), shared_data, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, ubo);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        // both stages read the small buffer, both copies have to be sent again
+        GLuint updated;
+
+        shared_data[4] = 0;
+        shared_data[5] = 1;
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(shared_data), shared_data);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        MGLget(NULL, MGL_BINDING_CALLS, &updated);
+
+        GLubyte pixel[4];
+        glReadPixels([self winWidth] / 2, [self winHeight] / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+        XCTAssertGreaterThanOrEqual(updated, 2u);
+        XCTAssertEqual(pixel[0], 0);
+        XCTAssertEqual(pixel[1], 255);
+
+        glDeleteBuffers(1, &ubo);
+        glDeleteBuffers(1, &vbo);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testSamplerCache {
+    SamplerCache cache;
+    TextureParameter params[16];
+    SamplerKey key;
+
+    initSamplerCache(&cache);
+    memset(params, 0, sizeof(params));
+
+    // two parameter sets shared across 16 textures
+    for(int i=0; i<16; i++)
+    {
+        params[i].min_filter = (i & 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST;
+        params[i].mag_filter = (i & 1) ? GL_LINEAR : GL_NEAREST;
+        params[i].wrap_s = params[i].wrap_t = params[i].wrap_r = GL_CLAMP_TO_EDGE;
+        params[i].max_lod = 1000;
+
+        initSamplerKey(&key, &params[i], GL_TEXTURE_2D);
+        params[i].sampler_entry = samplerCacheAcquire(&cache, &key);
+        XCTAssert(params[i].sampler_entry);
+    }
+
+    NSLog(@"testSamplerCache unique %u requested %llu", cache.unique, cache.requested);
+
+    XCTAssertEqual(cache.unique, 2u);
+    XCTAssertEqual(cache.requested, 16u);
+    XCTAssertEqual(params[0].sampler_entry, params[2].sampler_entry);
+    XCTAssertNotEqual(params[0].sampler_entry, params[1].sampler_entry);
+    XCTAssertEqual(params[1].sampler_entry->refcount, 8u);
+
+    // anisotropy up to 1 is the same sampler
+    params[0].max_anisotropy = 1.0;
+    initSamplerKey(&key, &params[0], GL_TEXTURE_2D);
+    SamplerCacheEntry *entry = samplerCacheAcquire(&cache, &key);
+    XCTAssertEqual(entry, params[2].sampler_entry);
+    samplerCacheRelease(&cache, entry);
+
+    // rectangles clamped to edge get their own unnormalized sampler
+    initSamplerKey(&key, &params[0], GL_TEXTURE_RECTANGLE);
+    XCTAssertEqual(key.normalized_coords, GL_FALSE);
+
+    // the backend object comes back with the last reference only
+    params[0].sampler_entry->mtl_data = (void *)0x1;
+    for(int i=0; i<16; i+=2)
+    {
+        void *mtl_data = samplerCacheRelease(&cache, params[i].sampler_entry);
+        XCTAssertEqual(mtl_data, (i == 14) ? (void *)0x1 : NULL);
+    }
+
+    XCTAssertEqual(cache.unique, 1u);
+}
+
+- (void)testDrawValidationCache {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec3 position;
+
+             void main() {
+                gl_Position = vec4(position, 1.0);
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+
+             void main() {
+                frag_colour = vec4(1.0, 0.0, 0.0, 1.0);
+            }
+        );
+
+        float points[] = {
+            0.0f,  0.5f,  0.0f,
+            0.5f, -0.5f,  0.0f,
+            -0.5f, -0.5f,  0.0f
+        };
+
+        GLuint vbo = bindDataToVBO(GL_ARRAY_BUFFER, 9 * sizeof(float), points, GL_STATIC_DRAW);
+
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+
+        bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        GLuint validations, skipped, start_validations, start_skipped;
+
+        MGLget(NULL, MGL_VALIDATIONS, &start_validations);
+        MGLget(NULL, MGL_VALIDATIONS_SKIPPED, &start_skipped);
+
+        for(int i=0; i<10; i++)
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        MGLget(NULL, MGL_VALIDATIONS, &validations);
+        MGLget(NULL, MGL_VALIDATIONS_SKIPPED, &skipped);
+
+        // only the first draw walks the vao and program
+        XCTAssertEqual(validations - start_validations, 1u);
+        XCTAssertEqual(skipped - start_skipped, 9u);
+
+        // a mapped buffer has to be caught again
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glMapBuffer(GL_ARRAY_BUFFER, GL_READ_ONLY);
+        glGetError();
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        XCTAssertEqual(glGetError(), GL_INVALID_OPERATION);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+
+        // attrib changes and a relink revalidate
+        bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glLinkProgram(shader_program);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        MGLget(NULL, MGL_VALIDATIONS, &validations);
+        MGLget(NULL, MGL_VALIDATIONS_SKIPPED, &skipped);
+
+        MGLswapBuffers();
+
+        NSLog(@"testDrawValidationCache validations: %u skipped: %u", validations - start_validations, skipped - start_skipped);
+
+        XCTAssertEqual(validations - start_validations, 4u);
+        XCTAssertEqual(skipped - start_skipped, 10u);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testNoErrorDispatch {
+    GLMContext ctx[2];
+    double ns_per_call[2];
+    const GLuint iterations = 1000000, calls_per_iteration = 5;
+    GLfloat data[16] = {0};
+
+    // same pixel formats as the test context, no renderer is attached so only cpu side calls are timed
+    ctx[0] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, 0);
+    ctx[1] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, GL_CONTEXT_FLAG_NO_ERROR_BIT);
+
+    // hot entry points are swapped, everything else shares the checked version
+    XCTAssertNotEqual(ctx[0]->dispatch.draw_arrays, ctx[1]->dispatch.draw_arrays);
+    XCTAssertNotEqual(ctx[0]->dispatch.buffer_sub_data, ctx[1]->dispatch.buffer_sub_data);
+    XCTAssertEqual(ctx[0]->dispatch.clear, ctx[1]->dispatch.clear);
+
+    GLuint flags;
+    MGLget(ctx[1], MGL_CONTEXT_FLAGS, &flags);
+    XCTAssertEqual(flags, (GLuint)GL_CONTEXT_FLAG_NO_ERROR_BIT);
+
+    for(int i=0; i<2; i++)
+    {
+        GLMContext c = ctx[i];
+
+        c->dispatch.bind_buffer(c, GL_ARRAY_BUFFER, 1);
+        c->dispatch.buffer_storage(c, GL_ARRAY_BUFFER, sizeof(data), NULL, GL_DYNAMIC_STORAGE_BIT);
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint j=0; j<iterations; j++)
+        {
+            c->dispatch.bind_vertex_array(c, 1 + (j & 1));
+            c->dispatch.bind_buffer(c, GL_ARRAY_BUFFER, 2);
+            c->dispatch.bind_buffer(c, GL_ARRAY_BUFFER, 1);
+            data[0] = j;
+            c->dispatch.buffer_sub_data(c, GL_ARRAY_BUFFER, 0, sizeof(data), data);
+            c->dispatch.bind_buffer(c, GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
+
+        ns_per_call[i] = (CFAbsoluteTimeGetCurrent() - start) * 1e9 / (iterations * calls_per_iteration);
+
+        // both tables end up with the same state
+        XCTAssertEqual(c->state.buffers[_ARRAY_BUFFER]->name, 1u);
+        XCTAssertEqual(c->state.vao->name, 2u);
+        XCTAssertEqual(((GLfloat *)c->state.buffers[_ARRAY_BUFFER]->data.buffer_data)[0], (GLfloat)(iterations - 1));
+    }
+
+    NSLog(@"testNoErrorDispatch %.2f ns/call checked, %.2f ns/call no error", ns_per_call[0], ns_per_call[1]);
+}
+
+- (void)testDrawQueue {
+    DrawQueueRecorder rec;
+    int elements, other_elements;
+
+    // an empty queue has nothing to append to
+    XCTAssertFalse(drawQueueCanAppend(&rec.queue, GL_TRIANGLES, 0, NULL));
+
+    // back to back triangle ranges fold into one draw
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, 0, NULL, 0, 6, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, 0, NULL, 6, 3, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, 0, NULL, 9, 3, 0));
+
+    // a gap, then a range after a partial triangle, neither can be joined
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, 0, NULL, 30, 4, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, 0, NULL, 34, 3, 0));
+
+    // a different mode needs a flush first
+    XCTAssertFalse(drawQueueCanAppend(&rec.queue, GL_LINES, 0, NULL));
+    XCTAssertFalse(drawQueueAdd(&rec.queue, GL_LINES, 0, NULL, 0, 2, 0));
+
+    XCTAssertEqual(rec.flush(), 3u);
+    XCTAssertEqual(rec.draws.size(), 3u);
+    XCTAssertEqual(rec.draws[0].start, 0u);
+    XCTAssertEqual(rec.draws[0].count, 12u);
+    XCTAssertEqual(rec.draws[1].start, 30u);
+    XCTAssertEqual(rec.draws[1].count, 4u);
+    XCTAssertEqual(rec.draws[2].start, 34u);
+    XCTAssertEqual(rec.draws[2].count, 3u);
+    XCTAssertEqual(rec.queue.merged, 2u);
+    XCTAssertEqual(rec.queue.count, 0u);
+
+    // indexed draws continue at count * index size bytes, base vertex has to match
+    rec.draws.clear();
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 0, 3, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 6, 3, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 12, 3, 8));
+    XCTAssertFalse(drawQueueCanAppend(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &other_elements));
+    XCTAssertFalse(drawQueueCanAppend(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_INT, &elements));
+
+    XCTAssertEqual(rec.flush(), 2u);
+    XCTAssertEqual(rec.draws[0].start, 0u);
+    XCTAssertEqual(rec.draws[0].count, 6u);
+    XCTAssertEqual(rec.draws[1].start, 12u);
+    XCTAssertEqual(rec.draws[1].basevertex, 8);
+    XCTAssertEqual(rec.queue.merged, 3u);
+
+    // strips share vertices across draws, they are sent as they came
+    rec.draws.clear();
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLE_STRIP, 0, NULL, 0, 4, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLE_STRIP, 0, NULL, 4, 4, 0));
+    XCTAssertEqual(rec.flush(), 2u);
+    XCTAssertEqual(rec.draws[1].start, 4u);
+    XCTAssertEqual(rec.queue.merged, 3u);
+
+    // a full queue takes nothing more
+    for (int i=0; i<DRAW_QUEUE_SIZE; i++)
+    {
+        XCTAssertTrue(drawQueueAdd(&rec.queue, GL_POINTS, 0, NULL, i, 1, 0));
+    }
+    XCTAssertFalse(drawQueueCanAppend(&rec.queue, GL_POINTS, 0, NULL));
+
+    rec.draws.clear();
+    XCTAssertEqual(rec.flush(), 1u);
+    XCTAssertEqual(rec.draws[0].count, (GLuint)DRAW_QUEUE_SIZE);
+    XCTAssertEqual(rec.queue.queued, 10u + DRAW_QUEUE_SIZE);
+    XCTAssertEqual(rec.queue.batches, 4u);
+
+    // flushing an empty queue sends nothing
+    XCTAssertEqual(rec.flush(), 0u);
+    XCTAssertEqual(rec.queue.batches, 4u);
+    XCTAssertEqual(rec.queue.batched, 0u);
+
+    // scattered ranges with their own base vertex merge where they touch, the rest go out as one batch
+    rec.draws.clear();
+    rec.batch_min = 4;
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 0, 3, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 6, 3, 0));
+    for (int i=0; i<4; i++)
+    {
+        XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 100 + i * 60, 6, i * 16));
+    }
+
+    XCTAssertEqual(rec.flush(), 1u);
+    XCTAssertEqual(rec.draws.size(), 0u);
+    XCTAssertEqual(rec.batch.size(), 5u);
+    XCTAssertEqual(rec.batch[0].count, 6u);
+    XCTAssertEqual(rec.batch[4].start, 280u);
+    XCTAssertEqual(rec.batch[4].basevertex, 48);
+    XCTAssertEqual(rec.queue.batched, 5u);
+
+    // too few for the backend to batch, drawn one by one
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 0, 3, 0));
+    XCTAssertTrue(drawQueueAdd(&rec.queue, GL_TRIANGLES, GL_UNSIGNED_SHORT, &elements, 12, 3, 4));
+    XCTAssertEqual(rec.flush(), 2u);
+    XCTAssertEqual(rec.draws.size(), 2u);
+    XCTAssertEqual(rec.queue.batched, 5u);
+}
+
+- (void)testIndexTranslation {
+    IndexSource src;
+    IndexTranslation out;
+    std::vector<GLushort> dst(64);
+
+    // fan from an array draw, every triangle shares the first vertex
+    bzero(&src, sizeof(src));
+    src.mode = GL_TRIANGLE_FAN;
+    src.first = 10;
+    src.count = 5;
+    XCTAssertTrue(indexTranslationNeeded(src.mode, 0, GL_FALSE, 0));
+    indexTranslationPlan(&src, &out);
+    XCTAssertEqual(out.mode, (GLenum)GL_TRIANGLES);
+    XCTAssertEqual(out.type, (GLenum)GL_UNSIGNED_SHORT);
+    XCTAssertEqual(translateIndices(&src, &out, dst.data()), 9u);
+    const GLushort fan[] = {10, 11, 12, 10, 12, 13, 10, 13, 14};
+    XCTAssertEqual(memcmp(dst.data(), fan, sizeof(fan)), 0);
+
+    // byte indices with a restart, a loop per segment joined by the 16 bit restart index
+    const GLubyte bytes[] = {0, 1, 2, 3, 5, 6, 7, 3, 8};
+    src.mode = GL_LINE_LOOP;
+    src.type = GL_UNSIGNED_BYTE;
+    src.indices = bytes;
+    src.count = sizeof(bytes);
+    src.restart = GL_TRUE;
+    src.restart_index = 3;
+    indexTranslationPlan(&src, &out);
+    XCTAssertEqual(out.mode, (GLenum)GL_LINE_STRIP);
+    XCTAssertEqual(translateIndices(&src, &out, dst.data()), out.count);
+    const GLushort loops[] = {0, 1, 2, 0, 0xFFFF, 5, 6, 7, 5};
+    XCTAssertEqual(out.count, sizeof(loops) / sizeof(loops[0]));
+    XCTAssertEqual(memcmp(dst.data(), loops, sizeof(loops)), 0);
+
+    // restart splits a list, the partial triangle before it is dropped
+    src.mode = GL_TRIANGLES;
+    indexTranslationPlan(&src, &out);
+    translateIndices(&src, &out, dst.data());
+    const GLushort tris[] = {0, 1, 2, 5, 6, 7};
+    XCTAssertEqual(out.count, 6u);
+    XCTAssertEqual(memcmp(dst.data(), tris, sizeof(tris)), 0);
+
+    // strips only swap the restart index for metal's
+    const GLushort shorts[] = {0, 1, 2, 7, 3, 4, 5};
+    src.mode = GL_TRIANGLE_STRIP;
+    src.type = GL_UNSIGNED_SHORT;
+    src.indices = shorts;
+    src.count = 7;
+    src.restart_index = 7;
+    XCTAssertTrue(indexTranslationNeeded(src.mode, src.type, GL_TRUE, 7));
+    XCTAssertFalse(indexTranslationNeeded(src.mode, src.type, GL_TRUE, 0xFFFF));
+    XCTAssertFalse(indexTranslationNeeded(GL_TRIANGLES, src.type, GL_FALSE, 0));
+    indexTranslationPlan(&src, &out);
+    translateIndices(&src, &out, dst.data());
+    XCTAssertEqual(out.count, 7u);
+    XCTAssertEqual(dst[3], 0xFFFF);
+    XCTAssertEqual(dst[6], 5);
+
+    // adjacency vertices are dropped
+    bzero(&src, sizeof(src));
+    src.mode = GL_TRIANGLE_STRIP_ADJACENCY;
+    src.count = 8;
+    indexTranslationPlan(&src, &out);
+    translateIndices(&src, &out, dst.data());
+    const GLushort strip_adj[] = {0, 2, 4, 4, 2, 6};
+    XCTAssertEqual(out.count, 6u);
+    XCTAssertEqual(memcmp(dst.data(), strip_adj, sizeof(strip_adj)), 0);
+
+    // same source contents hit, a new buffer generation misses
+    IndexCache cache;
+    IndexCacheKey key;
+    int buffer;
+
+    initIndexCache(&cache);
+    initIndexCacheKey(&key, &buffer, 1, 0, &src);
+    XCTAssertTrue(indexCacheFind(&cache, &key) == NULL);
+    indexCacheInsert(&cache, &key, &out, &buffer, NULL);
+    XCTAssertTrue(indexCacheFind(&cache, &key) != NULL);
+    initIndexCacheKey(&key, &buffer, 2, 0, &src);
+    XCTAssertTrue(indexCacheFind(&cache, &key) == NULL);
+    XCTAssertEqual(cache.hits, 1u);
+    XCTAssertEqual(cache.misses, 2u);
+    indexCacheClear(&cache, NULL);
+}
+
+- (void)testIndexTranslationPerf {
+    struct {
+        GLenum mode;
+        GLenum type;
+        GLboolean restart;
+        const char *name;
+    } cases[] = {
+        {GL_TRIANGLES, GL_UNSIGNED_BYTE, GL_FALSE, "u8 -> u16 widen"},
+        {GL_TRIANGLE_STRIP, GL_UNSIGNED_BYTE, GL_TRUE, "u8 strip restart"},
+        {GL_TRIANGLE_STRIP, GL_UNSIGNED_SHORT, GL_TRUE, "u16 strip restart remap"},
+        {GL_TRIANGLE_STRIP, GL_UNSIGNED_INT, GL_TRUE, "u32 strip restart remap"},
+        {GL_TRIANGLE_FAN, GL_UNSIGNED_SHORT, GL_FALSE, "u16 fan -> list"},
+        {GL_LINE_LOOP, GL_UNSIGNED_INT, GL_TRUE, "u32 loop restart -> strip"},
+        {GL_TRIANGLES, GL_UNSIGNED_SHORT, GL_TRUE, "u16 list restart split"},
+    };
+    const GLuint count = 1 << 20, iterations = 10;
+
+    std::vector<GLuint> indices(count);
+    std::vector<GLuint> dst(count * 3);
+
+    for(GLuint i=0; i<count; i++)
+        indices[i] = (i * 2654435761u) >> 8;
+
+    for(size_t i=0; i<sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        IndexSource src;
+        IndexTranslation out;
+        std::vector<GLubyte> packed(count * sizeof(GLuint));
+
+        // same values packed to the source type, restart index 7 so it shows up
+        for(GLuint j=0; j<count; j++)
+        {
+            switch(cases[i].type)
+            {
+                case GL_UNSIGNED_BYTE: packed[j] = (GLubyte)indices[j]; break;
+                case GL_UNSIGNED_SHORT: ((GLushort *)packed.data())[j] = (GLushort)indices[j]; break;
+                default: ((GLuint *)packed.data())[j] = indices[j]; break;
+            }
+        }
+
+        bzero(&src, sizeof(src));
+        src.mode = cases[i].mode;
+        src.type = cases[i].type;
+        src.indices = packed.data();
+        src.count = count;
+        src.restart = cases[i].restart;
+        src.restart_index = 7;
+
+        XCTAssertTrue(indexTranslationNeeded(src.mode, src.type, src.restart, src.restart_index));
+
+        indexTranslationPlan(&src, &out);
+        XCTAssertLessThanOrEqual(out.count, count * 3);
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint iter=0; iter<iterations; iter++)
+        {
+            XCTAssertEqual(translateIndices(&src, &out, dst.data()), out.count);
+        }
+
+        CFAbsoluteTime elapsed = (CFAbsoluteTimeGetCurrent() - start) / iterations;
+
+        NSLog(@"testIndexTranslationPerf %s %u indices %.3f ms (%.1f MIndices/s)", cases[i].name,
+              count, elapsed * 1000.0, count / elapsed / 1e6);
+    }
+}
+
+- (void)testUploadRing {
+    GLuint min = 0, max = 0;
+
+    // restart indices are skipped, the tail past the last full vector is scanned too
+    std::vector<GLushort> shorts(37);
+    for(GLuint i=0; i<shorts.size(); i++)
+        shorts[i] = 100 + i * 3;
+    shorts[5] = 7;
+    shorts[20] = 0xFFFF;
+    shorts[36] = 0xFFFF;
+    XCTAssertTrue(scanIndexRange(GL_UNSIGNED_SHORT, shorts.data(), 37, GL_TRUE, 0xFFFF, &min, &max));
+    XCTAssertEqual(min, 7u);
+    XCTAssertEqual(max, 100u + 35 * 3);
+    XCTAssertTrue(scanIndexRange(GL_UNSIGNED_SHORT, shorts.data(), 37, GL_FALSE, 0, &min, &max));
+    XCTAssertEqual(max, 0xFFFFu);
+
+    std::vector<GLubyte> bytes(40, 9);
+    XCTAssertFalse(scanIndexRange(GL_UNSIGNED_BYTE, bytes.data(), 40, GL_TRUE, 9, &min, &max));
+    bytes[2] = 200;
+    bytes[33] = 3;
+    XCTAssertTrue(scanIndexRange(GL_UNSIGNED_BYTE, bytes.data(), 40, GL_TRUE, 9, &min, &max));
+    XCTAssertEqual(min, 3u);
+    XCTAssertEqual(max, 200u);
+
+    // rebased indices keep metal's restart index
+    GLuint ints[] = {5, 6, 7, 0xFFFFFFFF, 9, 10, 11, 12, 13, 14, 4};
+    XCTAssertTrue(scanIndexRange(GL_UNSIGNED_INT, ints, 11, GL_TRUE, 0xFFFFFFFF, &min, &max));
+    XCTAssertEqual(min, 4u);
+    XCTAssertEqual(max, 14u);
+    rebaseIndices(GL_UNSIGNED_INT, ints, ints, 11, min, GL_TRUE);
+    XCTAssertEqual(ints[0], 1u);
+    XCTAssertEqual(ints[3], 0xFFFFFFFFu);
+    XCTAssertEqual(ints[10], 0u);
+
+    // allocations don't straddle the end and wait for the serial that used them
+    UploadRing ring;
+    GLuint64 offset;
+
+    initUploadRing(&ring, 1024);
+    XCTAssertFalse(uploadRingAlloc(&ring, 10, &offset));
+    XCTAssertTrue(uploadRingFence(&ring, 1));
+    XCTAssertTrue(uploadRingAlloc(&ring, 10, &offset));
+    XCTAssertEqual(offset, 0u);
+    XCTAssertTrue(uploadRingAlloc(&ring, 500, &offset));
+    XCTAssertEqual(offset, (GLuint64)UPLOAD_RING_ALIGN);
+    XCTAssertTrue(uploadRingFence(&ring, 2));
+    XCTAssertTrue(uploadRingAlloc(&ring, 400, &offset));
+    XCTAssertFalse(uploadRingAlloc(&ring, 200, &offset));
+    uploadRingRetire(&ring, 1);
+    XCTAssertTrue(uploadRingAlloc(&ring, 200, &offset));
+    XCTAssertEqual(offset, 0u);
+    XCTAssertFalse(uploadRingAlloc(&ring, 400, &offset));
+    uploadRingRetire(&ring, 2);
+    XCTAssertTrue(uploadRingFence(&ring, 3));
+    XCTAssertTrue(uploadRingAlloc(&ring, 400, &offset));
+    XCTAssertEqual(ring.bytes_uploaded, 1510u);
+
+    // out of fences the oldest serial is the one to wait for
+    XCTAssertEqual(uploadRingOldestSerial(&ring), 3u);
+    for(GLuint64 serial=4; serial<3 + UPLOAD_RING_FENCES; serial++)
+        XCTAssertTrue(uploadRingFence(&ring, serial));
+    XCTAssertFalse(uploadRingFence(&ring, 3 + UPLOAD_RING_FENCES));
+    uploadRingRetire(&ring, uploadRingOldestSerial(&ring));
+    XCTAssertEqual(uploadRingOldestSerial(&ring), 4u);
+    XCTAssertTrue(uploadRingFence(&ring, 3 + UPLOAD_RING_FENCES));
+}
+
+- (void)testClientArraysPerf {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec2 position;
+             layout(location = 1) in vec4 in_color;
+             layout(location = 0) out vec4 out_color;
+
+             void main() {
+                gl_Position = vec4(position, 0.0, 1.0);
+                out_color = in_color;
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec4 in_color;
+             layout(location = 0) out vec4 frag_colour;
+
+             void main() {
+                frag_colour = in_color;
+            }
+        );
+
+        // immediate mode style, a quad per draw rebuilt in client memory each time
+        const GLuint quads = 4096, frames = 8;
+        std::vector<float> positions(quads * 4 * 2);
+        std::vector<float> colors(quads * 4 * 4);
+        const GLushort quad_indices[] = {0, 1, 2, 2, 1, 3};
+
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+
+        GLuint streamed_before, streamed_after;
+
+        MGLget(NULL, MGL_CLIENT_BYTES_STREAMED, &streamed_before);
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint frame=0; frame<frames; frame++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            for(GLuint q=0; q<quads; q++)
+            {
+                float *p = &positions[q * 8];
+                float *c = &colors[q * 16];
+                float x = (q % 64) / 32.0f - 1.0f, y = (q / 64) / 32.0f - 1.0f;
+
+                p[0] = x; p[1] = y; p[2] = x + 0.03f; p[3] = y;
+                p[4] = x; p[5] = y + 0.03f; p[6] = x + 0.03f; p[7] = y + 0.03f;
+
+                for(int i=0; i<16; i++)
+                    c[i] = (i & 3) == 3 ? 1.0f : (float)frame / frames;
+
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, p);
+                glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, c);
+
+                // even quads as a strip from the arrays, odd ones indexed
+                if (q & 1)
+                    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, quad_indices);
+                else
+                    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            }
+
+            MGLswapBuffers();
+        }
+
+        CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+        MGLget(NULL, MGL_CLIENT_BYTES_STREAMED, &streamed_after);
+
+        // only the 4 vertices each draw reads and the indices of the indexed ones
+        GLuint expected = frames * (quads * 4 * (2 + 4) * sizeof(float) + (quads / 2) * sizeof(quad_indices));
+
+        NSLog(@"testClientArraysPerf %u client array draws %.3f ms (%.0f draws/s) %u bytes streamed",
+              quads * frames, elapsed * 1000.0, quads * frames / elapsed, streamed_after - streamed_before);
+
+        XCTAssertEqual(glGetError(), (GLenum)GL_NO_ERROR);
+        XCTAssertEqual(streamed_after - streamed_before, expected);
+
+        glDeleteVertexArrays(1, &vao);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testMultiDrawIndirect {
+    MultiDrawIndirect mdi;
+    GLuint counts[] = {0, 7, 100};
+
+    // stride 0 means tightly packed commands, the last one isn't followed by a stride
+    initMultiDrawIndirect(&mdi, GL_TRIANGLES, GL_UNSIGNED_INT, 64, 10, 0);
+    XCTAssertEqual(mdi.stride, (GLuint)sizeof(DrawElementsIndirectCommand));
+    XCTAssertEqual(multiDrawIndirectCommandOffset(&mdi, 3), 64u + 3 * sizeof(DrawElementsIndirectCommand));
+    XCTAssertEqual(multiDrawIndirectEnd(&mdi), 64u + 10 * sizeof(DrawElementsIndirectCommand));
+    XCTAssertEqual(multiDrawIndirectCount(&mdi, NULL), 10u);
+
+    initMultiDrawIndirect(&mdi, GL_TRIANGLES, 0, 0, 4, 32);
+    XCTAssertEqual(multiDrawIndirectEnd(&mdi), 3 * 32u + sizeof(DrawArraysIndirectCommand));
+
+    // the parameter buffer count is clamped to maxdrawcount
+    multiDrawIndirectSetCountBuffer(&mdi, 4);
+    XCTAssertEqual(multiDrawIndirectCount(&mdi, counts), 4u);
+    multiDrawIndirectSetCountBuffer(&mdi, 0);
+    XCTAssertEqual(multiDrawIndirectCount(&mdi, counts), 0u);
+
+    MultiDrawIndirectParams params;
+    XCTAssertTrue(multiDrawIndirectParams(&mdi, 3, &params));
+    XCTAssertEqual(params.stride, 32u);
+    XCTAssertEqual(params.max_count, 4u);
+    XCTAssertEqual(params.count_offset, 0u);
+
+    initMultiDrawIndirect(&mdi, GL_TRIANGLES, 0, 0xFFFFFFF0ull, 4, 0);
+    XCTAssertFalse(multiDrawIndirectParams(&mdi, 3, &params));
+}
+
+- (void)testMultiDrawIndirectPerf {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec2 position;
+
+             void main() {
+                gl_Position = vec4(position, 0.0, 1.0);
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+
+             void main() {
+                frag_colour = vec4(1.0, 1.0, 1.0, 1.0);
+            }
+        );
+
+        // a culling pass would write these, one quad per command picked with the base vertex
+        const GLuint quads = 4096, frames = 8;
+        std::vector<float> positions(quads * 4 * 2);
+        std::vector<DrawElementsIndirectCommand> commands(quads);
+        const GLushort quad_indices[] = {0, 1, 2, 2, 1, 3};
+        const GLuint visible = quads / 2;
+
+        for(GLuint q=0; q<quads; q++)
+        {
+            float *p = &positions[q * 8];
+            float x = (q % 64) / 32.0f - 1.0f, y = (q / 64) / 32.0f - 1.0f;
+
+            p[0] = x; p[1] = y; p[2] = x + 0.03f; p[3] = y;
+            p[4] = x; p[5] = y + 0.03f; p[6] = x + 0.03f; p[7] = y + 0.03f;
+
+            commands[q] = {6, 1, 0, (int)(q * 4), 0};
+        }
+
+        GLuint vao = 0, buffers[4];
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glGenBuffers(4, buffers);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(0);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quad_indices), quad_indices, GL_STATIC_DRAW);
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffers[2]);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STATIC_DRAW);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+
+        // the draw count comes from a parameter buffer, nothing bound is an error
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, 0, quads, 0);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+
+        glBindBuffer(GL_PARAMETER_BUFFER, buffers[3]);
+        glBufferData(GL_PARAMETER_BUFFER, sizeof(visible), &visible, GL_STATIC_DRAW);
+
+        // commands past the end of the indirect buffer and misaligned offsets
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)sizeof(DrawElementsIndirectCommand), quads, 0);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)2, 1, 0);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_VALUE);
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, 4, quads, 0);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+        for(GLuint frame=0; frame<frames; frame++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            if (frame & 1)
+                glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, 0, quads, 0);
+            else
+                glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, quads, 0);
+
+            MGLswapBuffers();
+        }
+
+        CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+        NSLog(@"testMultiDrawIndirectPerf %u indirect commands %.3f ms (%.0f commands/s)",
+              quads * frames, elapsed * 1000.0, quads * frames / elapsed);
+
+        XCTAssertEqual(glGetError(), (GLenum)GL_NO_ERROR);
+
+        glDeleteBuffers(4, buffers);
+        glDeleteVertexArrays(1, &vao);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testQueryPool {
+    QueryPool *pool = (QueryPool *)malloc(sizeof(QueryPool));
+    GLuint a, b, slot;
+
+    initQueryPool(pool);
+    XCTAssertTrue(queryPoolAlloc(pool, 0, &a));
+    XCTAssertTrue(queryPoolAlloc(pool, 0, &b));
+    XCTAssertEqual(a, 0u);
+    XCTAssertEqual(b, 1u);
+
+    // a slot shared by two queries retires with the last one
+    queryPoolRetain(pool, a);
+    queryPoolRelease(pool, a, 5);
+    XCTAssertEqual(pool->retired_count, 0u);
+    queryPoolRelease(pool, a, 5);
+    queryPoolRelease(pool, b, 6);
+    XCTAssertEqual(pool->retired_count, 2u);
+
+    // the gpu can still write a retired slot until its serial completes
+    XCTAssertTrue(queryPoolAlloc(pool, 4, &slot));
+    XCTAssertEqual(slot, 2u);
+    XCTAssertTrue(queryPoolAlloc(pool, 5, &slot));
+    XCTAssertEqual(slot, 0u);
+
+    for(GLuint i=0; i<QUERY_POOL_SLOTS-3; i++)
+        XCTAssertTrue(queryPoolAlloc(pool, 5, &slot));
+    XCTAssertFalse(queryPoolAlloc(pool, 5, &slot));
+    XCTAssertEqual(pool->exhausted, 1u);
+    XCTAssertTrue(queryPoolAlloc(pool, 6, &slot));
+    XCTAssertEqual(slot, 1u);
+
+    XCTAssertEqual(primitiveCount(GL_TRIANGLES, 7), 2u);
+    XCTAssertEqual(primitiveCount(GL_TRIANGLE_FAN, 2), 0u);
+    XCTAssertEqual(primitiveCount(GL_LINE_LOOP, 5), 5u);
+    XCTAssertEqual(primitiveCount(GL_LINE_STRIP, 5), 4u);
+    XCTAssertEqual(primitiveCount(GL_PATCHES, 9), 0u);
+
+    free(pool);
+}
+
+- (void)testQueries {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec2 position;
+
+             void main() {
+                gl_Position = vec4(position, 0.0, 1.0);
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+
+             void main() {
+                frag_colour = vec4(1.0, 1.0, 1.0, 1.0);
+            }
+        );
+
+        // a full screen quad and one outside the viewport
+        const float positions[] = {-1, -1, 1, -1, -1, 1, 1, 1,
+                                   2, 2, 3, 2, 2, 3, 3, 3};
+
+        GLuint vao = 0, buffers[2], queries[5];
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glGenBuffers(2, buffers);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(positions), positions, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(0);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+
+        glGenQueries(5, queries);
+        XCTAssertFalse(glIsQuery(queries[0]));
+
+        // end without a begin, a query on two targets at once
+        glEndQuery(GL_SAMPLES_PASSED);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+        glBeginQuery(GL_SAMPLES_PASSED, 0);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glBeginQuery(GL_SAMPLES_PASSED, queries[0]);
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, queries[0]);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_OPERATION);
+        glBeginQuery(GL_TIME_ELAPSED, queries[2]);
+        glBeginQuery(GL_PRIMITIVES_GENERATED, queries[3]);
+        XCTAssertTrue(glIsQuery(queries[0]));
+
+        GLint current = 0;
+        glGetQueryiv(GL_SAMPLES_PASSED, GL_CURRENT_QUERY, &current);
+        XCTAssertEqual(current, (GLint)queries[0]);
+
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        glEndQuery(GL_SAMPLES_PASSED);
+
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, queries[1]);
+        glDrawArrays(GL_TRIANGLE_STRIP, 4, 4);
+        glEndQuery(GL_ANY_SAMPLES_PASSED);
+
+        glEndQuery(GL_PRIMITIVES_GENERATED);
+        glEndQuery(GL_TIME_ELAPSED);
+        glQueryCounter(queries[4], GL_TIMESTAMP);
+
+        // polling never blocks, the result shows up within a few frames
+        GLuint available = 0;
+        for(int frame=0; frame<100 && available == 0; frame++)
+        {
+            glGetQueryObjectuiv(queries[0], GL_QUERY_RESULT_AVAILABLE, &available);
+            MGLswapBuffers();
+        }
+        XCTAssertEqual(available, 1u);
+
+        GLuint64 samples = 0, any = 1, primitives = 0, elapsed = 0, timestamp = 0;
+        glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &samples);
+        glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &any);
+        glGetQueryObjectui64v(queries[3], GL_QUERY_RESULT, &primitives);
+        glGetQueryObjectui64v(queries[2], GL_QUERY_RESULT, &elapsed);
+        glGetQueryObjectui64v(queries[4], GL_QUERY_RESULT, &timestamp);
+
+        XCTAssertGreaterThan(samples, 0u);
+        XCTAssertEqual(any, 0u);
+        XCTAssertEqual(primitives, 4u);
+        XCTAssertGreaterThan(elapsed, 0u);
+        XCTAssertGreaterThan(timestamp, 0u);
+
+        // with a query buffer bound the result lands in it, resolved on the gpu if need be
+        glBindBuffer(GL_QUERY_BUFFER, buffers[1]);
+        glBufferData(GL_QUERY_BUFFER, 16, NULL, GL_DYNAMIC_READ);
+
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, queries[1]);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        glEndQuery(GL_ANY_SAMPLES_PASSED);
+
+        glGetQueryObjectuiv(queries[1], GL_QUERY_RESULT, (GLuint *)4);
+        glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, (GLuint64 *)8);
+        XCTAssertEqual(glGetError(), (GLenum)GL_NO_ERROR);
+
+        // the resolve's command buffer has completed once the query is available
+        glBindBuffer(GL_QUERY_BUFFER, 0);
+        available = 0;
+        for(int frame=0; frame<100 && available == 0; frame++)
+        {
+            glGetQueryObjectuiv(queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+            MGLswapBuffers();
+        }
+        XCTAssertEqual(available, 1u);
+        glBindBuffer(GL_QUERY_BUFFER, buffers[1]);
+
+        GLuint *results = (GLuint *)glMapBufferRange(GL_QUERY_BUFFER, 0, 16, GL_MAP_READ_BIT);
+        XCTAssertEqual(results[1], 1u);
+        XCTAssertEqual(*(GLuint64 *)&results[2], samples);
+        glUnmapBuffer(GL_QUERY_BUFFER);
+        glBindBuffer(GL_QUERY_BUFFER, 0);
+
+        glDeleteQueries(5, queries);
+        XCTAssertFalse(glIsQuery(queries[0]));
+
+        glDeleteBuffers(2, buffers);
+        glDeleteVertexArrays(1, &vao);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testSyncTable {
+    SyncTable table;
+    std::vector<int> objects(5000);
+    std::vector<GLsync> handles(5000);
+
+    initSyncTable(&table, 4);
+
+    for(size_t i=0; i<handles.size(); i++)
+    {
+        handles[i] = syncTableInsert(&table, &objects[i]);
+        XCTAssert(handles[i] != NULL);
+    }
+    XCTAssertEqual(table.count, 5000u);
+
+    for(size_t i=0; i<handles.size(); i++)
+        XCTAssert(syncTableLookup(&table, handles[i]) == &objects[i]);
+
+    // deleted handles never match again, even once their slot is reused
+    for(size_t i=0; i<handles.size(); i+=2)
+        XCTAssert(syncTableRemove(&table, handles[i]) == &objects[i]);
+    for(size_t i=0; i<handles.size(); i+=2)
+        XCTAssert(syncTableLookup(&table, handles[i]) == NULL);
+
+    GLsync reused = syncTableInsert(&table, &objects[0]);
+    XCTAssert(reused != handles[4998]);
+    XCTAssert(syncTableLookup(&table, handles[4998]) == NULL);
+    XCTAssert(syncTableLookup(&table, reused) == &objects[0]);
+
+    // made up handles are rejected without being dereferenced
+    XCTAssert(syncTableLookup(&table, NULL) == NULL);
+    XCTAssert(syncTableLookup(&table, (GLsync)(uintptr_t)0xdeadbeef00001234ull) == NULL);
+    XCTAssertEqual(table.count, 2501u);
+}
+
+- (void)testFenceStress {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const GLuint count = 4096;
+        std::vector<GLsync> fences(count);
+
+        glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 1);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_VALUE);
+
+        // thousands outstanding at once, flushed in batches
+        for(GLuint i=0; i<count; i++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+            fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            XCTAssertTrue(glIsSync(fences[i]));
+
+            if ((i & 255) == 255)
+                glFlush();
+        }
+
+        // status and 0 timeouts only look at the timeline
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+        GLuint signaled = 0;
+        for(GLuint i=0; i<count; i++)
+        {
+            GLint status = 0;
+            GLsizei length = 0;
+
+            glGetSynciv(fences[i], GL_SYNC_STATUS, 1, &length, &status);
+            XCTAssertEqual(length, 1);
+
+            GLenum result = glClientWaitSync(fences[i], 0, 0);
+            XCTAssert(result == GL_ALREADY_SIGNALED || result == GL_TIMEOUT_EXPIRED);
+
+            signaled += (status == GL_SIGNALED);
+        }
+        CFAbsoluteTime polled = CFAbsoluteTimeGetCurrent() - start;
+
+        NSLog(@"testFenceStress polled %u fences in %.3f ms, %u signaled", count, polled * 1000.0, signaled);
+
+        // a gpu wait returns straight away
+        glWaitSync(fences[count - 1], 0, GL_TIMEOUT_IGNORED);
+        XCTAssertEqual(glGetError(), (GLenum)GL_NO_ERROR);
+        glWaitSync(fences[count - 1], 0, 1000);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_VALUE);
+
+        // the last fence completing means every earlier one has
+        GLenum result = glClientWaitSync(fences[count - 1], GL_SYNC_FLUSH_COMMANDS_BIT, 5000000000ull);
+        XCTAssert(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+
+        for(GLuint i=0; i<count; i++)
+        {
+            XCTAssertEqual(glClientWaitSync(fences[i], 0, 0), (GLenum)GL_ALREADY_SIGNALED);
+            glDeleteSync(fences[i]);
+        }
+
+        XCTAssertFalse(glIsSync(fences[0]));
+        glDeleteSync(fences[0]);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_VALUE);
+        XCTAssertEqual(glClientWaitSync(fences[0], 0, 0), (GLenum)GL_WAIT_FAILED);
+        XCTAssertEqual(glGetError(), (GLenum)GL_INVALID_VALUE);
+
+        // a fence in work that never gets submitted times out
+        glClear(GL_COLOR_BUFFER_BIT);
+        GLsync pending = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        XCTAssertEqual(glClientWaitSync(pending, 0, 0), (GLenum)GL_TIMEOUT_EXPIRED);
+        glDeleteSync(pending);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testFramePacing {
+    FramePacing fp;
+    GLuint64 first, last;
+
+    initFramePacing(&fp, NULL, NULL);
+    XCTAssertEqual(fp.max_frames, (GLuint)FRAME_PACING_DEFAULT_FRAMES);
+    XCTAssertFalse(fp.low_latency);
+
+    // the env strings are clamped
+    initFramePacing(&fp, "0", "1");
+    XCTAssertEqual(fp.max_frames, 1u);
+    XCTAssertTrue(fp.low_latency);
+    initFramePacing(&fp, "100", "0");
+    XCTAssertEqual(fp.max_frames, (GLuint)FRAME_PACING_MAX_FRAMES);
+    XCTAssertFalse(fp.low_latency);
+
+    // 3 in flight, the 4th frame can't start until the 1st is done
+    framePacingSetMaxFrames(&fp, 3);
+    framePacingSubmit(&fp, 2);
+    framePacingSubmit(&fp, 5);
+    XCTAssertEqual(framePacingWaitSerial(&fp, 0), 0ull);
+    framePacingSubmit(&fp, 9);
+    XCTAssertEqual(framePacingWaitSerial(&fp, 0), 2ull);
+    XCTAssertEqual(framePacingWaitSerial(&fp, 2), 0ull);
+
+    // low latency waits for the oldest frame still running
+    fp.low_latency = GL_TRUE;
+    XCTAssertEqual(framePacingWaitSerial(&fp, 2), 5ull);
+    XCTAssertEqual(framePacingWaitSerial(&fp, 9), 0ull);
+
+    // a frame is every command buffer since the last one
+    XCTAssertFalse(framePacingCompletedFrame(&fp, 1, &first, &last));
+    XCTAssertTrue(framePacingCompletedFrame(&fp, 6, &first, &last));
+    XCTAssertEqual(first, 3ull);
+    XCTAssertEqual(last, 5ull);
+}
+
+- (void)testFramePacingSwap {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        GLuint frames, low_latency, cpu_time, gpu_time, wait_time, dropped;
+
+        MGLset(NULL, MGL_MAX_FRAMES_IN_FLIGHT, 0);
+        MGLget(NULL, MGL_MAX_FRAMES_IN_FLIGHT, &frames);
+        XCTAssertEqual(frames, 1u);
+
+        for(GLuint mode=0; mode<3; mode++)
+        {
+            MGLset(NULL, MGL_MAX_FRAMES_IN_FLIGHT, mode == 1 ? 1 : 3);
+            MGLset(NULL, MGL_LOW_LATENCY, mode == 2);
+
+            CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+            GLuint64 total_wait = 0;
+
+            for(int i=0; i<60; i++)
+            {
+                glClearColor(i / 60.0f, 0, 0, 1);
+                glClear(GL_COLOR_BUFFER_BIT);
+                MGLswapBuffers(NULL);
+
+                MGLget(NULL, MGL_FRAME_WAIT_TIME_US, &wait_time);
+                total_wait += wait_time;
+            }
+
+            CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+            MGLget(NULL, MGL_LOW_LATENCY, &low_latency);
+            MGLget(NULL, MGL_FRAME_CPU_TIME_US, &cpu_time);
+            MGLget(NULL, MGL_FRAME_GPU_TIME_US, &gpu_time);
+            MGLget(NULL, MGL_FRAMES_DROPPED, &dropped);
+            XCTAssertEqual(low_latency, (GLuint)(mode == 2));
+
+            NSLog(@"testFramePacingSwap mode %u: 60 frames in %.3f ms, cpu %u us gpu %u us, waited %llu us, %u dropped",
+                  mode, elapsed * 1000.0, cpu_time, gpu_time, total_wait, dropped);
+        }
+
+        MGLset(NULL, MGL_MAX_FRAMES_IN_FLIGHT, FRAME_PACING_DEFAULT_FRAMES);
+        MGLset(NULL, MGL_LOW_LATENCY, 0);
+
+        XCTAssertEqual(glGetError(), (GLenum)GL_NO_ERROR);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testStats {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        const char* vertex_shader =
+        GLSL(450 core,
+             layout(location = 0) in vec3 position;
+
+             void main() {
+                gl_Position = vec4(position, 1.0);
+            }
+        );
+
+        const char* fragment_shader =
+        GLSL(450 core,
+             layout(location = 0) out vec4 frag_colour;
+
+             void main() {
+                frag_colour = vec4(0.0, 1.0, 0.0, 1.0);
+            }
+        );
+
+        float points[] = {
+            0.0f,  0.5f,  0.0f,
+            0.5f, -0.5f,  0.0f,
+            -0.5f, -0.5f,  0.0f
+        };
+
+        MGLStats stats, frame;
+
+        // whatever earlier tests left in the current frame goes with the reset
+        MGLswapBuffers(NULL);
+        MGLResetStats(NULL);
+
+        GLuint vbo = bindDataToVBO(GL_ARRAY_BUFFER, sizeof(points), points, GL_STATIC_DRAW);
+
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+
+        bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+
+        GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+        glUseProgram(shader_program);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        for(int i=0; i<10; i++)
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        MGLGetStats(NULL, &stats, NULL);
+        XCTAssertEqual(stats.draws, 10ull);
+        XCTAssertEqual(stats.shader_compiles, 2ull);
+        XCTAssertEqual(stats.program_links, 1ull);
+        XCTAssertGreaterThan(stats.shader_compile_ns, 0ull);
+        XCTAssertGreaterThanOrEqual(stats.bytes_uploaded, (GLuint64)sizeof(points));
+        XCTAssertGreaterThanOrEqual(stats.pipeline_creates, 1ull);
+        XCTAssertGreaterThanOrEqual(stats.render_passes, 1ull);
+
+        MGLswapBuffers(NULL);
+
+        // the second frame only sees its own draws and uploads
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(points), points);
+        glClear(GL_COLOR_BUFFER_BIT);
+        for(int i=0; i<3; i++)
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        MGLswapBuffers(NULL);
+
+        MGLGetStats(NULL, &stats, &frame);
+        XCTAssertEqual(stats.draws, 13ull);
+        XCTAssertEqual(frame.draws, 3ull);
+        XCTAssertEqual(frame.bytes_uploaded, (GLuint64)sizeof(points));
+        XCTAssertEqual(frame.shader_compiles, 0ull);
+
+        NSLog(@"testStats: %llu draws %llu state updates %llu passes %llu pipelines (%.3f ms) %llu samplers %llu/%llu depth stencil, "
+              "%llu uploaded %llu flushed %llu read back, compile %.3f ms link %.3f ms, %llu allocations %llu bytes",
+              stats.draws, stats.state_updates, stats.render_passes, stats.pipeline_creates, stats.pipeline_create_ns / 1e6,
+              stats.sampler_creates, stats.depth_stencil_creates, stats.depth_stencil_cache_hits,
+              stats.bytes_uploaded, stats.bytes_flushed, stats.bytes_read_back,
+              stats.shader_compile_ns / 1e6, stats.program_link_ns / 1e6, stats.allocations, stats.bytes_allocated);
+
+        MGLResetStats(NULL);
+        MGLGetStats(NULL, &stats, &frame);
+        XCTAssertEqual(stats.draws, 0ull);
+        XCTAssertEqual(frame.draws, 0ull);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testTrace {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent: @"mgl_trace.json"];
+
+        initTrace([path UTF8String]);
+        XCTAssertTrue(mgl_trace_enabled);
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClearColor(0.0, 0.0, 0.0, 1.0);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        MGLswapBuffers(NULL);
+
+        // every thread gets its own ring and thread id
+        dispatch_apply(4, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+            for(int j=0; j<100; j++)
+            {
+                TRACE_SCOPE("testTrace", TRACE_SYNC);
+            }
+        });
+
+        traceShutdown();
+        XCTAssertFalse(mgl_trace_enabled);
+
+        // nothing is recorded once the trace is shut down
+        {
+            TRACE_SCOPE("afterShutdown", TRACE_SYNC);
+        }
+        traceFlush();
+
+        NSData *data = [NSData dataWithContentsOfFile: path];
+        XCTAssertNotNil(data);
+
+        NSError *error = nil;
+        NSDictionary *json = [NSJSONSerialization JSONObjectWithData: data options: 0 error: &error];
+        XCTAssertNil(error);
+
+        NSUInteger clears = 0, swaps = 0, scopes = 0;
+        NSMutableSet *tids = [NSMutableSet set];
+
+        for(NSDictionary *event in json[@"traceEvents"])
+        {
+            if (![event[@"ph"] isEqualToString: @"X"])
+                continue;
+
+            XCTAssertGreaterThanOrEqual([event[@"dur"] doubleValue], 0.0);
+            XCTAssertNotEqualObjects(event[@"name"], @"afterShutdown");
+
+            if ([event[@"name"] isEqualToString: @"glClear"])
+            {
+                XCTAssertEqualObjects(event[@"cat"], @"gl");
+                clears++;
+            }
+            else if ([event[@"name"] isEqualToString: @"mtlSwapBuffers"])
+            {
+                XCTAssertEqualObjects(event[@"cat"], @"frame");
+                swaps++;
+            }
+            else if ([event[@"name"] isEqualToString: @"testTrace"])
+            {
+                [tids addObject: event[@"tid"]];
+                scopes++;
+            }
+        }
+
+        XCTAssertEqual(clears, 1u);
+        XCTAssertEqual(swaps, 1u);
+        XCTAssertEqual(scopes, 400u);
+        XCTAssertGreaterThanOrEqual(tids.count, 1u);
+
+        [[NSFileManager defaultManager] removeItemAtPath: path error: nil];
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testCaptureReplay {
+    GLMContext ctx[2];
+    GLuint names[2];
+    GLfloat data[16];
+
+    // no renderer attached, the trace sticks to cpu side state
+    ctx[0] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, 0);
+    ctx[1] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, 0);
+
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent: @"mgl_capture.bin"];
+
+    XCTAssertTrue(MGLStartCapture(ctx[0], [path UTF8String]));
+
+    GLMContext c = ctx[0];
+
+    for(int i=0; i<16; i++)
+        data[i] = i;
+
+    c->dispatch.gen_buffers(c, 2, names);
+    c->dispatch.bind_buffer(c, GL_ARRAY_BUFFER, names[1]);
+    c->dispatch.buffer_storage(c, GL_ARRAY_BUFFER, sizeof(data), NULL, GL_DYNAMIC_STORAGE_BIT);
+    c->dispatch.buffer_sub_data(c, GL_ARRAY_BUFFER, 0, sizeof(data), data);
+    c->dispatch.clear_color(c, 0.25, 0.5, 0.75, 1.0);
+
+    MGLStopCapture(ctx[0]);
+
+    // the wrappers are swapped back out
+    XCTAssertEqual(ctx[0]->dispatch.clear_color, ctx[1]->dispatch.clear_color);
+
+    // the buffers it named wouldn't be in the trace
+    XCTAssertFalse(MGLStartCapture(ctx[0], [path UTF8String]));
+
+    Replay *r = replayOpen([path UTF8String]);
+    XCTAssertTrue(r != NULL);
+
+    XCTAssertTrue(replayRun(r, ctx[1]));
+    XCTAssertEqual(r->calls, (GLuint64)5);
+    XCTAssertEqual(r->mismatches, (GLuint64)0);
+    XCTAssertEqual(r->commands[CAPTURE_glBufferSubData].calls, (GLuint64)1);
+
+    XCTAssertEqual(ctx[1]->state.buffers[_ARRAY_BUFFER]->name, names[1]);
+    XCTAssertEqual(memcmp(ctx[1]->state.buffers[_ARRAY_BUFFER]->data.buffer_data, data, sizeof(data)), 0);
+    XCTAssertEqual(ctx[1]->state.color_clear_value[2], 0.75f);
+
+    replayReport(r, stderr);
+    replayClose(r);
+
+    [[NSFileManager defaultManager] removeItemAtPath: path error: nil];
+}
+
+- (void)testCaptureClientArrays {
+    GLMContext ctx[2];
+    GLuint vao;
+    GLfloat verts[16];
+
+    ctx[0] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, 0);
+    ctx[1] = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, GL_DEPTH_COMPONENT, GL_FLOAT, 0, 0, 0);
+
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent: @"mgl_capture_client.bin"];
+
+    XCTAssertTrue(MGLStartCapture(ctx[0], [path UTF8String]));
+
+    GLMContext c = ctx[0];
+
+    for(int i=0; i<16; i++)
+        verts[i] = 100 + i;
+
+    // vec2 per vertex, the draw reads vertices 2 .. 4, the draw itself fails for want of a program
+    c->dispatch.gen_vertex_arrays(c, 1, &vao);
+    c->dispatch.bind_vertex_array(c, vao);
+    c->dispatch.vertex_attrib_pointer(c, 0, 2, GL_FLOAT, GL_FALSE, 0, verts);
+    c->dispatch.enable_vertex_attrib_array(c, 0);
+    c->dispatch.draw_arrays(c, GL_TRIANGLES, 2, 3);
+
+    MGLStopCapture(ctx[0]);
+
+    NSData *trace = [NSData dataWithContentsOfFile: path];
+    XCTAssertTrue(trace != nil);
+
+    // only the range the draw reads is in the trace
+    NSData *range = [NSData dataWithBytes: &verts[4] length: 6 * sizeof(GLfloat)];
+    XCTAssertNotEqual([trace rangeOfData: range options: 0 range: NSMakeRange(0, trace.length)].location, (NSUInteger)NSNotFound);
+
+    NSData *before = [NSData dataWithBytes: &verts[0] length: 4 * sizeof(GLfloat)];
+    XCTAssertEqual([trace rangeOfData: before options: 0 range: NSMakeRange(0, trace.length)].location, (NSUInteger)NSNotFound);
+
+    Replay *r = replayOpen([path UTF8String]);
+    XCTAssertTrue(r != NULL);
+
+    // replay runs past the draw, and puts the captured pointer back after it
+    XCTAssertTrue(replayRun(r, ctx[1]));
+    XCTAssertEqual(r->calls, (GLuint64)5);
+    XCTAssertEqual(r->mismatches, (GLuint64)0);
+    XCTAssertEqual(r->commands[CAPTURE_glDrawArrays].calls, (GLuint64)1);
+    XCTAssertEqual(ctx[1]->state.vao->attrib[0].ptr, (const void *)verts);
+
+    replayClose(r);
+
+    [[NSFileManager defaultManager] removeItemAtPath: path error: nil];
+}
+
+- (void)testPackBufferOverwrite {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        GLubyte fill[4 * 4 * 4];
+        GLuint pbo;
+
+        memset(fill, 0x11, sizeof(fill));
+
+        glViewport(0, 0, [self winWidth], [self winHeight]);
+        glClearColor(1.0, 0.0, 0.0, 1.0);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glGenBuffers(1, &pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, sizeof(fill), NULL, GL_STREAM_READ);
+
+        // a write after glReadPixels must win over the queued readback
+        glReadPixels(0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glBufferSubData(GL_PIXEL_PACK_BUFFER, 0, sizeof(fill), fill);
+
+        GLubyte *data = (GLubyte *)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        XCTAssert(data != NULL);
+        XCTAssert(data && memcmp(data, fill, sizeof(fill)) == 0);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+        // respecifying the store drops the readback
+        glReadPixels(0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        memset(fill, 0x22, sizeof(fill));
+        glBufferData(GL_PIXEL_PACK_BUFFER, sizeof(fill), fill, GL_STREAM_READ);
+
+        data = (GLubyte *)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        XCTAssert(data && memcmp(data, fill, sizeof(fill)) == 0);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glDeleteBuffers(1, &pbo);
+
+        XCTAssertEqual(glGetError(), GL_NO_ERROR);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
+- (void)testTextureViewLifetime {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Task on main thread completed"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        GLubyte texels[4 * 4 * 4];
+        GLuint tex, view, buf, tbo;
+
+        memset(texels, 0x7f, sizeof(texels));
+
+        glGenTextures(1, &tex);
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 4, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+
+        glGenTextures(1, &view);
+        glTextureView(view, GL_TEXTURE_2D, tex, GL_RGBA8, 0, 1, 0, 1);
+
+        // the view keeps the parent's storage alive
+        glDeleteTextures(1, &tex);
+        glBindTexture(GL_TEXTURE_2D, view);
+        glFinish();
+        glDeleteTextures(1, &view);
+
+        glGenBuffers(1, &buf);
+        glBindBuffer(GL_TEXTURE_BUFFER, buf);
+        glBufferData(GL_TEXTURE_BUFFER, sizeof(texels), texels, GL_STATIC_DRAW);
+
+        glGenTextures(1, &tbo);
+        glBindTexture(GL_TEXTURE_BUFFER, tbo);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA8, buf);
+
+        // and a texture buffer keeps the buffer's store
+        glDeleteBuffers(1, &buf);
+        glFinish();
+        glDeleteTextures(1, &tbo);
+
+        XCTAssertEqual(glGetError(), GL_NO_ERROR);
+
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:60.0 handler:^(NSError * _Nullable error) {
+        XCTAssertNil(error, @"The task did not complete in time");
+    }];
+}
+
 #if 0
 - (void)testPerformanceExample {
     // This is an example of a performance test case.
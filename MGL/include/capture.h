@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * capture.h
+ * MGL
+ *
+ */
+
+#ifndef capture_h
+#define capture_h
+
+#include <stdio.h>
+
+#include "glm_context.h"
+#include "glm_capture.h"
+
+#define CAPTURE_MAGIC           0x43474c4d      // "MGLC"
+#define CAPTURE_VERSION         3               // bump with any change to the record layout or the command list
+
+// records that aren't gl commands, past the end of the command ids
+#define CAPTURE_FRAME           0xffff          // MGLswapBuffers
+#define CAPTURE_MAPPED          0xfffe          // client writes to a mapped buffer range
+#define CAPTURE_CLIENT_ARRAY    0xfffd          // the part of a client array the next draw reads
+#define CAPTURE_CLIENT_INDICES  0xfffc          // one of the next multi draw's client index arrays
+
+#define CAPTURE_MAX_ARGS        16
+#define CAPTURE_MAX_MAPS        64
+
+// out params with no size in their args get this much scratch on replay
+#define CAPTURE_OUT_SCRATCH     4096
+
+// glGetTexImage doesn't say how big the image is
+#define CAPTURE_OUT_PIXELS      (16 * 1024 * 1024)
+
+// how a param is recorded, spec_parser picks one from its c type
+enum {
+    CAPTURE_VOID,
+    CAPTURE_VALUE,      // copied as is
+    CAPTURE_SYNC,       // GLsync, mapped to the replay's syncs
+    CAPTURE_PROC,       // callbacks, NULL on replay
+    CAPTURE_IN,         // client memory read by the call
+    CAPTURE_OUT,        // client memory written by the call, replay hands it scratch
+    CAPTURE_STRING,     // const GLchar *
+    CAPTURE_STRINGS     // const GLchar *const *, shader sources
+};
+
+typedef struct CaptureArg_t {
+    const char  *name;          // spec name, the size rules go by it
+    GLubyte     kind;
+    GLubyte     size;
+    GLubyte     elem_size;      // pointers, size of what they point at, 1 for void
+} CaptureArg;
+
+typedef struct CaptureCommand_t {
+    const char          *name;
+    GLuint              arg_count;
+    const CaptureArg    *args;
+    GLubyte             ret_kind;
+    GLubyte             ret_size;
+} CaptureCommand;
+
+// a buffer range the client has a pointer into
+typedef struct CaptureMapping_t {
+    GLuint      buffer;
+    GLboolean   write;
+    GLboolean   persistent;     // written every frame, nothing unmaps it
+    GLboolean   explicit_flush; // only flushed ranges are written
+    GLintptr    offset;
+    GLsizeiptr  length;
+    GLubyte     *ptr;
+} CaptureMapping;
+
+typedef struct Capture_t {
+    FILE            *fp;
+    GLuint64        calls;
+    GLuint64        frames;
+    GLuint64        bytes;
+    CaptureMapping  maps[CAPTURE_MAX_MAPS];
+    GLuint          map_count;
+    GLboolean       warned[CAPTURE_COMMANDS];   // client memory of unknown size, warned once
+    GLboolean       client_unsized;             // a client array draw with no known vertex range, warned once
+} Capture;
+
+typedef struct ReplayCommandStats_t {
+    GLuint64    calls;
+    GLuint64    ns;
+    GLuint64    max_ns;
+} ReplayCommandStats;
+
+typedef struct Replay_t {
+    const GLubyte       *data;      // the whole trace, mapped
+    size_t              size;
+    const GLubyte       *ptr;
+    const GLubyte       *end;
+
+    GLuint64            calls;
+    GLuint64            frames;
+    GLuint64            mismatches; // names, syncs or mappings that came back different, draws skipped
+    ReplayCommandStats  commands[CAPTURE_COMMANDS];
+
+    GLuint64            *frame_ns;
+    size_t              frame_capacity;
+
+    CaptureMapping      maps[CAPTURE_MAX_MAPS];
+    GLuint              map_count;
+
+    GLuint64            *syncs;     // captured, replayed pairs
+    size_t              sync_count;
+    size_t              sync_capacity;
+
+    const void          *client_ptrs[MAX_ATTRIBS];  // captured pointers of the attribs the next draw reads copies for
+    unsigned            client_attribs;
+    void                **client_indices;           // the next multi draw's index arrays, by sub draw
+    size_t              client_index_count;
+    size_t              client_index_capacity;
+
+    void                **allocs;   // scratch for the call being replayed
+    size_t              alloc_count;
+    size_t              alloc_capacity;
+} Replay;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// generated by spec_parser, glm_capture.c
+extern const CaptureCommand capture_commands[CAPTURE_COMMANDS];
+void init_capture_dispatch(GLMContext ctx);
+void replay_command(GLMContext ctx, GLuint command, const GLuint64 *args, GLuint64 *ret);
+
+// swaps the capture wrappers into ctx->dispatch, MGL_CAPTURE=path starts one at context creation
+// fails on a context that has named objects, replay would hand out different names
+GLboolean captureStart(GLMContext ctx, const char *path);
+void captureStop(GLMContext ctx);
+
+// the wrappers call these on either side of the real entry point
+void captureCall(GLMContext ctx, GLuint command, const GLuint64 *args);
+void captureReturn(GLMContext ctx, GLuint command, const GLuint64 *args, const void *ret);
+
+void captureFrame(GLMContext ctx);
+
+// a trace starts from a fresh context, object names are checked against the capture rather than remapped
+Replay *replayOpen(const char *path);
+GLboolean replayRun(Replay *r, GLMContext ctx);
+void replayReport(const Replay *r, FILE *fp);
+void replayClose(Replay *r);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* capture_h */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * draw_queue.h
+ * MGL
+ *
+ */
+
+#ifndef draw_queue_h
+#define draw_queue_h
+
+#include "glcorearb.h"
+
+// draws held back between state changes
+#define DRAW_QUEUE_SIZE     64
+
+typedef struct DrawQueueEntry_t {
+    GLuint      count;
+    GLuint64    start;          // first vertex, or byte offset into the element buffer
+    GLint       basevertex;
+} DrawQueueEntry;
+
+// every queued draw shares the mode, index type and element buffer, nothing else
+// changes between them or the queue would have been flushed
+typedef struct DrawQueue_t {
+    GLenum          mode;
+    GLenum          type;       // index type, 0 for array draws
+    void            *elements;  // backend element buffer, opaque
+
+    DrawQueueEntry  entries[DRAW_QUEUE_SIZE];
+    GLuint          count;
+
+    GLuint64        queued;     // draws that went through the queue
+    GLuint64        merged;     // draws folded into the one before them
+    GLuint64        batched;    // draws left after merging that went out as one multi draw
+    GLuint64        batches;    // flushes that emitted something
+} DrawQueue;
+
+// backend draw, called once per merged draw in submission order
+typedef void (*DrawQueueEmitFunc)(void *user, const DrawQueue *queue, const DrawQueueEntry *entry);
+
+// backend multi draw, gets every draw left after merging, false sends them through emit one by one
+typedef GLboolean (*DrawQueueBatchFunc)(void *user, const DrawQueue *queue, const DrawQueueEntry *entries, GLuint count);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initDrawQueue(DrawQueue *queue);
+
+// true when the draw can go in behind the queued ones without a flush
+GLboolean drawQueueCanAppend(const DrawQueue *queue, GLenum mode, GLenum type, void *elements);
+
+// an empty queue takes the mode / type / elements of the draw, false means flush first
+GLboolean drawQueueAdd(DrawQueue *queue, GLenum mode, GLenum type, void *elements,
+                       GLuint64 start, GLuint count, GLint basevertex);
+
+// merges draws of list primitives that continue where the previous one ended, hands the rest
+// to batch when there is more than one and emits them unchanged when batch is NULL or declines,
+// returns the number of backend calls, a batch is one
+GLuint drawQueueFlush(DrawQueue *queue, DrawQueueEmitFunc emit, DrawQueueBatchFunc batch, void *user);
+
+// drops anything queued, the backend lost what it was drawing into
+void drawQueueDiscard(DrawQueue *queue);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* draw_queue_h */
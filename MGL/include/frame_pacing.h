@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * frame_pacing.h
+ * MGL
+ *
+ */
+
+#ifndef frame_pacing_h
+#define frame_pacing_h
+
+#include "glcorearb.h"
+
+#define FRAME_PACING_MAX_FRAMES         8
+#define FRAME_PACING_DEFAULT_FRAMES     3
+
+// how far the cpu runs ahead of the gpu, frames are tracked by the serial of the
+// command buffer that presented them
+typedef struct FramePacing_t {
+    GLuint      max_frames;                         // in flight, counting the one being recorded
+    GLboolean   low_latency;                        // wait for the oldest frame before starting a new one
+    GLuint64    serials[FRAME_PACING_MAX_FRAMES];   // by frame number
+    GLuint64    frames;                             // submitted
+    GLuint64    frame_start;                        // ns, host clock
+
+    // last frame, ns
+    GLuint64    cpu_time;                           // start of the frame to its swap
+    GLuint64    gpu_time;                           // newest completed frame
+    GLuint64    wait_time;                          // swap blocked on the gpu
+
+    GLuint64    frames_dropped;                     // never committed
+} FramePacing;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the strings are the MGL_MAX_FRAMES_IN_FLIGHT and MGL_LOW_LATENCY env vars, NULL for defaults
+void initFramePacing(FramePacing *fp, const char *max_frames, const char *low_latency);
+
+// clamped to 1 .. FRAME_PACING_MAX_FRAMES
+void framePacingSetMaxFrames(FramePacing *fp, GLuint max_frames);
+
+void framePacingSubmit(FramePacing *fp, GLuint64 serial);
+
+// the serial the cpu has to wait for before starting the next frame, 0 when it doesn't
+GLuint64 framePacingWaitSerial(const FramePacing *fp, GLuint64 completed);
+
+// command buffer serials of the newest completed frame, false when none has completed
+GLboolean framePacingCompletedFrame(const FramePacing *fp, GLuint64 completed, GLuint64 *first, GLuint64 *last);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* frame_pacing_h */
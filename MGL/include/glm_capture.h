@@ -0,0 +1,1066 @@
+//
+// /tmp/glm_capture.h
+//
+// Autogenerated from gl.xml
+//
+// Mike Larson
+//
+// January 2026
+//
+
+#ifndef glm_capture_h
+#define glm_capture_h
+
+enum {
+	CAPTURE_glCullFace,
+	CAPTURE_glFrontFace,
+	CAPTURE_glHint,
+	CAPTURE_glLineWidth,
+	CAPTURE_glPointSize,
+	CAPTURE_glPolygonMode,
+	CAPTURE_glScissor,
+	CAPTURE_glTexParameterf,
+	CAPTURE_glTexParameterfv,
+	CAPTURE_glTexParameteri,
+	CAPTURE_glTexParameteriv,
+	CAPTURE_glTexImage1D,
+	CAPTURE_glTexImage2D,
+	CAPTURE_glDrawBuffer,
+	CAPTURE_glClear,
+	CAPTURE_glClearColor,
+	CAPTURE_glClearStencil,
+	CAPTURE_glClearDepth,
+	CAPTURE_glStencilMask,
+	CAPTURE_glColorMask,
+	CAPTURE_glDepthMask,
+	CAPTURE_glDisable,
+	CAPTURE_glEnable,
+	CAPTURE_glFinish,
+	CAPTURE_glFlush,
+	CAPTURE_glBlendFunc,
+	CAPTURE_glLogicOp,
+	CAPTURE_glStencilFunc,
+	CAPTURE_glStencilOp,
+	CAPTURE_glDepthFunc,
+	CAPTURE_glPixelStoref,
+	CAPTURE_glPixelStorei,
+	CAPTURE_glReadBuffer,
+	CAPTURE_glReadPixels,
+	CAPTURE_glGetBooleanv,
+	CAPTURE_glGetDoublev,
+	CAPTURE_glGetError,
+	CAPTURE_glGetFloatv,
+	CAPTURE_glGetIntegerv,
+	CAPTURE_glGetString,
+	CAPTURE_glGetTexImage,
+	CAPTURE_glGetTexParameterfv,
+	CAPTURE_glGetTexParameteriv,
+	CAPTURE_glGetTexLevelParameterfv,
+	CAPTURE_glGetTexLevelParameteriv,
+	CAPTURE_glIsEnabled,
+	CAPTURE_glDepthRange,
+	CAPTURE_glViewport,
+	CAPTURE_glNewList,
+	CAPTURE_glEndList,
+	CAPTURE_glCallList,
+	CAPTURE_glCallLists,
+	CAPTURE_glDeleteLists,
+	CAPTURE_glGenLists,
+	CAPTURE_glListBase,
+	CAPTURE_glBegin,
+	CAPTURE_glBitmap,
+	CAPTURE_glColor3b,
+	CAPTURE_glColor3bv,
+	CAPTURE_glColor3d,
+	CAPTURE_glColor3dv,
+	CAPTURE_glColor3f,
+	CAPTURE_glColor3fv,
+	CAPTURE_glColor3i,
+	CAPTURE_glColor3iv,
+	CAPTURE_glColor3s,
+	CAPTURE_glColor3sv,
+	CAPTURE_glColor3ub,
+	CAPTURE_glColor3ubv,
+	CAPTURE_glColor3ui,
+	CAPTURE_glColor3uiv,
+	CAPTURE_glColor3us,
+	CAPTURE_glColor3usv,
+	CAPTURE_glColor4b,
+	CAPTURE_glColor4bv,
+	CAPTURE_glColor4d,
+	CAPTURE_glColor4dv,
+	CAPTURE_glColor4f,
+	CAPTURE_glColor4fv,
+	CAPTURE_glColor4i,
+	CAPTURE_glColor4iv,
+	CAPTURE_glColor4s,
+	CAPTURE_glColor4sv,
+	CAPTURE_glColor4ub,
+	CAPTURE_glColor4ubv,
+	CAPTURE_glColor4ui,
+	CAPTURE_glColor4uiv,
+	CAPTURE_glColor4us,
+	CAPTURE_glColor4usv,
+	CAPTURE_glEdgeFlag,
+	CAPTURE_glEdgeFlagv,
+	CAPTURE_glEnd,
+	CAPTURE_glIndexd,
+	CAPTURE_glIndexdv,
+	CAPTURE_glIndexf,
+	CAPTURE_glIndexfv,
+	CAPTURE_glIndexi,
+	CAPTURE_glIndexiv,
+	CAPTURE_glIndexs,
+	CAPTURE_glIndexsv,
+	CAPTURE_glNormal3b,
+	CAPTURE_glNormal3bv,
+	CAPTURE_glNormal3d,
+	CAPTURE_glNormal3dv,
+	CAPTURE_glNormal3f,
+	CAPTURE_glNormal3fv,
+	CAPTURE_glNormal3i,
+	CAPTURE_glNormal3iv,
+	CAPTURE_glNormal3s,
+	CAPTURE_glNormal3sv,
+	CAPTURE_glRasterPos2d,
+	CAPTURE_glRasterPos2dv,
+	CAPTURE_glRasterPos2f,
+	CAPTURE_glRasterPos2fv,
+	CAPTURE_glRasterPos2i,
+	CAPTURE_glRasterPos2iv,
+	CAPTURE_glRasterPos2s,
+	CAPTURE_glRasterPos2sv,
+	CAPTURE_glRasterPos3d,
+	CAPTURE_glRasterPos3dv,
+	CAPTURE_glRasterPos3f,
+	CAPTURE_glRasterPos3fv,
+	CAPTURE_glRasterPos3i,
+	CAPTURE_glRasterPos3iv,
+	CAPTURE_glRasterPos3s,
+	CAPTURE_glRasterPos3sv,
+	CAPTURE_glRasterPos4d,
+	CAPTURE_glRasterPos4dv,
+	CAPTURE_glRasterPos4f,
+	CAPTURE_glRasterPos4fv,
+	CAPTURE_glRasterPos4i,
+	CAPTURE_glRasterPos4iv,
+	CAPTURE_glRasterPos4s,
+	CAPTURE_glRasterPos4sv,
+	CAPTURE_glRectd,
+	CAPTURE_glRectdv,
+	CAPTURE_glRectf,
+	CAPTURE_glRectfv,
+	CAPTURE_glRecti,
+	CAPTURE_glRectiv,
+	CAPTURE_glRects,
+	CAPTURE_glRectsv,
+	CAPTURE_glTexCoord1d,
+	CAPTURE_glTexCoord1dv,
+	CAPTURE_glTexCoord1f,
+	CAPTURE_glTexCoord1fv,
+	CAPTURE_glTexCoord1i,
+	CAPTURE_glTexCoord1iv,
+	CAPTURE_glTexCoord1s,
+	CAPTURE_glTexCoord1sv,
+	CAPTURE_glTexCoord2d,
+	CAPTURE_glTexCoord2dv,
+	CAPTURE_glTexCoord2f,
+	CAPTURE_glTexCoord2fv,
+	CAPTURE_glTexCoord2i,
+	CAPTURE_glTexCoord2iv,
+	CAPTURE_glTexCoord2s,
+	CAPTURE_glTexCoord2sv,
+	CAPTURE_glTexCoord3d,
+	CAPTURE_glTexCoord3dv,
+	CAPTURE_glTexCoord3f,
+	CAPTURE_glTexCoord3fv,
+	CAPTURE_glTexCoord3i,
+	CAPTURE_glTexCoord3iv,
+	CAPTURE_glTexCoord3s,
+	CAPTURE_glTexCoord3sv,
+	CAPTURE_glTexCoord4d,
+	CAPTURE_glTexCoord4dv,
+	CAPTURE_glTexCoord4f,
+	CAPTURE_glTexCoord4fv,
+	CAPTURE_glTexCoord4i,
+	CAPTURE_glTexCoord4iv,
+	CAPTURE_glTexCoord4s,
+	CAPTURE_glTexCoord4sv,
+	CAPTURE_glVertex2d,
+	CAPTURE_glVertex2dv,
+	CAPTURE_glVertex2f,
+	CAPTURE_glVertex2fv,
+	CAPTURE_glVertex2i,
+	CAPTURE_glVertex2iv,
+	CAPTURE_glVertex2s,
+	CAPTURE_glVertex2sv,
+	CAPTURE_glVertex3d,
+	CAPTURE_glVertex3dv,
+	CAPTURE_glVertex3f,
+	CAPTURE_glVertex3fv,
+	CAPTURE_glVertex3i,
+	CAPTURE_glVertex3iv,
+	CAPTURE_glVertex3s,
+	CAPTURE_glVertex3sv,
+	CAPTURE_glVertex4d,
+	CAPTURE_glVertex4dv,
+	CAPTURE_glVertex4f,
+	CAPTURE_glVertex4fv,
+	CAPTURE_glVertex4i,
+	CAPTURE_glVertex4iv,
+	CAPTURE_glVertex4s,
+	CAPTURE_glVertex4sv,
+	CAPTURE_glClipPlane,
+	CAPTURE_glColorMaterial,
+	CAPTURE_glFogf,
+	CAPTURE_glFogfv,
+	CAPTURE_glFogi,
+	CAPTURE_glFogiv,
+	CAPTURE_glLightf,
+	CAPTURE_glLightfv,
+	CAPTURE_glLighti,
+	CAPTURE_glLightiv,
+	CAPTURE_glLightModelf,
+	CAPTURE_glLightModelfv,
+	CAPTURE_glLightModeli,
+	CAPTURE_glLightModeliv,
+	CAPTURE_glLineStipple,
+	CAPTURE_glMaterialf,
+	CAPTURE_glMaterialfv,
+	CAPTURE_glMateriali,
+	CAPTURE_glMaterialiv,
+	CAPTURE_glPolygonStipple,
+	CAPTURE_glShadeModel,
+	CAPTURE_glTexEnvf,
+	CAPTURE_glTexEnvfv,
+	CAPTURE_glTexEnvi,
+	CAPTURE_glTexEnviv,
+	CAPTURE_glTexGend,
+	CAPTURE_glTexGendv,
+	CAPTURE_glTexGenf,
+	CAPTURE_glTexGenfv,
+	CAPTURE_glTexGeni,
+	CAPTURE_glTexGeniv,
+	CAPTURE_glFeedbackBuffer,
+	CAPTURE_glSelectBuffer,
+	CAPTURE_glRenderMode,
+	CAPTURE_glInitNames,
+	CAPTURE_glLoadName,
+	CAPTURE_glPassThrough,
+	CAPTURE_glPopName,
+	CAPTURE_glPushName,
+	CAPTURE_glClearAccum,
+	CAPTURE_glClearIndex,
+	CAPTURE_glIndexMask,
+	CAPTURE_glAccum,
+	CAPTURE_glPopAttrib,
+	CAPTURE_glPushAttrib,
+	CAPTURE_glMap1d,
+	CAPTURE_glMap1f,
+	CAPTURE_glMap2d,
+	CAPTURE_glMap2f,
+	CAPTURE_glMapGrid1d,
+	CAPTURE_glMapGrid1f,
+	CAPTURE_glMapGrid2d,
+	CAPTURE_glMapGrid2f,
+	CAPTURE_glEvalCoord1d,
+	CAPTURE_glEvalCoord1dv,
+	CAPTURE_glEvalCoord1f,
+	CAPTURE_glEvalCoord1fv,
+	CAPTURE_glEvalCoord2d,
+	CAPTURE_glEvalCoord2dv,
+	CAPTURE_glEvalCoord2f,
+	CAPTURE_glEvalCoord2fv,
+	CAPTURE_glEvalMesh1,
+	CAPTURE_glEvalPoint1,
+	CAPTURE_glEvalMesh2,
+	CAPTURE_glEvalPoint2,
+	CAPTURE_glAlphaFunc,
+	CAPTURE_glPixelZoom,
+	CAPTURE_glPixelTransferf,
+	CAPTURE_glPixelTransferi,
+	CAPTURE_glPixelMapfv,
+	CAPTURE_glPixelMapuiv,
+	CAPTURE_glPixelMapusv,
+	CAPTURE_glCopyPixels,
+	CAPTURE_glDrawPixels,
+	CAPTURE_glGetClipPlane,
+	CAPTURE_glGetLightfv,
+	CAPTURE_glGetLightiv,
+	CAPTURE_glGetMapdv,
+	CAPTURE_glGetMapfv,
+	CAPTURE_glGetMapiv,
+	CAPTURE_glGetMaterialfv,
+	CAPTURE_glGetMaterialiv,
+	CAPTURE_glGetPixelMapfv,
+	CAPTURE_glGetPixelMapuiv,
+	CAPTURE_glGetPixelMapusv,
+	CAPTURE_glGetPolygonStipple,
+	CAPTURE_glGetTexEnvfv,
+	CAPTURE_glGetTexEnviv,
+	CAPTURE_glGetTexGendv,
+	CAPTURE_glGetTexGenfv,
+	CAPTURE_glGetTexGeniv,
+	CAPTURE_glIsList,
+	CAPTURE_glFrustum,
+	CAPTURE_glLoadIdentity,
+	CAPTURE_glLoadMatrixf,
+	CAPTURE_glLoadMatrixd,
+	CAPTURE_glMatrixMode,
+	CAPTURE_glMultMatrixf,
+	CAPTURE_glMultMatrixd,
+	CAPTURE_glOrtho,
+	CAPTURE_glPopMatrix,
+	CAPTURE_glPushMatrix,
+	CAPTURE_glRotated,
+	CAPTURE_glRotatef,
+	CAPTURE_glScaled,
+	CAPTURE_glScalef,
+	CAPTURE_glTranslated,
+	CAPTURE_glTranslatef,
+	CAPTURE_glDrawArrays,
+	CAPTURE_glDrawElements,
+	CAPTURE_glGetPointerv,
+	CAPTURE_glPolygonOffset,
+	CAPTURE_glCopyTexImage1D,
+	CAPTURE_glCopyTexImage2D,
+	CAPTURE_glCopyTexSubImage1D,
+	CAPTURE_glCopyTexSubImage2D,
+	CAPTURE_glTexSubImage1D,
+	CAPTURE_glTexSubImage2D,
+	CAPTURE_glBindTexture,
+	CAPTURE_glDeleteTextures,
+	CAPTURE_glGenTextures,
+	CAPTURE_glIsTexture,
+	CAPTURE_glArrayElement,
+	CAPTURE_glColorPointer,
+	CAPTURE_glDisableClientState,
+	CAPTURE_glEdgeFlagPointer,
+	CAPTURE_glEnableClientState,
+	CAPTURE_glIndexPointer,
+	CAPTURE_glInterleavedArrays,
+	CAPTURE_glNormalPointer,
+	CAPTURE_glTexCoordPointer,
+	CAPTURE_glVertexPointer,
+	CAPTURE_glAreTexturesResident,
+	CAPTURE_glPrioritizeTextures,
+	CAPTURE_glIndexub,
+	CAPTURE_glIndexubv,
+	CAPTURE_glPopClientAttrib,
+	CAPTURE_glPushClientAttrib,
+	CAPTURE_glDrawRangeElements,
+	CAPTURE_glTexImage3D,
+	CAPTURE_glTexSubImage3D,
+	CAPTURE_glCopyTexSubImage3D,
+	CAPTURE_glActiveTexture,
+	CAPTURE_glSampleCoverage,
+	CAPTURE_glCompressedTexImage3D,
+	CAPTURE_glCompressedTexImage2D,
+	CAPTURE_glCompressedTexImage1D,
+	CAPTURE_glCompressedTexSubImage3D,
+	CAPTURE_glCompressedTexSubImage2D,
+	CAPTURE_glCompressedTexSubImage1D,
+	CAPTURE_glGetCompressedTexImage,
+	CAPTURE_glClientActiveTexture,
+	CAPTURE_glMultiTexCoord1d,
+	CAPTURE_glMultiTexCoord1dv,
+	CAPTURE_glMultiTexCoord1f,
+	CAPTURE_glMultiTexCoord1fv,
+	CAPTURE_glMultiTexCoord1i,
+	CAPTURE_glMultiTexCoord1iv,
+	CAPTURE_glMultiTexCoord1s,
+	CAPTURE_glMultiTexCoord1sv,
+	CAPTURE_glMultiTexCoord2d,
+	CAPTURE_glMultiTexCoord2dv,
+	CAPTURE_glMultiTexCoord2f,
+	CAPTURE_glMultiTexCoord2fv,
+	CAPTURE_glMultiTexCoord2i,
+	CAPTURE_glMultiTexCoord2iv,
+	CAPTURE_glMultiTexCoord2s,
+	CAPTURE_glMultiTexCoord2sv,
+	CAPTURE_glMultiTexCoord3d,
+	CAPTURE_glMultiTexCoord3dv,
+	CAPTURE_glMultiTexCoord3f,
+	CAPTURE_glMultiTexCoord3fv,
+	CAPTURE_glMultiTexCoord3i,
+	CAPTURE_glMultiTexCoord3iv,
+	CAPTURE_glMultiTexCoord3s,
+	CAPTURE_glMultiTexCoord3sv,
+	CAPTURE_glMultiTexCoord4d,
+	CAPTURE_glMultiTexCoord4dv,
+	CAPTURE_glMultiTexCoord4f,
+	CAPTURE_glMultiTexCoord4fv,
+	CAPTURE_glMultiTexCoord4i,
+	CAPTURE_glMultiTexCoord4iv,
+	CAPTURE_glMultiTexCoord4s,
+	CAPTURE_glMultiTexCoord4sv,
+	CAPTURE_glLoadTransposeMatrixf,
+	CAPTURE_glLoadTransposeMatrixd,
+	CAPTURE_glMultTransposeMatrixf,
+	CAPTURE_glMultTransposeMatrixd,
+	CAPTURE_glBlendFuncSeparate,
+	CAPTURE_glMultiDrawArrays,
+	CAPTURE_glMultiDrawElements,
+	CAPTURE_glPointParameterf,
+	CAPTURE_glPointParameterfv,
+	CAPTURE_glPointParameteri,
+	CAPTURE_glPointParameteriv,
+	CAPTURE_glFogCoordf,
+	CAPTURE_glFogCoordfv,
+	CAPTURE_glFogCoordd,
+	CAPTURE_glFogCoorddv,
+	CAPTURE_glFogCoordPointer,
+	CAPTURE_glSecondaryColor3b,
+	CAPTURE_glSecondaryColor3bv,
+	CAPTURE_glSecondaryColor3d,
+	CAPTURE_glSecondaryColor3dv,
+	CAPTURE_glSecondaryColor3f,
+	CAPTURE_glSecondaryColor3fv,
+	CAPTURE_glSecondaryColor3i,
+	CAPTURE_glSecondaryColor3iv,
+	CAPTURE_glSecondaryColor3s,
+	CAPTURE_glSecondaryColor3sv,
+	CAPTURE_glSecondaryColor3ub,
+	CAPTURE_glSecondaryColor3ubv,
+	CAPTURE_glSecondaryColor3ui,
+	CAPTURE_glSecondaryColor3uiv,
+	CAPTURE_glSecondaryColor3us,
+	CAPTURE_glSecondaryColor3usv,
+	CAPTURE_glSecondaryColorPointer,
+	CAPTURE_glWindowPos2d,
+	CAPTURE_glWindowPos2dv,
+	CAPTURE_glWindowPos2f,
+	CAPTURE_glWindowPos2fv,
+	CAPTURE_glWindowPos2i,
+	CAPTURE_glWindowPos2iv,
+	CAPTURE_glWindowPos2s,
+	CAPTURE_glWindowPos2sv,
+	CAPTURE_glWindowPos3d,
+	CAPTURE_glWindowPos3dv,
+	CAPTURE_glWindowPos3f,
+	CAPTURE_glWindowPos3fv,
+	CAPTURE_glWindowPos3i,
+	CAPTURE_glWindowPos3iv,
+	CAPTURE_glWindowPos3s,
+	CAPTURE_glWindowPos3sv,
+	CAPTURE_glBlendColor,
+	CAPTURE_glBlendEquation,
+	CAPTURE_glGenQueries,
+	CAPTURE_glDeleteQueries,
+	CAPTURE_glIsQuery,
+	CAPTURE_glBeginQuery,
+	CAPTURE_glEndQuery,
+	CAPTURE_glGetQueryiv,
+	CAPTURE_glGetQueryObjectiv,
+	CAPTURE_glGetQueryObjectuiv,
+	CAPTURE_glBindBuffer,
+	CAPTURE_glDeleteBuffers,
+	CAPTURE_glGenBuffers,
+	CAPTURE_glIsBuffer,
+	CAPTURE_glBufferData,
+	CAPTURE_glBufferSubData,
+	CAPTURE_glGetBufferSubData,
+	CAPTURE_glMapBuffer,
+	CAPTURE_glUnmapBuffer,
+	CAPTURE_glGetBufferParameteriv,
+	CAPTURE_glGetBufferPointerv,
+	CAPTURE_glBlendEquationSeparate,
+	CAPTURE_glDrawBuffers,
+	CAPTURE_glStencilOpSeparate,
+	CAPTURE_glStencilFuncSeparate,
+	CAPTURE_glStencilMaskSeparate,
+	CAPTURE_glAttachShader,
+	CAPTURE_glBindAttribLocation,
+	CAPTURE_glCompileShader,
+	CAPTURE_glCreateProgram,
+	CAPTURE_glCreateShader,
+	CAPTURE_glDeleteProgram,
+	CAPTURE_glDeleteShader,
+	CAPTURE_glDetachShader,
+	CAPTURE_glDisableVertexAttribArray,
+	CAPTURE_glEnableVertexAttribArray,
+	CAPTURE_glGetActiveAttrib,
+	CAPTURE_glGetActiveUniform,
+	CAPTURE_glGetAttachedShaders,
+	CAPTURE_glGetAttribLocation,
+	CAPTURE_glGetProgramiv,
+	CAPTURE_glGetProgramInfoLog,
+	CAPTURE_glGetShaderiv,
+	CAPTURE_glGetShaderInfoLog,
+	CAPTURE_glGetShaderSource,
+	CAPTURE_glGetUniformLocation,
+	CAPTURE_glGetUniformfv,
+	CAPTURE_glGetUniformiv,
+	CAPTURE_glGetVertexAttribdv,
+	CAPTURE_glGetVertexAttribfv,
+	CAPTURE_glGetVertexAttribiv,
+	CAPTURE_glGetVertexAttribPointerv,
+	CAPTURE_glIsProgram,
+	CAPTURE_glIsShader,
+	CAPTURE_glLinkProgram,
+	CAPTURE_glShaderSource,
+	CAPTURE_glUseProgram,
+	CAPTURE_glUniform1f,
+	CAPTURE_glUniform2f,
+	CAPTURE_glUniform3f,
+	CAPTURE_glUniform4f,
+	CAPTURE_glUniform1i,
+	CAPTURE_glUniform2i,
+	CAPTURE_glUniform3i,
+	CAPTURE_glUniform4i,
+	CAPTURE_glUniform1fv,
+	CAPTURE_glUniform2fv,
+	CAPTURE_glUniform3fv,
+	CAPTURE_glUniform4fv,
+	CAPTURE_glUniform1iv,
+	CAPTURE_glUniform2iv,
+	CAPTURE_glUniform3iv,
+	CAPTURE_glUniform4iv,
+	CAPTURE_glUniformMatrix2fv,
+	CAPTURE_glUniformMatrix3fv,
+	CAPTURE_glUniformMatrix4fv,
+	CAPTURE_glValidateProgram,
+	CAPTURE_glVertexAttrib1d,
+	CAPTURE_glVertexAttrib1dv,
+	CAPTURE_glVertexAttrib1f,
+	CAPTURE_glVertexAttrib1fv,
+	CAPTURE_glVertexAttrib1s,
+	CAPTURE_glVertexAttrib1sv,
+	CAPTURE_glVertexAttrib2d,
+	CAPTURE_glVertexAttrib2dv,
+	CAPTURE_glVertexAttrib2f,
+	CAPTURE_glVertexAttrib2fv,
+	CAPTURE_glVertexAttrib2s,
+	CAPTURE_glVertexAttrib2sv,
+	CAPTURE_glVertexAttrib3d,
+	CAPTURE_glVertexAttrib3dv,
+	CAPTURE_glVertexAttrib3f,
+	CAPTURE_glVertexAttrib3fv,
+	CAPTURE_glVertexAttrib3s,
+	CAPTURE_glVertexAttrib3sv,
+	CAPTURE_glVertexAttrib4Nbv,
+	CAPTURE_glVertexAttrib4Niv,
+	CAPTURE_glVertexAttrib4Nsv,
+	CAPTURE_glVertexAttrib4Nub,
+	CAPTURE_glVertexAttrib4Nubv,
+	CAPTURE_glVertexAttrib4Nuiv,
+	CAPTURE_glVertexAttrib4Nusv,
+	CAPTURE_glVertexAttrib4bv,
+	CAPTURE_glVertexAttrib4d,
+	CAPTURE_glVertexAttrib4dv,
+	CAPTURE_glVertexAttrib4f,
+	CAPTURE_glVertexAttrib4fv,
+	CAPTURE_glVertexAttrib4iv,
+	CAPTURE_glVertexAttrib4s,
+	CAPTURE_glVertexAttrib4sv,
+	CAPTURE_glVertexAttrib4ubv,
+	CAPTURE_glVertexAttrib4uiv,
+	CAPTURE_glVertexAttrib4usv,
+	CAPTURE_glVertexAttribPointer,
+	CAPTURE_glUniformMatrix2x3fv,
+	CAPTURE_glUniformMatrix3x2fv,
+	CAPTURE_glUniformMatrix2x4fv,
+	CAPTURE_glUniformMatrix4x2fv,
+	CAPTURE_glUniformMatrix3x4fv,
+	CAPTURE_glUniformMatrix4x3fv,
+	CAPTURE_glColorMaski,
+	CAPTURE_glGetBooleani_v,
+	CAPTURE_glGetIntegeri_v,
+	CAPTURE_glEnablei,
+	CAPTURE_glDisablei,
+	CAPTURE_glIsEnabledi,
+	CAPTURE_glBeginTransformFeedback,
+	CAPTURE_glEndTransformFeedback,
+	CAPTURE_glBindBufferRange,
+	CAPTURE_glBindBufferBase,
+	CAPTURE_glTransformFeedbackVaryings,
+	CAPTURE_glGetTransformFeedbackVarying,
+	CAPTURE_glClampColor,
+	CAPTURE_glBeginConditionalRender,
+	CAPTURE_glEndConditionalRender,
+	CAPTURE_glVertexAttribIPointer,
+	CAPTURE_glGetVertexAttribIiv,
+	CAPTURE_glGetVertexAttribIuiv,
+	CAPTURE_glVertexAttribI1i,
+	CAPTURE_glVertexAttribI2i,
+	CAPTURE_glVertexAttribI3i,
+	CAPTURE_glVertexAttribI4i,
+	CAPTURE_glVertexAttribI1ui,
+	CAPTURE_glVertexAttribI2ui,
+	CAPTURE_glVertexAttribI3ui,
+	CAPTURE_glVertexAttribI4ui,
+	CAPTURE_glVertexAttribI1iv,
+	CAPTURE_glVertexAttribI2iv,
+	CAPTURE_glVertexAttribI3iv,
+	CAPTURE_glVertexAttribI4iv,
+	CAPTURE_glVertexAttribI1uiv,
+	CAPTURE_glVertexAttribI2uiv,
+	CAPTURE_glVertexAttribI3uiv,
+	CAPTURE_glVertexAttribI4uiv,
+	CAPTURE_glVertexAttribI4bv,
+	CAPTURE_glVertexAttribI4sv,
+	CAPTURE_glVertexAttribI4ubv,
+	CAPTURE_glVertexAttribI4usv,
+	CAPTURE_glGetUniformuiv,
+	CAPTURE_glBindFragDataLocation,
+	CAPTURE_glGetFragDataLocation,
+	CAPTURE_glUniform1ui,
+	CAPTURE_glUniform2ui,
+	CAPTURE_glUniform3ui,
+	CAPTURE_glUniform4ui,
+	CAPTURE_glUniform1uiv,
+	CAPTURE_glUniform2uiv,
+	CAPTURE_glUniform3uiv,
+	CAPTURE_glUniform4uiv,
+	CAPTURE_glTexParameterIiv,
+	CAPTURE_glTexParameterIuiv,
+	CAPTURE_glGetTexParameterIiv,
+	CAPTURE_glGetTexParameterIuiv,
+	CAPTURE_glClearBufferiv,
+	CAPTURE_glClearBufferuiv,
+	CAPTURE_glClearBufferfv,
+	CAPTURE_glClearBufferfi,
+	CAPTURE_glGetStringi,
+	CAPTURE_glIsRenderbuffer,
+	CAPTURE_glBindRenderbuffer,
+	CAPTURE_glDeleteRenderbuffers,
+	CAPTURE_glGenRenderbuffers,
+	CAPTURE_glRenderbufferStorage,
+	CAPTURE_glGetRenderbufferParameteriv,
+	CAPTURE_glIsFramebuffer,
+	CAPTURE_glBindFramebuffer,
+	CAPTURE_glDeleteFramebuffers,
+	CAPTURE_glGenFramebuffers,
+	CAPTURE_glCheckFramebufferStatus,
+	CAPTURE_glFramebufferTexture1D,
+	CAPTURE_glFramebufferTexture2D,
+	CAPTURE_glFramebufferTexture3D,
+	CAPTURE_glFramebufferRenderbuffer,
+	CAPTURE_glGetFramebufferAttachmentParameteriv,
+	CAPTURE_glGenerateMipmap,
+	CAPTURE_glBlitFramebuffer,
+	CAPTURE_glRenderbufferStorageMultisample,
+	CAPTURE_glFramebufferTextureLayer,
+	CAPTURE_glMapBufferRange,
+	CAPTURE_glFlushMappedBufferRange,
+	CAPTURE_glBindVertexArray,
+	CAPTURE_glDeleteVertexArrays,
+	CAPTURE_glGenVertexArrays,
+	CAPTURE_glIsVertexArray,
+	CAPTURE_glDrawArraysInstanced,
+	CAPTURE_glDrawElementsInstanced,
+	CAPTURE_glTexBuffer,
+	CAPTURE_glPrimitiveRestartIndex,
+	CAPTURE_glCopyBufferSubData,
+	CAPTURE_glGetUniformIndices,
+	CAPTURE_glGetActiveUniformsiv,
+	CAPTURE_glGetActiveUniformName,
+	CAPTURE_glGetUniformBlockIndex,
+	CAPTURE_glGetActiveUniformBlockiv,
+	CAPTURE_glGetActiveUniformBlockName,
+	CAPTURE_glUniformBlockBinding,
+	CAPTURE_glDrawElementsBaseVertex,
+	CAPTURE_glDrawRangeElementsBaseVertex,
+	CAPTURE_glDrawElementsInstancedBaseVertex,
+	CAPTURE_glMultiDrawElementsBaseVertex,
+	CAPTURE_glProvokingVertex,
+	CAPTURE_glFenceSync,
+	CAPTURE_glIsSync,
+	CAPTURE_glDeleteSync,
+	CAPTURE_glClientWaitSync,
+	CAPTURE_glWaitSync,
+	CAPTURE_glGetInteger64v,
+	CAPTURE_glGetSynciv,
+	CAPTURE_glGetInteger64i_v,
+	CAPTURE_glGetBufferParameteri64v,
+	CAPTURE_glFramebufferTexture,
+	CAPTURE_glTexImage2DMultisample,
+	CAPTURE_glTexImage3DMultisample,
+	CAPTURE_glGetMultisamplefv,
+	CAPTURE_glSampleMaski,
+	CAPTURE_glBindFragDataLocationIndexed,
+	CAPTURE_glGetFragDataIndex,
+	CAPTURE_glGenSamplers,
+	CAPTURE_glDeleteSamplers,
+	CAPTURE_glIsSampler,
+	CAPTURE_glBindSampler,
+	CAPTURE_glSamplerParameteri,
+	CAPTURE_glSamplerParameteriv,
+	CAPTURE_glSamplerParameterf,
+	CAPTURE_glSamplerParameterfv,
+	CAPTURE_glSamplerParameterIiv,
+	CAPTURE_glSamplerParameterIuiv,
+	CAPTURE_glGetSamplerParameteriv,
+	CAPTURE_glGetSamplerParameterIiv,
+	CAPTURE_glGetSamplerParameterfv,
+	CAPTURE_glGetSamplerParameterIuiv,
+	CAPTURE_glQueryCounter,
+	CAPTURE_glGetQueryObjecti64v,
+	CAPTURE_glGetQueryObjectui64v,
+	CAPTURE_glVertexAttribDivisor,
+	CAPTURE_glVertexAttribP1ui,
+	CAPTURE_glVertexAttribP1uiv,
+	CAPTURE_glVertexAttribP2ui,
+	CAPTURE_glVertexAttribP2uiv,
+	CAPTURE_glVertexAttribP3ui,
+	CAPTURE_glVertexAttribP3uiv,
+	CAPTURE_glVertexAttribP4ui,
+	CAPTURE_glVertexAttribP4uiv,
+	CAPTURE_glVertexP2ui,
+	CAPTURE_glVertexP2uiv,
+	CAPTURE_glVertexP3ui,
+	CAPTURE_glVertexP3uiv,
+	CAPTURE_glVertexP4ui,
+	CAPTURE_glVertexP4uiv,
+	CAPTURE_glTexCoordP1ui,
+	CAPTURE_glTexCoordP1uiv,
+	CAPTURE_glTexCoordP2ui,
+	CAPTURE_glTexCoordP2uiv,
+	CAPTURE_glTexCoordP3ui,
+	CAPTURE_glTexCoordP3uiv,
+	CAPTURE_glTexCoordP4ui,
+	CAPTURE_glTexCoordP4uiv,
+	CAPTURE_glMultiTexCoordP1ui,
+	CAPTURE_glMultiTexCoordP1uiv,
+	CAPTURE_glMultiTexCoordP2ui,
+	CAPTURE_glMultiTexCoordP2uiv,
+	CAPTURE_glMultiTexCoordP3ui,
+	CAPTURE_glMultiTexCoordP3uiv,
+	CAPTURE_glMultiTexCoordP4ui,
+	CAPTURE_glMultiTexCoordP4uiv,
+	CAPTURE_glNormalP3ui,
+	CAPTURE_glNormalP3uiv,
+	CAPTURE_glColorP3ui,
+	CAPTURE_glColorP3uiv,
+	CAPTURE_glColorP4ui,
+	CAPTURE_glColorP4uiv,
+	CAPTURE_glSecondaryColorP3ui,
+	CAPTURE_glSecondaryColorP3uiv,
+	CAPTURE_glMinSampleShading,
+	CAPTURE_glBlendEquationi,
+	CAPTURE_glBlendEquationSeparatei,
+	CAPTURE_glBlendFunci,
+	CAPTURE_glBlendFuncSeparatei,
+	CAPTURE_glDrawArraysIndirect,
+	CAPTURE_glDrawElementsIndirect,
+	CAPTURE_glUniform1d,
+	CAPTURE_glUniform2d,
+	CAPTURE_glUniform3d,
+	CAPTURE_glUniform4d,
+	CAPTURE_glUniform1dv,
+	CAPTURE_glUniform2dv,
+	CAPTURE_glUniform3dv,
+	CAPTURE_glUniform4dv,
+	CAPTURE_glUniformMatrix2dv,
+	CAPTURE_glUniformMatrix3dv,
+	CAPTURE_glUniformMatrix4dv,
+	CAPTURE_glUniformMatrix2x3dv,
+	CAPTURE_glUniformMatrix2x4dv,
+	CAPTURE_glUniformMatrix3x2dv,
+	CAPTURE_glUniformMatrix3x4dv,
+	CAPTURE_glUniformMatrix4x2dv,
+	CAPTURE_glUniformMatrix4x3dv,
+	CAPTURE_glGetUniformdv,
+	CAPTURE_glGetSubroutineUniformLocation,
+	CAPTURE_glGetSubroutineIndex,
+	CAPTURE_glGetActiveSubroutineUniformiv,
+	CAPTURE_glGetActiveSubroutineUniformName,
+	CAPTURE_glGetActiveSubroutineName,
+	CAPTURE_glUniformSubroutinesuiv,
+	CAPTURE_glGetUniformSubroutineuiv,
+	CAPTURE_glGetProgramStageiv,
+	CAPTURE_glPatchParameteri,
+	CAPTURE_glPatchParameterfv,
+	CAPTURE_glBindTransformFeedback,
+	CAPTURE_glDeleteTransformFeedbacks,
+	CAPTURE_glGenTransformFeedbacks,
+	CAPTURE_glIsTransformFeedback,
+	CAPTURE_glPauseTransformFeedback,
+	CAPTURE_glResumeTransformFeedback,
+	CAPTURE_glDrawTransformFeedback,
+	CAPTURE_glDrawTransformFeedbackStream,
+	CAPTURE_glBeginQueryIndexed,
+	CAPTURE_glEndQueryIndexed,
+	CAPTURE_glGetQueryIndexediv,
+	CAPTURE_glReleaseShaderCompiler,
+	CAPTURE_glShaderBinary,
+	CAPTURE_glGetShaderPrecisionFormat,
+	CAPTURE_glDepthRangef,
+	CAPTURE_glClearDepthf,
+	CAPTURE_glGetProgramBinary,
+	CAPTURE_glProgramBinary,
+	CAPTURE_glProgramParameteri,
+	CAPTURE_glUseProgramStages,
+	CAPTURE_glActiveShaderProgram,
+	CAPTURE_glCreateShaderProgramv,
+	CAPTURE_glBindProgramPipeline,
+	CAPTURE_glDeleteProgramPipelines,
+	CAPTURE_glGenProgramPipelines,
+	CAPTURE_glIsProgramPipeline,
+	CAPTURE_glGetProgramPipelineiv,
+	CAPTURE_glProgramUniform1i,
+	CAPTURE_glProgramUniform1iv,
+	CAPTURE_glProgramUniform1f,
+	CAPTURE_glProgramUniform1fv,
+	CAPTURE_glProgramUniform1d,
+	CAPTURE_glProgramUniform1dv,
+	CAPTURE_glProgramUniform1ui,
+	CAPTURE_glProgramUniform1uiv,
+	CAPTURE_glProgramUniform2i,
+	CAPTURE_glProgramUniform2iv,
+	CAPTURE_glProgramUniform2f,
+	CAPTURE_glProgramUniform2fv,
+	CAPTURE_glProgramUniform2d,
+	CAPTURE_glProgramUniform2dv,
+	CAPTURE_glProgramUniform2ui,
+	CAPTURE_glProgramUniform2uiv,
+	CAPTURE_glProgramUniform3i,
+	CAPTURE_glProgramUniform3iv,
+	CAPTURE_glProgramUniform3f,
+	CAPTURE_glProgramUniform3fv,
+	CAPTURE_glProgramUniform3d,
+	CAPTURE_glProgramUniform3dv,
+	CAPTURE_glProgramUniform3ui,
+	CAPTURE_glProgramUniform3uiv,
+	CAPTURE_glProgramUniform4i,
+	CAPTURE_glProgramUniform4iv,
+	CAPTURE_glProgramUniform4f,
+	CAPTURE_glProgramUniform4fv,
+	CAPTURE_glProgramUniform4d,
+	CAPTURE_glProgramUniform4dv,
+	CAPTURE_glProgramUniform4ui,
+	CAPTURE_glProgramUniform4uiv,
+	CAPTURE_glProgramUniformMatrix2fv,
+	CAPTURE_glProgramUniformMatrix3fv,
+	CAPTURE_glProgramUniformMatrix4fv,
+	CAPTURE_glProgramUniformMatrix2dv,
+	CAPTURE_glProgramUniformMatrix3dv,
+	CAPTURE_glProgramUniformMatrix4dv,
+	CAPTURE_glProgramUniformMatrix2x3fv,
+	CAPTURE_glProgramUniformMatrix3x2fv,
+	CAPTURE_glProgramUniformMatrix2x4fv,
+	CAPTURE_glProgramUniformMatrix4x2fv,
+	CAPTURE_glProgramUniformMatrix3x4fv,
+	CAPTURE_glProgramUniformMatrix4x3fv,
+	CAPTURE_glProgramUniformMatrix2x3dv,
+	CAPTURE_glProgramUniformMatrix3x2dv,
+	CAPTURE_glProgramUniformMatrix2x4dv,
+	CAPTURE_glProgramUniformMatrix4x2dv,
+	CAPTURE_glProgramUniformMatrix3x4dv,
+	CAPTURE_glProgramUniformMatrix4x3dv,
+	CAPTURE_glValidateProgramPipeline,
+	CAPTURE_glGetProgramPipelineInfoLog,
+	CAPTURE_glVertexAttribL1d,
+	CAPTURE_glVertexAttribL2d,
+	CAPTURE_glVertexAttribL3d,
+	CAPTURE_glVertexAttribL4d,
+	CAPTURE_glVertexAttribL1dv,
+	CAPTURE_glVertexAttribL2dv,
+	CAPTURE_glVertexAttribL3dv,
+	CAPTURE_glVertexAttribL4dv,
+	CAPTURE_glVertexAttribLPointer,
+	CAPTURE_glGetVertexAttribLdv,
+	CAPTURE_glViewportArrayv,
+	CAPTURE_glViewportIndexedf,
+	CAPTURE_glViewportIndexedfv,
+	CAPTURE_glScissorArrayv,
+	CAPTURE_glScissorIndexed,
+	CAPTURE_glScissorIndexedv,
+	CAPTURE_glDepthRangeArrayv,
+	CAPTURE_glDepthRangeIndexed,
+	CAPTURE_glGetFloati_v,
+	CAPTURE_glGetDoublei_v,
+	CAPTURE_glDrawArraysInstancedBaseInstance,
+	CAPTURE_glDrawElementsInstancedBaseInstance,
+	CAPTURE_glDrawElementsInstancedBaseVertexBaseInstance,
+	CAPTURE_glGetInternalformativ,
+	CAPTURE_glGetActiveAtomicCounterBufferiv,
+	CAPTURE_glBindImageTexture,
+	CAPTURE_glMemoryBarrier,
+	CAPTURE_glTexStorage1D,
+	CAPTURE_glTexStorage2D,
+	CAPTURE_glTexStorage3D,
+	CAPTURE_glDrawTransformFeedbackInstanced,
+	CAPTURE_glDrawTransformFeedbackStreamInstanced,
+	CAPTURE_glClearBufferData,
+	CAPTURE_glClearBufferSubData,
+	CAPTURE_glDispatchCompute,
+	CAPTURE_glDispatchComputeIndirect,
+	CAPTURE_glCopyImageSubData,
+	CAPTURE_glFramebufferParameteri,
+	CAPTURE_glGetFramebufferParameteriv,
+	CAPTURE_glGetInternalformati64v,
+	CAPTURE_glInvalidateTexSubImage,
+	CAPTURE_glInvalidateTexImage,
+	CAPTURE_glInvalidateBufferSubData,
+	CAPTURE_glInvalidateBufferData,
+	CAPTURE_glInvalidateFramebuffer,
+	CAPTURE_glInvalidateSubFramebuffer,
+	CAPTURE_glMultiDrawArraysIndirect,
+	CAPTURE_glMultiDrawElementsIndirect,
+	CAPTURE_glGetProgramInterfaceiv,
+	CAPTURE_glGetProgramResourceIndex,
+	CAPTURE_glGetProgramResourceName,
+	CAPTURE_glGetProgramResourceiv,
+	CAPTURE_glGetProgramResourceLocation,
+	CAPTURE_glGetProgramResourceLocationIndex,
+	CAPTURE_glShaderStorageBlockBinding,
+	CAPTURE_glTexBufferRange,
+	CAPTURE_glTexStorage2DMultisample,
+	CAPTURE_glTexStorage3DMultisample,
+	CAPTURE_glTextureView,
+	CAPTURE_glBindVertexBuffer,
+	CAPTURE_glVertexAttribFormat,
+	CAPTURE_glVertexAttribIFormat,
+	CAPTURE_glVertexAttribLFormat,
+	CAPTURE_glVertexAttribBinding,
+	CAPTURE_glVertexBindingDivisor,
+	CAPTURE_glDebugMessageControl,
+	CAPTURE_glDebugMessageInsert,
+	CAPTURE_glDebugMessageCallback,
+	CAPTURE_glGetDebugMessageLog,
+	CAPTURE_glPushDebugGroup,
+	CAPTURE_glPopDebugGroup,
+	CAPTURE_glObjectLabel,
+	CAPTURE_glGetObjectLabel,
+	CAPTURE_glObjectPtrLabel,
+	CAPTURE_glGetObjectPtrLabel,
+	CAPTURE_glBufferStorage,
+	CAPTURE_glClearTexImage,
+	CAPTURE_glClearTexSubImage,
+	CAPTURE_glBindBuffersBase,
+	CAPTURE_glBindBuffersRange,
+	CAPTURE_glBindTextures,
+	CAPTURE_glBindSamplers,
+	CAPTURE_glBindImageTextures,
+	CAPTURE_glBindVertexBuffers,
+	CAPTURE_glClipControl,
+	CAPTURE_glCreateTransformFeedbacks,
+	CAPTURE_glTransformFeedbackBufferBase,
+	CAPTURE_glTransformFeedbackBufferRange,
+	CAPTURE_glGetTransformFeedbackiv,
+	CAPTURE_glGetTransformFeedbacki_v,
+	CAPTURE_glGetTransformFeedbacki64_v,
+	CAPTURE_glCreateBuffers,
+	CAPTURE_glNamedBufferStorage,
+	CAPTURE_glNamedBufferData,
+	CAPTURE_glNamedBufferSubData,
+	CAPTURE_glCopyNamedBufferSubData,
+	CAPTURE_glClearNamedBufferData,
+	CAPTURE_glClearNamedBufferSubData,
+	CAPTURE_glMapNamedBuffer,
+	CAPTURE_glMapNamedBufferRange,
+	CAPTURE_glUnmapNamedBuffer,
+	CAPTURE_glFlushMappedNamedBufferRange,
+	CAPTURE_glGetNamedBufferParameteriv,
+	CAPTURE_glGetNamedBufferParameteri64v,
+	CAPTURE_glGetNamedBufferPointerv,
+	CAPTURE_glGetNamedBufferSubData,
+	CAPTURE_glCreateFramebuffers,
+	CAPTURE_glNamedFramebufferRenderbuffer,
+	CAPTURE_glNamedFramebufferParameteri,
+	CAPTURE_glNamedFramebufferTexture,
+	CAPTURE_glNamedFramebufferTextureLayer,
+	CAPTURE_glNamedFramebufferDrawBuffer,
+	CAPTURE_glNamedFramebufferDrawBuffers,
+	CAPTURE_glNamedFramebufferReadBuffer,
+	CAPTURE_glInvalidateNamedFramebufferData,
+	CAPTURE_glInvalidateNamedFramebufferSubData,
+	CAPTURE_glClearNamedFramebufferiv,
+	CAPTURE_glClearNamedFramebufferuiv,
+	CAPTURE_glClearNamedFramebufferfv,
+	CAPTURE_glClearNamedFramebufferfi,
+	CAPTURE_glBlitNamedFramebuffer,
+	CAPTURE_glCheckNamedFramebufferStatus,
+	CAPTURE_glGetNamedFramebufferParameteriv,
+	CAPTURE_glGetNamedFramebufferAttachmentParameteriv,
+	CAPTURE_glCreateRenderbuffers,
+	CAPTURE_glNamedRenderbufferStorage,
+	CAPTURE_glNamedRenderbufferStorageMultisample,
+	CAPTURE_glGetNamedRenderbufferParameteriv,
+	CAPTURE_glCreateTextures,
+	CAPTURE_glTextureBuffer,
+	CAPTURE_glTextureBufferRange,
+	CAPTURE_glTextureStorage1D,
+	CAPTURE_glTextureStorage2D,
+	CAPTURE_glTextureStorage3D,
+	CAPTURE_glTextureStorage2DMultisample,
+	CAPTURE_glTextureStorage3DMultisample,
+	CAPTURE_glTextureSubImage1D,
+	CAPTURE_glTextureSubImage2D,
+	CAPTURE_glTextureSubImage3D,
+	CAPTURE_glCompressedTextureSubImage1D,
+	CAPTURE_glCompressedTextureSubImage2D,
+	CAPTURE_glCompressedTextureSubImage3D,
+	CAPTURE_glCopyTextureSubImage1D,
+	CAPTURE_glCopyTextureSubImage2D,
+	CAPTURE_glCopyTextureSubImage3D,
+	CAPTURE_glTextureParameterf,
+	CAPTURE_glTextureParameterfv,
+	CAPTURE_glTextureParameteri,
+	CAPTURE_glTextureParameterIiv,
+	CAPTURE_glTextureParameterIuiv,
+	CAPTURE_glTextureParameteriv,
+	CAPTURE_glGenerateTextureMipmap,
+	CAPTURE_glBindTextureUnit,
+	CAPTURE_glGetTextureImage,
+	CAPTURE_glGetCompressedTextureImage,
+	CAPTURE_glGetTextureLevelParameterfv,
+	CAPTURE_glGetTextureLevelParameteriv,
+	CAPTURE_glGetTextureParameterfv,
+	CAPTURE_glGetTextureParameterIiv,
+	CAPTURE_glGetTextureParameterIuiv,
+	CAPTURE_glGetTextureParameteriv,
+	CAPTURE_glCreateVertexArrays,
+	CAPTURE_glDisableVertexArrayAttrib,
+	CAPTURE_glEnableVertexArrayAttrib,
+	CAPTURE_glVertexArrayElementBuffer,
+	CAPTURE_glVertexArrayVertexBuffer,
+	CAPTURE_glVertexArrayVertexBuffers,
+	CAPTURE_glVertexArrayAttribBinding,
+	CAPTURE_glVertexArrayAttribFormat,
+	CAPTURE_glVertexArrayAttribIFormat,
+	CAPTURE_glVertexArrayAttribLFormat,
+	CAPTURE_glVertexArrayBindingDivisor,
+	CAPTURE_glGetVertexArrayiv,
+	CAPTURE_glGetVertexArrayIndexediv,
+	CAPTURE_glGetVertexArrayIndexed64iv,
+	CAPTURE_glCreateSamplers,
+	CAPTURE_glCreateProgramPipelines,
+	CAPTURE_glCreateQueries,
+	CAPTURE_glGetQueryBufferObjecti64v,
+	CAPTURE_glGetQueryBufferObjectiv,
+	CAPTURE_glGetQueryBufferObjectui64v,
+	CAPTURE_glGetQueryBufferObjectuiv,
+	CAPTURE_glMemoryBarrierByRegion,
+	CAPTURE_glGetTextureSubImage,
+	CAPTURE_glGetCompressedTextureSubImage,
+	CAPTURE_glGetGraphicsResetStatus,
+	CAPTURE_glGetnCompressedTexImage,
+	CAPTURE_glGetnTexImage,
+	CAPTURE_glGetnUniformdv,
+	CAPTURE_glGetnUniformfv,
+	CAPTURE_glGetnUniformiv,
+	CAPTURE_glGetnUniformuiv,
+	CAPTURE_glReadnPixels,
+	CAPTURE_glGetnMapdv,
+	CAPTURE_glGetnMapfv,
+	CAPTURE_glGetnMapiv,
+	CAPTURE_glGetnPixelMapfv,
+	CAPTURE_glGetnPixelMapuiv,
+	CAPTURE_glGetnPixelMapusv,
+	CAPTURE_glGetnPolygonStipple,
+	CAPTURE_glGetnColorTable,
+	CAPTURE_glGetnConvolutionFilter,
+	CAPTURE_glGetnSeparableFilter,
+	CAPTURE_glGetnHistogram,
+	CAPTURE_glGetnMinmax,
+	CAPTURE_glTextureBarrier,
+	CAPTURE_glSpecializeShader,
+	CAPTURE_glMultiDrawArraysIndirectCount,
+	CAPTURE_glMultiDrawElementsIndirectCount,
+	CAPTURE_glPolygonOffsetClamp,
+	CAPTURE_COMMANDS
+};
+
+#endif /* glm_capture_h */
@@ -23,6 +23,7 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <time.h>
 
 #include <mach/vm_types.h>
 #include <glslang_c_interface.h>
@@ -31,10 +32,22 @@
 #include "glm_dispatch.h"
 
 #include "hash_table.h"
+#include "render_pass.h"
+#include "sampler_cache.h"
+#include "draw_queue.h"
+#include "upload_ring.h"
+#include "multi_draw_indirect.h"
+#include "query_pool.h"
+#include "sync_table.h"
+#include "frame_pacing.h"
+#include "trace.h"
 
 // defines above set sizes in glm_params
 #include "glm_params.h"
 
+// MGLget params and MGLStats live in the public header
+#include "MGLContext.h"
+
 #ifdef DEBUG
 #define DEBUG_LEVEL 3
 #endif
@@ -55,12 +68,20 @@
 #define RETURN_ON_NULL(_expr_) if (_expr_ == NULL) { printf("failure %s:%d\n",__FUNCTION__,__LINE__); return; }
 
 #define STATE(_VAR_)     ctx->state._VAR_
+
+// MGLGetStats counters, relaxed so they cost an add on the hot paths and can be bumped
+// from any thread
+#define STATS_ADD(_COUNTER_, _N_)   __atomic_fetch_add(&ctx->state.stats._COUNTER_, (GLuint64)(_N_), __ATOMIC_RELAXED)
+#define STATS_TIME()                clock_gettime_nsec_np(CLOCK_UPTIME_RAW)
 #define STATE_VAR(_VAR_) ctx->state.var._VAR_
 
 #define VAO()   ctx->state.vao
 #define VAO_STATE(_val_)   ctx->state.vao->_val_
 #define VAO_ATTRIB_STATE(_index_) ctx->state.vao->attrib[_index_]
 
+// generations come from one context wide counter so a recycled object never matches a stale value
+#define BUMP_GENERATION(_obj_) (_obj_)->generation = ++ctx->state.object_generation
+
 #define ERROR_RETURN(_type_) ctx->error_func(ctx, __FUNCTION__, _type_)
 #define ERROR_RETURN_VALUE(_type_, _val_) ctx->error_func(ctx, __FUNCTION__, _type_); return _val_
 #define ERROR_CHECK_RETURN(_expr_, _type_) if ((_expr_) == false) {ctx->error_func(ctx, __FUNCTION__, _type_);}
@@ -82,6 +103,7 @@ enum {
     _COPY_WRITE_BUFFER,
     _DISPATCH_INDIRECT_BUFFER,
     _DRAW_INDIRECT_BUFFER,
+    _PARAMETER_BUFFER,
     _MAX_BUFFER_TYPES
 };
 
@@ -202,6 +224,10 @@ typedef struct Buffer_t {
     GLsizeiptr mapped_offset;
     GLsizeiptr mapped_length;
     BufferData data;
+    struct BufferReadback_t *readback; // pending glReadPixels into this pack buffer
+    GLuint generation; // bumped when the contents change, keys translated index buffers
+    GLuint refcount; // texture buffers aliasing the store
+    GLboolean delete_status; // deleted while a texture still aliases it, freed on the last release
 } Buffer;
 
 typedef struct BufferBaseTarget_t {
@@ -239,7 +265,7 @@ typedef struct TextureParameter_t {
     GLenum  wrap_s;
     GLenum  wrap_t;
     GLenum  wrap_r;
-    void *mtl_data;
+    SamplerCacheEntry *sampler_entry;   // shared with every texture / sampler with the same key
 } TextureParameter;
 
 typedef struct TextureLevel_t {
@@ -272,7 +298,6 @@ typedef struct Sampler_t {
     GLuint dirty_bits;
     GLuint name;
     TextureParameter params;
-    void *mtl_data;
 } Sampler;
 
 typedef struct Texture_t {
@@ -300,6 +325,25 @@ typedef struct Texture_t {
     GLuint mipmap_levels;
     TextureFace faces[6];
     void    *mtl_data;
+    GLuint  mtl_generation;     // bumped each time mtl_data is recreated
+
+    // glTextureView, levels alias the parent's storage
+    // views of views are flattened so view_parent never is a view
+    struct Texture_t *view_parent;
+    GLuint  view_min_level;
+    GLuint  view_min_layer;
+    GLuint  view_num_layers;
+    GLuint  view_generation;    // parent mtl_generation the metal view was made from
+    GLuint  view_refcount;      // views aliasing this texture's storage
+    GLboolean delete_status;    // deleted while views alias it, storage goes with the last view
+    GLboolean has_format_views; // a view reinterprets the format, needs pixel format view usage
+
+    // glTexBuffer, the texture aliases a range of a buffer object
+    Buffer  *tex_buffer;
+    GLintptr tex_buffer_offset;
+    GLsizeiptr tex_buffer_size;
+    void    *tex_buffer_mtl;    // metal buffer the metal texture was made from
+    GLuint  tex_buffer_generation; // buffer generation a small buffer's copy was made from
 } Texture;
 
 typedef struct TextureUnit_t {
@@ -333,6 +377,7 @@ typedef struct VertexAttrib_t {
     GLuint  divisor;
     GLintptr  relativeoffset;
     GLuint  buffer_bindingindex;
+    const void *ptr;    // client array, buffer is NULL
 } VertexAttrib;
 
 typedef struct VertexElementArray_t {
@@ -344,8 +389,10 @@ typedef struct VertexElementArray_t {
 
 typedef struct VertexArray_t {
     GLuint dirty_bits;
+    GLuint generation;  // bumped on any attrib, enable or buffer binding change
     unsigned name;
     unsigned enabled_attribs;
+    unsigned client_attribs;    // attribs sourced from client memory, streamed at draw time
     VertexAttrib attrib[MAX_ATTRIBS];
     VertexElementArray element_array;
     void *mtl_data;
@@ -395,6 +442,27 @@ typedef struct SpirvResourceList_t {
     SpirvResource   *list;
 } SpirvResourceList;
 
+// resource types a program binds per draw, in the order the binders walk them
+enum {
+    _BINDING_UNIFORM_BUFFER = 0,
+    _BINDING_UNIFORM_CONSTANT,
+    _BINDING_STORAGE_BUFFER,
+    _BINDING_ATOMIC_COUNTER,
+    _BINDING_SAMPLED_IMAGE,
+    _BINDING_STORAGE_IMAGE,
+    _MAX_BINDING_TYPES
+};
+
+#define BINDING_MASK_WORDS  (TEXTURE_UNITS / 64)
+
+// spirv bindings of one resource type in one stage, built at link time so a draw
+// doesn't have to go back to the spirv resource lists
+typedef struct ProgramBindingTable_t {
+    GLuint      count;
+    GLubyte     slots[TEXTURE_UNITS];       // binding per resource, metal buffer indexes follow this order
+    GLuint64    used[BINDING_MASK_WORDS];   // bit per binding
+} ProgramBindingTable;
+
 typedef struct BufferMap_t {
     GLuint      buffer_base_index;
     GLuint      attribute_mask;
@@ -409,6 +477,7 @@ typedef struct BufferMapList_t {
 
 typedef struct Program_t {
     GLuint dirty_bits;
+    GLuint generation;  // bumped on attach, detach and link
     GLuint name;
     int refcount;
     GLboolean delete_status;
@@ -416,9 +485,12 @@ typedef struct Program_t {
     glslang_program_t *linked_glsl_program;
     Spirv spirv[_MAX_SHADER_TYPES];
     SpirvResourceList spirv_resources_list[_MAX_SHADER_TYPES][_MAX_SPIRV_RES];
+    ProgramBindingTable binding_tables[_MAX_SHADER_TYPES][_MAX_BINDING_TYPES];
     struct {
         unsigned x, y, z;
     } local_workgroup_size;
+    GLboolean link_status;  // GL_LINK_STATUS
+    char *info_log;         // why the last link failed, NULL when it didn't
     void *mtl_data;
 } Program;
 
@@ -428,6 +500,32 @@ typedef struct ProgramPipeline_t {
     Program *stage_programs[_MAX_SHADER_TYPES];  // Programs attached to each stage
 } ProgramPipeline;
 
+enum {
+    _SAMPLES_PASSED_QUERY = 0,
+    _ANY_SAMPLES_PASSED_QUERY,
+    _ANY_SAMPLES_PASSED_CONSERVATIVE_QUERY,
+    _PRIMITIVES_GENERATED_QUERY,
+    _TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_QUERY,
+    _TIME_ELAPSED_QUERY,
+    _MAX_QUERY_TARGETS
+};
+
+// render passes an occlusion query can span, each pass counts into its own slot
+#define MAX_QUERY_SEGMENTS  16
+
+typedef struct Query_t {
+    GLuint      name;
+    GLenum      target;         // 0 until the first begin
+    GLboolean   active;
+    GLboolean   available;      // result is final
+    GLuint64    result;
+    GLuint64    serial;         // backend command buffer the query ended in
+    GLuint64    begin_serial;   // timer queries span whole command buffers
+    GLuint64    primitives;     // counted as draws go by
+    GLuint      segments[MAX_QUERY_SEGMENTS];
+    GLuint      segment_count;
+} Query;
+
 typedef struct TransformFeedback_t {
     GLuint name;
     GLenum target;
@@ -449,8 +547,6 @@ typedef struct FBOAttachment_t {
     GLuint texture;
     GLuint level;
     GLuint layer;
-    GLbitfield clear_bitmask;
-    GLfloat clear_color[4];
     union {
         Texture *tex;
         Renderbuffer *rbo;
@@ -472,9 +568,11 @@ typedef struct Framebuffer_t {
     GLboolean default_fixed_sample_locations;
 } Framebuffer;
 
+// fences are points on the submission timeline of the context that inserted them
 typedef struct __GLsync {
-    GLsizei name;
-    void *mtl_event;
+    GLuint64    serial;         // signaled once the timeline reaches it
+    void        *mtl_event;     // the timeline, shared between contexts
+    GLuint      refcount;       // the table's plus one per wait or query in flight, under the table lock
 #ifdef __cplusplus
 } Sync;
 #else
@@ -503,6 +601,23 @@ typedef struct PixelStore_t {
     GLint alignment;
 } PixelStore;
 
+// glReadPixels readback, the gpu copies raw pixels into a staging buffer and
+// conversion to format / type happens when a pack buffer is mapped, or right
+// away for reads into client memory
+typedef struct BufferReadback_t {
+    GLboolean   pending;
+    void        *mtl_staging;       // retained MTLBuffer, reused across reads
+    void        *mtl_cmd_buffer;    // retained command buffer doing the copy
+    size_t      src_pitch;
+    GLuint      src_format;         // MTLPixelFormat of the staging pixels
+    size_t      offset;             // pack buffer offset given to glReadPixels
+    GLsizei     width;
+    GLsizei     height;
+    GLenum      format;
+    GLenum      type;
+    PixelStore  pack;
+} BufferReadback;
+
 
 enum {
     dirtyVAO = 0,
@@ -520,6 +635,12 @@ enum {
     dirtyAlphaState,
     dirtyImageUnit,
     dirtyBufferBase,
+    dirtyRenderPass,
+    dirtyPipelineState,
+    dirtyViewport,
+    dirtyDepthStencil,
+    dirtyRaster,
+    dirtyBlendColor,
     maxDirtyState,
     dirtyAllBit = 31
 };
@@ -535,18 +656,71 @@ enum {
 #define DIRTY_PROGRAM   (0x1 << dirtyProgram)
 #define DIRTY_FBO       (0x1 << dirtyFBO)
 #define DIRTY_DRAWABLE      (0x1 << dirtyDrawable)
-#define DIRTY_RENDER_STATE  (0x1 << dirtyRenderState)
-#define DIRTY_ALPHA_STATE   (0x1 << dirtyAlphaState)
+#define DIRTY_RENDER_STATE  (0x1 << dirtyRenderState)      // all of the encoder state below
+#define DIRTY_ALPHA_STATE   (0x1 << dirtyAlphaState)       // blend / color mask, part of the pipeline
 #define DIRTY_IMAGE_UNIT_STATE   (0x1 << dirtyImageUnit)
 #define DIRTY_BUFFER_BASE_STATE   (0x1 << dirtyBufferBase)
+#define DIRTY_RENDER_PASS   (0x1 << dirtyRenderPass)       // attachments of the default framebuffer changed
+#define DIRTY_PIPELINE_STATE   (0x1 << dirtyPipelineState) // fixed function state baked into the pipeline
+#define DIRTY_VIEWPORT      (0x1 << dirtyViewport)         // viewport, depth range, scissor
+#define DIRTY_DEPTH_STENCIL (0x1 << dirtyDepthStencil)     // depth / stencil tests, funcs, ops, masks and reference
+#define DIRTY_RASTER        (0x1 << dirtyRaster)           // cull, winding, depth clamp, fill mode
+#define DIRTY_BLEND_COLOR   (0x1 << dirtyBlendColor)
+
+// state categories, only a pass level change ends the current render encoder
+// dynamic state is set on the open encoder, pipeline state picks a new pipeline object
+#define DIRTY_PASS_BITS     (DIRTY_FBO | DIRTY_DRAWABLE | DIRTY_RENDER_PASS)
+#define DIRTY_DYNAMIC_BITS  (DIRTY_RENDER_STATE | DIRTY_VIEWPORT | DIRTY_DEPTH_STENCIL | DIRTY_RASTER | DIRTY_BLEND_COLOR)
+#define DIRTY_PIPELINE_BITS (DIRTY_PROGRAM | DIRTY_VAO | DIRTY_FBO | DIRTY_RENDER_PASS | DIRTY_ALPHA_STATE | DIRTY_PIPELINE_STATE)
 #define DIRTY_ALL_BIT   ((unsigned)0x1 << dirtyAllBit)    // so we know the dirty all was set.
 #define DIRTY_ALL       (0xFFFFFFFF)
 
+// the objects the last successful draw validation saw, a draw with the same tuple skips validation
+typedef struct DrawValidation_t {
+    VertexArray *vao;
+    GLuint      vao_generation;
+    Program     *program;
+    GLuint      program_generation;
+    GLuint      map_generation;
+    GLboolean   uses_elements;
+} DrawValidation;
+
 typedef struct {
     GLuint dirty_bits;
 
-    // clear request clear_bitmask from glClear to Metal
-    GLbitfield  clear_bitmask;
+    // clears and invalidates from gl turned into metal load / store actions
+    RenderPass  render_pass;
+
+    // backend samplers shared across textures and sampler objects with the same parameters
+    SamplerCache    sampler_cache;
+
+    // texture / sampler / buffer binding calls the last draw sent, slots the encoder already has are skipped
+    GLuint      binding_calls;
+    GLuint64    total_binding_calls;
+
+    // draw validation cache, any buffer map / unmap bumps map_generation
+    GLuint          object_generation;
+    GLuint          map_generation;
+    DrawValidation  last_validation;
+    GLuint64        validations;
+    GLuint64        validations_skipped;
+
+    // draws with no state change in between, flushed before the encoder state changes
+    DrawQueue       draw_queue;
+
+    // client arrays and indices copied for each draw that uses them
+    UploadRing      upload_ring;
+
+    // occlusion query counters
+    QueryPool       query_pool;
+
+    // frames in flight and per frame timing, owned by mtlSwapBuffers
+    FramePacing     frame_pacing;
+
+    // counters since the last MGLResetStats, frame_start is where they stood at the last swap
+    MGLStats        stats;
+    MGLStats        stats_frame_start;
+    MGLStats        stats_last_frame;
 
     // opengl state
 
@@ -576,8 +750,6 @@ typedef struct {
     Sampler     *texture_samplers[TEXTURE_UNITS];
     ImageUnit   image_units[TEXTURE_UNITS];
 
-    GLsizei sync_name;
-
     HashTable vao_table;
     HashTable buffer_table;
     HashTable texture_table;
@@ -588,11 +760,13 @@ typedef struct {
     HashTable renderbuffer_table;
     HashTable framebuffer_table;
     HashTable sampler_table;
+    HashTable query_table;
 
     Shader      *shaders[_MAX_SHADER_TYPES];
     Program     *program;
     ProgramPipeline *program_pipeline;
     TransformFeedback *transform_feedback;
+    Query       *active_queries[_MAX_QUERY_TARGETS];
 
     BufferBase  buffer_base[_MAX_BUFFER_TYPES];
 
@@ -632,8 +806,11 @@ struct GLMMetalFuncs {
 
     void (*mtlDeleteMTLObj)(GLMContext glm_ctx, void *obj);
 
-    void (*mtlGetSync)(GLMContext glm_ctx, Sync *sync);
-    void (*mtlWaitForSync)(GLMContext glm_ctx, Sync *sync);
+    bool (*mtlGetSync)(GLMContext glm_ctx, Sync *sync);
+    GLboolean (*mtlSyncSignaled)(GLMContext glm_ctx, Sync *sync);
+    GLenum (*mtlClientWaitSync)(GLMContext glm_ctx, Sync *sync, GLboolean flush, GLuint64 timeout);
+    void (*mtlWaitSync)(GLMContext glm_ctx, Sync *sync);
+    void (*mtlDeleteSync)(GLMContext glm_ctx, Sync *sync);
 
     void (*mtlFlush)(GLMContext glm_ctx, bool finish);
     void (*mtlSwapBuffers)(GLMContext glm_ctx);
@@ -646,7 +823,9 @@ struct GLMMetalFuncs {
     void *(*mtlMapUnmapBuffer)(GLMContext glm_ctx, Buffer *buf, size_t offset, size_t size, GLenum access, bool map);
     void (*mtlFlushBufferRange)(GLMContext glm_ctx, Buffer *buf, GLintptr offset, GLsizeiptr length);
 
-    void (*mtlReadDrawable)(GLMContext glm_ctx, void *pixelBytes, GLuint bytesPerRow, GLuint bytesPerImage, GLint x, GLint y, GLsizei width, GLsizei height);
+    bool (*mtlReadDrawableAsync)(GLMContext glm_ctx, BufferReadback *readback, GLint x, GLint y, GLsizei width, GLsizei height);
+    void *(*mtlReadbackData)(GLMContext glm_ctx, BufferReadback *readback, bool wait);
+    void (*mtlReadbackRelease)(GLMContext glm_ctx, BufferReadback *readback);
     void (*mtlGetTexImage)(GLMContext glm_ctx, Texture *tex, void *pixelBytes, GLuint bytesPerRow, GLuint bytesPerImage, GLint x, GLint y, GLsizei width, GLsizei height, GLuint level, GLuint slice);
 
     void (*mtlGenerateMipmaps)(GLMContext glm_ctx, Texture *tex);
@@ -682,12 +861,19 @@ struct GLMMetalFuncs {
     void (*mtlMultiDrawElements)(GLMContext ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
     void (*mtlMultiDrawElementsBaseVertex)(GLMContext ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
 
-    void (*mtlMultiDrawArraysIndirect)(GLMContext ctx, GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride);
-    void (*mtlMultiDrawElementsIndirect)(GLMContext ctx, GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+    // multi draw indirect, the draw count can come from the parameter buffer
+    void (*mtlMultiDrawIndirect)(GLMContext ctx, const MultiDrawIndirect *mdi);
 
 
     void (*mtlDispatchCompute)(GLMContext ctx, GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
     void (*mtlDispatchComputeIndirect)(GLMContext ctx, GLintptr indirect);
+
+    // query objects, results are polled without stalling unless wait is set
+    void (*mtlBeginQuery)(GLMContext ctx, Query *query);
+    void (*mtlEndQuery)(GLMContext ctx, Query *query);
+    GLboolean (*mtlGetQueryResult)(GLMContext ctx, Query *query, GLboolean wait);
+    void (*mtlQueryResultToBuffer)(GLMContext ctx, Query *query, Buffer *buf, GLintptr offset, GLboolean is64);
+    void (*mtlDeleteQuery)(GLMContext ctx, Query *query);
 } ;
 
 typedef struct GLMContextRec_t {
@@ -695,6 +881,10 @@ typedef struct GLMContextRec_t {
 
 #ifdef MGL_GL_CORE
     struct GLMDispatchTable dispatch;
+
+    // the entry points the capture wrappers forward to, ctx->capture is NULL when not capturing
+    struct GLMDispatchTable capture_dispatch;
+    struct Capture_t *capture;
 #endif
     
 #ifdef MGL_GL_ES
@@ -720,20 +910,15 @@ GLMContext createGLMContext(GLenum format, GLenum type,
                             GLenum depth_format, GLenum depth_type,
                             GLenum stencil_format, GLenum stencil_type);
 
+GLMContext createGLMContextWithFlags(GLenum format, GLenum type,
+                                     GLenum depth_format, GLenum depth_type,
+                                     GLenum stencil_format, GLenum stencil_type,
+                                     GLuint flags);
+
 void mgl_lazy_init(void);
 
 void MGLsetCurrentContext(GLMContext ctx);
 
-enum {
-    MGL_PIXEL_FORMAT,
-    MGL_PIXEL_TYPE,
-    MGL_DEPTH_FORMAT,
-    MGL_DEPTH_TYPE,
-    MGL_STENCIL_FORMAT,
-    MGL_STENCIL_TYPE,
-    MGL_CONTEXT_FLAGS
-};
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -742,6 +927,11 @@ GLuint sizeForFormatType(GLenum format, GLenum type);
 GLuint bicountForFormatType(GLenum format, GLenum type, GLenum component);
 GLMContext MGLgetCurrentContext(void);
 void MGLget(GLMContext ctx, GLenum param, GLuint *data);
+void MGLset(GLMContext ctx, GLenum param, GLuint data);
+void MGLGetStats(GLMContext ctx, MGLStats *stats, MGLStats *frame_stats);
+void MGLResetStats(GLMContext ctx);
+GLboolean MGLStartCapture(GLMContext ctx, const char *path);
+void MGLStopCapture(GLMContext ctx);
 bool pixelConvertToInternalFormat(GLMContext ctx, GLenum internalformat, GLenum format, GLenum type, const void *src, void *dst, size_t len);
 
 bool createTextureLevel(GLMContext ctx, Texture *tex, GLuint face, GLint level, GLboolean is_array, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void *pixels, GLboolean proxy);
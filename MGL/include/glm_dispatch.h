@@ -17,6 +17,7 @@
 typedef struct GLMContextRec_t *GLMContext;
 
 void init_dispatch(GLMContext ctx);
+void init_no_error_dispatch(GLMContext ctx);
 
 struct GLMDispatchTable {
         void  (*cull_face)(GLMContext ctx, GLenum mode);
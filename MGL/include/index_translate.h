@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * index_translate.h
+ * MGL
+ *
+ */
+
+#ifndef index_translate_h
+#define index_translate_h
+
+#include "glcorearb.h"
+
+// power of 2, sets of INDEX_CACHE_WAYS entries
+#define INDEX_CACHE_SIZE    64
+#define INDEX_CACHE_WAYS    4
+
+// a draw metal can't take as is, fans, loops, adjacency, byte indices or a restart index
+// metal doesn't know about
+typedef struct IndexSource_t {
+    GLenum      mode;
+    GLenum      type;           // 0 for array draws, the indices are first .. first + count - 1
+    const void  *indices;       // NULL for array draws
+    GLuint      first;
+    GLuint      count;
+    GLboolean   restart;
+    GLuint      restart_index;
+} IndexSource;
+
+// what the backend draws instead, always indexed, strips are split with the all ones index
+typedef struct IndexTranslation_t {
+    GLenum      mode;
+    GLenum      type;           // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    GLuint      count;
+} IndexTranslation;
+
+// everything the translated indices depend on, padding is part of the hash and compare
+typedef struct IndexCacheKey_t {
+    const void  *source;        // gl element buffer, NULL for array draws
+    GLuint      generation;     // of the source buffer
+    GLuint      count;
+    GLuint64    offset;         // byte offset into the source, first vertex for array draws
+    GLenum      mode;
+    GLenum      type;
+    GLuint      restart_index;  // 0 with restart off
+    GLboolean   restart;
+} IndexCacheKey;
+
+typedef struct IndexCacheEntry_t {
+    IndexCacheKey       key;
+    IndexTranslation    result;
+    void                *data;      // backend index buffer, NULL for an empty slot
+    GLuint64            last_used;
+} IndexCacheEntry;
+
+typedef struct IndexCache_t {
+    IndexCacheEntry     entries[INDEX_CACHE_SIZE];
+    GLuint64            clock;
+
+    GLuint64            hits;
+    GLuint64            misses;
+    GLuint64            indices_translated;
+} IndexCache;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// true when the draw needs translating before metal can draw it
+GLboolean indexTranslationNeeded(GLenum mode, GLenum type, GLboolean restart, GLuint restart_index);
+
+// the mode / type the backend draws and the exact number of indices translateIndices writes
+void indexTranslationPlan(const IndexSource *src, IndexTranslation *out);
+
+// writes out->count indices of out->type to dst, returns the count written
+GLuint translateIndices(const IndexSource *src, const IndexTranslation *out, void *dst);
+
+void initIndexCacheKey(IndexCacheKey *key, const void *source, GLuint generation, GLuint64 offset, const IndexSource *src);
+
+void initIndexCache(IndexCache *cache);
+
+// NULL on a miss
+IndexCacheEntry *indexCacheFind(IndexCache *cache, const IndexCacheKey *key);
+
+// the cache takes the reference to data, the least recently used entry of a full set is released
+IndexCacheEntry *indexCacheInsert(IndexCache *cache, const IndexCacheKey *key, const IndexTranslation *result,
+                                  void *data, void (*release)(void *data));
+
+void indexCacheClear(IndexCache *cache, void (*release)(void *data));
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* index_translate_h */
@@ -1074,6 +1074,23 @@ void mglMultiDrawArraysIndirectCount(GLMContext ctx, GLenum mode, const void *in
 void mglMultiDrawElementsIndirectCount(GLMContext ctx, GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
 void mglPolygonOffsetClamp(GLMContext ctx, GLfloat factor, GLfloat units, GLfloat clamp);
 
+// no error variants, skip argument validation
+void mglDrawArrays_no_error(GLMContext ctx, GLenum mode, GLint first, GLsizei count);
+void mglDrawElements_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices);
+void mglDrawRangeElements_no_error(GLMContext ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+void mglBindBuffer_no_error(GLMContext ctx, GLenum target, GLuint buffer);
+void mglBufferSubData_no_error(GLMContext ctx, GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+void mglUseProgram_no_error(GLMContext ctx, GLuint program);
+void mglUniform1f_no_error(GLMContext ctx, GLint location, GLfloat v0);
+void mglUniform4f_no_error(GLMContext ctx, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void mglUniform1i_no_error(GLMContext ctx, GLint location, GLint v0);
+void mglUniform4fv_no_error(GLMContext ctx, GLint location, GLsizei count, const GLfloat *value);
+void mglUniformMatrix4fv_no_error(GLMContext ctx, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void mglBindVertexArray_no_error(GLMContext ctx, GLuint array);
+void mglDrawArraysInstanced_no_error(GLMContext ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+void mglDrawElementsInstanced_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+void mglDrawElementsBaseVertex_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+
 #ifdef MGL_GL_ES
 void  mglBlendBarrier(GLMContext ctx);
 void mglPrimitiveBoundingBox(GLMContext ctx, GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * multi_draw_indirect.h
+ * MGL
+ *
+ */
+
+#ifndef multi_draw_indirect_h
+#define multi_draw_indirect_h
+
+#include "glcorearb.h"
+
+// fewer draws than this are cheaper issued one by one than ending the pass to encode them
+#define MDI_BATCH_MIN_DRAWS     16
+
+#define MDI_NO_COUNT_BUFFER     0xFFFFFFFF
+
+// a glMultiDraw*Indirect[Count] call, offsets are into the indirect and parameter buffers
+typedef struct MultiDrawIndirect_t {
+    GLenum      mode;
+    GLenum      type;           // 0 for array draws
+    GLuint64    offset;         // first command
+    GLuint      stride;         // never 0, tightly packed commands get the command size
+    GLuint      drawcount;      // maxdrawcount with a parameter buffer
+    GLuint64    count_offset;   // MDI_NO_COUNT_BUFFER without a parameter buffer
+} MultiDrawIndirect;
+
+// what the backend encode kernel reads, the layout is shared with the msl in MGLRenderer.m
+typedef struct MultiDrawIndirectParams_t {
+    GLuint      command_offset;
+    GLuint      stride;
+    GLuint      max_count;
+    GLuint      count_offset;
+    GLuint      primitive;      // backend primitive type
+    GLuint      pad[3];
+} MultiDrawIndirectParams;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sizeof DrawArraysIndirectCommand or DrawElementsIndirectCommand
+GLuint multiDrawIndirectCommandSize(GLenum type);
+
+void initMultiDrawIndirect(MultiDrawIndirect *mdi, GLenum mode, GLenum type, GLuint64 offset,
+                           GLuint drawcount, GLuint stride);
+
+// the draw count comes from the parameter buffer at offset, drawcount becomes the upper bound
+void multiDrawIndirectSetCountBuffer(MultiDrawIndirect *mdi, GLuint64 offset);
+
+GLuint64 multiDrawIndirectCommandOffset(const MultiDrawIndirect *mdi, GLuint i);
+
+// one past the last byte of the indirect buffer the draws can read, offset when there are none
+GLuint64 multiDrawIndirectEnd(const MultiDrawIndirect *mdi);
+
+// the number of draws issued given the parameter buffer contents, drawcount without one
+GLuint multiDrawIndirectCount(const MultiDrawIndirect *mdi, const void *count_data);
+
+// false when offsets don't fit the encode kernel's 32 bit params
+GLboolean multiDrawIndirectParams(const MultiDrawIndirect *mdi, GLuint primitive, MultiDrawIndirectParams *params);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* multi_draw_indirect_h */
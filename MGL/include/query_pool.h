@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * query_pool.h
+ * MGL
+ *
+ */
+
+#ifndef query_pool_h
+#define query_pool_h
+
+#include "glcorearb.h"
+
+// 64 bit counters in the backend visibility buffer
+#define QUERY_POOL_SLOTS    4096
+
+typedef struct QueryPoolRetired_t {
+    GLuint      slot;
+    GLuint64    serial;
+} QueryPoolRetired;
+
+// occlusion counters, a slot given back can still be written by the gpu so it waits in
+// retired until the command buffer with serial completes
+typedef struct QueryPool_t {
+    GLuint              free[QUERY_POOL_SLOTS];
+    GLuint              free_count;
+
+    QueryPoolRetired    retired[QUERY_POOL_SLOTS];      // fifo in serial order
+    GLuint              first_retired;
+    GLuint              retired_count;
+
+    GLushort            refs[QUERY_POOL_SLOTS];         // queries active at once share a slot
+
+    void                *mtl_data;                      // backend buffer, owned by the backend
+
+    GLuint64            allocations;
+    GLuint64            exhausted;
+} QueryPool;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initQueryPool(QueryPool *pool);
+
+// false when every slot is in use or still in flight, the slot has one reference
+GLboolean queryPoolAlloc(QueryPool *pool, GLuint64 completed, GLuint *slot);
+
+void queryPoolRetain(QueryPool *pool, GLuint slot);
+
+// the last reference retires the slot until serial completes
+void queryPoolRelease(QueryPool *pool, GLuint slot, GLuint64 serial);
+
+// primitives a draw of count vertices generates, 0 for patches
+GLuint64 primitiveCount(GLenum mode, GLuint count);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* query_pool_h */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * render_pass.h
+ * MGL
+ *
+ */
+
+#ifndef render_pass_h
+#define render_pass_h
+
+#include "glcorearb.h"
+#include "glm_limits.h"
+
+// attachment slots, color attachments first
+#define RENDER_PASS_DEPTH           MAX_COLOR_ATTACHMENTS
+#define RENDER_PASS_STENCIL         (MAX_COLOR_ATTACHMENTS + 1)
+#define RENDER_PASS_ATTACHMENTS     (MAX_COLOR_ATTACHMENTS + 2)
+
+#define RENDER_PASS_COLOR_MASK      ((0x1 << MAX_COLOR_ATTACHMENTS) - 1)
+#define RENDER_PASS_DEPTH_BIT       (0x1 << RENDER_PASS_DEPTH)
+#define RENDER_PASS_STENCIL_BIT     (0x1 << RENDER_PASS_STENCIL)
+
+// attachment history between encoder boundaries
+#define RENDER_PASS_CLEARED         0x01    // glClear / glClearBuffer since the last pass started
+#define RENDER_PASS_INVALIDATED     0x02    // contents discarded by glInvalidateFramebuffer
+#define RENDER_PASS_DRAWN           0x04    // written by a draw in the current pass
+
+// these mirror MTLLoadAction / MTLStoreAction without pulling in metal
+typedef enum {
+    RENDER_PASS_LOAD_DONT_CARE = 0,
+    RENDER_PASS_LOAD_LOAD,
+    RENDER_PASS_LOAD_CLEAR
+} RenderPassLoadAction;
+
+typedef enum {
+    RENDER_PASS_STORE_DONT_CARE = 0,
+    RENDER_PASS_STORE_STORE,
+    RENDER_PASS_STORE_RESOLVE,
+    RENDER_PASS_STORE_STORE_AND_RESOLVE
+} RenderPassStoreAction;
+
+typedef struct RenderPassActions_t {
+    GLbitfield  attachments;    // slots present in the pass
+    GLubyte     load[RENDER_PASS_ATTACHMENTS];
+    GLubyte     store[RENDER_PASS_ATTACHMENTS];
+    GLfloat     clear_color[MAX_COLOR_ATTACHMENTS][4];
+    GLdouble    clear_depth;
+    GLuint      clear_stencil;
+} RenderPassActions;
+
+typedef struct RenderPass_t {
+    GLboolean   active;
+    GLbitfield  attachments;
+    GLbitfield  resolve;        // multisample slots with a resolve target
+    GLubyte     pending[RENDER_PASS_ATTACHMENTS];   // applies to the load action of the next pass
+    GLubyte     current[RENDER_PASS_ATTACHMENTS];   // applies to the store action of the active pass
+
+    GLfloat     clear_color[MAX_COLOR_ATTACHMENTS][4];
+    GLdouble    clear_depth;
+    GLuint      clear_stencil;
+
+    // passes started since the last swap, and in the frame before it
+    GLuint      frame_passes;
+    GLuint      last_frame_passes;
+
+    // bandwidth saved, loads / stores turned into clear or dont care
+    GLuint64    passes;
+    GLuint64    loads_skipped;
+    GLuint64    stores_skipped;
+} RenderPass;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initRenderPass(RenderPass *pass);
+
+// glClear / glClearBuffer on the given slots, a clear inside an active pass needs a new pass
+void renderPassClearColor(RenderPass *pass, GLbitfield slots, const GLfloat color[4]);
+void renderPassClearDepth(RenderPass *pass, GLdouble depth);
+void renderPassClearStencil(RenderPass *pass, GLuint stencil);
+
+// glInvalidateFramebuffer, contents of the slots are undefined from here on
+void renderPassInvalidate(RenderPass *pass, GLbitfield slots);
+
+// a draw into the active pass
+void renderPassDraw(RenderPass *pass);
+
+// multisample slots resolved when the pass ends
+void renderPassSetResolve(RenderPass *pass, GLbitfield slots);
+
+// true when a clear is waiting on a pass to be applied
+GLboolean renderPassNeedsRestart(const RenderPass *pass);
+
+// the draw framebuffer changed, clears and invalidates still pending were for the old one
+void renderPassDropPending(RenderPass *pass);
+
+// start a pass on the attachments present, fills in the load actions and clear values
+void renderPassBegin(RenderPass *pass, GLbitfield attachments, RenderPassActions *actions);
+
+// end the active pass, fills in the store actions
+void renderPassEnd(RenderPass *pass, RenderPassActions *actions);
+
+// swap buffers, rolls frame_passes over into last_frame_passes
+void renderPassEndFrame(RenderPass *pass);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* render_pass_h */
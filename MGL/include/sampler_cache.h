@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * sampler_cache.h
+ * MGL
+ *
+ */
+
+#ifndef sampler_cache_h
+#define sampler_cache_h
+
+#include "glcorearb.h"
+
+#define SAMPLER_CACHE_BUCKETS   64
+
+struct GLMContextRec_t;
+struct TextureParameter_t;
+
+// everything a backend sampler is built from, textures and sampler objects with equal keys share one
+typedef struct SamplerKey_t {
+    GLenum      min_filter;
+    GLenum      mag_filter;
+    GLenum      wrap_s;
+    GLenum      wrap_t;
+    GLenum      wrap_r;
+    GLenum      compare_mode;
+    GLenum      compare_func;
+    GLfloat     min_lod;
+    GLfloat     max_lod;
+    GLfloat     lod_bias;
+    GLfloat     max_anisotropy;
+    GLfloat     border_color[4];
+    GLboolean   normalized_coords;  // false for rectangle textures
+} SamplerKey;
+
+typedef struct SamplerCacheEntry_t {
+    SamplerKey  key;
+    GLuint      hash;
+    GLuint      refcount;
+    void        *mtl_data;      // filled in by the backend on first use
+    struct SamplerCacheEntry_t *next;
+} SamplerCacheEntry;
+
+typedef struct SamplerCache_t {
+    SamplerCacheEntry   *buckets[SAMPLER_CACHE_BUCKETS];
+
+    GLuint      unique;         // live entries
+    GLuint64    requested;      // acquires, one per texture / sampler object (re)validation
+    GLuint64    created;        // entries ever created, backend samplers built
+} SamplerCache;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initSamplerKey(SamplerKey *key, const struct TextureParameter_t *params, GLenum target);
+
+// metal only takes unnormalized coordinates with clamp to edge
+GLboolean samplerNormalizedCoords(const struct TextureParameter_t *params, GLenum target);
+
+void initSamplerCache(SamplerCache *cache);
+
+// takes a reference, a new entry has mtl_data NULL
+SamplerCacheEntry *samplerCacheAcquire(SamplerCache *cache, const SamplerKey *key);
+
+// drops a reference, returns the backend sampler to delete once nothing uses it
+void *samplerCacheRelease(SamplerCache *cache, SamplerCacheEntry *entry);
+
+// drops the sampler a texture or sampler object holds, deleting the backend sampler with the last reference
+void releaseTexParamSampler(struct GLMContextRec_t *ctx, struct TextureParameter_t *params);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* sampler_cache_h */
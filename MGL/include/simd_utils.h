@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * simd_utils.h
+ * MGL
+ *
+ */
+
+#ifndef simd_utils_h
+#define simd_utils_h
+
+#include <stddef.h>
+
+#include "glcorearb.h"
+
+// 16 byte vectors, clang and gcc lower these to neon / sse
+typedef GLubyte     u8x16 __attribute__((vector_size(16)));
+typedef GLushort    u16x8 __attribute__((vector_size(16)));
+typedef GLushort    u16x16 __attribute__((vector_size(32)));
+typedef GLuint      u32x4 __attribute__((vector_size(16)));
+
+// FNV-1a over a cache key, the keys are zeroed before they're filled so padding hashes the same
+static inline GLuint hashBytes(const void *data, size_t size)
+{
+    const GLubyte *bytes;
+    GLuint hash;
+
+    bytes = (const GLubyte *)data;
+    hash = 2166136261u;
+
+    for(size_t i=0; i<size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+#endif /* simd_utils_h */
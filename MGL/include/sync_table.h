@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * sync_table.h
+ * MGL
+ *
+ */
+
+#ifndef sync_table_h
+#define sync_table_h
+
+#include "glcorearb.h"
+
+typedef struct SyncTableEntry_t {
+    void        *sync;
+    GLuint      generation;     // bumped on delete so stale handles don't match
+    GLuint      next_free;
+} SyncTableEntry;
+
+// GLsync handles are an index and a generation, never pointers, so a deleted or made up
+// handle is rejected without touching freed memory
+typedef struct SyncTable_t {
+    SyncTableEntry  *entries;
+    GLuint          size;
+    GLuint          count;          // live syncs
+    GLuint          first_free;     // index + 1, 0 when entries are all in use
+} SyncTable;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initSyncTable(SyncTable *table, GLuint size);
+
+// NULL when the table can't grow
+GLsync syncTableInsert(SyncTable *table, void *sync);
+
+void *syncTableLookup(SyncTable *table, GLsync handle);
+
+// the sync for the handle, which no longer matches anything
+void *syncTableRemove(SyncTable *table, GLsync handle);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* sync_table_h */
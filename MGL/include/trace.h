@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * trace.h
+ * MGL
+ *
+ */
+
+#ifndef trace_h
+#define trace_h
+
+#include "glcorearb.h"
+
+// events a thread can have waiting for the flusher, more are dropped rather than stall the caller
+#define TRACE_RING_EVENTS       8192
+
+// how often the flusher thread drains the rings
+#define TRACE_FLUSH_MS          50
+
+enum {
+    TRACE_GL,
+    TRACE_STATE,
+    TRACE_SHADER,
+    TRACE_SYNC,
+    TRACE_FRAME,
+    TRACE_CATEGORIES
+};
+
+typedef struct TraceEvent_t {
+    const char  *name;          // static storage, only the pointer is kept
+    GLuint      cat;
+    GLuint64    start;          // ns
+    GLuint64    end;
+} TraceEvent;
+
+// one per thread, the thread writes head and the flusher tail so neither takes a lock
+typedef struct TraceRing_t {
+    TraceEvent          events[TRACE_RING_EVENTS];
+    GLuint64            head;
+    GLuint64            tail;
+    GLuint64            dropped;
+    GLuint              tid;
+    GLboolean           named;      // thread_name metadata written
+    struct TraceRing_t  *next;
+} TraceRing;
+
+typedef struct TraceScope_t {
+    const char  *name;
+    GLuint      cat;
+    GLuint64    start;          // 0 when tracing was off as the scope opened
+} TraceScope;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int mgl_trace_enabled;
+
+// writes chrome trace event json to path, MGL_TRACE=path turns it on for a context
+void initTrace(const char *path);
+
+// drains every thread's ring into the file, the flusher thread calls this on its own
+void traceFlush(void);
+
+// flushes, terminates the json and stops tracing, runs at exit
+void traceShutdown(void);
+
+GLuint64 traceTime(void);
+void traceRecord(const char *name, GLuint cat, GLuint64 start, GLuint64 end);
+
+// events this thread lost to a full ring
+GLuint64 traceDropped(void);
+
+static inline TraceScope traceBegin(const char *name, GLuint cat)
+{
+    TraceScope scope = { name, cat, 0 };
+
+    if (__builtin_expect(__atomic_load_n(&mgl_trace_enabled, __ATOMIC_RELAXED), 0))
+        scope.start = traceTime();
+
+    return scope;
+}
+
+static inline void traceEnd(TraceScope *scope)
+{
+    if (__builtin_expect(scope->start != 0, 0))
+        traceRecord(scope->name, scope->cat, scope->start, traceTime());
+}
+
+#ifdef __cplusplus
+};
+#endif
+
+#define TRACE_CONCAT_(_a_, _b_)     _a_##_b_
+#define TRACE_CONCAT(_a_, _b_)      TRACE_CONCAT_(_a_, _b_)
+
+// traces until the end of the enclosing block, name has to outlive the trace
+#define TRACE_SCOPE(_name_, _cat_) \
+    TraceScope TRACE_CONCAT(_trace_scope_, __LINE__) __attribute__((cleanup(traceEnd))) = traceBegin(_name_, _cat_)
+
+// spec_parser puts one of these in every gl entry point
+#define TRACE_GL_CALL()     TRACE_SCOPE(__func__, TRACE_GL)
+
+#endif /* trace_h */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * upload_ring.h
+ * MGL
+ *
+ */
+
+#ifndef upload_ring_h
+#define upload_ring_h
+
+#include "glcorearb.h"
+
+#define UPLOAD_RING_SIZE        (4 * 1024 * 1024)
+#define UPLOAD_RING_FENCES      64
+
+// metal wants vertex buffer offsets on 4 bytes, 16 keeps every index and vertex format happy
+#define UPLOAD_RING_ALIGN       16
+
+// everything allocated up to end is in use until the command buffer with serial completes
+typedef struct UploadRingFence_t {
+    GLuint64    serial;
+    GLuint64    end;
+} UploadRingFence;
+
+// client arrays and indices copied per draw, head and tail only ever grow, the offset in
+// the backend buffer is the position modulo size
+typedef struct UploadRing_t {
+    GLuint64        size;
+    GLuint64        head;
+    GLuint64        tail;
+
+    UploadRingFence fences[UPLOAD_RING_FENCES];
+    GLuint          first_fence;
+    GLuint          fence_count;
+
+    void            *mtl_data;      // backend buffer of size bytes, owned by the backend
+
+    GLuint64        bytes_uploaded;
+    GLuint64        allocations;
+    GLuint64        grows;          // resets, the backend replaced a ring full of in flight data
+} UploadRing;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// min / max of the indices skipping the restart index, false when there is nothing but
+// restart indices, min / max are untouched then
+GLboolean scanIndexRange(GLenum type, const void *indices, GLuint count, GLboolean restart, GLuint restart_index,
+                         GLuint *min, GLuint *max);
+
+// dst = src - bias for 16 / 32 bit indices, with keep_restart the all ones index stays as it is
+// src and dst can be the same
+void rebaseIndices(GLenum type, const void *src, void *dst, GLuint count, GLuint bias, GLboolean keep_restart);
+
+void initUploadRing(UploadRing *ring, GLuint64 size);
+
+// forgets everything allocated, the backend buffer it was in has been replaced by one of size
+void uploadRingReset(UploadRing *ring, GLuint64 size);
+
+// allocations from here on belong to serial, false when out of fences
+GLboolean uploadRingFence(UploadRing *ring, GLuint64 serial);
+
+// frees what serials up to completed were using
+void uploadRingRetire(UploadRing *ring, GLuint64 completed);
+
+// the serial holding the oldest fence, 0 with nothing in flight
+GLuint64 uploadRingOldestSerial(UploadRing *ring);
+
+// false when the ring is full of in flight data, offset is into the backend buffer
+GLboolean uploadRingAlloc(UploadRing *ring, GLuint64 size, GLuint64 *offset);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* upload_ring_h */
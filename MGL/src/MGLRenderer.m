@@ -35,20 +35,22 @@
 
 #import "MGLRenderer.h"
 #import "glm_context.h"
+#import "pixel_formats.h"
+#import "depth_stencil_cache.h"
+#import "index_translate.h"
+#import "upload_ring.h"
+#import "multi_draw_indirect.h"
+#import "frame_pacing.h"
+#import "buffers.h"
 
 #define TRACE_FUNCTION()    DEBUG_PRINT("%s\n", __FUNCTION__);
 
 extern void mglDrawBuffer(GLMContext ctx, GLenum buf);
+extern GLsizei genStrideFromTypeSize(GLenum type, GLint size);
 
 // for resource types SPVC_RESOURCE_TYPE_UNIFORM_BUFFER..
 #import "spirv_cross_c.h"
 
-typedef struct SyncList_t {
-    GLuint count;
-    GLuint  size;
-    Sync **list;
-} SyncList;
-
 MTLPixelFormat mtlPixelFormatForGLTex(Texture * gl_tex);
 
 typedef struct MGLDrawable_t {
@@ -90,7 +92,47 @@ static inline id<NSObject> SafeMetalBridge(void *ptr, Class expectedClass, const
     return obj;
 }
 
+static MTLLoadAction mtlLoadActionForRenderPass(GLubyte action)
+{
+    switch(action)
+    {
+        case RENDER_PASS_LOAD_CLEAR: return MTLLoadActionClear;
+        case RENDER_PASS_LOAD_DONT_CARE: return MTLLoadActionDontCare;
+    }
+
+    return MTLLoadActionLoad;
+}
+
+static MTLStoreAction mtlStoreActionForRenderPass(GLubyte action)
+{
+    switch(action)
+    {
+        case RENDER_PASS_STORE_DONT_CARE: return MTLStoreActionDontCare;
+        case RENDER_PASS_STORE_RESOLVE: return MTLStoreActionMultisampleResolve;
+        case RENDER_PASS_STORE_STORE_AND_RESOLVE: return MTLStoreActionStoreAndMultisampleResolve;
+    }
+
+    return MTLStoreActionStore;
+}
+
+// gpu start / end of a completed command buffer in host seconds, indexed by serial
+#define GPU_TIMES   256
+
+typedef struct GPUTimes_t {
+    GLuint64        serial;
+    CFTimeInterval  start;
+    CFTimeInterval  end;
+} GPUTimes;
+
 // Main class performing the rendering
+// small buffers are copied into the encoder with set*Bytes, obj is the gl buffer for those
+typedef struct BoundBuffer_t {
+    void        *obj;
+    GLintptr    offset;
+    bool        bytes;
+    GLuint      generation;     // buffer generation the bytes were copied from
+} BoundBuffer;
+
 @implementation MGLRenderer
 {
     NSView *_view;
@@ -134,14 +176,52 @@ static inline id<NSObject> SafeMetalBridge(void *ptr, Class expectedClass, const
 
     // each pass a new command buffer is created
     id<MTLCommandBuffer> _currentCommandBuffer;
-    SyncList  *_currentCommandBufferSyncList;
 
     id<MTLRenderCommandEncoder> _currentRenderEncoder;
 
     GLuint _blitOperationComplete;
 
-    id<MTLEvent> _currentEvent;
-    GLsizei _currentSyncName;
+    // fences, signaled with each numbered command buffer's serial as it completes
+    id<MTLSharedEvent> _timeline;
+    MTLSharedEventListener *_timelineListener;
+
+    // MTLDepthStencilState objects keyed by the packed gl depth / stencil state
+    DepthStencilCache _depthStencilCache;
+
+    // index buffers for draws metal can't take as is, keyed by source buffer contents
+    IndexCache _indexCache;
+
+    // command buffers are numbered the first time something is fenced on them, completion
+    // handlers report the last serial done and its gpu times for timer queries
+    id<MTLCommandBuffer> _serialCommandBuffer;
+    GLuint64 _commandBufferSerial;
+    GLuint64 _completedSerial;
+    GPUTimes _gpuTimes[GPU_TIMES];
+
+    // occlusion query resolves into a query buffer
+    id<MTLComputePipelineState> _queryResolve;
+
+    // glMultiDraw*Indirect batches, a compute pass writes the gl commands into an indirect command buffer
+    bool _mdiSupported;
+    id<MTLComputePipelineState> _mdiEncodeArrays;
+    id<MTLComputePipelineState> _mdiEncodeElements16;
+    id<MTLComputePipelineState> _mdiEncodeElements32;
+    id<MTLArgumentEncoder> _mdiArgumentEncoder;
+    id<MTLIndirectCommandBuffer> _mdiCommands;
+    id<MTLBuffer> _mdiArguments;
+    NSUInteger _mdiCapacity;
+
+    // what the current render encoder has in each slot, only changes are sent
+    void *_boundFragmentTextures[TEXTURE_UNITS];
+    void *_boundFragmentSamplers[TEXTURE_UNITS];
+    BoundBuffer _boundVertexBuffers[MAX_MAPPED_BUFFERS];
+    BoundBuffer _boundFragmentBuffers[MAX_MAPPED_BUFFERS];
+
+    // a blocking readback can flush, which comes back through the buffer update paths
+    bool _resolvingReadback;
+
+    // a batched draw queue flush ends the pass, which flushes the queue again
+    bool _flushingDrawQueue;
 }
 
 MTLVertexFormat glTypeSizeToMtlType(GLuint type, GLuint size, bool normalized)
@@ -326,6 +406,12 @@ void logDirtyBits(GLMContext ctx)
             printDirtyBit(ctx->state.dirty_bits, DIRTY_ALPHA_STATE, "DIRTY_ALPHA_STATE ");
             printDirtyBit(ctx->state.dirty_bits, DIRTY_IMAGE_UNIT_STATE, "DIRTY_IMAGE_UNIT_STATE ");
             printDirtyBit(ctx->state.dirty_bits, DIRTY_BUFFER_BASE_STATE, "DIRTY_BUFFER_BASE_STATE ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_RENDER_PASS, "DIRTY_RENDER_PASS ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_PIPELINE_STATE, "DIRTY_PIPELINE_STATE ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_VIEWPORT, "DIRTY_VIEWPORT ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_DEPTH_STENCIL, "DIRTY_DEPTH_STENCIL ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_RASTER, "DIRTY_RASTER ");
+            printDirtyBit(ctx->state.dirty_bits, DIRTY_BLEND_COLOR, "DIRTY_BLEND_COLOR ");
         }
         DEBUG_PRINT("\n");
     }
@@ -407,6 +493,20 @@ void logDirtyBits(GLMContext ctx)
 
         ptr->data.mtl_data = (void *)CFBridgingRetain(buffer);
     }
+
+    STATS_ADD(allocations, 1);
+    STATS_ADD(bytes_allocated, ((__bridge id<MTLBuffer>)ptr->data.mtl_data).allocatedSize);
+}
+
+// binding tables of the current program, an empty table without one
+static const ProgramBindingTable *programBindingTable(GLMContext ctx, int stage, int type)
+{
+    static const ProgramBindingTable empty_table;
+
+    if (ctx->state.program == NULL)
+        return &empty_table;
+
+    return &ctx->state.program->binding_tables[stage][type];
 }
 
 - (bool) mapGLBuffersToMTLBufferMap:(BufferMapList *)buffer_map stage: (int) stage
@@ -414,14 +514,14 @@ void logDirtyBits(GLMContext ctx)
     int count;
     int mapped_buffers;
     struct {
-        int spvc_type;
+        int binding_type;
         int gl_buffer_type;
         const char *name;
     } mapped_types[4] = {
-        {SPVC_RESOURCE_TYPE_UNIFORM_BUFFER, _UNIFORM_BUFFER, "Uniform Buffer"},
-        {SPVC_RESOURCE_TYPE_UNIFORM_CONSTANT, _UNIFORM_CONSTANT, "Uniform Constant"},
-        {SPVC_RESOURCE_TYPE_STORAGE_BUFFER, _SHADER_STORAGE_BUFFER, "Shader Storage Buffer"},
-        {SPVC_RESOURCE_TYPE_ATOMIC_COUNTER, _ATOMIC_COUNTER_BUFFER, "Atomic Counter Buffer"}
+        {_BINDING_UNIFORM_BUFFER, _UNIFORM_BUFFER, "Uniform Buffer"},
+        {_BINDING_UNIFORM_CONSTANT, _UNIFORM_CONSTANT, "Uniform Constant"},
+        {_BINDING_STORAGE_BUFFER, _SHADER_STORAGE_BUFFER, "Shader Storage Buffer"},
+        {_BINDING_ATOMIC_COUNTER, _ATOMIC_COUNTER_BUFFER, "Atomic Counter Buffer"}
     };
 #if DEBUG_MAPPED_TYPES
     const char *stages[] = {"VERTEX_SHADER", "TESS_CONTROL_SHADER", "TESS_EVALUATION_SHADER",
@@ -434,56 +534,41 @@ void logDirtyBits(GLMContext ctx)
     // bind uniforms, shader storage and atomics to buffer map
     for(int type=0; type<4; type++)
     {
-        int spvc_type;
-        int gl_buffer_type;
+        const ProgramBindingTable *table;
+        BufferBaseTarget *buffers;
 
-        spvc_type = mapped_types[type].spvc_type;
-        gl_buffer_type = mapped_types[type].gl_buffer_type;
-        
-        count = [self getProgramBindingCount: stage type: spvc_type];
+        table = programBindingTable(ctx, stage, mapped_types[type].binding_type);
 
 #if DEBUG_MAPPED_TYPES
-        DEBUG_PRINT("Checking mapped_types: %s count:%d for stage: %s\n", mapped_types[type].name, count, stages[stage]);
+        DEBUG_PRINT("Checking mapped_types: %s count:%d for stage: %s\n", mapped_types[type].name, table->count, stages[stage]);
 #endif
-        
-        if (count)
-        {
-            BufferBaseTarget *buffers;
-            int buffers_to_be_mapped = count;
 
-            buffers = ctx->state.buffer_base[gl_buffer_type].buffers;
-            
-            for (int i=0; buffers_to_be_mapped; i++)
-            {
-                GLuint spirv_binding;
-                Buffer *buf;
+        buffers = ctx->state.buffer_base[mapped_types[type].gl_buffer_type].buffers;
 
-                // get the ubo binding from spirv
-                spirv_binding = [self getProgramBinding:stage type:spvc_type index: i];
+        // metal buffer indexes follow the order of the table
+        for (int i=0; i<table->count; i++)
+        {
+            GLuint spirv_binding;
+            Buffer *buf;
 
-                buf = buffers[spirv_binding].buf;
+            spirv_binding = table->slots[i];
 
-                if (buf)
-                {
-                    buffer_map->buffers[buffer_map->count].attribute_mask = 0; // non attribute.. no bits set
-                    buffer_map->buffers[buffer_map->count].buffer_base_index = spirv_binding;
-                    buffer_map->buffers[buffer_map->count].buf = buf;
-                    buffer_map->buffers[buffer_map->count].offset = buffers[spirv_binding].offset;
-                    buffer_map->count++;
-                    buffers_to_be_mapped--;
-                    
-                    //DEBUG_PRINT("Found buffer type: %s buffer_base_index: %d\n", mapped_types[type].name, spirv_binding);
-                }
-                else
-                {
-                    ctx->error_func(ctx, __FUNCTION__, GL_INVALID_OPERATION);
+            buf = buffers[spirv_binding].buf;
 
-                    return false;
-                }
+            if (buf == NULL)
+            {
+                ctx->error_func(ctx, __FUNCTION__, GL_INVALID_OPERATION);
 
-                // endless loop
-                RETURN_FALSE_ON_FAILURE(i < MAX_ATTRIBS);
+                return false;
             }
+
+            RETURN_FALSE_ON_FAILURE(buffer_map->count < MAX_MAPPED_BUFFERS);
+
+            buffer_map->buffers[buffer_map->count].attribute_mask = 0; // non attribute.. no bits set
+            buffer_map->buffers[buffer_map->count].buffer_base_index = spirv_binding;
+            buffer_map->buffers[buffer_map->count].buf = buf;
+            buffer_map->buffers[buffer_map->count].offset = buffers[spirv_binding].offset;
+            buffer_map->count++;
         }
     }
     
@@ -492,7 +577,7 @@ void logDirtyBits(GLMContext ctx)
     {
         int vao_buffer_start;
 
-        count = [self getProgramBindingCount: stage type: SPVC_RESOURCE_TYPE_STAGE_INPUT];
+        count = ctx->state.program ? ctx->state.program->spirv_resources_list[stage][SPVC_RESOURCE_TYPE_STAGE_INPUT].count : 0;
         mapped_buffers = 0;
 
         // vao buffers start after the uniforms and shader buffers
@@ -503,7 +588,6 @@ void logDirtyBits(GLMContext ctx)
                   buffer_map->count, ctx->state.max_vertex_attribs);
             return false;
         }
-        buffer_map->buffers[vao_buffer_start].buf = NULL;
 
         // create attribute map
         //
@@ -513,65 +597,55 @@ void logDirtyBits(GLMContext ctx)
         {
             if (VAO_STATE(enabled_attribs) & (0x1 << att))
             {
-                // CRITICAL SECURITY FIX: Check buffer instead of using assert()
-                if (!VAO_ATTRIB_STATE(att).buffer) {
-                    NSLog(@"MGL SECURITY ERROR: NULL buffer for enabled vertex attribute %d", att);
-                    return false;
-                }
-
-                // check all the buffers for metal objects
                 Buffer *gl_buffer;
-                Buffer *map_buffer;
+                bool found_buffer = false;
 
                 gl_buffer = VAO_ATTRIB_STATE(att).buffer;
 
-                // check start for map... then check
-                map_buffer = buffer_map->buffers[vao_buffer_start].buf;
+                // client arrays get a slot each, the draw binds the ring offset they were copied to
+                if (gl_buffer == NULL && (VAO_STATE(client_attribs) & (0x1 << att)) == 0) {
+                    NSLog(@"MGL SECURITY ERROR: NULL buffer for enabled vertex attribute %d", att);
+                    return false;
+                }
 
-                // empty slot map it here, only works on first buffer..
-                if (map_buffer == NULL)
+                // find vao attrib with same buffer
+                for (int map=vao_buffer_start;
+                     gl_buffer && (found_buffer == false) && map<buffer_map->count;
+                     map++)
                 {
-                    // map the buffer object to a metal vertex index
-                    assert(buffer_map->count < ctx->state.max_vertex_attribs);
-                    buffer_map->buffers[vao_buffer_start].attribute_mask |= (0x1 << att);
-                    buffer_map->buffers[vao_buffer_start].buf = gl_buffer;
-                    buffer_map->count++;
+                    Buffer *map_buffer;
 
-                    mapped_buffers++;
-                }
-                else
-                {
-                    bool found_buffer = false;
+                    map_buffer = buffer_map->buffers[map].buf;
 
-                    // find vao attrib with same buffer
-                    for (int map=vao_buffer_start;
-                         (found_buffer == false) && map<buffer_map->count;
-                         map++)
+                    // we need to check name and target, not pointers..
+                    // FIX ME: I think we don't need a target as all attribs should be an array_buffer
+                    if (map_buffer &&
+                        (map_buffer->name == gl_buffer->name) &&
+                        (map_buffer->target == gl_buffer->target))
                     {
-                        // we need to check name and target, not pointers..
-                        // FIX ME: I think we don't need a target as all attribs should be an array_buffer
-                        if ((map_buffer->name == gl_buffer->name) &&
-                            (map_buffer->target == gl_buffer->target))
-                        {
-                            // include it the list of attributes
-                            buffer_map->buffers[map].attribute_mask |= (0x1 << att);
-                            found_buffer = true;
-                            mapped_buffers++;
-                            break;
-                        }
+                        // include it the list of attributes
+                        buffer_map->buffers[map].attribute_mask |= (0x1 << att);
+                        found_buffer = true;
                     }
+                }
 
-                    if (found_buffer == false)
-                    {
-                        // map the next buffer object to a metal vertex index
-                        assert(buffer_map->count < ctx->state.max_vertex_attribs);
-                        buffer_map->buffers[buffer_map->count].attribute_mask = (0x1 << att);
-                        buffer_map->buffers[buffer_map->count].buf = gl_buffer;
-                        buffer_map->count++;
-
-                        mapped_buffers++;
+                if (found_buffer == false)
+                {
+                    // map the next buffer object to a metal vertex index
+                    if (buffer_map->count >= ctx->state.max_vertex_attribs) {
+                        NSLog(@"MGL SECURITY ERROR: buffer_map count %d exceeds max_vertex_attribs %d",
+                              buffer_map->count, ctx->state.max_vertex_attribs);
+                        return false;
                     }
+
+                    buffer_map->buffers[buffer_map->count].attribute_mask = (0x1 << att);
+                    buffer_map->buffers[buffer_map->count].buffer_base_index = 0;
+                    buffer_map->buffers[buffer_map->count].buf = gl_buffer;
+                    buffer_map->buffers[buffer_map->count].offset = 0;
+                    buffer_map->count++;
                 }
+
+                mapped_buffers++;
             }
 
             if ((VAO_STATE(enabled_attribs) >> (att+1)) == 0)
@@ -598,8 +672,21 @@ void logDirtyBits(GLMContext ctx)
     return true;
 }
 
+// glReadPixels into a buffer the gpu is about to read, convert it into place first
+- (void) resolveReadbackForGPU:(Buffer *)ptr
+{
+    if (ptr->readback == NULL || ptr->readback->pending == false || _resolvingReadback)
+        return;
+
+    _resolvingReadback = true;
+    resolveBufferReadback(ctx, ptr, true);
+    _resolvingReadback = false;
+}
+
 - (bool) updateDirtyBuffer:(Buffer *)ptr
 {
+    [self resolveReadbackForGPU: ptr];
+
     // buffers less than 4k will be uploaded using setVertexBytes
     if (ptr->size < 4096)
     {
@@ -713,25 +800,37 @@ void logDirtyBits(GLMContext ctx)
     BufferMap *map;
     Buffer *ptr;
     GLintptr offset;
-    
+    BoundBuffer *bound;
+
     assert(_currentRenderEncoder);
 
     for(int i=0; i<ctx->state.vertex_buffer_map_list.count; i++)
     {
         map = &ctx->state.vertex_buffer_map_list.buffers[i];
-        
+        bound = &_boundVertexBuffers[i];
+
         ptr = map->buf;
         offset = map->offset;
 
-        assert(ptr);
+        // client arrays, bound by the draw after they are streamed
+        if (ptr == NULL)
+            continue;
 
         // for buffers less than 4k we should use this call
         if (ptr->size < 4096)
         {
             assert(ptr->data.mtl_data == NULL);
 
+            // the encoder has a copy, only new data needs sending again, the dirty bit is
+            // shared with the other stage so the slot keeps the generation it copied
+            if (bound->bytes && bound->obj == ptr && bound->generation == ptr->generation)
+                continue;
+
             [_currentRenderEncoder setVertexBytes:(const void *)ptr->data.buffer_data length:ptr->size atIndex:i];
-            
+            STATE(binding_calls)++;
+
+            *bound = (BoundBuffer){ptr, 0, true, ptr->generation};
+
             // clear buffer data dirty bits
             ptr->data.dirty_bits &= ~DIRTY_BUFFER_DATA;
         }
@@ -739,10 +838,26 @@ void logDirtyBits(GLMContext ctx)
         {
             assert(ptr->data.mtl_data);
 
+            if (bound->bytes == false && bound->obj == ptr->data.mtl_data)
+            {
+                if (bound->offset != offset)
+                {
+                    [_currentRenderEncoder setVertexBufferOffset:offset atIndex:i];
+                    STATE(binding_calls)++;
+
+                    bound->offset = offset;
+                }
+
+                continue;
+            }
+
             id<MTLBuffer> buffer = (__bridge id<MTLBuffer>)(ptr->data.mtl_data);
             assert(buffer);
 
             [_currentRenderEncoder setVertexBuffer:buffer offset:offset atIndex:i ];
+            STATE(binding_calls)++;
+
+            *bound = (BoundBuffer){ptr->data.mtl_data, offset, false, 0};
         }
     }
 
@@ -754,12 +869,14 @@ void logDirtyBits(GLMContext ctx)
     BufferMap *map;
     Buffer *ptr;
     GLintptr offset;
-    
+    BoundBuffer *bound;
+
     assert(_currentRenderEncoder);
 
     for(int i=0; i<ctx->state.fragment_buffer_map_list.count; i++)
     {
         map = &ctx->state.fragment_buffer_map_list.buffers[i];
+        bound = &_boundFragmentBuffers[i];
 
         ptr = map->buf;
         offset = map->offset;
@@ -770,19 +887,41 @@ void logDirtyBits(GLMContext ctx)
         {
             assert(ptr->data.mtl_data == NULL);
 
+            if (bound->bytes && bound->obj == ptr && bound->generation == ptr->generation)
+                continue;
+
             [_currentRenderEncoder setFragmentBytes:(const void *)ptr->data.buffer_data length:ptr->size atIndex:i];
-            
+            STATE(binding_calls)++;
+
+            *bound = (BoundBuffer){ptr, 0, true, ptr->generation};
+
             // clear buffer data dirty bits
             ptr->data.dirty_bits &= ~DIRTY_BUFFER_DATA;
         }
         else
         {
             assert(ptr->data.mtl_data);
-            
+
+            if (bound->bytes == false && bound->obj == ptr->data.mtl_data)
+            {
+                if (bound->offset != offset)
+                {
+                    [_currentRenderEncoder setFragmentBufferOffset:offset atIndex:i];
+                    STATE(binding_calls)++;
+
+                    bound->offset = offset;
+                }
+
+                continue;
+            }
+
             id<MTLBuffer> buffer = (__bridge id<MTLBuffer>)(ptr->data.mtl_data);
             assert(buffer);
             
             [_currentRenderEncoder setFragmentBuffer:buffer offset:offset atIndex:i ];
+            STATE(binding_calls)++;
+
+            *bound = (BoundBuffer){ptr->data.mtl_data, offset, false, 0};
         }
     }
 
@@ -1058,6 +1197,12 @@ void logDirtyBits(GLMContext ctx)
         tex_desc.usage |= MTLTextureUsageRenderTarget;
     }
 
+    // a texture view reinterprets the format
+    if (tex->has_format_views)
+    {
+        tex_desc.usage |= MTLTextureUsagePixelFormatView;
+    }
+
     // CRITICAL FIX: Proper validation instead of assertions
     if (!tex_desc) {
         NSLog(@"MGL ERROR: Failed to create texture descriptor");
@@ -1086,6 +1231,9 @@ void logDirtyBits(GLMContext ctx)
         return NULL;
     }
 
+    STATS_ADD(allocations, 1);
+    STATS_ADD(bytes_allocated, texture.allocatedSize);
+
     if (tex->dirty_bits & DIRTY_TEXTURE_DATA)
     {
         NSLog(@"MGL DEBUG: DIRTY_TEXTURE_DATA detected - attempting texture filling");
@@ -1648,6 +1796,7 @@ void logDirtyBits(GLMContext ctx)
                                             BOOL hadRenderEncoder = (_currentRenderEncoder != nil);
                                             if (hadRenderEncoder) {
                                                 NSLog(@"MGL INFO: Ending render encoder temporarily for texture blit operation");
+                                                [self applyRenderPassStoreActions];
                                                 [_currentRenderEncoder endEncoding];
                                                 _currentRenderEncoder = nil;
                                             }
@@ -1672,6 +1821,7 @@ void logDirtyBits(GLMContext ctx)
                                             // CRITICAL FIX: Ensure no active encoders before creating blit encoder
                                             if (_currentRenderEncoder) {
                                                 NSLog(@"MGL WARNING: Active render encoder still detected during texture fill - ending encoder");
+                                                [self applyRenderPassStoreActions];
                                                 [_currentRenderEncoder endEncoding];
                                                 _currentRenderEncoder = nil;
                                             }
@@ -1725,6 +1875,7 @@ void logDirtyBits(GLMContext ctx)
                                             BOOL hadRenderEncoder = (_currentRenderEncoder != nil);
                                             if (hadRenderEncoder) {
                                                 NSLog(@"MGL INFO: Ending render encoder temporarily for fallback texture blit");
+                                                [self applyRenderPassStoreActions];
                                                 [_currentRenderEncoder endEncoding];
                                                 _currentRenderEncoder = nil;
                                             }
@@ -1970,67 +2121,20 @@ void logDirtyBits(GLMContext ctx)
 // Helper function to calculate bytes per pixel for different OpenGL formats
 - (NSUInteger)bytesPerPixelForFormat:(GLenum)internalformat
 {
-    switch(internalformat) {
-        case GL_RED:
-        case GL_R8:
-        case GL_R8I:
-        case GL_R8UI:
-            return 1;
-
-        case GL_RG:
-        case GL_RG8:
-        case GL_RG8I:
-        case GL_RG8UI:
-        case GL_R16:
-        case GL_R16F:
-            return 2;
-
-        case GL_RGB:
-        case GL_RGB8:
-        case GL_RGB8I:
-        case GL_RGB8UI:
-        case GL_SRGB8:
-        case GL_R11F_G11F_B10F:
-        case GL_RGB9_E5:
-            return 3;
-
-        case GL_RGBA:
-        case GL_RGBA8:
-        case GL_RGBA8I:
-        case GL_RGBA8UI:
-        case GL_RGB10_A2:
-        case GL_RGB10_A2UI:
-        case GL_SRGB8_ALPHA8:
-            return 4;
-
-        case GL_RGBA16:
-        case GL_RGBA16F:
-        case GL_R32F:
-            return 8;
-
-        case GL_RGB16:
-        case GL_RGB16F:
-            return 6;
-
-        case GL_RGBA16I:
-        case GL_RGBA16UI:
-            return 8;
-
-        case GL_RGB32F:
-        case GL_RGB32I:
-        case GL_RGB32UI:
-            return 12;
-
-        case GL_RGBA32F:
-        case GL_RGBA32I:
-        case GL_RGBA32UI:
-            return 16;
+    const PixelFormatDesc *desc;
 
-        default:
-            // Default to 4 bytes for unknown formats
-            NSLog(@"MGL WARNING: Unknown internal format 0x%x, defaulting to 4 bytes per pixel", internalformat);
-            return 4;
-    }
+    desc = pixelFormatDesc(internalformat);
+
+    if (desc && desc->pixel_size)
+        return desc->pixel_size;
+
+    // unsized formats are stored with 8 bit components
+    if (desc && (desc->flags & PIXEL_FORMAT_SIZED) == 0)
+        return desc->components;
+
+    // Default to 4 bytes for unknown formats
+    NSLog(@"MGL WARNING: Unknown internal format 0x%x, defaulting to 4 bytes per pixel", internalformat);
+    return 4;
 }
 
 - (id<MTLSamplerState>) createMTLSamplerForTexParam:(TextureParameter *)tex_param target:(GLuint)target
@@ -2248,79 +2352,143 @@ void logDirtyBits(GLMContext ctx)
     return sampler;
 }
 
-- (bool) bindTexturesToCurrentRenderEncoder
+- (void) releaseSamplerForTexParam:(TextureParameter *)params
+{
+    void *mtl_data;
+
+    if (params->sampler_entry == NULL)
+        return;
+
+    // the encoder keeps its own reference to anything already bound
+    mtl_data = samplerCacheRelease(&STATE(sampler_cache), params->sampler_entry);
+    params->sampler_entry = NULL;
+
+    if (mtl_data)
+    {
+        CFBridgingRelease(mtl_data);
+    }
+}
+
+- (id<MTLSamplerState>) samplerForTexParam:(TextureParameter *)params target:(GLuint)target
 {
-    GLuint count;
+    SamplerCacheEntry *entry;
+    SamplerKey key;
+
+    entry = params->sampler_entry;
+
+    // sampler objects can be used with any target, rectangles may need unnormalized coordinates
+    if (entry && entry->key.normalized_coords == samplerNormalizedCoords(params, target))
+    {
+        return (__bridge id<MTLSamplerState>)(entry->mtl_data);
+    }
+
+    initSamplerKey(&key, params, target);
+
+    // take the new reference first so a shared sampler isn't destroyed and rebuilt
+    entry = samplerCacheAcquire(&STATE(sampler_cache), &key);
+    if (entry == NULL)
+        return NULL;
+
+    [self releaseSamplerForTexParam: params];
+    params->sampler_entry = entry;
 
-    // iterate shader storage buffers
-    count = [self getProgramBindingCount: _FRAGMENT_SHADER type: SPVC_RESOURCE_TYPE_SAMPLED_IMAGE];
-    if (count)
+    if (entry->mtl_data)
+    {
+        STATS_ADD(sampler_cache_hits, 1);
+    }
+    else
     {
-        int textures_to_be_mapped = count;
+        id<MTLSamplerState> sampler;
+
+        STATS_ADD(sampler_creates, 1);
 
-        // something is very wrong..
-        assert(textures_to_be_mapped < TEXTURE_UNITS);
+        sampler = [self createMTLSamplerForTexParam:params target:target];
 
-        for (int i=0; textures_to_be_mapped > 0; i++)
+        // sampler creation should not fail even in recovery mode
+        if (sampler == NULL)
         {
-            RETURN_FALSE_ON_FAILURE(i < count);
+            NSLog(@"MGL WARNING: Sampler creation failed, using default");
+            sampler = [_device newSamplerStateWithDescriptor:[MTLSamplerDescriptor new]];
+        }
 
-            GLuint spirv_binding;
-            Texture *ptr;
+        entry->mtl_data = (void *)CFBridgingRetain(sampler);
 
-            spirv_binding = [self getProgramBinding:_FRAGMENT_SHADER type:SPVC_RESOURCE_TYPE_SAMPLED_IMAGE index: i];
+        DEBUG_PRINT("sampler cache unique: %d requested: %llu\n", STATE(sampler_cache).unique, STATE(sampler_cache).requested);
+    }
 
-            ptr = STATE(active_textures[spirv_binding]);
+    return (__bridge id<MTLSamplerState>)(entry->mtl_data);
+}
 
-            if (ptr)
-            {
-                id<MTLTexture> texture;
+- (id<MTLSamplerState>) samplerForTexture:(Texture *)ptr unit:(GLuint)unit
+{
+    Sampler *gl_sampler;
 
-                RETURN_FALSE_ON_FAILURE([self bindMTLTexture: ptr]);
-                assert(ptr->mtl_data);
+    // late binding of texture samplers.. but its better than scanning all texture_samplers
+    // texture samplers take priority over texture parameters
+    gl_sampler = STATE(texture_samplers[unit]);
 
-                texture = (__bridge id<MTLTexture>)(ptr->mtl_data);
-                assert(texture);
+    if (gl_sampler == NULL)
+        return [self samplerForTexParam:&ptr->params target:ptr->target];
 
-                id<MTLSamplerState> sampler;
+    // drop the shared sampler if the parameters changed
+    if (gl_sampler->dirty_bits)
+    {
+        [self releaseSamplerForTexParam: &gl_sampler->params];
+        gl_sampler->dirty_bits = 0;
+    }
 
-                // late binding of texture samplers.. but its better than scanning all texture_samplers
-                // texture samplers take priority over texture parameters
-                if(STATE(texture_samplers[spirv_binding]))
-                {
-                    Sampler *gl_sampler;
+    return [self samplerForTexParam:&gl_sampler->params target:ptr->target];
+}
 
-                    gl_sampler = STATE(texture_samplers[spirv_binding]);
+- (bool) bindTexturesToCurrentRenderEncoder
+{
+    const ProgramBindingTable *table;
 
-                    // delete existing sampler if dirty
-                    if (gl_sampler->dirty_bits)
-                    {
-                        if (gl_sampler->mtl_data)
-                        {
-                            CFBridgingRelease(gl_sampler->mtl_data);
-                            gl_sampler->mtl_data = NULL;
-                        }
-                    }
+    assert(_currentRenderEncoder);
 
-                    if (gl_sampler->mtl_data == NULL)
-                    {
-                        gl_sampler->mtl_data = (void *)CFBridgingRetain([self createMTLSamplerForTexParam:&gl_sampler->params target:ptr->target]);
-                        gl_sampler->dirty_bits = 0;
-                    }
+    table = programBindingTable(ctx, _FRAGMENT_SHADER, _BINDING_SAMPLED_IMAGE);
 
-                    sampler = (__bridge id<MTLSamplerState>)(gl_sampler->mtl_data);
-                    assert(sampler);
-                }
-                else
-                {
-                    sampler = (__bridge id<MTLSamplerState>)(ptr->params.mtl_data);
-                    assert(sampler);
-                }
+    for (int word=0; word<BINDING_MASK_WORDS; word++)
+    {
+        GLuint64 mask;
+
+        mask = table->used[word];
+
+        while (mask)
+        {
+            GLuint spirv_binding;
+            Texture *ptr;
+            id<MTLTexture> texture;
+            id<MTLSamplerState> sampler;
 
+            spirv_binding = word * 64 + __builtin_ctzll(mask);
+            mask &= mask - 1;
+
+            ptr = STATE(active_textures[spirv_binding]);
+            RETURN_FALSE_ON_NULL(ptr);
+
+            RETURN_FALSE_ON_FAILURE([self bindMTLTexture: ptr]);
+            assert(ptr->mtl_data);
+
+            texture = (__bridge id<MTLTexture>)(ptr->mtl_data);
+            sampler = [self samplerForTexture: ptr unit: spirv_binding];
+            assert(sampler);
+
+            // the encoder keeps whatever an earlier draw bound to the slot
+            if (_boundFragmentTextures[spirv_binding] != (__bridge void *)texture)
+            {
                 [_currentRenderEncoder setFragmentTexture:texture atIndex:spirv_binding];
+                STATE(binding_calls)++;
+
+                _boundFragmentTextures[spirv_binding] = (__bridge void *)texture;
+            }
+
+            if (_boundFragmentSamplers[spirv_binding] != (__bridge void *)sampler)
+            {
                 [_currentRenderEncoder setFragmentSamplerState:sampler atIndex:spirv_binding];
+                STATE(binding_calls)++;
 
-                textures_to_be_mapped--;
+                _boundFragmentSamplers[spirv_binding] = (__bridge void *)sampler;
             }
         }
     }
@@ -2425,67 +2593,223 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     return tex;
 }
 
-- (bool)bindMTLTexture:(Texture *)tex
+- (id<MTLTexture>) createMTLTextureViewFromGLTexture:(Texture *) tex
 {
-    if (tex->dirty_bits)
-    {
-        // release mtl data
-        if (tex->mtl_data)
-        {
-            CFBridgingRelease(tex->mtl_data);
-            tex->mtl_data = NULL;
-        }
+    Texture *parent;
+    MTLTextureType tex_type;
+    MTLPixelFormat pixelFormat;
 
-        if (tex->params.mtl_data)
-        {
-            CFBridgingRelease(tex->params.mtl_data);
-            tex->params.mtl_data = NULL;
-        }
+    parent = tex->view_parent;
+
+    id<MTLTexture> parent_texture = (__bridge id<MTLTexture>)(parent->mtl_data);
+    if (!parent_texture) {
+        NSLog(@"MGL ERROR: Texture view %d has no parent metal texture", tex->name);
+        return NULL;
     }
 
-    if (tex->mtl_data == NULL)
+    switch(tex->target)
     {
-        NSLog(@"MGL INFO: Creating MTL texture for texture (size: %dx%dx%d)", tex->width, tex->height, tex->depth);
+        case GL_TEXTURE_1D: tex_type = MTLTextureType2D; break;
+        case GL_TEXTURE_1D_ARRAY: tex_type = MTLTextureType1DArray; break;
+        case GL_TEXTURE_2D: tex_type = MTLTextureType2D; break;
+        case GL_TEXTURE_2D_ARRAY: tex_type = MTLTextureType2DArray; break;
+        case GL_TEXTURE_CUBE_MAP: tex_type = MTLTextureTypeCube; break;
+        case GL_TEXTURE_CUBE_MAP_ARRAY: tex_type = MTLTextureTypeCubeArray; break;
+        case GL_TEXTURE_3D: tex_type = MTLTextureType3D; break;
 
-        tex->mtl_data = (void *)CFBridgingRetain([self createMTLTextureFromGLTexture: tex]);
+        default:
+            NSLog(@"MGL ERROR: Unsupported texture view target 0x%x", tex->target);
+            return NULL;
+    }
 
-        // AGX-SAFE: Handle NULL texture gracefully when in GPU recovery mode
-        if (!tex->mtl_data) {
-            NSLog(@"MGL AGX: Primary texture creation returned NULL, attempting fallback texture creation");
-            // Create a simple fallback texture to prevent crashes
-            tex->mtl_data = (void *)CFBridgingRetain([self createFallbackMTLTexture: tex]);
+    pixelFormat = mtlPixelFormatForGLTex(tex);
 
-            if (tex->mtl_data) {
-                NSLog(@"MGL SUCCESS: Fallback texture created successfully");
-            } else {
-                NSLog(@"MGL ERROR: Even fallback texture creation failed - this texture will remain NULL");
-            }
-        } else {
-            NSLog(@"MGL SUCCESS: Primary texture created successfully");
-        }
+    // levels and slices are relative to the texture that owns the storage
+    id<MTLTexture> texture;
 
-        tex->params.mtl_data = (void *)CFBridgingRetain([self createMTLSamplerForTexParam:&tex->params target:tex->target]);
-        // Sampler creation should not fail even in recovery mode
-        if (!tex->params.mtl_data) {
-            NSLog(@"MGL WARNING: Sampler creation failed, using default");
-            tex->params.mtl_data = (void *)CFBridgingRetain([_device newSamplerStateWithDescriptor:[MTLSamplerDescriptor new]]);
-        }
+    @try {
+        texture = [parent_texture newTextureViewWithPixelFormat:pixelFormat
+                                                    textureType:tex_type
+                                                         levels:NSMakeRange(tex->view_min_level, tex->num_levels)
+                                                         slices:NSMakeRange(tex->view_min_layer, tex->view_num_layers)];
+    } @catch (NSException *exception) {
+        NSLog(@"MGL ERROR: Exception creating texture view: %@", exception);
+        return NULL;
     }
 
-    return true;
+    tex->view_generation = parent->mtl_generation;
+    tex->dirty_bits = 0;
+
+    return texture;
 }
 
-- (bool)bindActiveTexturesToMTL
+- (id<MTLTexture>) createMTLTextureBufferFromGLTexture:(Texture *) tex
 {
-    // search through active_texture_mask for enabled bits
-    // 128 bits long.. do it on 4 parts
-    for(int i=0; i<4; i++)
+    Buffer *buf;
+    MTLPixelFormat pixelFormat;
+    NSUInteger offset;
+
+    buf = tex->tex_buffer;
+    offset = tex->tex_buffer_offset;
+    pixelFormat = mtlPixelFormatForGLTex(tex);
+
+    id<MTLBuffer> buffer;
+
+    if (buf->size < 4096)
     {
-        unsigned mask = STATE(active_texture_mask[i]);
+        // small buffers are pushed with set*Bytes and never get a metal buffer,
+        // the texture gets a copy of the range, remade when the buffer changes
+        buffer = [_device newBufferWithBytes:(void *)(buf->data.buffer_data + offset)
+                                      length:tex->tex_buffer_size
+                                     options:MTLResourceStorageModeShared];
+        offset = 0;
 
-        if (mask)
-        {
-            for(int bitpos=0; bitpos<32; bitpos++)
+        tex->tex_buffer_mtl = NULL;
+        tex->tex_buffer_generation = buf->generation;
+    }
+    else
+    {
+        buffer = (__bridge id<MTLBuffer>)(buf->data.mtl_data);
+
+        tex->tex_buffer_mtl = buf->data.mtl_data;
+    }
+
+    if (!buffer) {
+        NSLog(@"MGL ERROR: Texture buffer %d has no metal buffer", tex->name);
+        return NULL;
+    }
+
+    if (offset % [_device minimumTextureBufferAlignmentForPixelFormat:pixelFormat]) {
+        NSLog(@"MGL ERROR: Texture buffer offset %lu not aligned for format 0x%lx", (unsigned long)offset, (unsigned long)pixelFormat);
+        return NULL;
+    }
+
+    MTLTextureDescriptor *tex_desc;
+    tex_desc = [MTLTextureDescriptor textureBufferDescriptorWithPixelFormat:pixelFormat
+                                                                       width:tex->width
+                                                             resourceOptions:buffer.resourceOptions
+                                                                       usage:MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite];
+
+    // the texture aliases the buffer's memory, writes through either are visible to both
+    id<MTLTexture> texture;
+    texture = [buffer newTextureWithDescriptor:tex_desc offset:offset bytesPerRow:tex->faces[0].levels[0].pitch];
+
+    tex->dirty_bits = 0;
+
+    return texture;
+}
+
+- (bool)bindMTLTexture:(Texture *)tex
+{
+    if (tex->view_parent)
+    {
+        RETURN_FALSE_ON_FAILURE([self bindMTLTexture: tex->view_parent]);
+
+        // the parent's metal texture was recreated, the view still points at the old one
+        if (tex->view_generation != tex->view_parent->mtl_generation)
+        {
+            tex->dirty_bits |= DIRTY_TEXTURE_LEVEL;
+        }
+    }
+    else if (tex->tex_buffer)
+    {
+        Buffer *buf;
+
+        buf = tex->tex_buffer;
+
+        [self resolveReadbackForGPU: buf];
+
+        if (buf->size < 4096)
+        {
+            // the copy is stale once the buffer contents change
+            if (tex->tex_buffer_generation != buf->generation)
+            {
+                tex->dirty_bits |= DIRTY_TEXTURE_DATA;
+            }
+        }
+        else
+        {
+            if (buf->data.mtl_data == NULL)
+            {
+                [self bindMTLBuffer: buf];
+                RETURN_FALSE_ON_NULL(buf->data.mtl_data);
+
+                buf->data.dirty_bits = 0;
+            }
+            else if (buf->data.dirty_bits)
+            {
+                RETURN_FALSE_ON_FAILURE([self updateDirtyBuffer: buf]);
+            }
+
+            // the buffer was respecified, the texture aliases its old memory
+            if (tex->tex_buffer_mtl != buf->data.mtl_data)
+            {
+                tex->dirty_bits |= DIRTY_TEXTURE_LEVEL;
+            }
+        }
+    }
+
+    if (tex->dirty_bits)
+    {
+        // release mtl data
+        if (tex->mtl_data)
+        {
+            CFBridgingRelease(tex->mtl_data);
+            tex->mtl_data = NULL;
+        }
+
+        [self releaseSamplerForTexParam: &tex->params];
+    }
+
+    if (tex->mtl_data == NULL)
+    {
+        NSLog(@"MGL INFO: Creating MTL texture for texture (size: %dx%dx%d)", tex->width, tex->height, tex->depth);
+
+        if (tex->view_parent)
+        {
+            tex->mtl_data = (void *)CFBridgingRetain([self createMTLTextureViewFromGLTexture: tex]);
+        }
+        else if (tex->tex_buffer)
+        {
+            tex->mtl_data = (void *)CFBridgingRetain([self createMTLTextureBufferFromGLTexture: tex]);
+        }
+        else
+        {
+            tex->mtl_data = (void *)CFBridgingRetain([self createMTLTextureFromGLTexture: tex]);
+        }
+
+        tex->mtl_generation++;
+
+        // AGX-SAFE: Handle NULL texture gracefully when in GPU recovery mode
+        if (!tex->mtl_data) {
+            NSLog(@"MGL AGX: Primary texture creation returned NULL, attempting fallback texture creation");
+            // Create a simple fallback texture to prevent crashes
+            tex->mtl_data = (void *)CFBridgingRetain([self createFallbackMTLTexture: tex]);
+
+            if (tex->mtl_data) {
+                NSLog(@"MGL SUCCESS: Fallback texture created successfully");
+            } else {
+                NSLog(@"MGL ERROR: Even fallback texture creation failed - this texture will remain NULL");
+            }
+        } else {
+            NSLog(@"MGL SUCCESS: Primary texture created successfully");
+        }
+    }
+
+    return true;
+}
+
+- (bool)bindActiveTexturesToMTL
+{
+    // search through active_texture_mask for enabled bits
+    // 128 bits long.. do it on 4 parts
+    for(int i=0; i<4; i++)
+    {
+        unsigned mask = STATE(active_texture_mask[i]);
+
+        if (mask)
+        {
+            for(int bitpos=0; bitpos<32; bitpos++)
             {
                 if (mask & (0x1 << bitpos))
                 {
@@ -2523,99 +2847,13 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 
 
 #pragma mark programs
-- (int) getProgramBindingCount: (int) stage type: (int) type
-{
-    Program *ptr;
-
-    assert(stage < _MAX_SPIRV_RES);
-    switch(type)
-    {
-        case SPVC_RESOURCE_TYPE_UNIFORM_BUFFER:
-        case SPVC_RESOURCE_TYPE_UNIFORM_CONSTANT:
-        case SPVC_RESOURCE_TYPE_STORAGE_BUFFER:
-        case SPVC_RESOURCE_TYPE_ATOMIC_COUNTER:
-        case SPVC_RESOURCE_TYPE_STAGE_INPUT:
-        case SPVC_RESOURCE_TYPE_SAMPLED_IMAGE:
-        case SPVC_RESOURCE_TYPE_STORAGE_IMAGE:
-            break;
-
-        default:
-           // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Unknown stage %d in getProgramBindingCount", stage);
-            return 0;
-    }
-
-    ptr = ctx->state.program;
-    if (ptr == NULL)
-        return 0;
-
-    return ptr->spirv_resources_list[stage][type].count;
-}
-
-- (int) getProgramBinding: (int) stage type: (int) type index: (int) index
-{
-    Program *ptr;
-
-    assert(stage < _MAX_SPIRV_RES);
-    switch(type)
-    {
-       case SPVC_RESOURCE_TYPE_UNIFORM_BUFFER:
-       case SPVC_RESOURCE_TYPE_UNIFORM_CONSTANT:
-       case SPVC_RESOURCE_TYPE_STORAGE_BUFFER:
-       case SPVC_RESOURCE_TYPE_ATOMIC_COUNTER:
-       case SPVC_RESOURCE_TYPE_STAGE_INPUT:
-       case SPVC_RESOURCE_TYPE_SAMPLED_IMAGE:
-       case SPVC_RESOURCE_TYPE_STORAGE_IMAGE:
-           break;
-
-       default:
-          // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return 0;
-    }
-
-    ptr = ctx->state.program;
-    assert(ptr);
-
-    assert(index < ptr->spirv_resources_list[stage][type].count);
-
-    return ptr->spirv_resources_list[stage][type].list[index].binding;
-}
-
-- (int) getProgramLocation: (int) stage type: (int) type index: (int) index
-{
-    Program *ptr;
-
-    assert(stage < _MAX_SPIRV_RES);
-    switch(type)
-    {
-       case SPVC_RESOURCE_TYPE_UNIFORM_BUFFER:
-       case SPVC_RESOURCE_TYPE_STORAGE_BUFFER:
-       case SPVC_RESOURCE_TYPE_ATOMIC_COUNTER:
-       case SPVC_RESOURCE_TYPE_STAGE_INPUT:
-       case SPVC_RESOURCE_TYPE_SAMPLED_IMAGE:
-       case SPVC_RESOURCE_TYPE_STORAGE_IMAGE:
-           break;
-
-       default:
-          // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return 0;
-    }
-
-    ptr = ctx->state.program;
-    assert(ptr);
-
-    assert(index < ptr->spirv_resources_list[stage][type].count);
-    
-    return ptr->spirv_resources_list[stage][type].list[index].location;
-}
-
 - (id<MTLLibrary>) compileShader: (const char *) str
 {
     id<MTLLibrary> library;
     __autoreleasing NSError *error = nil;
 
+    TRACE_SCOPE("newLibraryWithSource", TRACE_SHADER);
+
     library = [_device newLibraryWithSource: [NSString stringWithUTF8String: str] options: nil error: &error];
     if(!library) {
         NSLog(@"MGL ERROR: Failed to compile shader: %@ ", [error localizedDescription] );
@@ -2757,85 +2995,117 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 }
 
 #pragma mark render encoder and command buffer init code
-- (MTLStencilOperation) mtlStencilOpForGLOp:(GLenum) op
+static void releaseDepthStencilState(void *state)
 {
-    MTLStencilOperation stencil_op;
-
-    switch(ctx->state.var.stencil_fail)
-    {
-        case GL_KEEP: stencil_op = MTLStencilOperationKeep; break;
-        case GL_ZERO: stencil_op = MTLStencilOperationZero; break;
-        case GL_REPLACE: stencil_op = MTLStencilOperationReplace; break;
-        case GL_INCR: stencil_op = MTLStencilOperationIncrementClamp; break;
-        case GL_INCR_WRAP: stencil_op = MTLStencilOperationDecrementClamp; break;
-        case GL_DECR: stencil_op = MTLStencilOperationInvert; break;
-        case GL_DECR_WRAP: stencil_op = MTLStencilOperationIncrementWrap; break;
-        case GL_INVERT: stencil_op = MTLStencilOperationDecrementWrap; break;
-        default:
-            // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Unknown stencil operation 0x%x", op);
-            return MTLStencilOperationKeep;
-    }
+    CFBridgingRelease(state);
+}
 
-    return stencil_op;
+static void mtlStencilDescriptorForFace(MTLStencilDescriptor *sDesc, const DepthStencilFace *face)
+{
+    // the key already holds metal values
+    sDesc.stencilCompareFunction = (MTLCompareFunction)face->func;
+    sDesc.stencilFailureOperation = (MTLStencilOperation)face->fail;
+    sDesc.depthFailureOperation = (MTLStencilOperation)face->depth_fail;
+    sDesc.depthStencilPassOperation = (MTLStencilOperation)face->pass;
+    sDesc.readMask = face->read_mask;
+    sDesc.writeMask = face->write_mask;
 }
 
-- (void) updateCurrentRenderEncoder
+// a handful of configurations get reused all frame, look them up instead of creating a new state object
+- (id<MTLDepthStencilState>) depthStencilStateForCurrentState
 {
-    if (ctx->state.caps.depth_test ||
-        ctx->state.caps.stencil_test)
+    DepthStencilDesc desc;
+    GLuint64 key;
+    id<MTLDepthStencilState> dsState;
+
+    initDepthStencilDesc(&desc,
+                         ctx->state.caps.depth_test, ctx->state.var.depth_func, ctx->state.var.depth_writemask,
+                         ctx->state.caps.stencil_test,
+                         ctx->state.var.stencil_func, ctx->state.var.stencil_fail,
+                         ctx->state.var.stencil_pass_depth_fail, ctx->state.var.stencil_pass_depth_pass,
+                         ctx->state.var.stencil_value_mask, ctx->state.var.stencil_writemask,
+                         ctx->state.var.stencil_back_func, ctx->state.var.stencil_back_fail,
+                         ctx->state.var.stencil_back_pass_depth_fail, ctx->state.var.stencil_back_pass_depth_pass,
+                         ctx->state.var.stencil_back_value_mask, ctx->state.var.stencil_back_writemask);
+
+    key = packDepthStencilDesc(&desc);
+
+    dsState = (__bridge id<MTLDepthStencilState>)depthStencilCacheFind(&_depthStencilCache, key);
+    if (dsState)
     {
-        MTLDepthStencilDescriptor *dsDesc = [[MTLDepthStencilDescriptor alloc] init];
+        STATS_ADD(depth_stencil_cache_hits, 1);
 
-        // mtl maps directly to gl
-        if (ctx->state.caps.depth_test)
-        {
-            MTLCompareFunction depthCompareFunction;
+        return dsState;
+    }
 
-            depthCompareFunction = ctx->state.var.depth_func - GL_NEVER;
-            dsDesc.depthCompareFunction = depthCompareFunction;
+    STATS_ADD(depth_stencil_creates, 1);
 
-            dsDesc.depthWriteEnabled = ctx->state.var.depth_writemask;
-        }
+    // build from the key so the state always matches what it is cached under
+    unpackDepthStencilKey(key, &desc);
 
-        if (ctx->state.caps.stencil_test)
-        {
-            // mtl maps directly to gl
-            if (ctx->state.var.stencil_func != GL_NEVER)
-            {
-                MTLStencilDescriptor *frontSDesc = [[MTLStencilDescriptor alloc] init];
+    MTLDepthStencilDescriptor *dsDesc = [[MTLDepthStencilDescriptor alloc] init];
 
-                frontSDesc.stencilCompareFunction = ctx->state.var.stencil_func - GL_NEVER;
-                frontSDesc.stencilFailureOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_fail ];
-                frontSDesc.depthFailureOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_pass_depth_fail];
-                frontSDesc.depthStencilPassOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_pass_depth_pass];
-                frontSDesc.writeMask = ctx->state.var.stencil_writemask;
-                frontSDesc.readMask = ctx->state.var.stencil_value_mask;    // ????
+    dsDesc.depthCompareFunction = (MTLCompareFunction)desc.depth_func;
+    dsDesc.depthWriteEnabled = desc.depth_write;
 
-                dsDesc.frontFaceStencil = frontSDesc;
-            }
+    MTLStencilDescriptor *frontSDesc = [[MTLStencilDescriptor alloc] init];
+    MTLStencilDescriptor *backSDesc = [[MTLStencilDescriptor alloc] init];
 
-            if (ctx->state.var.stencil_func != GL_NEVER)
-            {
-                MTLStencilDescriptor *backSDesc = [[MTLStencilDescriptor alloc] init];
+    mtlStencilDescriptorForFace(frontSDesc, &desc.front);
+    mtlStencilDescriptorForFace(backSDesc, &desc.back);
 
-                backSDesc.stencilCompareFunction = ctx->state.var.stencil_back_func - GL_NEVER;
-                backSDesc.stencilFailureOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_back_fail ];
-                backSDesc.depthFailureOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_back_pass_depth_fail];
-                backSDesc.depthStencilPassOperation = [self mtlStencilOpForGLOp:ctx->state.var.stencil_back_pass_depth_pass];
-                backSDesc.writeMask = ctx->state.var.stencil_back_writemask;
-                backSDesc.readMask = ctx->state.var.stencil_back_value_mask;    // ????
+    dsDesc.frontFaceStencil = frontSDesc;
+    dsDesc.backFaceStencil = backSDesc;
 
-                dsDesc.backFaceStencil = backSDesc;
-            }
-        }
+    dsState = [_device newDepthStencilStateWithDescriptor:dsDesc];
+    if (dsState == NULL)
+    {
+        NSLog(@"MGL ERROR: newDepthStencilStateWithDescriptor failed for key 0x%llx", key);
+        return NULL;
+    }
+
+    depthStencilCacheInsert(&_depthStencilCache, key, (void *)CFBridgingRetain(dsState), releaseDepthStencilState);
+
+    return dsState;
+}
+
+// only the groups in dirty_bits are sent, DIRTY_RENDER_STATE sends all of them
+- (void) updateCurrentRenderEncoder: (GLuint) dirty_bits
+{
+    if (dirty_bits & DIRTY_RENDER_STATE)
+    {
+        dirty_bits |= DIRTY_DYNAMIC_BITS;
+    }
 
-        id <MTLDepthStencilState> dsState = [_device
-                                  newDepthStencilStateWithDescriptor:dsDesc];
+    if (dirty_bits & DIRTY_DEPTH_STENCIL)
+    {
+        [_currentRenderEncoder setDepthStencilState: [self depthStencilStateForCurrentState]];
+
+        [_currentRenderEncoder setStencilFrontReferenceValue: ctx->state.var.stencil_ref
+                                          backReferenceValue: ctx->state.var.stencil_back_ref];
+    }
+
+    if (dirty_bits & DIRTY_VIEWPORT)
+    {
+        [self updateCurrentRenderEncoderViewport];
+    }
+
+    if (dirty_bits & DIRTY_RASTER)
+    {
+        [self updateCurrentRenderEncoderRaster];
+    }
 
-        [_currentRenderEncoder setDepthStencilState: dsState];
+    if (dirty_bits & DIRTY_BLEND_COLOR)
+    {
+        [_currentRenderEncoder setBlendColorRed: ctx->state.var.blend_color[0]
+                                          green: ctx->state.var.blend_color[1]
+                                           blue: ctx->state.var.blend_color[2]
+                                          alpha: ctx->state.var.blend_color[3]];
     }
+}
 
+- (void) updateCurrentRenderEncoderViewport
+{
     if (ctx->state.caps.scissor_test)
     {
         MTLScissorRect rect;
@@ -2847,11 +3117,28 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 
         [_currentRenderEncoder setScissorRect:rect];
     }
+    else
+    {
+        id<MTLTexture> texture;
+
+        texture = _renderPassDescriptor.colorAttachments[0].texture;
+        if (texture == NULL)
+            texture = _renderPassDescriptor.depthAttachment.texture;
+
+        // scissor the whole render target
+        if (texture)
+        {
+            [_currentRenderEncoder setScissorRect:(MTLScissorRect){0, 0, texture.width, texture.height}];
+        }
+    }
 
     [_currentRenderEncoder setViewport:(MTLViewport){ctx->state.viewport[0], ctx->state.viewport[1],
                                         ctx->state.viewport[2], ctx->state.viewport[3],
                                         ctx->state.var.depth_range[0], ctx->state.var.depth_range[1]}];
+}
 
+- (void) updateCurrentRenderEncoderRaster
+{
     if (ctx->state.caps.cull_face)
     {
         MTLCullMode cull_mode;
@@ -2872,20 +3159,34 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 
         [_currentRenderEncoder setFrontFacingWinding:winding];
     }
+    else
+    {
+        [_currentRenderEncoder setCullMode:MTLCullModeNone];
+    }
 
     if (ctx->state.caps.depth_clamp)
     {
         [_currentRenderEncoder setDepthClipMode: MTLDepthClipModeClamp];
     }
+    else
+    {
+        [_currentRenderEncoder setDepthClipMode: MTLDepthClipModeClip];
+    }
 
     if (ctx->state.var.polygon_mode == GL_LINES)
     {
         [_currentRenderEncoder setTriangleFillMode: MTLTriangleFillModeLines];
     }
+    else
+    {
+        [_currentRenderEncoder setTriangleFillMode: MTLTriangleFillModeFill];
+    }
 }
 
 - (bool) newRenderEncoder
 {
+    TRACE_SCOPE("newRenderEncoder", TRACE_STATE);
+
     // I can't remember why this is here...
     @autoreleasepool {
 
@@ -3091,75 +3392,7 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         _renderPassDescriptor.renderTargetHeight = texture.height;
     }
 
-    // in case one of the framebuffers should be cleared
-    if (ctx->state.clear_bitmask)
-    {
-        if (ctx->state.clear_bitmask & GL_COLOR_BUFFER_BIT)
-        {
-            _renderPassDescriptor.colorAttachments[0].clearColor =
-                MTLClearColorMake(STATE(color_clear_value[0]),
-                                  STATE(color_clear_value[1]),
-                                  STATE(color_clear_value[2]),
-                                  STATE(color_clear_value[3]));
-
-            _renderPassDescriptor.colorAttachments[0].loadAction = MTLLoadActionClear;
-        }
-        else
-        {
-            _renderPassDescriptor.colorAttachments[0].loadAction = MTLLoadActionLoad;
-        }
-
-        if (ctx->state.framebuffer) {
-            Framebuffer * fbo = ctx->state.framebuffer;
-            for(int i=0; i<STATE(max_color_attachments);i++) {
-                FBOAttachment * fboa;
-                fboa = &fbo->color_attachments[i];
-                if (fboa->clear_bitmask & GL_COLOR_BUFFER_BIT) {
-                    _renderPassDescriptor.colorAttachments[i].clearColor =
-                        MTLClearColorMake(fboa->clear_color[0],
-                                        fboa->clear_color[1],
-                                        fboa->clear_color[2],
-                                        fboa->clear_color[3]);
-
-                    _renderPassDescriptor.colorAttachments[i].loadAction = MTLLoadActionClear;
-                } else {
-                    _renderPassDescriptor.colorAttachments[i].loadAction = MTLLoadActionLoad;
-                }
-            }
-        }
-
-        if (ctx->state.clear_bitmask & GL_DEPTH_BUFFER_BIT)
-        {
-            _renderPassDescriptor.depthAttachment.clearDepth = STATE_VAR(depth_clear_value);
-
-            _renderPassDescriptor.depthAttachment.loadAction = MTLLoadActionClear;
-        }
-        else
-        {
-            _renderPassDescriptor.depthAttachment.loadAction = MTLLoadActionLoad;
-        }
-
-        if (ctx->state.clear_bitmask & GL_STENCIL_BUFFER_BIT)
-        {
-            _renderPassDescriptor.stencilAttachment.clearStencil = STATE_VAR(stencil_clear_value);
-
-            _renderPassDescriptor.stencilAttachment.loadAction = MTLLoadActionClear;
-        }
-        else
-        {
-            _renderPassDescriptor.stencilAttachment.loadAction = MTLLoadActionLoad;
-        }
-
-        ctx->state.clear_bitmask = 0;
-    }
-    else
-    {
-        _renderPassDescriptor.colorAttachments[0].loadAction = MTLLoadActionLoad;
-        _renderPassDescriptor.depthAttachment.loadAction = MTLLoadActionLoad;
-        _renderPassDescriptor.stencilAttachment.loadAction = MTLLoadActionLoad;
-    }
-
-    _renderPassDescriptor.colorAttachments[0].storeAction = MTLStoreActionStore;
+    [self applyRenderPassLoadActions];
 
     // create a render encoder from the renderpass descriptor
     // CRITICAL SAFETY: Validate inputs before creating render encoder
@@ -3179,12 +3412,9 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     // Check if command buffer already has an active encoder (Metal API violation)
     if (_currentRenderEncoder) {
         NSLog(@"MGL WARNING: Active render encoder detected - ending it before creating new one");
-        @try {
-            [_currentRenderEncoder endEncoding];
-        } @catch (NSException *exception) {
-            NSLog(@"MGL WARNING: Exception ending existing encoder: %@", exception);
-        }
-        _currentRenderEncoder = nil;
+
+        // queued draws and store actions belong to the old pass
+        [self endRenderEncoding];
     }
 
     // Validate command buffer status - cannot create encoders on committed/buffer
@@ -3195,6 +3425,12 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         return false;
     }
 
+    // occlusion queries count into slots of the shared visibility buffer
+    if (STATE(query_pool).mtl_data)
+    {
+        _renderPassDescriptor.visibilityResultBuffer = (__bridge id<MTLBuffer>)STATE(query_pool).mtl_data;
+    }
+
     NSLog(@"MGL DEBUG: About to create render encoder with descriptor and command buffer");
     @try {
         _currentRenderEncoder = [_currentCommandBuffer renderCommandEncoderWithDescriptor: _renderPassDescriptor];
@@ -3206,6 +3442,8 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         }
         NSLog(@"MGL INFO: Successfully created Metal render encoder");
         [self recordGPUSuccess];
+
+        STATS_ADD(render_passes, 1);
     } @catch (NSException *exception) {
         NSLog(@"MGL ERROR: Exception creating render encoder: %@ - continuing with degraded functionality", exception);
         NSLog(@"MGL DEBUG: Exception details - name: %@, reason: %@", exception.name, exception.reason);
@@ -3215,8 +3453,20 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     }
     _currentRenderEncoder.label = @"GL Render Encoder";
 
+    // nothing is bound on a new encoder
+    bzero(_boundFragmentTextures, sizeof(_boundFragmentTextures));
+    bzero(_boundFragmentSamplers, sizeof(_boundFragmentSamplers));
+    bzero(_boundVertexBuffers, sizeof(_boundVertexBuffers));
+    bzero(_boundFragmentBuffers, sizeof(_boundFragmentBuffers));
+
     // apply all state that isn't included in a renderPassDescriptor into the render encoder
-    [self updateCurrentRenderEncoder];
+    [self updateCurrentRenderEncoder: DIRTY_RENDER_STATE];
+
+    // visibility results reset with each pass, active occlusion queries need a new slot
+    if (_renderPassDescriptor.visibilityResultBuffer)
+    {
+        [self startVisibilitySegment];
+    }
 
     // only bind all this if there is a VAO
     if (VAO())
@@ -3259,6 +3509,7 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     if (_currentRenderEncoder) {
         NSLog(@"MGL INFO: Ending existing render encoder before creating new command buffer");
         @try {
+            [self applyRenderPassStoreActions];
             [_currentRenderEncoder endEncoding];
             _currentRenderEncoder = nil;
         } @catch (NSException *exception) {
@@ -3267,76 +3518,6 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         }
     }
 
-    // STEP 1: Clean up any existing sync events safely
-    if (_currentCommandBufferSyncList)
-    {
-        // CRITICAL: Add thread synchronization for sync list access
-        if (_metalStateLock) {
-            [_metalStateLock lock];
-        }
-
-        GLuint count;
-        count = _currentCommandBufferSyncList->count;
-
-        for(GLuint i=0; i<count; i++)
-        {
-            Sync *sync;
-            sync = _currentCommandBufferSyncList->list[i];
-
-            // CRITICAL FIX: Validate sync pointer itself before dereferencing
-            if (!sync) {
-                NSLog(@"MGL WARNING: sync pointer is NULL at index %u - skipping", i);
-                continue;
-            }
-
-            // Validate sync pointer is within valid memory range
-            uintptr_t sync_addr = (uintptr_t)sync;
-            if (sync_addr < 0x1000 || sync_addr > 0x100000000000ULL) {
-                NSLog(@"MGL ERROR: Invalid sync pointer 0x%lx at index %u - skipping", sync_addr, i);
-                continue;
-            }
-
-            // CRITICAL FIX: Enhanced memory validation before CFBridgingRelease to prevent segmentation faults
-            if (sync->mtl_event) {
-                // Validate the mtl_event pointer is within valid memory range
-                uintptr_t event_addr = (uintptr_t)sync->mtl_event;
-                if (event_addr < 0x1000 || event_addr > 0x100000000000ULL) {
-                    NSLog(@"MGL ERROR: Invalid mtl_event pointer 0x%lx - skipping release", event_addr);
-                    sync->mtl_event = NULL; // Clear invalid pointer
-                    continue; // Skip this corrupted entry
-                }
-
-                // Additional validation: ensure the object is valid before release
-                @try {
-                    // Cast to id for Objective-C object validation
-                    id eventObj = (__bridge id)sync->mtl_event;
-
-                    // Test if the object is still valid by checking its class
-                    Class eventClass = [eventObj class];
-                    if (!eventClass) {
-                        NSLog(@"MGL WARNING: mtl_event object has no valid class - skipping release");
-                        sync->mtl_event = NULL;
-                        continue;
-                    }
-
-                    // Safe release with exception handling
-                    CFBridgingRelease(sync->mtl_event);
-                } @catch (NSException *exception) {
-                    NSLog(@"MGL WARNING: Exception releasing mtl_event: %@ - skipping", exception);
-                    // Continue without crashing - just clear the pointer
-                }
-
-                sync->mtl_event = NULL; // Prevent double-release
-            }
-        }
-
-        _currentCommandBufferSyncList->count = 0;
-
-        if (_metalStateLock) {
-            [_metalStateLock unlock];
-        }
-    }
-
     // CRITICAL SAFETY: Validate command queue before creating buffer
     if (!_commandQueue) {
         NSLog(@"MGL ERROR: Cannot create command buffer - command queue is NULL");
@@ -3439,69 +3620,6 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         return false;
     }
 
-    // STEP 2: Now handle pending event waits on the FRESH command buffer
-    if (_currentEvent)
-    {
-        assert(_currentSyncName);
-
-        // SAFELY ENCODE: Event wait functionality on the new command buffer
-        NSLog(@"MGL INFO: Encoding event wait on fresh command buffer");
-
-        // CRITICAL SAFETY: Cache event and sync values to prevent race conditions
-        id<MTLEvent> cachedEvent = _currentEvent;
-        GLuint cachedSyncName = _currentSyncName;
-
-        // COMPREHENSIVE EVENT VALIDATION: Validate Metal event pointer
-        if (!cachedEvent) {
-            NSLog(@"MGL ERROR: Cannot encode event wait - cached event is NULL");
-            _currentEvent = NULL;
-            _currentSyncName = 0;
-            return false;
-        }
-
-        // Validate event pointer looks like a valid object address
-        uintptr_t eventPtr = (uintptr_t)cachedEvent;
-        if (eventPtr == 0x10 || eventPtr == 0x30 || eventPtr == 0x1000) {
-            NSLog(@"MGL CRITICAL ERROR: Known corrupted event pointer pattern detected: 0x%lx", eventPtr);
-            NSLog(@"MGL CRITICAL ERROR: Skipping event wait to prevent crash");
-            _currentEvent = NULL;
-            _currentSyncName = 0;
-            return false;
-        }
-
-        if (eventPtr < 0x1000 || (eventPtr & 0x7) != 0) {
-            NSLog(@"MGL ERROR: Suspicious event pointer value: %p", cachedEvent);
-            NSLog(@"MGL INFO: Skipping event wait for safety");
-            _currentEvent = NULL;
-            _currentSyncName = 0;
-            return false;
-        }
-
-        // ADDITIONAL SAFETY: Validate command buffer is still valid before encoding
-        if (!_currentCommandBuffer) {
-            NSLog(@"MGL ERROR: Command buffer became NULL before event wait encoding");
-            _currentEvent = NULL;
-            _currentSyncName = 0;
-            return false;
-        }
-
-        @try {
-            NSLog(@"MGL INFO: Encoding safe event wait: event=%p, syncName=%u, cmdbuf=%p", cachedEvent, cachedSyncName, _currentCommandBuffer);
-
-            // Use conservative approach: only encode if everything looks perfect
-            [_currentCommandBuffer encodeWaitForEvent:cachedEvent value:cachedSyncName];
-
-            NSLog(@"MGL SUCCESS: Event wait encoded successfully on fresh command buffer");
-        } @catch (NSException *exception) {
-            NSLog(@"MGL ERROR: Event wait failed - %@: %@", exception.name, exception.reason);
-            NSLog(@"MGL INFO: Continuing without event wait to maintain stability");
-            // Continue without event wait - system remains stable
-        }
-
-        _currentEvent = NULL;
-        _currentSyncName = 0;
-    }
-
     return true;
 }
 
@@ -3584,6 +3702,7 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     pipelineStateDescriptor.label = @"GLSL Pipeline";
     pipelineStateDescriptor.vertexFunction = vertexFunction;
     pipelineStateDescriptor.fragmentFunction = fragmentFunction;
+    pipelineStateDescriptor.supportIndirectCommandBuffers = _mdiSupported;
 
     if (ctx->state.framebuffer)
     {
@@ -3684,7 +3803,8 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         {
             MTLVertexFormat format;
 
-            if (VAO_ATTRIB_STATE(i).buffer == NULL)
+            if (VAO_ATTRIB_STATE(i).buffer == NULL &&
+                (VAO_STATE(client_attribs) & (0x1 << i)) == 0)
             {
                 NSLog(@"Error: Invalid VAO defined enabled but no buffer bound\n");
                 return NULL;
@@ -3842,6 +3962,30 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     }
 }
 
+// bind the attachments of a newly bound or modified draw framebuffer
+- (bool) bindDirtyFramebuffer
+{
+    // MEMORY SAFETY: Add comprehensive validation to prevent use-after-free crashes
+    if (ctx->state.framebuffer == NULL)
+        return true;
+
+    // Validate framebuffer pointer is within reasonable bounds
+    uintptr_t fb_addr = (uintptr_t)ctx->state.framebuffer;
+    if (fb_addr < 0x1000 || fb_addr > 0x100000000000ULL) {
+        NSLog(@"MGL ERROR: Invalid framebuffer pointer detected: 0x%lx", fb_addr);
+        return false;
+    }
+
+    if (ctx->state.framebuffer->dirty_bits & DIRTY_FBO_BINDING)
+    {
+        RETURN_FALSE_ON_FAILURE([self bindFramebufferAttachmentTextures]);
+
+        ctx->state.framebuffer->dirty_bits &= ~DIRTY_FBO_BINDING;
+    }
+
+    return true;
+}
+
 -(bool)bindFramebufferAttachmentTextures
 {
     Framebuffer *fbo;
@@ -3913,8 +4057,103 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     return true;
 }
 
+- (void) applyRenderPassLoadActions
+{
+    GLbitfield attachments, resolve;
+    RenderPassActions actions;
+
+    attachments = 0;
+    resolve = 0;
+
+    for (int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
+    {
+        if (_renderPassDescriptor.colorAttachments[i].texture)
+            attachments |= (0x1 << i);
+
+        if (_renderPassDescriptor.colorAttachments[i].resolveTexture)
+            resolve |= (0x1 << i);
+    }
+
+    if (_renderPassDescriptor.depthAttachment.texture)
+        attachments |= RENDER_PASS_DEPTH_BIT;
+
+    if (_renderPassDescriptor.stencilAttachment.texture)
+        attachments |= RENDER_PASS_STENCIL_BIT;
+
+    renderPassSetResolve(&STATE(render_pass), resolve);
+    renderPassBegin(&STATE(render_pass), attachments, &actions);
+
+    // store actions are left unknown until endRenderEncoding, an invalidate
+    // after drawing can still turn them into dont care
+    for (int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
+    {
+        MTLRenderPassColorAttachmentDescriptor *color;
+
+        if ((attachments & (0x1 << i)) == 0)
+            continue;
+
+        color = _renderPassDescriptor.colorAttachments[i];
+        color.loadAction = mtlLoadActionForRenderPass(actions.load[i]);
+        color.clearColor = MTLClearColorMake(actions.clear_color[i][0],
+                                             actions.clear_color[i][1],
+                                             actions.clear_color[i][2],
+                                             actions.clear_color[i][3]);
+        color.storeAction = MTLStoreActionUnknown;
+    }
+
+    if (attachments & RENDER_PASS_DEPTH_BIT)
+    {
+        _renderPassDescriptor.depthAttachment.loadAction = mtlLoadActionForRenderPass(actions.load[RENDER_PASS_DEPTH]);
+        _renderPassDescriptor.depthAttachment.clearDepth = actions.clear_depth;
+        _renderPassDescriptor.depthAttachment.storeAction = MTLStoreActionUnknown;
+    }
+
+    if (attachments & RENDER_PASS_STENCIL_BIT)
+    {
+        _renderPassDescriptor.stencilAttachment.loadAction = mtlLoadActionForRenderPass(actions.load[RENDER_PASS_STENCIL]);
+        _renderPassDescriptor.stencilAttachment.clearStencil = actions.clear_stencil;
+        _renderPassDescriptor.stencilAttachment.storeAction = MTLStoreActionUnknown;
+    }
+}
+
+- (void) applyRenderPassStoreActions
+{
+    RenderPassActions actions;
+
+    if (ctx == NULL)
+        return;
+
+    // every path that ends the encoder comes through here
+    [self flushDrawQueue];
+
+    renderPassEnd(&STATE(render_pass), &actions);
+
+    if (_currentRenderEncoder == NULL)
+        return;
+
+    for (int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
+    {
+        if (actions.attachments & (0x1 << i))
+        {
+            [_currentRenderEncoder setColorStoreAction: mtlStoreActionForRenderPass(actions.store[i]) atIndex: i];
+        }
+    }
+
+    if (actions.attachments & RENDER_PASS_DEPTH_BIT)
+    {
+        [_currentRenderEncoder setDepthStoreAction: mtlStoreActionForRenderPass(actions.store[RENDER_PASS_DEPTH])];
+    }
+
+    if (actions.attachments & RENDER_PASS_STENCIL_BIT)
+    {
+        [_currentRenderEncoder setStencilStoreAction: mtlStoreActionForRenderPass(actions.store[RENDER_PASS_STENCIL])];
+    }
+}
+
 - (void) endRenderEncoding
 {
+    [self applyRenderPassStoreActions];
+
     if (_currentRenderEncoder)
     {
         @try {
@@ -3999,22 +4238,34 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
     }
 
     //logDirtyBits(ctx);
-    
-    // since a clear is embedded into a render encoder
-    if (VAO() == NULL)
+
+    TRACE_SCOPE("processGLState", TRACE_STATE);
+
+    // queued draws were recorded against the encoder state as it is now
+    [self flushDrawQueue];
+
+    if (VAO() == NULL && draw_command)
     {
-        if (draw_command)
-        {
-            NSLog(@"Error: No VAO defined for ctx\n");
+        NSLog(@"Error: No VAO defined for ctx\n");
 
-            // quietly return if we are not in a draw command with no vao defined
-            // like a clear or init call
-            return false;
-        }
+        // quietly return if we are not in a draw command with no vao defined
+        // like a clear or init call
+        return false;
+    }
 
-        // for a clear flush sequence...
-        if (ctx->state.dirty_bits & DIRTY_STATE)
+    // only draw commands need a functioning render encoder
+    // this can mess up a transition between compute and rendering on a flush
+    // so just return
+    // we may have to create a blank render encoder to safely run compute and
+    // rendering correctly
+    if (draw_command == false)
+    {
+        // since a clear is embedded into a render encoder a pending clear still needs a pass
+        // glClear / glSwap / repeat..
+        if (renderPassNeedsRestart(&STATE(render_pass)))
         {
+            RETURN_FALSE_ON_FAILURE([self bindDirtyFramebuffer]);
+
             // RESTORED: Attempt render encoder creation with improved error handling
             NSLog(@"MGL INFO: RESTORED - Attempting newRenderEncoder with GPU throttling protection");
 
@@ -4024,7 +4275,6 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
             // Use GPU throttling to prevent crashes when creating new render encoder
             if (![self validateMetalObjects]) {
                 NSLog(@"MGL WARNING: GPU throttling active - deferring render encoder creation");
-                ctx->state.dirty_bits &= ~DIRTY_STATE;
                 return true;
             }
 
@@ -4039,24 +4289,11 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
                 NSLog(@"MGL ERROR: Render encoder creation failed: %@", exception);
                 NSLog(@"MGL INFO: Continuing without render encoder for stability");
             }
-
-            // Clear the dirty bit to prevent repeated attempts
-            ctx->state.dirty_bits &= ~DIRTY_STATE;
         }
 
         return true;
     }
 
-    // only draw commands need a functioning render encoder
-    // this can mess up a transition between compute and rendering on a flush
-    // so just return
-    // we may have to create a blank render encoder to safely run compute and
-    // rendering correctly
-    if (draw_command == false)
-    {
-        return true;
-    }
-
     // MEMORY SAFETY: Validate context before use
     if (!ctx) {
         NSLog(@"MGL ERROR: NULL context detected in processGLState");
@@ -4070,40 +4307,26 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         return false;
     }
 
+    // counts the binding calls this draw needs
+    STATE(binding_calls) = 0;
+
     if (ctx->state.dirty_bits)
     {
-        // dirty state covers all rendering attachments and general state
-        if (ctx->state.dirty_bits & DIRTY_STATE)
-        {
-            if (ctx->state.dirty_bits & DIRTY_FBO)
-            {
-                // MEMORY SAFETY: Add comprehensive validation to prevent use-after-free crashes
-                if (ctx->state.framebuffer)
-                {
-                    // Validate framebuffer pointer is within reasonable bounds
-                    uintptr_t fb_addr = (uintptr_t)ctx->state.framebuffer;
-                    if (fb_addr < 0x1000 || fb_addr > 0x100000000) {
-                        NSLog(@"MGL ERROR: Invalid framebuffer pointer detected: 0x%lx", fb_addr);
-                        return false;
-                    }
-
-                    if (ctx->state.framebuffer->dirty_bits & DIRTY_FBO_BINDING)
-                    {
-                        RETURN_FALSE_ON_FAILURE([self bindFramebufferAttachmentTextures]);
+        STATS_ADD(state_updates, 1);
 
-                        // Additional validation after binding
-                        if (ctx->state.framebuffer) {  // Re-validate in case binding corrupted memory
-                            ctx->state.framebuffer->dirty_bits &= ~DIRTY_FBO_BINDING;
-                        }
-                    }
-                }
+        // pass level state, the attachments changed so nothing more goes into the current pass
+        if (ctx->state.dirty_bits & DIRTY_PASS_BITS)
+        {
+            RETURN_FALSE_ON_FAILURE([self bindDirtyFramebuffer]);
 
-                // dirty FBO state can't be cleared just yet its needed below
-            }
+            [self endRenderEncoding];
 
-            ctx->state.dirty_bits &= ~DIRTY_STATE;
+            // dirty FBO state can't be cleared just yet its needed by the pipeline below
+            ctx->state.dirty_bits &= ~DIRTY_DRAWABLE;
         }
 
+        ctx->state.dirty_bits &= ~DIRTY_STATE;
+
         // check for dirty program and vao
         // leave program / vao state dirty, buffers need to be mapped before used below
         // dirty program causes buffers to be remapped
@@ -4114,6 +4337,8 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
             // programs are now compiled before execution, we shouldn't get here
             //assert(ctx->state.program->mtl_data); //
 
+            TRACE_SCOPE("mapBuffersToMTL", TRACE_STATE);
+
             // figure out vertex shader uniforms / buffer mappings
             RETURN_FALSE_ON_FAILURE([self mapBuffersToMTL]);
 
@@ -4123,59 +4348,55 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         // dirty tex covers all texture modifications
         if (ctx->state.dirty_bits & (DIRTY_PROGRAM | DIRTY_TEX | DIRTY_TEX_BINDING | DIRTY_SAMPLER))
         {
+            TRACE_SCOPE("bindTextures", TRACE_STATE);
+
             RETURN_FALSE_ON_FAILURE([self bindActiveTexturesToMTL]);
-            RETURN_FALSE_ON_FAILURE([self bindTexturesToCurrentRenderEncoder]);
+
+            // a new encoder binds these when it is created
+            if (_currentRenderEncoder)
+            {
+                RETURN_FALSE_ON_FAILURE([self bindTexturesToCurrentRenderEncoder]);
+            }
 
             // textures / active textures and samplers are all handled in bindActiveTexturesToMTL
             ctx->state.dirty_bits &= ~(DIRTY_TEX | DIRTY_TEX_BINDING | DIRTY_SAMPLER);
         }
 
-        // a dirty vao needs to update the render encoder and buffer list
-        if (ctx->state.dirty_bits & DIRTY_VAO)
+        // a dirty vao only needs its buffers bound, the pass stays open
+        if (ctx->state.dirty_bits & (DIRTY_VAO | DIRTY_BUFFER))
         {
-            // we have a dirty VAO, all the renderbuffer bindings are invalid so we need a new renderbuffer
-            // with new renderbuffer bindings
-
-            // always end encoding and start a new encoder and bind new vertex buffers
-            // end encoding on current render encoder
-            [self endRenderEncoding];
+            TRACE_SCOPE("bindBuffers", TRACE_STATE);
 
             // updateDirtyBaseBufferList binds new mtl buffers or updates old ones
             RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.vertex_buffer_map_list]);
             RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.fragment_buffer_map_list]);
 
-            // get a new renderer encoder
-            RETURN_FALSE_ON_FAILURE([self newRenderEncoder]);
-
-            // clear dirty render state
-            ctx->state.dirty_bits &= ~DIRTY_RENDER_STATE;
-        }
-        else if (ctx->state.dirty_bits & DIRTY_BUFFER)
-        {
-            // updateDirtyBaseBufferList binds new mtl buffers or updates old ones
-            RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.vertex_buffer_map_list]);
-            RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.fragment_buffer_map_list]);
+            // a new encoder binds these when it is created
+            if (_currentRenderEncoder)
+            {
+                RETURN_FALSE_ON_FAILURE([self bindVertexBuffersToCurrentRenderEncoder]);
+                RETURN_FALSE_ON_FAILURE([self bindFragmentBuffersToCurrentRenderEncoder]);
+            }
 
             ctx->state.dirty_bits &= ~DIRTY_BUFFER;
         }
-        else if (ctx->state.dirty_bits & DIRTY_RENDER_STATE)
+
+        // dynamic state is set on the open encoder, newRenderEncoder sets it on a new one
+        if (ctx->state.dirty_bits & DIRTY_DYNAMIC_BITS)
         {
-            if (_currentRenderEncoder == NULL)
+            if (_currentRenderEncoder)
             {
-                RETURN_FALSE_ON_FAILURE([self newRenderEncoder]);
+                [self updateCurrentRenderEncoder: ctx->state.dirty_bits];
             }
 
-            // a dirty render state may just be something like alpha changes which don't require a new renderbuffer
-
-            // updateCurrentRenderEncoder will update the renderstate outside of creating a new one
-            [self updateCurrentRenderEncoder];
-
-            ctx->state.dirty_bits &= ~DIRTY_RENDER_STATE;
+            ctx->state.dirty_bits &= ~DIRTY_DYNAMIC_BITS;
         }
 
-        // new pipeline / vertex / renderbuffer and pipelinestate descriptor, should probably make this a single dirty bit
-        if (ctx->state.dirty_bits & (DIRTY_PROGRAM | DIRTY_VAO | DIRTY_FBO | DIRTY_ALPHA_STATE | DIRTY_RENDER_STATE))
+        // pipeline level state, new pipeline / vertex descriptor
+        if (ctx->state.dirty_bits & DIRTY_PIPELINE_BITS)
         {
+            TRACE_SCOPE("newRenderPipelineState", TRACE_STATE);
+
             // create pipeline descriptor
             MTLRenderPipelineDescriptor *pipelineStateDescriptor;
 
@@ -4205,6 +4426,9 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 
             // PROPER AGX VIRTUALIZATION COMPATIBILITY: Fix root cause while maintaining Metal functionality
             NSError *error;
+            GLuint64 pipelineStart;
+
+            pipelineStart = STATS_TIME();
 
             @try {
                 NSLog(@"MGL INFO: Creating Metal pipeline state with AGX virtualization compatibility...");
@@ -4297,7 +4521,10 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
                 NSLog(@"MGL INFO: Pipeline state created successfully");
             }
 
-            ctx->state.dirty_bits &= ~(DIRTY_PROGRAM | DIRTY_VAO | DIRTY_FBO);
+            STATS_ADD(pipeline_creates, 1);
+            STATS_ADD(pipeline_create_ns, STATS_TIME() - pipelineStart);
+
+            ctx->state.dirty_bits &= ~DIRTY_PIPELINE_BITS;
         }
 
         //if (ctx->state.dirty_bits)
@@ -4316,14 +4543,18 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         // buffer data can be changed but the bindings remain in place.. so we need to update the data if this is the case
         // like a uniform or buffer sub data call
         
-        if( [self checkForDirtyBufferData: &ctx->state.vertex_buffer_map_list])
+        // both stages can share a buffer, binding one clears its dirty bits
+        bool vertex_dirty = [self checkForDirtyBufferData: &ctx->state.vertex_buffer_map_list];
+        bool fragment_dirty = [self checkForDirtyBufferData: &ctx->state.fragment_buffer_map_list];
+
+        if (vertex_dirty)
         {
             RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.vertex_buffer_map_list]);
 
             RETURN_FALSE_ON_FAILURE([self bindVertexBuffersToCurrentRenderEncoder]);
         }
         
-        if( [self checkForDirtyBufferData: &ctx->state.fragment_buffer_map_list])
+        if (fragment_dirty)
         {
             RETURN_FALSE_ON_FAILURE([self updateDirtyBaseBufferList: &ctx->state.fragment_buffer_map_list]);
 
@@ -4331,9 +4562,20 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
         }
     }
 
+    // nothing open to draw into, or a glClear since the pass started which
+    // becomes the load action of a new pass
+    if (_currentRenderEncoder == NULL || renderPassNeedsRestart(&STATE(render_pass)))
+    {
+        RETURN_FALSE_ON_FAILURE([self newRenderEncoder]);
+    }
+
     // Create a render command encoder.
     [_currentRenderEncoder setRenderPipelineState: _pipelineState];
 
+    renderPassDraw(&STATE(render_pass));
+
+    STATE(total_binding_calls) += STATE(binding_calls);
+
     return true;
 }
 
@@ -4374,116 +4616,66 @@ void mtlBlitFramebuffer(GLMContext glm_ctx, GLint srcX0, GLint srcY0, GLint srcX
 
 - (bool) bindTexturesToComputeEncoder:(id <MTLComputeCommandEncoder>) computeCommandEncoder
 {
-    GLuint count;
     enum {
         _TEXTURE,
         _IMAGE_TEXTURE
     };
     struct {
-        int spvc_type;
+        int binding_type;
         int gl_texture_type;
     } mapped_types[] = {
-        {SPVC_RESOURCE_TYPE_SAMPLED_IMAGE, _TEXTURE},
-        {SPVC_RESOURCE_TYPE_STORAGE_IMAGE, _IMAGE_TEXTURE},
-        {0,0}
+        {_BINDING_SAMPLED_IMAGE, _TEXTURE},
+        {_BINDING_STORAGE_IMAGE, _IMAGE_TEXTURE}
     };
 
     assert(computeCommandEncoder);
 
-    for(int type=0; mapped_types[type].spvc_type; type++)
+    for(int type=0; type<2; type++)
     {
-        int spvc_type;
-        int gl_texture_type;
+        const ProgramBindingTable *table;
 
-        spvc_type = mapped_types[type].spvc_type;
-        gl_texture_type = mapped_types[type].gl_texture_type;
+        table = programBindingTable(ctx, _COMPUTE_SHADER, mapped_types[type].binding_type);
 
-        // iterate shader storage buffers
-        count = [self getProgramBindingCount: _COMPUTE_SHADER type: spvc_type];
-        if (count)
+        for (int word=0; word<BINDING_MASK_WORDS; word++)
         {
-            int textures_to_be_mapped = count;
+            GLuint64 mask;
 
-            assert(textures_to_be_mapped < TEXTURE_UNITS);
+            mask = table->used[word];
 
-            for (int i=0; textures_to_be_mapped > 0; i++)
+            while (mask)
             {
-               // GLuint spirv_location;
                 GLuint spirv_binding;
                 Texture *ptr;
 
-                spirv_binding = [self getProgramLocation:_COMPUTE_SHADER type:spvc_type index: i];
-                spirv_binding = [self getProgramBinding:_COMPUTE_SHADER type:spvc_type index: i];
+                spirv_binding = word * 64 + __builtin_ctzll(mask);
+                mask &= mask - 1;
 
-                switch(gl_texture_type)
-                {
-                    case _TEXTURE: ptr = STATE(active_textures[spirv_binding]); break;
-                    case _IMAGE_TEXTURE: ptr = STATE(image_units[spirv_binding].tex); break;
-                    default:
-                        ptr = NULL;
-                        // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return NULL;
-                }
+                if (mapped_types[type].gl_texture_type == _TEXTURE)
+                    ptr = STATE(active_textures[spirv_binding]);
+                else
+                    ptr = STATE(image_units[spirv_binding].tex);
 
-                if (ptr)
+                // texture not found
+                if (ptr == NULL)
                 {
-                    RETURN_FALSE_ON_FAILURE([self bindMTLTexture: ptr]);
-                    assert(ptr->mtl_data);
-
-                    id<MTLTexture> texture;
-                    texture = (__bridge id<MTLTexture>)(ptr->mtl_data);
-                    assert(texture);
-
-                    id<MTLSamplerState> sampler;
-
-                    // late binding of texture samplers.. but its better than scanning the entire texture_samplers
-                    if(STATE(texture_samplers[spirv_binding]))
-                    {
-                        Sampler *gl_sampler;
+                    DEBUG_PRINT("No texture bound for compute shader binding %d\n", spirv_binding);
 
-                        gl_sampler = STATE(texture_samplers[spirv_binding]);
-
-                        // delete existing sampler if dirty
-                        if (gl_sampler->dirty_bits)
-                        {
-                            if (gl_sampler->mtl_data)
-                            {
-                                CFBridgingRelease(gl_sampler->mtl_data);
-                                gl_sampler->mtl_data = NULL;
-                            }
-                        }
-
-                        if (gl_sampler->mtl_data == NULL)
-                        {
-                            gl_sampler->mtl_data = (void *)CFBridgingRetain([self createMTLSamplerForTexParam:&gl_sampler->params target:ptr->target]);
-                            gl_sampler->dirty_bits = 0;
-                        }
-
-                        sampler = (__bridge id<MTLSamplerState>)(gl_sampler->mtl_data);
-                        assert(sampler);
-                    }
-                    else
-                    {
-                        sampler = (__bridge id<MTLSamplerState>)(ptr->params.mtl_data);
-                        assert(sampler);
-                    }
-
-                    [computeCommandEncoder setTexture:texture atIndex:spirv_binding];
-                    [computeCommandEncoder setSamplerState: sampler atIndex:spirv_binding];
-
-                    textures_to_be_mapped--;
+                    return false;
                 }
 
-                RETURN_FALSE_ON_FAILURE((i<TEXTURE_UNITS));
-            }
+                RETURN_FALSE_ON_FAILURE([self bindMTLTexture: ptr]);
+                assert(ptr->mtl_data);
 
-            // texture not found
-            if (textures_to_be_mapped)
-            {
-                DEBUG_PRINT("No texture bound for fragment shader location\n");
+                id<MTLTexture> texture;
+                texture = (__bridge id<MTLTexture>)(ptr->mtl_data);
+                assert(texture);
 
-                return false;
+                id<MTLSamplerState> sampler;
+                sampler = [self samplerForTexture: ptr unit: spirv_binding];
+                assert(sampler);
+
+                [computeCommandEncoder setTexture:texture atIndex:spirv_binding];
+                [computeCommandEncoder setSamplerState: sampler atIndex:spirv_binding];
             }
         }
     }
@@ -4634,6 +4826,8 @@ void mtlDispatchComputeIndirect(GLMContext glm_ctx, GLintptr indirect)
         return false;
     }
 
+    [self resolveReadbackForGPU: ptr];
+
     if (ptr->data.mtl_data == NULL)
     {
         [self bindMTLBuffer: ptr];
@@ -4696,6 +4890,7 @@ void mtlDispatchComputeIndirect(GLMContext glm_ctx, GLintptr indirect)
     if (![self validateMetalObjects]) {
         NSLog(@"MGL WARNING: GPU throttling active - skipping command buffer commit");
         [self cleanupCommandBuffer];
+        STATE(frame_pacing).frames_dropped++;
         return;
     }
 
@@ -4813,124 +5008,147 @@ void mtlDeleteMTLObj (GLMContext glm_ctx, void *obj)
 }
 
 #pragma mark C interface to mtlGetSync
--(void) mtlGetSync:(GLMContext) glm_ctx sync: (Sync *)sync
+// a fence is the serial of the command buffer being recorded, it signals when that completes
+-(bool) mtlGetSync:(GLMContext) glm_ctx sync: (Sync *)sync
 {
     // SAFETY: Check Metal objects before processing
-    if (!_device || !_commandQueue) {
+    if (!_device || !_commandQueue || !_timeline) {
         NSLog(@"MGL ERROR: Metal device or queue is NULL in mtlGetSync");
-        return;
-    }
-
-    if (![self processGLState: false]) {
-        NSLog(@"MGL WARNING: processGLState failed in mtlGetSync");
-        return;
-    }
-
-    if (_currentEvent == NULL)
-    {
-        @try {
-            _currentEvent = [_device newEvent];
-            if (!_currentEvent) {
-                NSLog(@"MGL ERROR: Failed to create Metal event");
-                return;
-            }
-        } @catch (NSException *exception) {
-            NSLog(@"MGL ERROR: Exception creating Metal event: %@", exception);
-            return;
-        }
+        return false;
     }
 
-    _currentSyncName = sync->name;
+    // queued draws come before the fence
+    [self flushDrawQueue];
 
-    sync->mtl_event = (void *)CFBridgingRetain(_currentEvent);
-
-    if (_currentCommandBufferSyncList == NULL)
-    {
-        // CRITICAL SECURITY FIX: Check malloc results instead of using assert()
-        _currentCommandBufferSyncList = (SyncList *)malloc(sizeof(SyncList));
-        if (!_currentCommandBufferSyncList) {
-            NSLog(@"MGL SECURITY ERROR: Failed to allocate SyncList");
-            return;
-        }
+    sync->serial = [self commandBufferSerial];
+    sync->mtl_event = (void *)CFBridgingRetain(_timeline);
 
-        _currentCommandBufferSyncList->size = 8;
-        _currentCommandBufferSyncList->list = (Sync **)malloc(sizeof(Sync *) * 8);
-        if (!_currentCommandBufferSyncList->list) {
-            NSLog(@"MGL SECURITY ERROR: Failed to allocate SyncList array");
-            free(_currentCommandBufferSyncList);
-            _currentCommandBufferSyncList = NULL;
-            return;
-        }
+    return true;
+}
 
-        _currentCommandBufferSyncList->count = 0;
-    }
+bool mtlGetSync (GLMContext glm_ctx, Sync *sync)
+{
+    // Call the Objective-C method using Objective-C syntax
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlGetSync: glm_ctx sync: sync];
+}
 
-    _currentCommandBufferSyncList->list[_currentCommandBufferSyncList->count] = sync;
-    _currentCommandBufferSyncList->count++;
+-(GLboolean) mtlSyncSignaled:(GLMContext) glm_ctx sync: (Sync *)sync
+{
+    id<MTLSharedEvent> timeline;
 
-    if (_currentCommandBufferSyncList->count >= _currentCommandBufferSyncList->size)
-    {
-        // CRITICAL SECURITY FIX: Check for integer overflow before multiplication
-        if (_currentCommandBufferSyncList->size > SIZE_MAX / 2 / sizeof(Sync *)) {
-            NSLog(@"MGL SECURITY ERROR: SyncList size would overflow, preventing expansion");
-            return;
-        }
+    if (sync->mtl_event == NULL)
+        return GL_TRUE;
 
-        size_t new_size = _currentCommandBufferSyncList->size * 2;
-        Sync **new_list = (Sync **)realloc(_currentCommandBufferSyncList->list,
-                                           sizeof(Sync *) * new_size);
-        if (!new_list) {
-            NSLog(@"MGL SECURITY ERROR: Failed to reallocate SyncList array");
-            return;
-        }
+    timeline = (__bridge id<MTLSharedEvent>)sync->mtl_event;
 
-        _currentCommandBufferSyncList->size = new_size;
-        _currentCommandBufferSyncList->list = new_list;
-    }
+    return timeline.signaledValue >= sync->serial;
 }
 
-void mtlGetSync (GLMContext glm_ctx, Sync *sync)
+GLboolean mtlSyncSignaled (GLMContext glm_ctx, Sync *sync)
 {
-    // Call the Objective-C method using Objective-C syntax
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlGetSync: glm_ctx sync: sync];
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlSyncSignaled: glm_ctx sync: sync];
 }
 
-#pragma mark C interface to mtlWaitForSync
--(void) mtlWaitForSync:(GLMContext) glm_ctx sync: (Sync *)sync
+// the fence's command buffer has to be submitted before anything can wait on it
+- (void) submitSync: (Sync *) sync
 {
-    // CRITICAL SAFETY: Validate sync object before processing
-    if (!sync) {
-        NSLog(@"MGL ERROR: mtlWaitForSync - sync object is NULL");
-        return;
+    if (sync->mtl_event == (__bridge void *)_timeline &&
+        sync->serial == _commandBufferSerial &&
+        _serialCommandBuffer == _currentCommandBuffer &&
+        _currentCommandBuffer.status < MTLCommandBufferStatusCommitted)
+    {
+        [self splitCommandBuffer];
     }
+}
 
-    // SAFETY: Check processGLState result before continuing
-    if (![self processGLState: false]) {
-        NSLog(@"MGL WARNING: mtlWaitForSync - processGLState failed, skipping sync wait");
-        return;  // Don't try to release potentially corrupted sync object
+// blocks until the timeline reaches value, false once timeout ns have passed
+- (bool) waitTimeline: (id<MTLSharedEvent>) timeline value: (GLuint64) value timeout: (GLuint64) timeout
+{
+    dispatch_semaphore_t signaled;
+    dispatch_time_t deadline;
+
+    if (timeline.signaledValue >= value)
+        return true;
+
+    TRACE_SCOPE("waitTimeline", TRACE_SYNC);
+
+    signaled = dispatch_semaphore_create(0);
+
+    [timeline notifyListener: _timelineListener atValue: value block:^(id<MTLSharedEvent> event, uint64_t value) {
+        dispatch_semaphore_signal(signaled);
+    }];
+
+    // GL_TIMEOUT_IGNORED and anything past what dispatch_time takes wait forever
+    if (timeout > (GLuint64)INT64_MAX)
+        deadline = DISPATCH_TIME_FOREVER;
+    else
+        deadline = dispatch_time(DISPATCH_TIME_NOW, (int64_t)timeout);
+
+    return dispatch_semaphore_wait(signaled, deadline) == 0;
+}
+
+-(GLenum) mtlClientWaitSync:(GLMContext) glm_ctx sync: (Sync *)sync flush: (GLboolean) flush timeout: (GLuint64) timeout
+{
+    id<MTLSharedEvent> timeline;
+
+    timeline = (__bridge id<MTLSharedEvent>)sync->mtl_event;
+
+    // without the flush bit a fence in the open command buffer would never signal, submit it
+    // anyway unless this is only a poll
+    if (flush || timeout)
+    {
+        [self submitSync: sync];
     }
 
-    // SAFETY: Validate mtl_event before releasing - prevent objc_release crash
-    if (!sync->mtl_event) {
-        NSLog(@"MGL WARNING: mtlWaitForSync - sync->mtl_event is NULL");
+    if (timeout == 0)
+        return GL_TIMEOUT_EXPIRED;
+
+    if (![self waitTimeline: timeline value: sync->serial timeout: timeout])
+        return GL_TIMEOUT_EXPIRED;
+
+    return GL_CONDITION_SATISFIED;
+}
+
+GLenum mtlClientWaitSync (GLMContext glm_ctx, Sync *sync, GLboolean flush, GLuint64 timeout)
+{
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlClientWaitSync: glm_ctx sync: sync flush: flush timeout: timeout];
+}
+
+// commands after this in the context wait on the gpu for the fence
+-(void) mtlWaitSync:(GLMContext) glm_ctx sync: (Sync *)sync
+{
+    // command buffers on one queue already run in order
+    if (sync->mtl_event == (__bridge void *)_timeline)
         return;
+
+    [self flushDrawQueue];
+    [self endRenderEncoding];
+
+    if (_currentCommandBuffer == nil || _currentCommandBuffer.status >= MTLCommandBufferStatusCommitted)
+    {
+        RETURN_ON_FAILURE([self newCommandBuffer]);
     }
 
-    @try {
-        NSLog(@"MGL INFO: Releasing Metal sync event");
+    [_currentCommandBuffer encodeWaitForEvent: (__bridge id<MTLSharedEvent>)sync->mtl_event value: sync->serial];
+}
+
+void mtlWaitSync (GLMContext glm_ctx, Sync *sync)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlWaitSync: glm_ctx sync: sync];
+}
+
+-(void) mtlDeleteSync:(GLMContext) glm_ctx sync: (Sync *)sync
+{
+    if (sync->mtl_event)
+    {
         CFBridgingRelease(sync->mtl_event);
         sync->mtl_event = NULL;
-    } @catch (NSException *exception) {
-        NSLog(@"MGL ERROR: Exception releasing sync event: %@", exception);
-        // Don't crash - set to NULL to prevent double release
-        sync->mtl_event = NULL;
     }
 }
 
-void mtlWaitForSync (GLMContext glm_ctx, Sync *sync)
+void mtlDeleteSync (GLMContext glm_ctx, Sync *sync)
 {
-    // Call the Objective-C method using Objective-C syntax
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlWaitForSync: glm_ctx sync: sync];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDeleteSync: glm_ctx sync: sync];
 }
 
 #pragma mark C interface to mtlFlush
@@ -4946,8 +5164,58 @@ void mtlFlush (GLMContext glm_ctx, bool finish)
 }
 
 #pragma mark C interface to mtlSwapBuffers
+// a frame that doesn't retire in this long is stuck, pacing gives up on it rather than hang the app
+#define FRAME_PACING_TIMEOUT    (1000000000ULL)
+
+// called after the present is committed, serial is its command buffer. blocks while too many
+// frames are in flight and times the frame
+- (void) paceFrame: (GLuint64) serial
+{
+    FramePacing *fp;
+    GLuint64 wait_serial, first, last;
+    CFTimeInterval now, start, end;
+
+    fp = &STATE(frame_pacing);
+
+    now = CACurrentMediaTime();
+
+    if (fp->frame_start)
+        fp->cpu_time = (GLuint64)(now * 1e9) - fp->frame_start;
+
+    framePacingSubmit(fp, serial);
+
+    fp->wait_time = 0;
+
+    wait_serial = framePacingWaitSerial(fp, [self completedSerial]);
+
+    if (wait_serial)
+    {
+        TRACE_SCOPE("paceFrame", TRACE_FRAME);
+
+        if (![self waitTimeline: _timeline value: wait_serial timeout: FRAME_PACING_TIMEOUT])
+        {
+            NSLog(@"MGL WARNING: frame with command buffer %llu still in flight after 1s", wait_serial);
+        }
+
+        fp->wait_time = (GLuint64)((CACurrentMediaTime() - now) * 1e9);
+    }
+
+    if (framePacingCompletedFrame(fp, [self completedSerial], &first, &last))
+    {
+        start = [self gpuTime: first end: false];
+        end = [self gpuTime: last end: true];
+
+        if (start > 0 && end > start)
+            fp->gpu_time = (GLuint64)((end - start) * 1e9);
+    }
+
+    fp->frame_start = (GLuint64)(CACurrentMediaTime() * 1e9);
+}
+
 -(void) mtlSwapBuffers:(GLMContext) glm_ctx
 {
+    TRACE_SCOPE("mtlSwapBuffers", TRACE_FRAME);
+
     if (ctx->state.draw_buffer == GL_FRONT || ctx->state.draw_buffer == GL_COLOR_ATTACHMENT0)
     {
         // clear commands rely on processGLState
@@ -4956,6 +5224,9 @@ void mtlFlush (GLMContext glm_ctx, bool finish)
 
         [self endRenderEncoding];
 
+        // render passes per frame, every extra pass is a load / store of the attachments
+        renderPassEndFrame(&STATE(render_pass));
+
         if (_drawable == NULL)
         {
             _drawable = [_layer nextDrawable];
@@ -4978,6 +5249,7 @@ void mtlFlush (GLMContext glm_ctx, bool finish)
             if (_drawable == NULL) {
                 NSLog(@"MGL ERROR: Failed to obtain any drawable from Metal layer");
                 [_currentCommandBuffer commit];
+                STATE(frame_pacing).frames_dropped++;
                 return;
             }
         }
@@ -5043,12 +5315,17 @@ void mtlFlush (GLMContext glm_ctx, bool finish)
             return;
         }
 
+        GLuint64 frameSerial = [self commandBufferSerial];
+
         @try {
             // AGX Driver Compatibility: Use specialized commit method for AGX
             [self commitCommandBufferWithAGXRecovery:_currentCommandBuffer];
+
+            [self paceFrame: frameSerial];
         } @catch (NSException *exception) {
             NSLog(@"MGL ERROR: Failed to commit command buffer: %@", exception);
             [self recordGPUError];
+            STATE(frame_pacing).frames_dropped++;
         }
 
         _drawable = [_layer nextDrawable];
@@ -5159,6 +5436,8 @@ void mtlBufferSubData(GLMContext glm_ctx, Buffer *buf, size_t offset, size_t siz
 
     [mtl_buffer didModifyRange:NSMakeRange(offset, size)];
 
+    STATS_ADD(bytes_flushed, size);
+
     return NULL;
 }
 
@@ -5176,6 +5455,8 @@ void *mtlMapUnmapBuffer(GLMContext glm_ctx, Buffer *buf, size_t offset, size_t s
     mtl_buffer = (__bridge id<MTLBuffer>)(buf->data.mtl_data);
 
     [mtl_buffer didModifyRange:NSMakeRange(offset, length)];
+
+    STATS_ADD(bytes_flushed, length);
 }
 
 void mtlFlushBufferRange(GLMContext glm_ctx, Buffer *buf, GLintptr offset, GLsizeiptr length)
@@ -5185,174 +5466,185 @@ void mtlFlushBufferRange(GLMContext glm_ctx, Buffer *buf, GLintptr offset, GLsiz
 }
 
 
-#pragma mark C interface to mtlReadDrawable
--(void) mtlReadDrawable:(GLMContext) glm_ctx pixelBytes:(void *)pixelBytes bytesPerRow:(NSUInteger)bytesPerRow bytesPerImage:(NSUInteger)bytesPerImage fromRegion:(MTLRegion)region
+#pragma mark C interface to mtlReadDrawableAsync
+-(bool) mtlReadDrawableAsync:(GLMContext) glm_ctx readback:(BufferReadback *)readback fromRegion:(MTLRegion)region
 {
     id<MTLTexture> texture;
+    GLuint mgl_drawbuffer;
 
-    // if tex is null we are pulling from a readbuffer or a drawable
+    // fbo read buffers aren't handled yet
     if (glm_ctx->state.readbuffer)
+        return false;
+
+    switch(ctx->state.read_buffer)
     {
-        Framebuffer *fbo;
-        GLuint drawbuffer;
+        case GL_FRONT: mgl_drawbuffer = _FRONT; break;
+        case GL_BACK: mgl_drawbuffer = _BACK; break;
+        case GL_FRONT_LEFT: mgl_drawbuffer = _FRONT_LEFT; break;
+        case GL_FRONT_RIGHT: mgl_drawbuffer = _FRONT_RIGHT; break;
+        case GL_BACK_LEFT: mgl_drawbuffer = _BACK_LEFT; break;
+        case GL_BACK_RIGHT: mgl_drawbuffer = _BACK_RIGHT; break;
+        default:
+            return false;
+    }
 
-        fbo = ctx->state.readbuffer;
-        drawbuffer = ctx->state.read_buffer - GL_COLOR_ATTACHMENT0;
-        assert(drawbuffer >= 0);
-        assert(drawbuffer <= STATE(max_color_attachments));
+    if (mgl_drawbuffer == _FRONT)
+        texture = _drawable.texture;
+    else
+        texture = _drawBuffers[mgl_drawbuffer].drawbuffer;
 
-        // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return;
-        
-        //tex = [self framebufferAttachmentTexture: &fbo->color_attachments[drawbuffer]];
-        //assert(tex);
+    if (texture == nil || texture.framebufferOnly)
+        return false;
+
+    switch(texture.pixelFormat)
+    {
+        case MTLPixelFormatBGRA8Unorm:
+        case MTLPixelFormatBGRA8Unorm_sRGB:
+        case MTLPixelFormatRGBA8Unorm:
+        case MTLPixelFormatRGBA8Unorm_sRGB:
+            break;
 
-        //texture = (__bridge id<MTLTexture>)(tex->mtl_data);
-        //assert(texture);
+        default:
+            // conversion at map time only understands 8 bit rgba / bgra
+            return false;
     }
-    else
+
+    if (region.origin.x + region.size.width > texture.width ||
+        region.origin.y + region.size.height > texture.height)
+        return false;
+
+    // gl reads from the bottom left, the flip back happens on the cpu
+    region.origin.y = texture.height - region.origin.y - region.size.height;
+
+    if (![self processGLState: false])
+        return false;
+
+    [self endRenderEncoding];
+
+    if (_currentCommandBuffer == nil)
+        return false;
+
+    NSUInteger bytesPerRow = region.size.width * 4;
+    NSUInteger length = bytesPerRow * region.size.height;
+    id<MTLBuffer> staging = nil;
+
+    // continuous capture reuses the same staging buffer every frame
+    if (readback->mtl_staging)
     {
-        GLuint mgl_drawbuffer;
-        id<MTLTexture> texture;
+        staging = (__bridge id<MTLBuffer>)(readback->mtl_staging);
 
-        // reading from the drawbuffer
-        switch(ctx->state.read_buffer)
+        if (staging.length < length)
         {
-            case GL_FRONT: mgl_drawbuffer = _FRONT; break;
-            case GL_BACK: mgl_drawbuffer = _BACK; break;
-            case GL_FRONT_LEFT: mgl_drawbuffer = _FRONT_LEFT; break;
-            case GL_FRONT_RIGHT: mgl_drawbuffer = _FRONT_RIGHT; break;
-            case GL_BACK_LEFT: mgl_drawbuffer = _BACK_LEFT; break;
-            case GL_BACK_RIGHT: mgl_drawbuffer = _BACK_RIGHT; break;
-            default:
-                // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return;
+            CFBridgingRelease(readback->mtl_staging);
+            readback->mtl_staging = NULL;
+            staging = nil;
         }
+    }
 
-        if (mgl_drawbuffer == _FRONT)
+    if (staging == nil)
+    {
+        staging = [_device newBufferWithLength:length options:MTLResourceStorageModeShared];
+
+        if (staging == nil)
+            return false;
+
+        readback->mtl_staging = (void *)CFBridgingRetain(staging);
+    }
+
+    id<MTLBlitCommandEncoder> blitEncoder = [_currentCommandBuffer blitCommandEncoder];
+
+    [blitEncoder copyFromTexture:texture
+                     sourceSlice:0
+                     sourceLevel:0
+                    sourceOrigin:region.origin
+                      sourceSize:region.size
+                        toBuffer:staging
+               destinationOffset:0
+          destinationBytesPerRow:bytesPerRow
+        destinationBytesPerImage:length];
+    [blitEncoder endEncoding];
+
+    readback->src_pitch = bytesPerRow;
+    readback->src_format = (GLuint)texture.pixelFormat;
+    readback->mtl_cmd_buffer = (void *)CFBridgingRetain(_currentCommandBuffer);
+
+    // kick the copy off without waiting on it
+    [self flushCommandBuffer: false];
+
+    return true;
+}
+
+bool mtlReadDrawableAsync(GLMContext glm_ctx, BufferReadback *readback, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlReadDrawableAsync:glm_ctx readback:readback fromRegion:MTLRegionMake2D(x,y,width,height)];
+}
+
+#pragma mark C interface to mtlReadbackData
+-(void *) mtlReadbackData:(GLMContext) glm_ctx readback:(BufferReadback *)readback wait:(bool)wait
+{
+    if (readback->mtl_staging == NULL)
+        return NULL;
+
+    if (readback->mtl_cmd_buffer)
+    {
+        id<MTLCommandBuffer> cmdBuffer = (__bridge id<MTLCommandBuffer>)(readback->mtl_cmd_buffer);
+
+        if (cmdBuffer.status < MTLCommandBufferStatusCompleted)
         {
-            [self endRenderEncoding];
-            
-            assert(_currentCommandBuffer);
-            if (_currentCommandBuffer.status < MTLCommandBufferStatusCommitted)
+            if (wait == false)
+                return NULL;
+
+            // throttled flushes can leave the copy uncommitted
+            if (cmdBuffer == _currentCommandBuffer)
+                [self flushCommandBuffer: false];
+
+            if (cmdBuffer.status < MTLCommandBufferStatusCommitted)
             {
-                [_currentCommandBuffer presentDrawable: _drawable];
+                CFBridgingRelease(readback->mtl_cmd_buffer);
+                readback->mtl_cmd_buffer = NULL;
 
-                [_currentCommandBuffer commit];
+                return NULL;
             }
-            
-            id<MTLTexture> drawableTexture = _drawable.texture;
-            assert(drawableTexture);
-            
-            // Create a downscale texture
-            MTLTextureDescriptor *downScaleTextureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:drawableTexture.pixelFormat
-                                                                                                                 width:region.size.width
-                                                                                                                height:region.size.height
-                                                                                                             mipmapped:NO];
-            downScaleTextureDescriptor.usage = MTLTextureUsageShaderRead | MTLTextureUsageRenderTarget;
-            id<MTLTexture> downscaledTexture = [_device newTextureWithDescriptor:downScaleTextureDescriptor];
-            
-            // Create a command buffer
-            [self newCommandBuffer];
-            
-            // Use a blit command encoder to copy texture data to the buffer
-            id<MTLBlitCommandEncoder> blitEncoder = [_currentCommandBuffer blitCommandEncoder];
-            
-            // Set up the source and destination sizes
-            MTLOrigin sourceOrigin = MTLOriginMake(0, 0, 0);
-            MTLSize sourceSize = MTLSizeMake(drawableTexture.width, drawableTexture.height, 1);
-            MTLOrigin destinationOrigin = MTLOriginMake(region.origin.x, region.origin.y, 0);
-
-            // Perform the scaling operation
-            [blitEncoder copyFromTexture:drawableTexture
-                             sourceSlice:0
-                             sourceLevel:0
-                            sourceOrigin:sourceOrigin
-                              sourceSize:sourceSize
-                               toTexture:downscaledTexture
-                      destinationSlice:0
-                      destinationLevel:0
-                     destinationOrigin:destinationOrigin];
-            [blitEncoder endEncoding];
-
-            // Create a CPU-accessible buffer
-            NSUInteger bytesPerPixel = 4; // For RGBA8Unorm format
-            NSUInteger bytesPerRow = region.size.width * bytesPerPixel;
-
-            id<MTLBuffer> readBuffer = [_device newBufferWithLength:bytesPerRow * region.size.height
-                                                           options:MTLResourceStorageModeShared];
-
-            // Use another blit command encoder to copy the texture into the buffer
-            id<MTLBlitCommandEncoder> readBlitEncoder = [_currentCommandBuffer blitCommandEncoder];
-            [readBlitEncoder copyFromTexture:downscaledTexture
-                                sourceSlice:0
-                                sourceLevel:0
-                               sourceOrigin:MTLOriginMake(0, 0, 0)
-                                  sourceSize:MTLSizeMake(region.size.width, region.size.height, 1)
-                                   toBuffer:readBuffer
-                          destinationOffset:0
-                     destinationBytesPerRow:bytesPerRow
-                   destinationBytesPerImage:bytesPerRow * region.size.height];
-            [readBlitEncoder endEncoding];
-
-            // Commit and wait for completion
-            [_currentCommandBuffer commit];
-            [_currentCommandBuffer waitUntilCompleted];
-            
-            // copy the data
-            void *data = [readBuffer contents];
-            memcpy(pixelBytes, data, bytesPerRow * region.size.height);
-            
-            // get a new command buffer
-            [self newCommandBuffer];
-        }
-        else if(_drawBuffers[mgl_drawbuffer].drawbuffer)
-        {
-            texture = _drawBuffers[mgl_drawbuffer].drawbuffer;
-        }
-        else
-        {
-            // CRITICAL FIX: Handle assertion gracefully instead of crashing
-            NSLog(@"MGL ERROR: Assertion hit in MGLRenderer.m at line %d", __LINE__);
-            return;
+
+            [cmdBuffer waitUntilCompleted];
         }
+
+        bool failed = (cmdBuffer.status == MTLCommandBufferStatusError);
+
+        CFBridgingRelease(readback->mtl_cmd_buffer);
+        readback->mtl_cmd_buffer = NULL;
+
+        if (failed)
+            return NULL;
     }
+
+    id<MTLBuffer> staging = (__bridge id<MTLBuffer>)(readback->mtl_staging);
+
+    return staging.contents;
 }
 
-#pragma mark C interface to mtlGetTexImage
--(void) mtlGetTexImage:(GLMContext) glm_ctx tex: (Texture *)tex pixelBytes:(void *)pixelBytes bytesPerRow:(NSUInteger)bytesPerRow bytesPerImage:(NSUInteger)bytesPerImage fromRegion:(MTLRegion)region mipmapLevel:(NSUInteger)level slice:(NSUInteger)slice
+void *mtlReadbackData(GLMContext glm_ctx, BufferReadback *readback, bool wait)
 {
-    id<MTLTexture> texture;
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlReadbackData:glm_ctx readback:readback wait:wait];
+}
 
-    if (tex)
-    {
-        texture = (__bridge id<MTLTexture>)(tex->mtl_data);
-        assert(texture);
-    }
-    else
+#pragma mark C interface to mtlReadbackRelease
+void mtlReadbackRelease(GLMContext glm_ctx, BufferReadback *readback)
+{
+    // the command buffer holds its own reference to the staging buffer
+    if (readback->mtl_cmd_buffer)
     {
- 
+        CFBridgingRelease(readback->mtl_cmd_buffer);
+        readback->mtl_cmd_buffer = NULL;
     }
 
-    if ([texture isFramebufferOnly] == NO)
-    {
-        //[texture getBytes:pixelBytes bytesPerRow:bytesPerRow bytesPerImage:bytesPerImage fromRegion:region mipmapLevel:level slice:slice];
-    }
-    else
+    if (readback->mtl_staging)
     {
-        // issue a gl error as we can't read a framebuffer only texture
-        NSLog(@"Cannot read from framebuffer only texture\n");
-        ctx->error_func(ctx, __FUNCTION__, GL_INVALID_OPERATION);
+        CFBridgingRelease(readback->mtl_staging);
+        readback->mtl_staging = NULL;
     }
 }
 
-void mtlReadDrawable(GLMContext glm_ctx, void *pixelBytes, GLuint bytesPerRow, GLuint bytesPerImage, GLint x, GLint y, GLsizei width, GLsizei height)
-{
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlReadDrawable:glm_ctx pixelBytes:pixelBytes bytesPerRow:bytesPerRow bytesPerImage:bytesPerImage fromRegion:MTLRegionMake2D(x,y,width,height)];
-}
-
 void mtlGetTexImage(GLMContext glm_ctx, Texture *tex, void *pixelBytes, GLuint bytesPerRow, GLuint bytesPerImage, GLint x, GLint y, GLsizei width, GLsizei height, GLuint level, GLuint slice)
 {
     [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlGetTexImage:glm_ctx tex:tex pixelBytes:pixelBytes bytesPerRow:bytesPerRow bytesPerImage:bytesPerImage fromRegion:MTLRegionMake2D(x,y,width,height) mipmapLevel:level slice:slice];
@@ -5500,105 +5792,1167 @@ Buffer *getIndirectBuffer(GLMContext ctx)
     return gl_indirect_buffer;
 }
 
-#pragma mark C interface to mtlDrawArrays
--(void) mtlDrawArrays: (GLMContext) ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count
+#pragma mark index translation
+static void releaseIndexBuffer(void *data)
 {
-    MTLPrimitiveType primitiveType;
-
-    // AGGRESSIVE MEMORY SAFETY: Immediate validation before any Metal operations (realistic bounds)
-    if (!ctx || ((uintptr_t)ctx < 0x1000) || ((uintptr_t)ctx > 0x100000000000ULL)) {
-        NSLog(@"MGL ERROR: mtlDrawArrays - Invalid context detected, aborting");
-        return; // Early return to prevent crash
-    }
+    CFBridgingRelease(data);
+}
 
-    if ([self processGLState: true] == false) {
-        NSLog(@"MGL ERROR: mtlDrawArrays - processGLState failed, aborting");
-        return; // Early return instead of continuing with invalid state
-    }
+- (bool) primitiveRestart: (GLenum) type index: (GLuint *) restart_index
+{
+    if (STATE(caps.primitive_restart_fixed_index))
+    {
+        switch(type)
+        {
+            case GL_UNSIGNED_BYTE: *restart_index = 0xFF; break;
+            case GL_UNSIGNED_SHORT: *restart_index = 0xFFFF; break;
+            default: *restart_index = 0xFFFFFFFF; break;
+        }
 
-    // Additional safety check after processGLState
-    if (!_currentRenderEncoder) {
-        NSLog(@"MGL ERROR: mtlDrawArrays - No current render encoder, aborting");
-        return;
+        return true;
     }
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    *restart_index = STATE_VAR(primitive_restart_index);
 
-    @try {
-        [_currentRenderEncoder drawPrimitives: primitiveType
-                                 vertexStart: first
-                                 vertexCount: count];
-    } @catch (NSException *exception) {
-        NSLog(@"MGL ERROR: mtlDrawArrays - drawPrimitives failed: %@", exception);
-        // Don't crash, just return gracefully
-    }
+    return STATE(caps.primitive_restart);
 }
 
-void mtlDrawArrays(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count)
+- (bool) needsIndexTranslation: (GLenum) mode type: (GLenum) type
 {
-    // FINAL FAILSAFE: Catch any unhandled exceptions to prevent QEMU crashes
-    @try {
-        // Validate context before bridging (realistic bounds for 64-bit systems)
-        if (!glm_ctx || ((uintptr_t)glm_ctx < 0x1000) || ((uintptr_t)glm_ctx > 0x100000000000ULL)) {
-            NSLog(@"MGL CRITICAL: mtlDrawArrays - Invalid GLM context, aborting operation");
-            return;
-        }
+    GLuint restart_index;
+    bool restart;
 
-        // Validate the Metal object pointer (realistic bounds for 64-bit systems)
-        if (!glm_ctx->mtl_funcs.mtlObj || ((uintptr_t)glm_ctx->mtl_funcs.mtlObj < 0x1000) || ((uintptr_t)glm_ctx->mtl_funcs.mtlObj > 0x100000000000ULL)) {
-            NSLog(@"MGL CRITICAL: mtlDrawArrays - Invalid Metal object, aborting operation");
-            return;
-        }
+    restart = [self primitiveRestart: type index: &restart_index];
 
-        [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArrays: glm_ctx mode: mode first: first count: count];
-    } @catch (NSException *exception) {
-        NSLog(@"MGL CRITICAL: mtlDrawArrays - Unhandled exception caught: %@", exception);
-        NSLog(@"MGL CRITICAL: Exception reason: %@", [exception reason]);
-        NSLog(@"MGL CRITICAL: This is a failsafe to prevent QEMU crashes");
-        // Don't crash, just return gracefully
-    } @catch (id exception) {
-        NSLog(@"MGL CRITICAL: mtlDrawArrays - Unknown exception caught: %@", exception);
-        // Final safety net
-    }
+    return indexTranslationNeeded(mode, type, restart, restart_index);
 }
 
-#pragma mark C interface to mtlDrawElements
--(void) mtlDrawElements: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices
+// fans, loops, adjacency, byte indices and restart indices metal doesn't use are drawn from
+// an index buffer built once per source contents, type 0 is an array draw starting at first
+- (void) drawTranslated: (GLenum) mode type: (GLenum) type indices: (const void *) indices first: (GLint) first
+                  count: (GLsizei) count instancecount: (GLsizei) instancecount
+             basevertex: (GLint) basevertex baseinstance: (GLuint) baseinstance
 {
-    MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+    IndexSource src;
+    IndexCacheKey key;
+    IndexCacheEntry *entry;
+    Buffer *gl_element_buffer;
+    size_t offset;
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+    if (count <= 0 || instancecount <= 0)
+        return;
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    src.mode = mode;
+    src.type = type;
+    src.indices = NULL;
+    src.first = first;
+    src.count = count;
+    src.restart = [self primitiveRestart: type index: &src.restart_index];
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+    gl_element_buffer = NULL;
+    offset = first;
 
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+    if (type)
+    {
+        size_t index_size;
 
-    if ([self processBuffer: gl_element_buffer] == false)
-        return;
+        gl_element_buffer = getElementBuffer(ctx);
+        RETURN_ON_NULL(gl_element_buffer);
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+        if ([self processBuffer: gl_element_buffer] == false)
+            return;
 
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType
-                                     indexBuffer:indexBuffer indexBufferOffset:0 instanceCount:1];
+        index_size = (type == GL_UNSIGNED_BYTE) ? 1 : (type == GL_UNSIGNED_SHORT) ? 2 : 4;
+        offset = (char *)indices - (char *)NULL;
+
+        if (offset + count * index_size > gl_element_buffer->size)
+        {
+            NSLog(@"MGL ERROR: drawTranslated - indices past the end of the element buffer");
+            return;
+        }
+
+        id<MTLBuffer> sourceBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+
+        src.indices = (const GLubyte *)sourceBuffer.contents + offset;
+        src.first = 0;
+    }
+
+    initIndexCacheKey(&key, gl_element_buffer, gl_element_buffer ? gl_element_buffer->generation : 0, offset, &src);
+
+    // a mapped buffer can be written without the generation moving
+    entry = NULL;
+    if (gl_element_buffer == NULL || gl_element_buffer->mapped == GL_FALSE)
+    {
+        entry = indexCacheFind(&_indexCache, &key);
+    }
+
+    if (entry == NULL)
+    {
+        IndexTranslation result;
+        id<MTLBuffer> indexBuffer;
+
+        indexTranslationPlan(&src, &result);
+
+        // nothing but partial primitives
+        if (result.count == 0)
+            return;
+
+        indexBuffer = [_device newBufferWithLength: result.count * (result.type == GL_UNSIGNED_INT ? sizeof(GLuint) : sizeof(GLushort))
+                                           options: MTLResourceCPUCacheModeWriteCombined | MTLResourceStorageModeManaged];
+        RETURN_ON_NULL(indexBuffer);
+
+        translateIndices(&src, &result, indexBuffer.contents);
+        [indexBuffer didModifyRange: NSMakeRange(0, indexBuffer.length)];
+
+        // the command buffer keeps its own reference if this is evicted before it completes
+        entry = indexCacheInsert(&_indexCache, &key, &result, (void *)CFBridgingRetain(indexBuffer), releaseIndexBuffer);
+    }
+
+    [_currentRenderEncoder drawIndexedPrimitives: getMTLPrimitiveType(entry->result.mode)
+                                      indexCount: entry->result.count
+                                       indexType: getMTLIndexType(entry->result.type)
+                                     indexBuffer: (__bridge id<MTLBuffer>)entry->data
+                               indexBufferOffset: 0
+                                   instanceCount: instancecount
+                                      baseVertex: basevertex
+                                    baseInstance: baseinstance];
+}
+
+#pragma mark draw queue
+// backend for the draw queue, user is the renderer, a failed batch can leave it without an encoder
+static void emitQueuedDraw(void *user, const DrawQueue *queue, const DrawQueueEntry *entry)
+{
+    MGLRenderer *renderer = (__bridge MGLRenderer *)user;
+    id<MTLRenderCommandEncoder> encoder = renderer->_currentRenderEncoder;
+    MTLPrimitiveType primitiveType;
+
+    if (encoder == nil)
+        return;
+
+    primitiveType = getMTLPrimitiveType(queue->mode);
+
+    if (queue->type == 0)
+    {
+        [encoder drawPrimitives: primitiveType vertexStart: entry->start vertexCount: entry->count];
+        return;
+    }
+
+    [encoder drawIndexedPrimitives: primitiveType indexCount: entry->count indexType: getMTLIndexType(queue->type)
+                       indexBuffer: (__bridge id<MTLBuffer>)queue->elements indexBufferOffset: entry->start
+                     instanceCount: 1 baseVertex: entry->basevertex baseInstance: 0];
+}
+
+static GLboolean batchQueuedDraws(void *user, const DrawQueue *queue, const DrawQueueEntry *entries, GLuint count)
+{
+    MGLRenderer *renderer = (__bridge MGLRenderer *)user;
+
+    return [renderer batchQueuedDraws: queue entries: entries count: count];
+}
+
+// draws the merge couldn't join, glDrawElementsBaseVertex over scattered ranges.. are written out
+// as gl indirect commands and go through the multi draw indirect batch as one execute
+- (GLboolean) batchQueuedDraws: (const DrawQueue *) queue entries: (const DrawQueueEntry *) entries count: (GLuint) count
+{
+    MultiDrawIndirect mdi;
+    GLuint command_size, index_size;
+    GLuint64 offset;
+    GLubyte *dst;
+
+    // the batch ends the pass, it has to save more than that costs
+    if (_mdiSupported == false || count < MDI_BATCH_MIN_DRAWS)
+        return GL_FALSE;
+
+    command_size = multiDrawIndirectCommandSize(queue->type);
+    index_size = queue->type == GL_UNSIGNED_INT ? sizeof(GLuint) : sizeof(GLushort);
+
+    dst = [self uploadRingAlloc: count * command_size offset: &offset];
+    if (dst == NULL)
+        return GL_FALSE;
+
+    for(GLuint i=0; i<count; i++)
+    {
+        if (queue->type)
+        {
+            DrawElementsIndirectCommand cmd = { entries[i].count, 1, (GLuint)(entries[i].start / index_size), entries[i].basevertex, 0 };
+
+            memcpy(dst + i * command_size, &cmd, command_size);
+        }
+        else
+        {
+            DrawArraysIndirectCommand cmd = { entries[i].count, 1, (GLuint)entries[i].start, 0 };
+
+            memcpy(dst + i * command_size, &cmd, command_size);
+        }
+    }
+
+    initMultiDrawIndirect(&mdi, queue->mode, queue->type, offset, count, 0);
+
+    return [self encodeMultiDrawIndirect: &mdi primitive: getMTLPrimitiveType(queue->mode)
+                                indirect: (__bridge id<MTLBuffer>)STATE(upload_ring).mtl_data parameters: nil
+                                elements: (__bridge id<MTLBuffer>)queue->elements];
+}
+
+- (void) flushDrawQueue
+{
+    void *elements;
+
+    // the batch ends the pass, which comes back here
+    if (ctx == NULL || STATE(draw_queue).count == 0 || _flushingDrawQueue)
+        return;
+
+    elements = STATE(draw_queue).elements;
+
+    if (_currentRenderEncoder)
+    {
+        _flushingDrawQueue = true;
+
+        @try {
+            drawQueueFlush(&STATE(draw_queue), emitQueuedDraw, batchQueuedDraws, (__bridge void *)self);
+        } @catch (NSException *exception) {
+            NSLog(@"MGL ERROR: flushDrawQueue - draw failed: %@", exception);
+            drawQueueDiscard(&STATE(draw_queue));
+        }
+
+        _flushingDrawQueue = false;
+    }
+    else
+    {
+        // every path that ends the encoder flushes first, getting here loses draws
+        NSLog(@"MGL ERROR: flushDrawQueue - %u queued draws with no render encoder, dropped", STATE(draw_queue).count);
+
+        drawQueueDiscard(&STATE(draw_queue));
+    }
+
+    if (elements)
+    {
+        CFBridgingRelease(elements);
+    }
+}
+
+// nothing the encoder sees changed since the queued draws, the draw can go in behind them
+- (bool) canQueueDraw: (GLenum) mode type: (GLenum) type
+{
+    void *elements;
+
+    if (STATE(draw_queue).count == 0 || STATE(dirty_bits))
+        return false;
+
+    if (_currentRenderEncoder == NULL || VAO() == NULL || renderPassNeedsRestart(&STATE(render_pass)))
+        return false;
+
+    // enabling primitive restart doesn't dirty anything
+    if ([self needsIndexTranslation: mode type: type])
+        return false;
+
+    elements = NULL;
+
+    if (type)
+    {
+        Buffer *gl_element_buffer = getElementBuffer(ctx);
+
+        if (gl_element_buffer == NULL || gl_element_buffer->data.dirty_bits)
+            return false;
+
+        elements = gl_element_buffer->data.mtl_data;
+    }
+
+    if (drawQueueCanAppend(&STATE(draw_queue), mode, type, elements) == GL_FALSE)
+        return false;
+
+    // sub data on a bound buffer still has to be pushed by processGLState
+    if ([self checkForDirtyBufferData: &ctx->state.vertex_buffer_map_list] ||
+        [self checkForDirtyBufferData: &ctx->state.fragment_buffer_map_list])
+        return false;
+
+    return true;
+}
+
+- (void) queueDraw: (GLenum) mode type: (GLenum) type indexBuffer: (id<MTLBuffer>) indexBuffer
+             start: (GLuint64) start count: (GLuint) count basevertex: (GLint) basevertex
+{
+    void *elements = (__bridge void *)indexBuffer;
+
+    if (drawQueueCanAppend(&STATE(draw_queue), mode, type, elements) == GL_FALSE)
+    {
+        [self flushDrawQueue];
+
+        // the queue keeps the element buffer alive until it is flushed
+        if (indexBuffer)
+        {
+            elements = (void *)CFBridgingRetain(indexBuffer);
+        }
+    }
+
+    drawQueueAdd(&STATE(draw_queue), mode, type, elements, start, count, basevertex);
+}
+
+#pragma mark command buffer serials
+// numbers the current command buffer, work fenced on the serial is done once completedSerial reaches it
+- (GLuint64) commandBufferSerial
+{
+    // nothing more goes into a committed command buffer
+    if (_currentCommandBuffer == nil || _currentCommandBuffer.status >= MTLCommandBufferStatusCommitted)
+    {
+        [self newCommandBuffer];
+    }
+
+    if (_currentCommandBuffer == nil)
+        return _commandBufferSerial;
+
+    if (_serialCommandBuffer != _currentCommandBuffer)
+    {
+        GLuint64 serial;
+
+        serial = ++_commandBufferSerial;
+        _serialCommandBuffer = _currentCommandBuffer;
+
+        id<MTLSharedEvent> timeline = _timeline;
+
+        [_currentCommandBuffer addCompletedHandler:^(id<MTLCommandBuffer> commandBuffer) {
+            GPUTimes *times;
+
+            times = &self->_gpuTimes[serial % GPU_TIMES];
+            times->start = commandBuffer.GPUStartTime;
+            times->end = commandBuffer.GPUEndTime;
+
+            __atomic_store_n(&times->serial, serial, __ATOMIC_RELEASE);
+            __atomic_store_n(&self->_completedSerial, serial, __ATOMIC_RELEASE);
+
+            // wakes client waits and releases gpu waits in other contexts
+            timeline.signaledValue = serial;
+        }];
+    }
+
+    return _commandBufferSerial;
+}
+
+- (GLuint64) completedSerial
+{
+    return __atomic_load_n(&_completedSerial, __ATOMIC_ACQUIRE);
+}
+
+// commits what has been encoded so far and carries on in a new command buffer
+- (void) splitCommandBuffer
+{
+    [self flushCommandBuffer: false];
+
+    if (_currentCommandBuffer == nil || _currentCommandBuffer.status >= MTLCommandBufferStatusCommitted)
+    {
+        [self newCommandBuffer];
+    }
+}
+
+#pragma mark client arrays
+// the command buffer a draw is going into owns what it takes from the ring until it completes
+- (void *) uploadRingAlloc: (size_t) length offset: (GLuint64 *) offset
+{
+    UploadRing *ring;
+    id<MTLBuffer> ringBuffer;
+    GLuint64 serial;
+
+    ring = &STATE(upload_ring);
+
+    if (_currentCommandBuffer == nil)
+        return NULL;
+
+    serial = [self commandBufferSerial];
+
+    uploadRingRetire(ring, [self completedSerial]);
+
+    // a fence per command buffer, when older ones hold all of them wait for the oldest
+    // to finish, growing the ring wouldn't give back any fences
+    if (ring->mtl_data && uploadRingFence(ring, serial) == GL_FALSE)
+    {
+        TRACE_SCOPE("uploadRingWait", TRACE_SYNC);
+
+        if (![self waitTimeline: _timeline value: uploadRingOldestSerial(ring) timeout: FRAME_PACING_TIMEOUT])
+        {
+            NSLog(@"MGL WARNING: uploadRingAlloc - timed out waiting for serial %llu", uploadRingOldestSerial(ring));
+        }
+
+        uploadRingRetire(ring, [self completedSerial]);
+    }
+
+    if (ring->mtl_data == NULL ||
+        uploadRingFence(ring, serial) == GL_FALSE ||
+        uploadRingAlloc(ring, length, offset) == GL_FALSE)
+    {
+        GLuint64 size;
+
+        // everything in the ring is still in flight, the command buffers using the old
+        // buffer keep it alive until they complete
+        size = ring->mtl_data ? ring->size * 2 : ring->size;
+        while(size < length)
+            size *= 2;
+
+        ringBuffer = [_device newBufferWithLength: size
+                                          options: MTLResourceCPUCacheModeWriteCombined | MTLResourceStorageModeShared];
+        if (ringBuffer == nil)
+        {
+            NSLog(@"MGL ERROR: uploadRingAlloc - failed to create a %llu byte upload ring", size);
+            return NULL;
+        }
+
+        if (ring->mtl_data)
+        {
+            CFBridgingRelease(ring->mtl_data);
+            uploadRingReset(ring, size);
+        }
+        else
+        {
+            ring->size = size;
+        }
+
+        ring->mtl_data = (void *)CFBridgingRetain(ringBuffer);
+
+        uploadRingFence(ring, serial);
+
+        if (uploadRingAlloc(ring, length, offset) == GL_FALSE)
+            return NULL;
+    }
+
+    ringBuffer = (__bridge id<MTLBuffer>)ring->mtl_data;
+
+    STATS_ADD(bytes_uploaded, length);
+
+    return (GLubyte *)ringBuffer.contents + *offset;
+}
+
+// client vertex arrays or, with no element buffer bound, client indices
+- (bool) hasClientArrays: (GLenum) type
+{
+    if (VAO() == NULL)
+        return false;
+
+    if (VAO_STATE(client_attribs) & VAO_STATE(enabled_attribs))
+        return true;
+
+    return (type && getElementBuffer(ctx) == NULL);
+}
+
+// copies the client arrays for vertices first .. last (instances for instanced arrays) to the
+// ring and binds them where mapBuffersToMTL left them a slot
+- (bool) streamClientArrays: (GLuint64) first last: (GLuint64) last instancecount: (GLsizei) instancecount baseinstance: (GLuint) baseinstance
+{
+    BufferMapList *map_list;
+
+    map_list = &ctx->state.vertex_buffer_map_list;
+
+    for(int i=0; i<map_list->count; i++)
+    {
+        VertexAttrib *attrib;
+        BoundBuffer *bound;
+        GLuint64 start, elements, length, offset;
+        GLsizei element_size;
+        void *dst;
+
+        if (map_list->buffers[i].buf)
+            continue;
+
+        attrib = &VAO_ATTRIB_STATE(__builtin_ctz(map_list->buffers[i].attribute_mask));
+
+        if (attrib->divisor)
+        {
+            start = 0;
+            elements = baseinstance + (instancecount - 1) / attrib->divisor + 1;
+        }
+        else
+        {
+            start = first;
+            elements = last - first + 1;
+        }
+
+        // the last element is only as long as the attrib, not the stride
+        element_size = genStrideFromTypeSize(attrib->type, attrib->size);
+        if (element_size > attrib->stride)
+            element_size = attrib->stride;
+
+        length = (elements - 1) * attrib->stride + element_size;
+
+        dst = [self uploadRingAlloc: length offset: &offset];
+        if (dst == NULL)
+        {
+            NSLog(@"MGL ERROR: streamClientArrays - no room for %llu bytes of client array", length);
+            return false;
+        }
+
+        memcpy(dst, (const GLubyte *)attrib->ptr + start * attrib->stride, length);
+
+        bound = &_boundVertexBuffers[i];
+
+        if (bound->bytes == false && bound->obj == STATE(upload_ring).mtl_data)
+        {
+            if (bound->offset != offset)
+            {
+                [_currentRenderEncoder setVertexBufferOffset: offset atIndex: i];
+                STATE(binding_calls)++;
+
+                bound->offset = offset;
+            }
+
+            continue;
+        }
+
+        [_currentRenderEncoder setVertexBuffer: (__bridge id<MTLBuffer>)STATE(upload_ring).mtl_data offset: offset atIndex: i];
+        STATE(binding_calls)++;
+
+        *bound = (BoundBuffer){STATE(upload_ring).mtl_data, offset, false, 0};
+    }
+
+    return true;
+}
+
+// draws reading client memory, only the vertex range the draw uses is copied, when nothing
+// else reads vertices in place the copy starts at the first vertex and the draw is rebased
+- (void) drawStreamed: (GLenum) mode type: (GLenum) type indices: (const void *) indices first: (GLint) first
+                count: (GLsizei) count instancecount: (GLsizei) instancecount
+           basevertex: (GLint) basevertex baseinstance: (GLuint) baseinstance
+{
+    Buffer *gl_element_buffer;
+    const void *index_data;
+    GLuint min_index, max_index, restart_index;
+    GLint64 first_vertex, last_vertex;
+    GLuint64 lo;
+    size_t index_size;
+    bool restart, rebase;
+
+    if (count <= 0 || instancecount <= 0)
+        return;
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    gl_element_buffer = NULL;
+    index_data = NULL;
+    index_size = 0;
+    restart = false;
+
+    if (type == 0)
+    {
+        min_index = first;
+        max_index = first + count - 1;
+    }
+    else
+    {
+        index_size = (type == GL_UNSIGNED_BYTE) ? 1 : (type == GL_UNSIGNED_SHORT) ? 2 : 4;
+        restart = [self primitiveRestart: type index: &restart_index];
+
+        gl_element_buffer = getElementBuffer(ctx);
+
+        if (gl_element_buffer)
+        {
+            size_t offset;
+
+            RETURN_ON_FAILURE([self processBuffer: gl_element_buffer]);
+
+            offset = (char *)indices - (char *)NULL;
+
+            if (offset + count * index_size > gl_element_buffer->size)
+            {
+                NSLog(@"MGL ERROR: drawStreamed - indices past the end of the element buffer");
+                return;
+            }
+
+            id<MTLBuffer> sourceBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+
+            index_data = (const GLubyte *)sourceBuffer.contents + offset;
+        }
+        else
+        {
+            RETURN_ON_NULL(indices);
+
+            index_data = indices;
+        }
+
+        // nothing but restart indices
+        if (scanIndexRange(type, index_data, count, restart, restart_index, &min_index, &max_index) == GL_FALSE)
+            return;
+    }
+
+    first_vertex = (GLint64)min_index + basevertex;
+    last_vertex = (GLint64)max_index + basevertex;
+
+    if (first_vertex < 0)
+    {
+        NSLog(@"MGL ERROR: drawStreamed - basevertex reads before the start of the client arrays");
+        return;
+    }
+
+    // vertices can only move when every per vertex attrib is copied and the indices, if
+    // there are any, are copied too
+    rebase = (gl_element_buffer == NULL);
+
+    for(int i=0; rebase && i<ctx->state.max_vertex_attribs; i++)
+    {
+        if ((VAO_STATE(enabled_attribs) & (0x1 << i)) &&
+            (VAO_STATE(client_attribs) & (0x1 << i)) == 0 &&
+            VAO_ATTRIB_STATE(i).divisor == 0)
+        {
+            rebase = false;
+        }
+    }
+
+    lo = rebase ? first_vertex : 0;
+
+    if ([self streamClientArrays: lo last: last_vertex instancecount: instancecount baseinstance: baseinstance] == false)
+        return;
+
+    if (type == 0)
+    {
+        if ([self needsIndexTranslation: mode type: 0])
+        {
+            [self drawTranslated: mode type: 0 indices: NULL first: (GLint)(first - lo) count: count
+                   instancecount: instancecount basevertex: 0 baseinstance: baseinstance];
+            return;
+        }
+
+        [_currentRenderEncoder drawPrimitives: getMTLPrimitiveType(mode) vertexStart: first - lo vertexCount: count
+                                instanceCount: instancecount baseInstance: baseinstance];
+        return;
+    }
+
+    // indices in a buffer object stay there
+    if (gl_element_buffer)
+    {
+        if ([self needsIndexTranslation: mode type: type])
+        {
+            [self drawTranslated: mode type: type indices: indices first: 0 count: count
+                   instancecount: instancecount basevertex: basevertex baseinstance: baseinstance];
+            return;
+        }
+
+        [_currentRenderEncoder drawIndexedPrimitives: getMTLPrimitiveType(mode)
+                                          indexCount: count
+                                           indexType: getMTLIndexType(type)
+                                         indexBuffer: (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data)
+                                   indexBufferOffset: (char *)indices - (char *)NULL
+                                       instanceCount: instancecount
+                                          baseVertex: basevertex
+                                        baseInstance: baseinstance];
+        return;
+    }
+
+    IndexSource src;
+    IndexTranslation result;
+    GLuint64 offset;
+    bool translate;
+    void *dst;
+
+    src.mode = mode;
+    src.type = type;
+    src.indices = index_data;
+    src.first = 0;
+    src.count = count;
+    src.restart = restart;
+    src.restart_index = restart ? restart_index : 0;
+
+    translate = [self needsIndexTranslation: mode type: type];
+
+    if (translate)
+    {
+        indexTranslationPlan(&src, &result);
+
+        // nothing but partial primitives
+        if (result.count == 0)
+            return;
+    }
+    else
+    {
+        result.mode = mode;
+        result.type = type;
+        result.count = count;
+    }
+
+    dst = [self uploadRingAlloc: result.count * (result.type == GL_UNSIGNED_INT ? sizeof(GLuint) : sizeof(GLushort))
+                         offset: &offset];
+    if (dst == NULL)
+    {
+        NSLog(@"MGL ERROR: drawStreamed - no room for %u client indices", result.count);
+        return;
+    }
+
+    // rebased indices already point at the copied vertices, basevertex is folded in
+    if (translate)
+    {
+        translateIndices(&src, &result, dst);
+        rebaseIndices(result.type, dst, dst, result.count, rebase ? min_index : 0, GL_TRUE);
+    }
+    else
+    {
+        rebaseIndices(type, index_data, dst, count, rebase ? min_index : 0, restart);
+    }
+
+    [_currentRenderEncoder drawIndexedPrimitives: getMTLPrimitiveType(result.mode)
+                                      indexCount: result.count
+                                       indexType: getMTLIndexType(result.type)
+                                     indexBuffer: (__bridge id<MTLBuffer>)STATE(upload_ring).mtl_data
+                               indexBufferOffset: offset
+                                   instanceCount: instancecount
+                                      baseVertex: rebase ? 0 : basevertex
+                                    baseInstance: baseinstance];
+}
+
+#pragma mark C interface to mtlDrawArrays
+-(void) mtlDrawArrays: (GLMContext) ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count
+{
+    MTLPrimitiveType primitiveType;
+
+    // AGGRESSIVE MEMORY SAFETY: Immediate validation before any Metal operations (realistic bounds)
+    if (!ctx || ((uintptr_t)ctx < 0x1000) || ((uintptr_t)ctx > 0x100000000000ULL)) {
+        NSLog(@"MGL ERROR: mtlDrawArrays - Invalid context detected, aborting");
+        return; // Early return to prevent crash
+    }
+
+    if ([self hasClientArrays: 0])
+    {
+        [self drawStreamed: mode type: 0 indices: NULL first: first count: count
+             instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    if ([self canQueueDraw: mode type: 0])
+    {
+        // nothing to bind, the encoder is as the last draw left it
+        STATE(binding_calls) = 0;
+        renderPassDraw(&STATE(render_pass));
+
+        [self queueDraw: mode type: 0 indexBuffer: nil start: first count: count basevertex: 0];
+        return;
+    }
+
+    if ([self processGLState: true] == false) {
+        NSLog(@"MGL ERROR: mtlDrawArrays - processGLState failed, aborting");
+        return; // Early return instead of continuing with invalid state
+    }
+
+    // Additional safety check after processGLState
+    if (!_currentRenderEncoder) {
+        NSLog(@"MGL ERROR: mtlDrawArrays - No current render encoder, aborting");
+        return;
+    }
+
+    if ([self needsIndexTranslation: mode type: 0])
+    {
+        [self drawTranslated: mode type: 0 indices: NULL first: first count: count
+               instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    // drawn when the state changes or the encoder ends
+    [self queueDraw: mode type: 0 indexBuffer: nil start: first count: count basevertex: 0];
+}
+
+void mtlDrawArrays(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count)
+{
+    // FINAL FAILSAFE: Catch any unhandled exceptions to prevent QEMU crashes
+    @try {
+        // Validate context before bridging (realistic bounds for 64-bit systems)
+        if (!glm_ctx || ((uintptr_t)glm_ctx < 0x1000) || ((uintptr_t)glm_ctx > 0x100000000000ULL)) {
+            NSLog(@"MGL CRITICAL: mtlDrawArrays - Invalid GLM context, aborting operation");
+            return;
+        }
+
+        // Validate the Metal object pointer (realistic bounds for 64-bit systems)
+        if (!glm_ctx->mtl_funcs.mtlObj || ((uintptr_t)glm_ctx->mtl_funcs.mtlObj < 0x1000) || ((uintptr_t)glm_ctx->mtl_funcs.mtlObj > 0x100000000000ULL)) {
+            NSLog(@"MGL CRITICAL: mtlDrawArrays - Invalid Metal object, aborting operation");
+            return;
+        }
+
+        [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArrays: glm_ctx mode: mode first: first count: count];
+    } @catch (NSException *exception) {
+        NSLog(@"MGL CRITICAL: mtlDrawArrays - Unhandled exception caught: %@", exception);
+        NSLog(@"MGL CRITICAL: Exception reason: %@", [exception reason]);
+        NSLog(@"MGL CRITICAL: This is a failsafe to prevent QEMU crashes");
+        // Don't crash, just return gracefully
+    } @catch (id exception) {
+        NSLog(@"MGL CRITICAL: mtlDrawArrays - Unknown exception caught: %@", exception);
+        // Final safety net
+    }
+}
+
+#pragma mark C interface to mtlDrawElements
+-(void) mtlDrawElements: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    size_t offset = (char *)indices - (char *)NULL;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    if ([self canQueueDraw: mode type: type])
+    {
+        // nothing to bind, the encoder is as the last draw left it
+        STATE(binding_calls) = 0;
+        renderPassDraw(&STATE(render_pass));
+
+        [self queueDraw: mode type: type indexBuffer: (__bridge id<MTLBuffer>)(getElementBuffer(ctx)->data.mtl_data)
+                  start: offset count: count basevertex: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    [self queueDraw: mode type: type indexBuffer: indexBuffer start: offset count: count basevertex: 0];
+}
+
+void mtlDrawElements(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    // Call the Objective-C method using Objective-C syntax
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElements: glm_ctx mode: mode count: count type: type indices: indices];
+}
+
+
+#pragma mark C interface to mtlDrawRangeElements
+-(void) mtlDrawRangeElements: (GLMContext) glm_ctx mode:(GLenum) mode start:(GLuint) start end:(GLuint) end count: (GLsizei) count type: (GLenum) type indices:(const void *)indices
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: 1 basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    // start / end bound the index values, the indices start at the offset
+    size_t offset = (char *)indices - (char *)NULL;
+
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType
+                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1];
 }
 
-void mtlDrawElements(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices)
+void mtlDrawRangeElements(GLMContext glm_ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
 {
-    // Call the Objective-C method using Objective-C syntax
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElements: glm_ctx mode: mode count: count type: type indices: indices];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawRangeElements: glm_ctx mode: mode start: start end: end count: count type: type indices: indices];
 }
 
 
-#pragma mark C interface to mtlDrawRangeElements
--(void) mtlDrawRangeElements: (GLMContext) glm_ctx mode:(GLenum) mode start:(GLuint) start end:(GLuint) end count: (GLsizei) count type: (GLenum) type indices:(const void *)indices
+#pragma mark C interface to mtlDrawArraysInstanced
+-(void) mtlDrawArraysInstanced: (GLMContext) glm_ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count instancecount:(GLsizei) instancecount
+{
+    MTLPrimitiveType primitiveType;
+
+    if ([self hasClientArrays: 0])
+    {
+        [self drawStreamed: mode type: 0 indices: NULL first: first count: count
+             instancecount: instancecount basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: 0])
+    {
+        [self drawTranslated: mode type: 0 indices: NULL first: first count: count
+               instancecount: instancecount basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    [_currentRenderEncoder drawPrimitives:primitiveType vertexStart:first vertexCount:count instanceCount:instancecount];
+}
+
+void mtlDrawArraysInstanced(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysInstanced: glm_ctx mode: mode first: first count: count instancecount: instancecount];
+}
+
+
+#pragma mark C interface to mtlDrawElementsInstanced
+-(void) mtlDrawElementsInstanced: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: instancecount basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: instancecount basevertex: 0 baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    size_t offset = (char *)indices - (char *)NULL;
+
+    // for now lets just ignore the range data and use drawIndexedPrimitives
+    //
+    // in the future it would be an idea to use temp buffers for large buffers that would wire
+    // to much memory down.. like a million point galaxy drawing
+    //
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType
+                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount];
+}
+
+void mtlDrawElementsInstanced(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstanced: glm_ctx mode: mode count: count type: type indices: indices instancecount: instancecount];
+}
+
+
+#pragma mark C interface to mtlDrawElementsBaseVertex
+-(void) mtlDrawElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices basevertex:(GLint) basevertex
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    size_t offset = (char *)indices - (char *)NULL;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: 1 basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    if ([self canQueueDraw: mode type: type])
+    {
+        // nothing to bind, the encoder is as the last draw left it
+        STATE(binding_calls) = 0;
+        renderPassDraw(&STATE(render_pass));
+
+        [self queueDraw: mode type: type indexBuffer: (__bridge id<MTLBuffer>)(getElementBuffer(ctx)->data.mtl_data)
+                  start: offset count: count basevertex: basevertex];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: 1 basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    [self queueDraw: mode type: type indexBuffer: indexBuffer start: offset count: count basevertex: basevertex];
+}
+
+void mtlDrawElementsBaseVertex(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsBaseVertex: glm_ctx mode: mode count: count type: type indices: indices basevertex: basevertex];
+}
+
+
+#pragma mark C interface to mtlDrawRangeElementsBaseVertex
+-(void) mtlDrawRangeElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode start: (GLuint) start end: (GLuint) end count: (GLsizei) count type: (GLenum) type indices:(const void *)indices basevertex:(GLint) basevertex
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: 1 basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: 1 basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    size_t offset = (char *)indices - (char *)NULL;
+
+    [_currentRenderEncoder drawIndexedPrimitives: primitiveType indexCount:count indexType: indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1 baseVertex:basevertex baseInstance:0];
+}
+
+void mtlDrawRangeElementsBaseVertex(GLMContext glm_ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawRangeElementsBaseVertex:glm_ctx mode:mode start: start end: end count: count type: type indices: indices basevertex:basevertex];
+}
+
+
+#pragma mark C interface to mtlDrawElementsInstancedBaseVertex
+-(void) mtlDrawElementsInstancedBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count:(GLuint) count type: (GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount basevertex:(GLint) basevertex
+{
+    MTLPrimitiveType primitiveType;
+    MTLIndexType indexType;
+
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: instancecount basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: instancecount basevertex: basevertex baseinstance: 0];
+        return;
+    }
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    indexType = getMTLIndexType(type);
+    assert(indexType != 0xFFFFFFFF);
+
+    Buffer *gl_element_buffer = getElementBuffer(ctx);
+    assert(gl_element_buffer);
+
+    if ([self processBuffer: gl_element_buffer] == false)
+        return;
+
+    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+    assert(indexBuffer);
+
+    size_t offset = (char *)indices - (char *)NULL;
+
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:basevertex baseInstance:0];
+}
+
+void mtlDrawElementsInstancedBaseVertex(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseVertex:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount basevertex:basevertex];
+}
+
+#pragma mark C interface to mtlDrawArraysIndirect
+-(void) mtlDrawArraysIndirect: (GLMContext) glm_ctx mode:(GLenum) mode indirect: (const void *) indirect
+{
+    MTLPrimitiveType primitiveType;
+
+    RETURN_ON_FAILURE([self processGLState: true]);
+
+    primitiveType = getMTLPrimitiveType(mode);
+    assert(primitiveType != 0xFFFFFFFF);
+
+    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
+    assert(gl_indirect_buffer);
+
+    if ([self processBuffer: gl_indirect_buffer] == false)
+        return;
+
+    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
+    assert(indirectBuffer);
+
+    [_currentRenderEncoder drawPrimitives:primitiveType indirectBuffer:indirectBuffer indirectBufferOffset:(uintptr_t)indirect];
+}
+
+void mtlDrawArraysIndirect(GLMContext glm_ctx, GLenum mode, const void *indirect)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysIndirect:glm_ctx mode:mode indirect:indirect];
+}
+
+
+#pragma mark C interface to mtlDrawElementsIndirect
+-(void) mtlDrawElementsIndirect: (GLMContext) glm_ctx mode:(GLenum) mode type:(GLenum) type indirect: (const void *) indirect
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
@@ -5608,6 +6962,7 @@ void mtlDrawElements(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
+    // get element buffer
     indexType = getMTLIndexType(type);
     assert(indexType != 0xFFFFFFFF);
 
@@ -5620,54 +6975,81 @@ void mtlDrawElements(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type
     id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
     assert(indexBuffer);
 
-    size_t offset = (char *)indices - (char *)NULL;
+    // get indirect buffer
+    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
+    assert(gl_indirect_buffer);
+
+    if ([self processBuffer: gl_indirect_buffer] == false)
+        return;
 
-    // indexBufferOffset is a byte offset
-    switch(indexType)
-    {
-        case MTLIndexTypeUInt16: start <<= 1; break;
-        case MTLIndexTypeUInt32: start <<= 2; break;
-    }
+    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
+    assert(indirectBuffer);
 
-    offset += start;
-    
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType
-                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1];
+    // draw indexed primitive
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexType:indexType indexBuffer: indexBuffer indexBufferOffset:0 indirectBuffer:indirectBuffer indirectBufferOffset:(uintptr_t)indirect];
 }
 
-void mtlDrawRangeElements(GLMContext glm_ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+void mtlDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type, const void *indirect)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawRangeElements: glm_ctx mode: mode start: start end: end count: count type: type indices: indices];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsIndirect:glm_ctx mode:mode type:type indirect:indirect];
 }
 
 
-#pragma mark C interface to mtlDrawArraysInstanced
--(void) mtlDrawArraysInstanced: (GLMContext) glm_ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count instancecount:(GLsizei) instancecount
+#pragma mark C interface to mtlDrawArraysInstancedBaseInstance
+-(void) mtlDrawArraysInstancedBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count instancecount:(GLsizei) instancecount baseinstance:(GLuint) baseinstance
 {
     MTLPrimitiveType primitiveType;
 
+    if ([self hasClientArrays: 0])
+    {
+        [self drawStreamed: mode type: 0 indices: NULL first: first count: count
+             instancecount: instancecount basevertex: 0 baseinstance: baseinstance];
+        return;
+    }
+
     RETURN_ON_FAILURE([self processGLState: true]);
 
+    if ([self needsIndexTranslation: mode type: 0])
+    {
+        [self drawTranslated: mode type: 0 indices: NULL first: first count: count
+               instancecount: instancecount basevertex: 0 baseinstance: baseinstance];
+        return;
+    }
+
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
-    [_currentRenderEncoder drawPrimitives:primitiveType vertexStart:first vertexCount:count instanceCount:instancecount];
+    [_currentRenderEncoder drawPrimitives:primitiveType vertexStart:first vertexCount:count instanceCount:instancecount baseInstance:baseinstance];
 }
 
-void mtlDrawArraysInstanced(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+void mtlDrawArraysInstancedBaseInstance(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysInstanced: glm_ctx mode: mode first: first count: count instancecount: instancecount];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysInstancedBaseInstance:glm_ctx mode:mode first:first count:count instancecount:instancecount baseinstance:baseinstance];
 }
 
 
-#pragma mark C interface to mtlDrawElementsInstanced
--(void) mtlDrawElementsInstanced: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount
+#pragma mark C interface to mtlDrawElementsInstancedBaseInstance
+-(void) mtlDrawElementsInstancedBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode  count: (GLsizei) count type:(GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount baseinstance:(GLuint) baseinstance
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
 
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: instancecount basevertex: 0 baseinstance: baseinstance];
+        return;
+    }
+
     RETURN_ON_FAILURE([self processGLState: true]);
 
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: instancecount basevertex: 0 baseinstance: baseinstance];
+        return;
+    }
+
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
@@ -5690,24 +7072,38 @@ void mtlDrawArraysInstanced(GLMContext glm_ctx, GLenum mode, GLint first, GLsize
     // in the future it would be an idea to use temp buffers for large buffers that would wire
     // to much memory down.. like a million point galaxy drawing
     //
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType
-                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount];
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:0 baseInstance:baseinstance];
 }
 
-void mtlDrawElementsInstanced(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+void mtlDrawElementsInstancedBaseInstance(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstanced: glm_ctx mode: mode count: count type: type indices: indices instancecount: instancecount];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseInstance:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount baseinstance:baseinstance];
 }
 
 
-#pragma mark C interface to mtlDrawElementsBaseVertex
--(void) mtlDrawElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type: (GLenum) type indices:(const void *)indices basevertex:(GLint) basevertex
+#pragma mark C interface to mtlDrawElementsInstancedBaseVertexBaseInstance
+-(void) mtlDrawElementsInstancedBaseVertexBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type:(GLenum) type indices:(const void *)indices
+                                                        instancecount:(GLsizei) instancecount basevertex:(GLint) basevertex baseinstance:(GLuint) baseinstance
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
 
+    if ([self hasClientArrays: type])
+    {
+        [self drawStreamed: mode type: type indices: indices first: 0 count: count
+             instancecount: instancecount basevertex: basevertex baseinstance: baseinstance];
+        return;
+    }
+
     RETURN_ON_FAILURE([self processGLState: true]);
 
+    if ([self needsIndexTranslation: mode type: type])
+    {
+        [self drawTranslated: mode type: type indices: indices first: 0 count: count
+               instancecount: instancecount basevertex: basevertex baseinstance: baseinstance];
+        return;
+    }
+
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
@@ -5725,62 +7121,71 @@ void mtlDrawElementsInstanced(GLMContext glm_ctx, GLenum mode, GLsizei count, GL
 
     size_t offset = (char *)indices - (char *)NULL;
 
-    [_currentRenderEncoder drawIndexedPrimitives: primitiveType indexCount:count indexType: indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1 baseVertex:basevertex baseInstance:0];
+    // for now lets just ignore the range data and use drawIndexedPrimitives
+    //
+    // in the future it would be an idea to use temp buffers for large buffers that would wire
+    // to much memory down.. like a million point galaxy drawing
+    //
+    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:basevertex baseInstance:baseinstance];
 }
 
-void mtlDrawElementsBaseVertex(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+void mtlDrawElementsInstancedBaseVertexBaseInstance(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsBaseVertex: glm_ctx mode: mode count: count type: type indices: indices basevertex: basevertex];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseVertexBaseInstance:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount basevertex:basevertex baseinstance:baseinstance];
 }
 
 
-#pragma mark C interface to mtlDrawRangeElementsBaseVertex
--(void) mtlDrawRangeElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode start: (GLuint) start end: (GLuint) end type: (GLenum) type indices:(const void *)indices basevertex:(GLint) basevertex
+#pragma mark C interface to mtlMultiDrawArrays
+-(void) mtlMultiDrawArrays: (GLMContext)glm_ctx mode:(GLenum) mode first:(const GLint *)first count:(const GLsizei *)count drawcount:(GLsizei) drawcount
 {
     MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+
+    // each sub draw streams the vertex range it reads
+    if ([self hasClientArrays: 0])
+    {
+        for(int i=0; i<drawcount; i++)
+        {
+            [self drawStreamed: mode type: 0 indices: NULL first: first[i] count: count[i]
+                 instancecount: 1 basevertex: 0 baseinstance: 0];
+        }
+        return;
+    }
 
     RETURN_ON_FAILURE([self processGLState: true]);
 
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
-
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
-
-    if ([self processBuffer: gl_element_buffer] == false)
-        return;
-
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
-
-    size_t offset = (char *)indices - (char *)NULL;
-
-    // indexBufferOffset is a byte offset
-    switch(indexType)
+    for(int i=0; i<drawcount; i++)
     {
-        case MTLIndexTypeUInt16: start <<= 1; break;
-        case MTLIndexTypeUInt32: start <<= 2; break;
+         [_currentRenderEncoder drawPrimitives: primitiveType
+                                  vertexStart: first[i]
+                                  vertexCount: count[i]];
     }
-
-    [_currentRenderEncoder drawIndexedPrimitives: primitiveType indexCount:end - start indexType: indexType indexBuffer:indexBuffer indexBufferOffset:offset+start instanceCount:1 baseVertex:basevertex baseInstance:0];
 }
 
-void mtlDrawRangeElementsBaseVertex(GLMContext glm_ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+void mtlMultiDrawArrays(GLMContext glm_ctx, GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawRangeElementsBaseVertex:glm_ctx mode:mode start: start end: end type: type indices: indices basevertex:basevertex];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawArrays:glm_ctx mode:mode first:first count:count drawcount:drawcount];
 }
 
 
-#pragma mark C interface to mtlDrawElementsInstancedBaseVertex
--(void) mtlDrawElementsInstancedBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count:(GLuint) count type: (GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount basevertex:(GLint) basevertex
+#pragma mark C interface to mtlMultiDrawElements
+-(void) mtlMultiDrawElements: (GLMContext)glm_ctx mode:(GLenum) mode count:(const GLsizei *)count type:(GLenum)type indices:(const void *const*)indices drawcount:(GLsizei) drawcount
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
 
+    if ([self hasClientArrays: type])
+    {
+        for(int i=0; i<drawcount; i++)
+        {
+            [self drawStreamed: mode type: type indices: indices[i] first: 0 count: count[i]
+                 instancecount: 1 basevertex: 0 baseinstance: 0];
+        }
+        return;
+    }
+
     RETURN_ON_FAILURE([self processGLState: true]);
 
     primitiveType = getMTLPrimitiveType(mode);
@@ -5798,59 +7203,51 @@ void mtlDrawRangeElementsBaseVertex(GLMContext glm_ctx, GLenum mode, GLuint star
     id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
     assert(indexBuffer);
 
-    size_t offset = (char *)indices - (char *)NULL;
+    for(int i=0; i<drawcount; i++)
+    {
+        size_t offset;
 
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:basevertex baseInstance:0];
-}
+        offset = (char *)indices[i] - (char *)NULL;
 
-void mtlDrawElementsInstancedBaseVertex(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
-{
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseVertex:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount basevertex:basevertex];
+        [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count[i] indexType:indexType
+                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1];
+    }
 }
 
-#pragma mark C interface to mtlDrawArraysIndirect
--(void) mtlDrawArraysIndirect: (GLMContext) glm_ctx mode:(GLenum) mode indirect: (const void *) indirect
+void mtlMultiDrawElements(GLMContext glm_ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
 {
-    MTLPrimitiveType primitiveType;
-
-    RETURN_ON_FAILURE([self processGLState: true]);
-
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
-
-    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
-    assert(gl_indirect_buffer);
-
-    if ([self processBuffer: gl_indirect_buffer] == false)
-        return;
-
-    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
-    assert(indirectBuffer);
-
-    [_currentRenderEncoder drawPrimitives:primitiveType indirectBuffer:indirectBuffer indirectBufferOffset:(DrawArraysIndirectCommand *)indirect - (DrawArraysIndirectCommand *)NULL];
+    // Call the Objective-C method using Objective-C syntax
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawElements: glm_ctx mode: mode count: count type: type indices: indices drawcount: drawcount];
 }
 
-void mtlDrawArraysIndirect(GLMContext glm_ctx, GLenum mode, const void *indirect)
-{
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysIndirect:glm_ctx mode:mode indirect:indirect];
-}
 
 
-#pragma mark C interface to mtlDrawElementsIndirect
--(void) mtlDrawElementsIndirect: (GLMContext) glm_ctx mode:(GLenum) mode type:(GLenum) type indirect: (const void *) indirect
+
+#pragma mark C interface to mtlMultiDrawElementsBaseVertex
+-(void) mtlMultiDrawElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count: (const GLsizei *) count type: (GLenum) type indices:(const void *const *)indices drawcount:(GLsizei) drawcount basevertex:(const GLint *) basevertex
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
 
+    if ([self hasClientArrays: type])
+    {
+        for(int i=0; i<drawcount; i++)
+        {
+            [self drawStreamed: mode type: type indices: indices[i] first: 0 count: count[i]
+                 instancecount: 1 basevertex: basevertex[i] baseinstance: 0];
+        }
+        return;
+    }
+
     RETURN_ON_FAILURE([self processGLState: true]);
 
     primitiveType = getMTLPrimitiveType(mode);
     assert(primitiveType != 0xFFFFFFFF);
 
-    // get element buffer
     indexType = getMTLIndexType(type);
     assert(indexType != 0xFFFFFFFF);
 
+    // element buffer
     Buffer *gl_element_buffer = getElementBuffer(ctx);
     assert(gl_element_buffer);
 
@@ -5860,328 +7257,702 @@ void mtlDrawArraysIndirect(GLMContext glm_ctx, GLenum mode, const void *indirect
     id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
     assert(indexBuffer);
 
-    // get indirect buffer
-    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
-    assert(gl_indirect_buffer);
 
-    if ([self processBuffer: gl_indirect_buffer] == false)
-        return;
+    for(int i=0; i<drawcount; i++)
+    {
+        size_t offset;
 
-    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
-    assert(indirectBuffer);
+        offset = (char *)indices[i] - (char *)NULL;
 
-    // draw indexed primitive
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexType:indexType indexBuffer: indexBuffer indexBufferOffset:0 indirectBuffer:indirectBuffer indirectBufferOffset:(DrawElementsIndirectCommand *)indirect - (DrawElementsIndirectCommand *)NULL];
+        [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count[i] indexType:indexType
+                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:count[i] baseVertex:basevertex[i] baseInstance:1];
+    }
 }
 
-void mtlDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type, const void *indirect)
+void mtlMultiDrawElementsBaseVertex(GLMContext glm_ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsIndirect:glm_ctx mode:mode type:type indirect:indirect];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawElementsBaseVertex: glm_ctx mode: mode count: count type: type indices: indices drawcount: drawcount basevertex:basevertex];
 }
 
 
-#pragma mark C interface to mtlDrawArraysInstancedBaseInstance
--(void) mtlDrawArraysInstancedBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode first: (GLint) first count: (GLsizei) count instancecount:(GLsizei) instancecount baseinstance:(GLuint) baseinstance
-{
-    MTLPrimitiveType primitiveType;
+#pragma mark multi draw indirect
+// one thread per gl command, commands past the draw count or drawing nothing are reset to no-ops
+// params matches MultiDrawIndirectParams
+static const char *multiDrawIndirectSource =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "\n"
+    "struct Params {\n"
+    "    uint command_offset;\n"
+    "    uint stride;\n"
+    "    uint max_count;\n"
+    "    uint count_offset;\n"
+    "    uint primitive;\n"
+    "    uint pad[3];\n"
+    "};\n"
+    "\n"
+    "struct Commands {\n"
+    "    command_buffer cmds [[id(0)]];\n"
+    "};\n"
+    "\n"
+    "static device const uint *command(uint i, device const uint *indirect, constant Params &p, device const uint *count)\n"
+    "{\n"
+    "    if (p.count_offset != 0xFFFFFFFF && i >= count[p.count_offset / 4])\n"
+    "        return nullptr;\n"
+    "\n"
+    "    device const uint *c = indirect + (p.command_offset + i * p.stride) / 4;\n"
+    "\n"
+    "    return (c[0] && c[1]) ? c : nullptr;\n"
+    "}\n"
+    "\n"
+    "kernel void mdi_arrays(uint i [[thread_position_in_grid]],\n"
+    "                       device const Commands &icb [[buffer(0)]],\n"
+    "                       device const uint *indirect [[buffer(1)]],\n"
+    "                       device const uint *count [[buffer(2)]],\n"
+    "                       constant Params &p [[buffer(3)]])\n"
+    "{\n"
+    "    if (i >= p.max_count)\n"
+    "        return;\n"
+    "\n"
+    "    render_command cmd(icb.cmds, i);\n"
+    "    device const uint *c = command(i, indirect, p, count);\n"
+    "\n"
+    "    if (c == nullptr)\n"
+    "        cmd.reset();\n"
+    "    else\n"
+    "        cmd.draw_primitives(primitive_type(p.primitive), c[2], c[0], c[1], c[3]);\n"
+    "}\n"
+    "\n"
+    "template <typename T>\n"
+    "static void encode_elements(uint i, device const Commands &icb, device const uint *indirect,\n"
+    "                            device const uint *count, constant Params &p, device T *indices)\n"
+    "{\n"
+    "    if (i >= p.max_count)\n"
+    "        return;\n"
+    "\n"
+    "    render_command cmd(icb.cmds, i);\n"
+    "    device const uint *c = command(i, indirect, p, count);\n"
+    "\n"
+    "    if (c == nullptr)\n"
+    "        cmd.reset();\n"
+    "    else\n"
+    "        cmd.draw_indexed_primitives(primitive_type(p.primitive), c[0], indices + c[2], c[1], c[3], c[4]);\n"
+    "}\n"
+    "\n"
+    "kernel void mdi_elements16(uint i [[thread_position_in_grid]],\n"
+    "                           device const Commands &icb [[buffer(0)]],\n"
+    "                           device const uint *indirect [[buffer(1)]],\n"
+    "                           device const uint *count [[buffer(2)]],\n"
+    "                           constant Params &p [[buffer(3)]],\n"
+    "                           device ushort *indices [[buffer(4)]])\n"
+    "{\n"
+    "    encode_elements(i, icb, indirect, count, p, indices);\n"
+    "}\n"
+    "\n"
+    "kernel void mdi_elements32(uint i [[thread_position_in_grid]],\n"
+    "                           device const Commands &icb [[buffer(0)]],\n"
+    "                           device const uint *indirect [[buffer(1)]],\n"
+    "                           device const uint *count [[buffer(2)]],\n"
+    "                           constant Params &p [[buffer(3)]],\n"
+    "                           device uint *indices [[buffer(4)]])\n"
+    "{\n"
+    "    encode_elements(i, icb, indirect, count, p, indices);\n"
+    "}\n";
+
+- (id<MTLComputePipelineState>) newMultiDrawIndirectPipeline: (id<MTLLibrary>) library name: (NSString *) name
+{
+    id<MTLFunction> function;
+    id<MTLComputePipelineState> pipeline;
+    __autoreleasing NSError *error = nil;
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+    function = [library newFunctionWithName: name];
+    if (function == nil)
+        return nil;
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    if (_mdiArgumentEncoder == nil)
+    {
+        _mdiArgumentEncoder = [function newArgumentEncoderWithBufferIndex: 0];
+    }
 
-    [_currentRenderEncoder drawPrimitives:primitiveType vertexStart:first vertexCount:count instanceCount:instancecount baseInstance:baseinstance];
+    pipeline = [_device newComputePipelineStateWithFunction: function error: &error];
+    if (pipeline == nil)
+    {
+        NSLog(@"MGL ERROR: multi draw indirect pipeline %@: %@", name, [error localizedDescription]);
+    }
+
+    return pipeline;
 }
 
-void mtlDrawArraysInstancedBaseInstance(GLMContext glm_ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+// the icb is reused by every batch, metal's hazard tracking orders an encode after the
+// previous batch's execute
+- (bool) reserveMultiDrawIndirect: (NSUInteger) count
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawArraysInstancedBaseInstance:glm_ctx mode:mode first:first count:count instancecount:instancecount baseinstance:baseinstance];
-}
+    if (_mdiEncodeArrays == nil)
+    {
+        id<MTLLibrary> library;
 
+        library = [self compileShader: multiDrawIndirectSource];
+        RETURN_FALSE_ON_NULL(library);
 
-#pragma mark C interface to mtlDrawElementsInstancedBaseInstance
--(void) mtlDrawElementsInstancedBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode  count: (GLsizei) count type:(GLenum) type indices:(const void *)indices instancecount:(GLsizei) instancecount baseinstance:(GLuint) baseinstance
-{
-    MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+        _mdiEncodeArrays = [self newMultiDrawIndirectPipeline: library name: @"mdi_arrays"];
+        _mdiEncodeElements16 = [self newMultiDrawIndirectPipeline: library name: @"mdi_elements16"];
+        _mdiEncodeElements32 = [self newMultiDrawIndirectPipeline: library name: @"mdi_elements32"];
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+        RETURN_FALSE_ON_NULL(_mdiEncodeArrays);
+        RETURN_FALSE_ON_NULL(_mdiEncodeElements16);
+        RETURN_FALSE_ON_NULL(_mdiEncodeElements32);
+        RETURN_FALSE_ON_NULL(_mdiArgumentEncoder);
+    }
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    if (count <= _mdiCapacity)
+        return true;
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+    MTLIndirectCommandBufferDescriptor *descriptor;
+    NSUInteger capacity;
 
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+    capacity = _mdiCapacity ? _mdiCapacity : 1024;
+    while(capacity < count)
+        capacity *= 2;
 
-    if ([self processBuffer: gl_element_buffer] == false)
-        return;
+    descriptor = [[MTLIndirectCommandBufferDescriptor alloc] init];
+    descriptor.commandTypes = MTLIndirectCommandTypeDraw | MTLIndirectCommandTypeDrawIndexed;
+    descriptor.inheritPipelineState = YES;
+    descriptor.inheritBuffers = YES;
+    descriptor.maxVertexBufferBindCount = 0;
+    descriptor.maxFragmentBufferBindCount = 0;
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+    _mdiCommands = [_device newIndirectCommandBufferWithDescriptor: descriptor maxCommandCount: capacity options: MTLResourceStorageModePrivate];
+    RETURN_FALSE_ON_NULL(_mdiCommands);
 
-    size_t offset = (char *)indices - (char *)NULL;
+    // earlier batches in flight keep the old icb and the argument buffer pointing at it
+    _mdiArguments = [_device newBufferWithLength: _mdiArgumentEncoder.encodedLength options: MTLResourceStorageModeShared];
+    RETURN_FALSE_ON_NULL(_mdiArguments);
 
-    // for now lets just ignore the range data and use drawIndexedPrimitives
-    //
-    // in the future it would be an idea to use temp buffers for large buffers that would wire
-    // to much memory down.. like a million point galaxy drawing
-    //
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:0 baseInstance:baseinstance];
+    _mdiCapacity = capacity;
+
+    [_mdiArgumentEncoder setArgumentBuffer: _mdiArguments offset: 0];
+    [_mdiArgumentEncoder setIndirectCommandBuffer: _mdiCommands atIndex: 0];
+
+    return true;
 }
 
-void mtlDrawElementsInstancedBaseInstance(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+// ends the pass, encodes the whole batch with one dispatch and draws it with one execute
+- (bool) encodeMultiDrawIndirect: (const MultiDrawIndirect *) mdi primitive: (MTLPrimitiveType) primitiveType
+                        indirect: (id<MTLBuffer>) indirectBuffer parameters: (id<MTLBuffer>) parameterBuffer
+                        elements: (id<MTLBuffer>) indexBuffer
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseInstance:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount baseinstance:baseinstance];
+    MultiDrawIndirectParams params;
+    id<MTLComputePipelineState> pipeline;
+    id<MTLComputeCommandEncoder> computeEncoder;
+    NSUInteger width;
+
+    if (multiDrawIndirectParams(mdi, primitiveType, &params) == GL_FALSE)
+        return false;
+
+    if ([self reserveMultiDrawIndirect: mdi->drawcount] == false)
+        return false;
+
+    switch(mdi->type)
+    {
+        case GL_UNSIGNED_SHORT: pipeline = _mdiEncodeElements16; break;
+        case GL_UNSIGNED_INT: pipeline = _mdiEncodeElements32; break;
+        default: pipeline = _mdiEncodeArrays; break;
+    }
+
+    // the commands can come from gpu work earlier in this command buffer, the encode has to follow it
+    [self endRenderEncoding];
+
+    computeEncoder = [_currentCommandBuffer computeCommandEncoder];
+    RETURN_FALSE_ON_NULL(computeEncoder);
+
+    [computeEncoder setComputePipelineState: pipeline];
+    [computeEncoder setBuffer: _mdiArguments offset: 0 atIndex: 0];
+    [computeEncoder setBuffer: indirectBuffer offset: 0 atIndex: 1];
+    [computeEncoder setBuffer: parameterBuffer ? parameterBuffer : indirectBuffer offset: 0 atIndex: 2];
+    [computeEncoder setBytes: &params length: sizeof(params) atIndex: 3];
+
+    if (indexBuffer)
+        [computeEncoder setBuffer: indexBuffer offset: 0 atIndex: 4];
+
+    [computeEncoder useResource: _mdiCommands usage: MTLResourceUsageWrite];
+
+    width = pipeline.threadExecutionWidth;
+    [computeEncoder dispatchThreadgroups: MTLSizeMake((mdi->drawcount + width - 1) / width, 1, 1)
+                   threadsPerThreadgroup: MTLSizeMake(width, 1, 1)];
+    [computeEncoder endEncoding];
+
+    // a new pass picks up the attachments with load actions and rebinds everything
+    RETURN_FALSE_ON_FAILURE([self processGLState: true]);
+
+    if (indexBuffer)
+        [_currentRenderEncoder useResource: indexBuffer usage: MTLResourceUsageRead];
+
+    [_currentRenderEncoder executeCommandsInBuffer: _mdiCommands withRange: NSMakeRange(0, mdi->drawcount)];
+
+    return true;
 }
 
-
-#pragma mark C interface to mtlDrawElementsInstancedBaseVertexBaseInstance
--(void) mtlDrawElementsInstancedBaseVertexBaseInstance: (GLMContext) glm_ctx mode:(GLenum) mode count: (GLsizei) count type:(GLenum) type indices:(const void *)indices
-                                                        instancecount:(GLsizei) instancecount basevertex:(GLint) basevertex baseinstance:(GLuint) baseinstance
+-(void) mtlMultiDrawIndirect: (GLMContext) glm_ctx mdi: (const MultiDrawIndirect *) mdi
 {
     MTLPrimitiveType primitiveType;
     MTLIndexType indexType;
+    GLuint drawcount;
 
     RETURN_ON_FAILURE([self processGLState: true]);
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    primitiveType = getMTLPrimitiveType(mdi->mode);
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+    // fans / loops need the commands on the cpu to translate
+    if (primitiveType == (MTLPrimitiveType)0xFFFFFFFF)
+    {
+        NSLog(@"MGL Error: multi draw indirect mode 0x%x unsupported\n", mdi->mode);
+        return;
+    }
 
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
+    assert(gl_indirect_buffer);
 
-    if ([self processBuffer: gl_element_buffer] == false)
+    if ([self processBuffer: gl_indirect_buffer] == false)
         return;
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+    id<MTLBuffer> indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
+    assert(indirectBuffer);
 
-    size_t offset = (char *)indices - (char *)NULL;
+    id<MTLBuffer> parameterBuffer = nil;
+    Buffer *gl_parameter_buffer = NULL;
 
-    // for now lets just ignore the range data and use drawIndexedPrimitives
-    //
-    // in the future it would be an idea to use temp buffers for large buffers that would wire
-    // to much memory down.. like a million point galaxy drawing
-    //
-    [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count indexType:indexType indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:instancecount baseVertex:basevertex baseInstance:baseinstance];
-}
+    if (mdi->count_offset != MDI_NO_COUNT_BUFFER)
+    {
+        gl_parameter_buffer = STATE(buffers[_PARAMETER_BUFFER]);
+        assert(gl_parameter_buffer);
 
-void mtlDrawElementsInstancedBaseVertexBaseInstance(GLMContext glm_ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
-{
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDrawElementsInstancedBaseVertexBaseInstance:glm_ctx mode:mode count:count type:type indices:indices instancecount:instancecount basevertex:basevertex baseinstance:baseinstance];
-}
+        if ([self processBuffer: gl_parameter_buffer] == false)
+            return;
 
+        parameterBuffer = (__bridge id<MTLBuffer>)(gl_parameter_buffer->data.mtl_data);
+        assert(parameterBuffer);
+    }
 
-#pragma mark C interface to mtlMultiDrawArrays
--(void) mtlMultiDrawArrays: (GLMContext)glm_ctx mode:(GLenum) mode first:(const GLint *)first count:(const GLsizei *)count drawcount:(GLsizei) drawcount
-{
-    MTLPrimitiveType primitiveType;
+    id<MTLBuffer> indexBuffer = nil;
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+    if (mdi->type)
+    {
+        Buffer *gl_element_buffer = getElementBuffer(ctx);
+        assert(gl_element_buffer);
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+        if ([self processBuffer: gl_element_buffer] == false)
+            return;
 
-    for(int i=0; i<drawcount; i++)
+        indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
+        assert(indexBuffer);
+    }
+
+    // a gpu written draw count can only be read on the gpu, small batches aren't worth a pass break
+    if (_mdiSupported &&
+        (parameterBuffer || mdi->drawcount >= MDI_BATCH_MIN_DRAWS))
     {
-         [_currentRenderEncoder drawPrimitives: primitiveType
-                                  vertexStart: first[i]
-                                  vertexCount: count[i]];
+        if ([self encodeMultiDrawIndirect: mdi primitive: primitiveType indirect: indirectBuffer
+                               parameters: parameterBuffer elements: indexBuffer])
+            return;
+
+        // the pass may have been ended
+        RETURN_ON_FAILURE([self processGLState: true]);
+    }
+
+    // one metal indirect draw per command, without icbs the count is what the cpu last wrote
+    drawcount = mdi->drawcount;
+
+    if (gl_parameter_buffer)
+        drawcount = multiDrawIndirectCount(mdi, gl_parameter_buffer->data.buffer_data);
+
+    indexType = mdi->type ? getMTLIndexType(mdi->type) : MTLIndexTypeUInt16;
+
+    for(GLuint i=0; i<drawcount; i++)
+    {
+        NSUInteger offset;
+
+        offset = multiDrawIndirectCommandOffset(mdi, i);
+
+        if (indexBuffer)
+        {
+            [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexType:indexType indexBuffer: indexBuffer indexBufferOffset:0 indirectBuffer:indirectBuffer indirectBufferOffset:offset];
+        }
+        else
+        {
+            [_currentRenderEncoder drawPrimitives:primitiveType indirectBuffer:indirectBuffer indirectBufferOffset:offset];
+        }
     }
 }
 
-void mtlMultiDrawArrays(GLMContext glm_ctx, GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+void mtlMultiDrawIndirect(GLMContext glm_ctx, const MultiDrawIndirect *mdi)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawArrays:glm_ctx mode:mode first:first count:count drawcount:drawcount];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawIndirect:glm_ctx mdi:mdi];
 }
 
+#pragma mark queries
+// sums the slots of an occlusion query into a query buffer, p.x is the slot count, p.y bit 0
+// asks for 64 bit results and bit 1 for any samples passed
+static const char *queryResolveSource =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "\n"
+    "kernel void query_resolve(device const ulong *slots [[buffer(0)]],\n"
+    "                          constant uint *segments [[buffer(1)]],\n"
+    "                          constant uint2 &p [[buffer(2)]],\n"
+    "                          device uint *result [[buffer(3)]])\n"
+    "{\n"
+    "    ulong sum = 0;\n"
+    "\n"
+    "    for (uint i = 0; i < p.x; i++)\n"
+    "        sum += slots[segments[i]];\n"
+    "\n"
+    "    if (p.y & 2)\n"
+    "        sum = sum != 0;\n"
+    "\n"
+    "    if (p.y & 1)\n"
+    "        *(device ulong *)result = sum;\n"
+    "    else\n"
+    "        *result = uint(min(sum, ulong(0xFFFFFFFF)));\n"
+    "}\n";
 
-#pragma mark C interface to mtlMultiDrawElements
--(void) mtlMultiDrawElements: (GLMContext)glm_ctx mode:(GLenum) mode count:(const GLsizei *)count type:(GLenum)type indices:(const void *const*)indices drawcount:(GLsizei) drawcount
+static bool occlusionQuery(const Query *query)
 {
-    MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+    switch(query->target)
+    {
+        case GL_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            return true;
+    }
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+    return false;
+}
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+// a new slot for every active occlusion query, visibility counting stops without any
+- (void) startVisibilitySegment
+{
+    QueryPool *pool;
+    GLuint slot;
+    bool active;
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+    pool = &STATE(query_pool);
 
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+    active = false;
+    for(int i=_SAMPLES_PASSED_QUERY; i<=_ANY_SAMPLES_PASSED_CONSERVATIVE_QUERY; i++)
+    {
+        if (STATE(active_queries[i]))
+            active = true;
+    }
 
-    if ([self processBuffer: gl_element_buffer] == false)
+    if (active == false || _currentRenderEncoder == nil)
+    {
+        [_currentRenderEncoder setVisibilityResultMode: MTLVisibilityResultModeDisabled offset: 0];
         return;
+    }
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+    if (queryPoolAlloc(pool, [self completedSerial], &slot) == GL_FALSE)
+    {
+        NSLog(@"MGL WARNING: startVisibilitySegment - all %d query slots in flight, samples not counted", QUERY_POOL_SLOTS);
+        [_currentRenderEncoder setVisibilityResultMode: MTLVisibilityResultModeDisabled offset: 0];
+        return;
+    }
 
-    for(int i=0; i<drawcount; i++)
+    ((GLuint64 *)((__bridge id<MTLBuffer>)pool->mtl_data).contents)[slot] = 0;
+
+    for(int i=_SAMPLES_PASSED_QUERY; i<=_ANY_SAMPLES_PASSED_CONSERVATIVE_QUERY; i++)
     {
-        size_t offset;
+        Query *query;
 
-        offset = (char *)indices[i] - (char *)NULL;
+        query = STATE(active_queries[i]);
 
-        [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count[i] indexType:indexType
-                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:1];
+        if (query == NULL)
+            continue;
+
+        if (query->segment_count == MAX_QUERY_SEGMENTS)
+        {
+            NSLog(@"MGL WARNING: startVisibilitySegment - query %u spans more than %d passes, samples not counted", query->name, MAX_QUERY_SEGMENTS);
+            continue;
+        }
+
+        queryPoolRetain(pool, slot);
+        query->segments[query->segment_count++] = slot;
     }
+
+    // the queries hold the slot now
+    queryPoolRelease(pool, slot, [self commandBufferSerial]);
+
+    [_currentRenderEncoder setVisibilityResultMode: MTLVisibilityResultModeCounting offset: slot * sizeof(GLuint64)];
 }
 
-void mtlMultiDrawElements(GLMContext glm_ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+- (void) releaseQuerySegments: (Query *) query
 {
-    // Call the Objective-C method using Objective-C syntax
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawElements: glm_ctx mode: mode count: count type: type indices: indices drawcount: drawcount];
+    for(GLuint i=0; i<query->segment_count; i++)
+    {
+        queryPoolRelease(&STATE(query_pool), query->segments[i], query->serial);
+    }
+
+    query->segment_count = 0;
 }
 
+-(void) mtlBeginQuery: (GLMContext) glm_ctx query: (Query *) query
+{
+    // slots from an earlier begin nobody read back
+    [self releaseQuerySegments: query];
 
+    switch(query->target)
+    {
+        case GL_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            // queued draws belong to whatever was counting before
+            [self flushDrawQueue];
 
+            if (STATE(query_pool).mtl_data == NULL)
+            {
+                id<MTLBuffer> visibilityBuffer;
 
-#pragma mark C interface to mtlMultiDrawElementsBaseVertex
--(void) mtlMultiDrawElementsBaseVertex: (GLMContext) glm_ctx mode:(GLenum) mode count: (const GLsizei *) count type: (GLenum) type indices:(const void *const *)indices drawcount:(GLsizei) drawcount basevertex:(const GLint *) basevertex
-{
-    MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+                visibilityBuffer = [_device newBufferWithLength: QUERY_POOL_SLOTS * sizeof(GLuint64)
+                                                        options: MTLResourceStorageModeShared];
+                if (visibilityBuffer == nil)
+                {
+                    NSLog(@"MGL ERROR: mtlBeginQuery - failed to create visibility result buffer");
+                    return;
+                }
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+                STATE(query_pool).mtl_data = (void *)CFBridgingRetain(visibilityBuffer);
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+                // the pass descriptor only takes the buffer on a new pass
+                [self endRenderEncoding];
+            }
 
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+            // without an open pass the next one starts the segment
+            if (_currentRenderEncoder)
+            {
+                [self startVisibilitySegment];
+            }
+            break;
 
-    // element buffer
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+        case GL_TIME_ELAPSED:
+            // the timer covers whole command buffers, start one for the query
+            [self splitCommandBuffer];
+            query->begin_serial = [self commandBufferSerial];
+            break;
+    }
+}
 
-    if ([self processBuffer: gl_element_buffer] == false)
-        return;
+void mtlBeginQuery(GLMContext glm_ctx, Query *query)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlBeginQuery: glm_ctx query: query];
+}
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+-(void) mtlEndQuery: (GLMContext) glm_ctx query: (Query *) query
+{
+    switch(query->target)
+    {
+        case GL_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            [self flushDrawQueue];
 
+            query->serial = [self commandBufferSerial];
 
-    for(int i=0; i<drawcount; i++)
-    {
-        size_t offset;
+            // the queries still active move on to a slot this one doesn't read
+            if (_currentRenderEncoder)
+            {
+                [self startVisibilitySegment];
+            }
+            break;
 
-        offset = (char *)indices[i] - (char *)NULL;
+        case GL_TIME_ELAPSED:
+        case GL_TIMESTAMP:
+            query->serial = [self commandBufferSerial];
+            [self splitCommandBuffer];
+            break;
 
-        [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexCount:count[i] indexType:indexType
-                                     indexBuffer:indexBuffer indexBufferOffset:offset instanceCount:count[i] baseVertex:basevertex[i] baseInstance:1];
+        default:
+            // primitives are counted as the draws are issued
+            query->result = query->primitives;
+            query->available = GL_TRUE;
+            break;
     }
 }
 
-void mtlMultiDrawElementsBaseVertex(GLMContext glm_ctx, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+void mtlEndQuery(GLMContext glm_ctx, Query *query)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawElementsBaseVertex: glm_ctx mode: mode count: count type: type indices: indices drawcount: drawcount basevertex:basevertex];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlEndQuery: glm_ctx query: query];
 }
 
-
--(void) mtlMultiDrawArraysIndirect: (GLMContext)glm_ctx mode:(GLenum) mode indirect:(const void *)indirect drawcount:(GLsizei) drawcount stride:(GLsizei)stride
+// host seconds of the command buffer with serial, 0 once it has been overwritten
+- (CFTimeInterval) gpuTime: (GLuint64) serial end: (bool) end
 {
-    MTLPrimitiveType primitiveType;
-
-    RETURN_ON_FAILURE([self processGLState: true]);
+    GPUTimes *times;
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+    times = &_gpuTimes[serial % GPU_TIMES];
 
-    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
-    assert(gl_indirect_buffer);
+    if (__atomic_load_n(&times->serial, __ATOMIC_ACQUIRE) != serial)
+        return 0;
 
-    if ([self processBuffer: gl_indirect_buffer] == false)
-        return;
+    return end ? times->end : times->start;
+}
 
-    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
-    assert(indirectBuffer);
+-(GLboolean) mtlGetQueryResult: (GLMContext) glm_ctx query: (Query *) query wait: (GLboolean) wait
+{
+    if (query->available)
+        return GL_TRUE;
 
-    for(int i=0; i<drawcount; i++)
+    if ([self completedSerial] < query->serial)
     {
-        size_t offset;
+        id<MTLCommandBuffer> commandBuffer;
 
-        if (stride)
+        // the result never comes back if the work isn't submitted
+        if (_serialCommandBuffer == _currentCommandBuffer &&
+            _currentCommandBuffer.status < MTLCommandBufferStatusCommitted)
         {
-            offset = (char *)((char *)indirect + i * stride) - (char *)NULL;
+            [self splitCommandBuffer];
+        }
+
+        if (wait == GL_FALSE)
+            return GL_FALSE;
+
+        // serials complete in order, the last numbered command buffer is at or past the query
+        commandBuffer = _serialCommandBuffer;
+
+        if (commandBuffer.status >= MTLCommandBufferStatusCommitted)
+        {
+            TRACE_SCOPE("queryResultWait", TRACE_SYNC);
+
+            [commandBuffer waitUntilCompleted];
+
+            // the completion handler runs after waitUntilCompleted returns
+            while([self completedSerial] < query->serial)
+                sched_yield();
         }
         else
         {
-            offset = (char *)indirect + i - (char *)NULL;
+            NSLog(@"MGL WARNING: mtlGetQueryResult - query %u command buffer was never committed", query->name);
         }
+    }
+
+    switch(query->target)
+    {
+        case GL_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            {
+                GLuint64 *slots, sum;
+
+                slots = (GLuint64 *)((__bridge id<MTLBuffer>)STATE(query_pool).mtl_data).contents;
+
+                sum = 0;
+                for(GLuint i=0; i<query->segment_count; i++)
+                    sum += slots[query->segments[i]];
+
+                query->result = (query->target == GL_SAMPLES_PASSED) ? sum : (sum != 0);
+
+                [self releaseQuerySegments: query];
+            }
+            break;
+
+        case GL_TIME_ELAPSED:
+            {
+                CFTimeInterval start, end;
+
+                start = [self gpuTime: query->begin_serial end: false];
+                end = [self gpuTime: query->serial end: true];
 
-        [_currentRenderEncoder drawPrimitives:primitiveType indirectBuffer:indirectBuffer indirectBufferOffset:offset];
+                query->result = (end > start && start > 0) ? (GLuint64)((end - start) * 1e9) : 0;
+            }
+            break;
+
+        case GL_TIMESTAMP:
+            query->result = (GLuint64)([self gpuTime: query->serial end: true] * 1e9);
+            break;
     }
+
+    query->available = GL_TRUE;
+
+    return GL_TRUE;
 }
 
-void mtlMultiDrawArraysIndirect(GLMContext glm_ctx, GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+GLboolean mtlGetQueryResult(GLMContext glm_ctx, Query *query, GLboolean wait)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawArraysIndirect:glm_ctx mode:mode indirect:indirect drawcount:drawcount stride:stride];
+    return [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlGetQueryResult: glm_ctx query: query wait: wait];
 }
 
-
--(void) mtlMultiDrawElementsIndirect: (GLMContext)glm_ctx mode:(GLenum) mode type:(GLenum)type indirect:(const void *)indirect drawcount:(GLsizei) drawcount stride:(GLsizei)stride
+// occlusion results the cpu doesn't have yet are summed on the gpu after the passes that count them
+-(void) mtlQueryResultToBuffer: (GLMContext) glm_ctx query: (Query *) query buffer: (Buffer *) buf offset: (GLintptr) offset is64: (GLboolean) is64
 {
-    MTLPrimitiveType primitiveType;
-    MTLIndexType indexType;
+    id<MTLComputeCommandEncoder> computeEncoder;
+    id<MTLBuffer> resultBuffer;
+    simd_uint2 params;
 
-    RETURN_ON_FAILURE([self processGLState: true]);
+    if (_queryResolve == nil)
+    {
+        id<MTLLibrary> library;
+        id<MTLFunction> function;
+        __autoreleasing NSError *error = nil;
 
-    primitiveType = getMTLPrimitiveType(mode);
-    assert(primitiveType != 0xFFFFFFFF);
+        library = [self compileShader: queryResolveSource];
+        RETURN_ON_NULL(library);
 
-    // get element buffer
-    indexType = getMTLIndexType(type);
-    assert(indexType != 0xFFFFFFFF);
+        function = [library newFunctionWithName: @"query_resolve"];
+        RETURN_ON_NULL(function);
 
-    Buffer *gl_element_buffer = getElementBuffer(ctx);
-    assert(gl_element_buffer);
+        _queryResolve = [_device newComputePipelineStateWithFunction: function error: &error];
+        if (_queryResolve == nil)
+        {
+            NSLog(@"MGL ERROR: query resolve pipeline: %@", [error localizedDescription]);
+            return;
+        }
+    }
 
-    if ([self processBuffer: gl_element_buffer] == false)
-        return;
+    RETURN_ON_FAILURE([self processBuffer: buf]);
 
-    id <MTLBuffer>indexBuffer = (__bridge id<MTLBuffer>)(gl_element_buffer->data.mtl_data);
-    assert(indexBuffer);
+    resultBuffer = (__bridge id<MTLBuffer>)(buf->data.mtl_data);
 
-    // get indirect buffer
-    Buffer *gl_indirect_buffer = getIndirectBuffer(ctx);
-    assert(gl_indirect_buffer);
+    [self flushDrawQueue];
+    [self endRenderEncoding];
 
-    if ([self processBuffer: gl_indirect_buffer] == false)
-        return;
+    // the slots are read by this command buffer now, they can't be reused before it completes
+    query->serial = [self commandBufferSerial];
 
-    id <MTLBuffer>indirectBuffer = (__bridge id<MTLBuffer>)(gl_indirect_buffer->data.mtl_data);
-    assert(indirectBuffer);
+    params = simd_make_uint2(query->segment_count, (is64 ? 1 : 0) | (query->target != GL_SAMPLES_PASSED ? 2 : 0));
 
-    for(int i=0; i<drawcount; i++)
-    {
-        size_t offset;
+    computeEncoder = [_currentCommandBuffer computeCommandEncoder];
+    RETURN_ON_NULL(computeEncoder);
 
-        if (stride)
-        {
-            offset = (char *)((char *)indirect + i * stride) - (char *)NULL;
-        }
-        else
-        {
-            offset = (char *)indirect + i - (char *)NULL;
-        }
+    [computeEncoder setComputePipelineState: _queryResolve];
+    [computeEncoder setBuffer: (__bridge id<MTLBuffer>)STATE(query_pool).mtl_data offset: 0 atIndex: 0];
+    [computeEncoder setBytes: query->segments length: sizeof(query->segments) atIndex: 1];
+    [computeEncoder setBytes: &params length: sizeof(params) atIndex: 2];
+    [computeEncoder setBuffer: resultBuffer offset: offset atIndex: 3];
+    [computeEncoder dispatchThreadgroups: MTLSizeMake(1, 1, 1) threadsPerThreadgroup: MTLSizeMake(1, 1, 1)];
+    [computeEncoder endEncoding];
+
+    // so a map of the query buffer sees the result
+    if (resultBuffer.storageMode == MTLStorageModeManaged)
+    {
+        id<MTLBlitCommandEncoder> blitEncoder;
 
-        // draw indexed primitive
-        [_currentRenderEncoder drawIndexedPrimitives:primitiveType indexType:indexType indexBuffer: indexBuffer indexBufferOffset:0 indirectBuffer:indirectBuffer indirectBufferOffset:offset];
+        blitEncoder = [_currentCommandBuffer blitCommandEncoder];
+        [blitEncoder synchronizeResource: resultBuffer];
+        [blitEncoder endEncoding];
     }
 }
 
-void mtlMultiDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+void mtlQueryResultToBuffer(GLMContext glm_ctx, Query *query, Buffer *buf, GLintptr offset, GLboolean is64)
 {
-    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlMultiDrawElementsIndirect:glm_ctx mode:mode type:type indirect:indirect drawcount:drawcount stride:stride];
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlQueryResultToBuffer: glm_ctx query: query buffer: buf offset: offset is64: is64];
+}
+
+-(void) mtlDeleteQuery: (GLMContext) glm_ctx query: (Query *) query
+{
+    [self releaseQuerySegments: query];
+}
+
+void mtlDeleteQuery(GLMContext glm_ctx, Query *query)
+{
+    [(__bridge id) glm_ctx->mtl_funcs.mtlObj mtlDeleteQuery: glm_ctx query: query];
 }
 
 #pragma mark C interface to context functions
@@ -6197,7 +7968,10 @@ void mtlMultiDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type,
     glm_ctx->mtl_funcs.mtlDeleteMTLObj = mtlDeleteMTLObj;
 
     glm_ctx->mtl_funcs.mtlGetSync = mtlGetSync;
-    glm_ctx->mtl_funcs.mtlWaitForSync = mtlWaitForSync;
+    glm_ctx->mtl_funcs.mtlSyncSignaled = mtlSyncSignaled;
+    glm_ctx->mtl_funcs.mtlClientWaitSync = mtlClientWaitSync;
+    glm_ctx->mtl_funcs.mtlWaitSync = mtlWaitSync;
+    glm_ctx->mtl_funcs.mtlDeleteSync = mtlDeleteSync;
     glm_ctx->mtl_funcs.mtlFlush = mtlFlush;
     glm_ctx->mtl_funcs.mtlSwapBuffers = mtlSwapBuffers;
     glm_ctx->mtl_funcs.mtlClearBuffer = mtlClearBuffer;
@@ -6207,7 +7981,9 @@ void mtlMultiDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type,
     glm_ctx->mtl_funcs.mtlMapUnmapBuffer = mtlMapUnmapBuffer;
     glm_ctx->mtl_funcs.mtlFlushBufferRange = mtlFlushBufferRange;
 
-    glm_ctx->mtl_funcs.mtlReadDrawable = mtlReadDrawable;
+    glm_ctx->mtl_funcs.mtlReadDrawableAsync = mtlReadDrawableAsync;
+    glm_ctx->mtl_funcs.mtlReadbackData = mtlReadbackData;
+    glm_ctx->mtl_funcs.mtlReadbackRelease = mtlReadbackRelease;
     glm_ctx->mtl_funcs.mtlGetTexImage = mtlGetTexImage;
     
     glm_ctx->mtl_funcs.mtlGenerateMipmaps = mtlGenerateMipmaps;
@@ -6231,11 +8007,16 @@ void mtlMultiDrawElementsIndirect(GLMContext glm_ctx, GLenum mode, GLenum type,
     glm_ctx->mtl_funcs.mtlMultiDrawArrays = mtlMultiDrawArrays;
     glm_ctx->mtl_funcs.mtlMultiDrawElements = mtlMultiDrawElements;
     glm_ctx->mtl_funcs.mtlMultiDrawElementsBaseVertex = mtlMultiDrawElementsBaseVertex;
-    glm_ctx->mtl_funcs.mtlMultiDrawArraysIndirect = mtlMultiDrawArraysIndirect;
-    glm_ctx->mtl_funcs.mtlMultiDrawElementsIndirect = mtlMultiDrawElementsIndirect;
+    glm_ctx->mtl_funcs.mtlMultiDrawIndirect = mtlMultiDrawIndirect;
 
     glm_ctx->mtl_funcs.mtlDispatchCompute = mtlDispatchCompute;
     glm_ctx->mtl_funcs.mtlDispatchComputeIndirect = mtlDispatchComputeIndirect;
+
+    glm_ctx->mtl_funcs.mtlBeginQuery = mtlBeginQuery;
+    glm_ctx->mtl_funcs.mtlEndQuery = mtlEndQuery;
+    glm_ctx->mtl_funcs.mtlGetQueryResult = mtlGetQueryResult;
+    glm_ctx->mtl_funcs.mtlQueryResultToBuffer = mtlQueryResultToBuffer;
+    glm_ctx->mtl_funcs.mtlDeleteQuery = mtlDeleteQuery;
 }
 
 - (id) initMGLRendererFromContext: (void *)glm_ctx andBindToWindow: (NSWindow *)window;
@@ -6314,6 +8095,9 @@ void* CppCreateMGLRendererHeadless (void *glm_ctx)
 {
     ctx = glm_ctx;
 
+    initDepthStencilCache(&_depthStencilCache);
+    initIndexCache(&_indexCache);
+
     // CRITICAL FIX: Initialize thread synchronization lock
     _metalStateLock = [[NSLock alloc] init];
     if (!_metalStateLock) {
@@ -6342,6 +8126,15 @@ void* CppCreateMGLRendererHeadless (void *glm_ctx)
 
     NSLog(@"MGL INFO: Metal device created: %@", _device);
 
+    // gpu encoded indirect command buffers back glMultiDraw*Indirect, pipelines have to opt in to them
+    _mdiSupported = [_device supportsFamily: MTLGPUFamilyMac2] || [_device supportsFamily: MTLGPUFamilyApple4];
+
+    // fence timeline, other contexts wait on it on the gpu
+    _timeline = [_device newSharedEvent];
+    _timeline.signaledValue = 0;
+    _timeline.label = @"GL Fence Timeline";
+    _timelineListener = [[MTLSharedEventListener alloc] initWithDispatchQueue: dispatch_queue_create("mgl.fence", DISPATCH_QUEUE_SERIAL)];
+
     // PROPER AGX VIRTUALIZATION DETECTION: Maintain Metal functionality with virtualization compatibility
     BOOL isVirtualized = NO;
     NSString *deviceName = [_device name];
@@ -6530,11 +8323,25 @@ void* CppCreateMGLRendererHeadless (void *glm_ctx)
             _currentRenderEncoder = nil;
         }
 
-        // Cleanup sync objects
-        if (_currentEvent) {
-            NSLog(@"MGL INFO: Releasing current sync event");
-            _currentEvent = nil;
+        depthStencilCacheClear(&_depthStencilCache, releaseDepthStencilState);
+        indexCacheClear(&_indexCache, releaseIndexBuffer);
+
+        if (ctx && STATE(upload_ring).mtl_data)
+        {
+            CFBridgingRelease(STATE(upload_ring).mtl_data);
+            STATE(upload_ring).mtl_data = NULL;
+        }
+        _serialCommandBuffer = nil;
+
+        if (ctx && STATE(query_pool).mtl_data)
+        {
+            CFBridgingRelease(STATE(query_pool).mtl_data);
+            STATE(query_pool).mtl_data = NULL;
         }
+        _queryResolve = nil;
+
+        _mdiCommands = nil;
+        _mdiArguments = nil;
 
         // Cleanup pipeline state
         if (_pipelineState) {
@@ -6705,6 +8512,7 @@ void* CppCreateMGLRendererHeadless (void *glm_ctx)
         }
 
         if (_currentRenderEncoder) {
+            [self applyRenderPassStoreActions];
             [_currentRenderEncoder endEncoding];
             _currentRenderEncoder = nil;
         }
@@ -27,6 +27,7 @@
 #include "glm_context.h"
 #include "buffers.h"
 #include "pixel_utils.h"
+#include "pixel_store.h"
 #include "mgl_safety.h"
 
 // Used to recover from a corrupted context pointer (e.g. small non-NULL values like 0x2f)
@@ -52,6 +53,7 @@ GLuint bufferIndexFromTarget(GLMContext ctx, GLenum target)
         case GL_COPY_WRITE_BUFFER: return _COPY_WRITE_BUFFER;
         case GL_DISPATCH_INDIRECT_BUFFER: return _DISPATCH_INDIRECT_BUFFER;
         case GL_DRAW_INDIRECT_BUFFER: return _DRAW_INDIRECT_BUFFER;
+        case GL_PARAMETER_BUFFER: return _PARAMETER_BUFFER;
         case GL_SHADER_STORAGE_BUFFER: return _SHADER_STORAGE_BUFFER;
 
         default:
@@ -138,6 +140,7 @@ bool checkTarget(GLMContext ctx, GLenum target)
         case GL_COPY_WRITE_BUFFER:
         case GL_DISPATCH_INDIRECT_BUFFER:
         case GL_DRAW_INDIRECT_BUFFER:
+        case GL_PARAMETER_BUFFER:
         case GL_SHADER_STORAGE_BUFFER:
             return true;
     }
@@ -237,6 +240,9 @@ void *getBufferData(GLMContext ctx, Buffer *ptr)
 
     ERROR_CHECK_RETURN(ptr->mapped == false, GL_INVALID_OPERATION);
 
+    // a pack buffer reused as the unpack source
+    resolveBufferReadback(ctx, ptr, true);
+
     buffer_data = (void *)ptr->data.buffer_data;
 
     ERROR_CHECK_RETURN(buffer_data, GL_INVALID_OPERATION);
@@ -250,6 +256,9 @@ void bufferStorage(GLMContext ctx, Buffer *ptr, GLenum target, GLuint index, GLs
     vm_address_t buffer_data;
     size_t buffer_size;
 
+    // the new store replaces whatever a pending readback would write
+    releaseBufferReadback(ctx, ptr);
+
     buffer_size = page_size_align(size);
 
     // Allocate directly from VM
@@ -270,6 +279,8 @@ void bufferStorage(GLMContext ctx, Buffer *ptr, GLenum target, GLuint index, GLs
         memcpy((void *)ptr->data.buffer_data, data, size);
 
         ptr->data.dirty_bits |= DIRTY_BUFFER_DATA;
+
+        STATS_ADD(bytes_uploaded, size);
     }
 
     // init
@@ -290,6 +301,8 @@ void bufferStorage(GLMContext ctx, Buffer *ptr, GLenum target, GLuint index, GLs
     }
 
     ptr->mapped = GL_FALSE;
+    STATE(map_generation)++;
+    BUMP_GENERATION(ptr);
     ptr->access = 0;
     ptr->access_flags = 0;
     ptr->storage_flags = storage_flags;
@@ -404,6 +417,55 @@ void mglCreateBuffers(GLMContext ctx, GLsizei n, GLuint *buffers)
     }
 }
 
+static void freeBuffer(GLMContext ctx, Buffer *ptr)
+{
+    releaseBufferReadback(ctx, ptr);
+
+    if (ptr->data.buffer_data)
+    {
+        if (ptr->storage_flags & GL_CLIENT_STORAGE_BIT)
+        {
+            if (ptr->data.mtl_data)
+            {
+                // the mtl buffer has a deallocator for the vm allocate
+                ctx->mtl_funcs.mtlDeleteMTLObj(ctx, ptr->data.mtl_data);
+            }
+            else
+            {
+                vm_deallocate(mach_host_self(), ptr->data.buffer_data, ptr->data.buffer_size);
+            }
+        }
+        else
+        {
+            if (ptr->data.mtl_data)
+            {
+                ctx->mtl_funcs.mtlDeleteMTLObj(ctx, ptr->data.mtl_data);
+            }
+        }
+
+        ptr->data.buffer_data = 0;
+    }
+
+    free(ptr);
+}
+
+void retainBuffer(GLMContext ctx, Buffer *ptr)
+{
+    ptr->refcount++;
+}
+
+void releaseBuffer(GLMContext ctx, Buffer *ptr)
+{
+    assert(ptr->refcount);
+
+    ptr->refcount--;
+
+    if (ptr->refcount == 0 && ptr->delete_status)
+    {
+        freeBuffer(ctx, ptr);
+    }
+}
+
 void mglDeleteBuffers(GLMContext ctx, GLsizei n, const GLuint *buffers)
 {
     GLuint buffer;
@@ -424,31 +486,6 @@ void mglDeleteBuffers(GLMContext ctx, GLsizei n, const GLuint *buffers)
 
             ptr = (Buffer *)searchHashTable(&STATE(buffer_table), buffer);
 
-            if (ptr->data.buffer_data)
-            {
-                if (ptr->storage_flags & GL_CLIENT_STORAGE_BIT)
-                {
-                    if (ptr->data.mtl_data)
-                    {
-                        // the mtl buffer has a deallocator for the vm allocate
-                        ctx->mtl_funcs.mtlDeleteMTLObj(ctx, ptr->data.mtl_data);
-                    }
-                    else
-                    {
-                        vm_deallocate(mach_host_self(), ptr->data.buffer_data, ptr->data.buffer_size);
-                    }
-                }
-                else
-                {
-                    if (ptr->data.mtl_data)
-                    {
-                        ctx->mtl_funcs.mtlDeleteMTLObj(ctx, ptr->data.mtl_data);
-                    }
-                }
-
-                ptr->data.buffer_data = 0;
-            }
-
             deleteHashElement(&STATE(buffer_table), buffer);
 
             // remove any dangling references
@@ -470,6 +507,7 @@ void mglDeleteBuffers(GLMContext ctx, GLsizei n, const GLuint *buffers)
                     if (VAO_ATTRIB_STATE(target).buffer->name == buffer)
                     {
                         VAO_ATTRIB_STATE(target).buffer = NULL;
+                        BUMP_GENERATION(VAO());
                     }
                 }
             }
@@ -495,7 +533,15 @@ void mglDeleteBuffers(GLMContext ctx, GLsizei n, const GLuint *buffers)
                 }
             }
 
-            free(ptr);
+            // a texture buffer keeps the store alive until it lets go
+            if (ptr->refcount)
+            {
+                ptr->delete_status = true;
+            }
+            else
+            {
+                freeBuffer(ctx, ptr);
+            }
         } // if (isBuffer(ctx, buffer))
     } // while(--n)
 }
@@ -537,6 +583,22 @@ void mglBindBuffer(GLMContext ctx, GLenum target, GLuint buffer)
     }
 }
 
+void mglBindBuffer_no_error(GLMContext ctx, GLenum target, GLuint buffer)
+{
+    Buffer *ptr;
+    GLint index;
+
+    ptr = buffer ? getBuffer(ctx, target, buffer) : NULL;
+
+    index = bufferIndexFromTarget(ctx, target);
+
+    if (STATE(buffers[index]) != ptr)
+    {
+        STATE(buffers[index]) = ptr;
+        STATE(dirty_bits) |= DIRTY_BUFFER;
+    }
+}
+
 void mglBindBufferBase(GLMContext ctx, GLenum target, GLuint index, GLuint buffer)
 {
     Buffer  *ptr;
@@ -665,6 +727,9 @@ kern_return_t initBufferData(GLMContext ctx, Buffer *ptr, GLsizeiptr size, const
     vm_address_t buffer_data;
     size_t buffer_size;
 
+    // the new store replaces whatever a pending readback would write
+    releaseBufferReadback(ctx, ptr);
+
     if (ptr->data.buffer_data)
     {
         if (isUniformConstant)
@@ -678,6 +743,7 @@ kern_return_t initBufferData(GLMContext ctx, Buffer *ptr, GLsizeiptr size, const
                     memcpy((void *)ptr->data.buffer_data, data, size);
                     
                     ptr->data.dirty_bits |= DIRTY_BUFFER_DATA;
+                    BUMP_GENERATION(ptr);
                 }
                 
                 return 0;
@@ -738,6 +804,7 @@ kern_return_t initBufferData(GLMContext ctx, Buffer *ptr, GLsizeiptr size, const
     ptr->data.buffer_size = buffer_size;
 
     ptr->data.dirty_bits |= DIRTY_BUFFER_ADDR;
+    BUMP_GENERATION(ptr);
 
     // copy to new buffer
     if (data)
@@ -825,6 +892,30 @@ void mglNamedBufferData(GLMContext ctx, GLuint buffer, GLsizeiptr size, const vo
     ptr->storage_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_DYNAMIC_STORAGE_BIT;
 }
 
+void writeBufferSubData(GLMContext ctx, Buffer *ptr, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    // land an earlier glReadPixels first so it can't overwrite this data later
+    resolveBufferReadback(ctx, ptr, true);
+
+    BUMP_GENERATION(ptr);
+
+    STATS_ADD(bytes_uploaded, size);
+
+    if (ptr->storage_flags & (GL_CLIENT_STORAGE_BIT | GL_DYNAMIC_STORAGE_BIT))
+    {
+        memcpy((char*)ptr->data.buffer_data + offset, data, size);
+        ptr->data.dirty_bits |= DIRTY_BUFFER_DATA;
+        ctx->state.dirty_bits |= DIRTY_BUFFER;
+    }
+    else
+    {
+        if (ctx->mtl_funcs.mtlBufferSubData)
+        {
+            ctx->mtl_funcs.mtlBufferSubData(ctx, ptr, offset, size, data);
+        }
+    }
+}
+
 void mglBufferSubData(GLMContext ctx, GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
 {
     // Absolute first check - validate ctx before ANY access
@@ -907,18 +998,17 @@ void mglBufferSubData(GLMContext ctx, GLenum target, GLintptr offset, GLsizeiptr
                     offset, size, (long)ptr->data.buffer_size);
             ERROR_RETURN(GL_INVALID_VALUE);
         }
-        
-        memcpy((char*)ptr->data.buffer_data + offset, data, size);
-        ptr->data.dirty_bits |= DIRTY_BUFFER_DATA;
-        ctx->state.dirty_bits |= DIRTY_BUFFER;
-    }
-    else
-    {
-        if (ctx->mtl_funcs.mtlBufferSubData)
-        {
-            ctx->mtl_funcs.mtlBufferSubData(ctx, ptr, offset, size, data);
-        }
     }
+
+    writeBufferSubData(ctx, ptr, offset, size, data);
+}
+
+void mglBufferSubData_no_error(GLMContext ctx, GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    if (size == 0)
+        return;
+
+    writeBufferSubData(ctx, STATE(buffers[bufferIndexFromTarget(ctx, target)]), offset, size, data);
 }
 
 void mglNamedBufferSubData(GLMContext ctx, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
@@ -956,6 +1046,10 @@ void mglNamedBufferSubData(GLMContext ctx, GLuint buffer, GLintptr offset, GLsiz
         ERROR_RETURN(GL_INVALID_OPERATION);
     }
 
+    BUMP_GENERATION(ptr);
+
+    STATS_ADD(bytes_uploaded, size);
+
     if (ptr->storage_flags & (GL_CLIENT_STORAGE_BIT | GL_DYNAMIC_STORAGE_BIT))
     {
         // CRITICAL SECURITY FIX: Proper NULL pointer validation for vm_address_t
@@ -1017,6 +1111,10 @@ void copyBufferSubData(GLMContext ctx, Buffer *src_buf, Buffer *dst_buf, GLintpt
         ERROR_RETURN(GL_INVALID_VALUE);
     }
 
+    // both sides must see pixels from an earlier glReadPixels
+    resolveBufferReadback(ctx, src_buf, true);
+    resolveBufferReadback(ctx, dst_buf, true);
+
     if (src_buf == dst_buf)
     {
         if (readOffset == writeOffset)
@@ -1061,6 +1159,7 @@ void copyBufferSubData(GLMContext ctx, Buffer *src_buf, Buffer *dst_buf, GLintpt
     assert(dst_data);
 
     memcpy(dst_data, src_data, size);
+    BUMP_GENERATION(dst_buf);
 
     ctx->mtl_funcs.mtlMapUnmapBuffer(ctx, dst_buf, writeOffset, size, GL_WRITE_ONLY, false);
 }
@@ -1206,6 +1305,157 @@ void mglClearNamedBufferSubData(GLMContext ctx, GLuint buffer, GLenum internalfo
     ERROR_CHECK_RETURN(err == true, GL_INVALID_ENUM);
 }
 
+#pragma mark Pixel Pack Readback
+bool queueBufferReadback(GLMContext ctx, Buffer *ptr, size_t offset, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    BufferReadback *readback;
+
+    if (ctx->mtl_funcs.mtlReadDrawableAsync == NULL)
+        return false;
+
+    if (ptr->readback == NULL)
+    {
+        ptr->readback = (BufferReadback *)calloc(1, sizeof(BufferReadback));
+
+        if (ptr->readback == NULL)
+            return false;
+    }
+
+    readback = ptr->readback;
+
+    // reads into the same buffer land in order
+    resolveBufferReadback(ctx, ptr, true);
+
+    readback->offset = offset;
+    readback->width = width;
+    readback->height = height;
+    readback->format = format;
+    readback->type = type;
+    readback->pack = STATE(pack);
+
+    readback->pending = ctx->mtl_funcs.mtlReadDrawableAsync(ctx, readback, x, y, width, height);
+
+    if (readback->pending)
+    {
+        // the next draw resolves it before the gpu reads this buffer
+        ptr->data.dirty_bits |= DIRTY_BUFFER_DATA;
+        ctx->state.dirty_bits |= DIRTY_BUFFER;
+    }
+
+    return readback->pending;
+}
+
+void resolveBufferReadback(GLMContext ctx, Buffer *ptr, GLboolean wait)
+{
+    BufferReadback *readback;
+    PixelStoreLayout layout;
+    GLubyte *src, *dst;
+    size_t span;
+
+    readback = ptr->readback;
+
+    if (readback == NULL || readback->pending == false)
+        return;
+
+    src = (GLubyte *)ctx->mtl_funcs.mtlReadbackData(ctx, readback, wait);
+
+    if (src == NULL)
+    {
+        // a blocking wait that returns nothing means the copy failed
+        if (wait)
+            readback->pending = false;
+
+        return;
+    }
+
+    readback->pending = false;
+
+    if (pixelStoreLayout(&readback->pack, 2, readback->format, readback->type, readback->width, readback->height, &layout) == false)
+        return;
+
+    span = pixelStoreSpan(&layout, readback->width, readback->height, 1);
+
+    if (readback->offset + span > (size_t)ptr->size)
+        return;
+
+    STATS_ADD(bytes_read_back, span);
+    BUMP_GENERATION(ptr);
+
+    if (ptr->data.mtl_data)
+        dst = (GLubyte *)ctx->mtl_funcs.mtlMapUnmapBuffer(ctx, ptr, 0, ptr->size, GL_MAP_WRITE_BIT, true);
+    else
+        dst = (GLubyte *)ptr->data.buffer_data;
+
+    if (dst == NULL)
+        return;
+
+    convertReadbackPixels(dst + readback->offset, &layout, readback->format, readback->type,
+                          src, readback->src_pitch, readback->src_format,
+                          readback->width, readback->height);
+
+    if (ptr->data.mtl_data)
+    {
+        // small buffers keep a separate cpu copy
+        if (ptr->data.buffer_data && (vm_address_t)dst != ptr->data.buffer_data)
+        {
+            memcpy((GLubyte *)ptr->data.buffer_data + readback->offset, dst + readback->offset, span);
+        }
+
+        ctx->mtl_funcs.mtlMapUnmapBuffer(ctx, ptr, readback->offset, span, 0, false);
+    }
+}
+
+void releaseBufferReadback(GLMContext ctx, Buffer *ptr)
+{
+    if (ptr->readback == NULL)
+        return;
+
+    if (ctx->mtl_funcs.mtlReadbackRelease)
+        ctx->mtl_funcs.mtlReadbackRelease(ctx, ptr->readback);
+
+    free(ptr->readback);
+    ptr->readback = NULL;
+}
+
+// client memory and pack buffer reads see the same format / type, pack state and y flip
+bool readDrawablePixels(GLMContext ctx, void *dst, const PixelStoreLayout *layout, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    BufferReadback readback;
+    GLubyte *src;
+    bool ret;
+
+    if (ctx->mtl_funcs.mtlReadDrawableAsync == NULL)
+        return false;
+
+    if (readbackFormatSupported(format, type) == false)
+        return false;
+
+    memset(&readback, 0, sizeof(readback));
+
+    if (ctx->mtl_funcs.mtlReadDrawableAsync(ctx, &readback, x, y, width, height) == false)
+    {
+        ctx->mtl_funcs.mtlReadbackRelease(ctx, &readback);
+        return false;
+    }
+
+    src = (GLubyte *)ctx->mtl_funcs.mtlReadbackData(ctx, &readback, true);
+
+    ret = false;
+    if (src)
+    {
+        ret = convertReadbackPixels(dst, layout, format, type,
+                                    src, readback.src_pitch, readback.src_format,
+                                    width, height);
+
+        if (ret)
+            STATS_ADD(bytes_read_back, pixelStoreSpan(layout, width, height, 1));
+    }
+
+    ctx->mtl_funcs.mtlReadbackRelease(ctx, &readback);
+
+    return ret;
+}
+
 #pragma mark GL Buffer Map Functions
 void *mglMapBuffer(GLMContext ctx, GLenum target, GLenum access)
 {
@@ -1236,7 +1486,11 @@ void *mglMapBuffer(GLMContext ctx, GLenum target, GLenum access)
         ERROR_RETURN_VALUE(GL_INVALID_OPERATION, NULL);
     }
 
+    resolveBufferReadback(ctx, ptr, true);
+
     ptr->mapped = GL_TRUE;
+    STATE(map_generation)++;
+    BUMP_GENERATION(ptr);
     ptr->access = access;
     ptr->access_flags = 0;
     ptr->mapped_offset = 0;
@@ -1277,6 +1531,8 @@ GLboolean mglUnmapBuffer(GLMContext ctx, GLenum target)
     }
 
     ptr->mapped = GL_FALSE;
+    STATE(map_generation)++;
+    BUMP_GENERATION(ptr);
     ptr->access = 0;
     ptr->access_flags = 0;
     ptr->mapped_offset = 0;
@@ -1339,6 +1595,9 @@ void *mglMapBufferRange(GLMContext ctx, GLenum target, GLintptr offset, GLsizeip
         ERROR_RETURN_VALUE(GL_INVALID_OPERATION, NULL);
     }
 
+    // unsynchronized maps only pick up a readback that already finished
+    resolveBufferReadback(ctx, ptr, (access_flags & GL_MAP_UNSYNCHRONIZED_BIT) == 0);
+
     ptr->access = 0;
     ptr->mapped_offset = offset;
     ptr->mapped_length = length;
@@ -1367,6 +1626,8 @@ void *mglMapBufferRange(GLMContext ctx, GLenum target, GLintptr offset, GLsizeip
 
     ptr->access_flags = access_flags;
     ptr->mapped = GL_TRUE;
+    STATE(map_generation)++;
+    BUMP_GENERATION(ptr);
 
     return ctx->mtl_funcs.mtlMapUnmapBuffer(ctx, ptr, offset, length, access_flags, true);
 }
@@ -1426,6 +1687,7 @@ void mglFlushMappedBufferRange(GLMContext ctx, GLenum target, GLintptr offset, G
 
     if (ptr->access_flags & GL_MAP_FLUSH_EXPLICIT_BIT)
     {
+        BUMP_GENERATION(ptr);
         ctx->mtl_funcs.mtlFlushBufferRange(ctx, ptr, offset, length);
     }
     else
@@ -1644,6 +1906,8 @@ void mglGetBufferSubData(GLMContext ctx, GLenum target, GLintptr offset, GLsizei
         ERROR_RETURN(GL_INVALID_VALUE);
     }
 
+    resolveBufferReadback(ctx, ptr, true);
+
     if (ptr->data.buffer_data == 0)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
@@ -1655,6 +1919,8 @@ void mglGetBufferSubData(GLMContext ctx, GLenum target, GLintptr offset, GLsizei
     }
 
     memcpy(data, (const uint8_t *)((uintptr_t)ptr->data.buffer_data) + (uintptr_t)offset, (size_t)size);
+
+    STATS_ADD(bytes_read_back, size);
 }
 
 void mglGetNamedBufferParameteriv(GLMContext ctx, GLuint buffer, GLenum pname, GLint *params)
@@ -14,7 +14,24 @@
 #include <mach/arm/kern_return.h>
 #endif
 
+#include "pixel_store.h"
+
 kern_return_t initBufferData(GLMContext ctx, Buffer *ptr, GLsizeiptr size, const void *data, bool isUniformConstant);
 Buffer *newBuffer(GLMContext ctx, GLenum target, GLuint name);
 
+// texture buffers hold a reference, glDeleteBuffers frees the store on the last release
+void retainBuffer(GLMContext ctx, Buffer *ptr);
+void releaseBuffer(GLMContext ctx, Buffer *ptr);
+
+// glBufferSubData without the checks, for results the gl writes into buffers
+void writeBufferSubData(GLMContext ctx, Buffer *ptr, GLintptr offset, GLsizeiptr size, const void *data);
+
+// glReadPixels into a pack buffer without stalling, converted on map / read back
+bool queueBufferReadback(GLMContext ctx, Buffer *ptr, size_t offset, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type);
+void resolveBufferReadback(GLMContext ctx, Buffer *ptr, GLboolean wait);
+void releaseBufferReadback(GLMContext ctx, Buffer *ptr);
+
+// blocking glReadPixels through the same conversion, false if format / type or the read buffer can't be read
+bool readDrawablePixels(GLMContext ctx, void *dst, const PixelStoreLayout *layout, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type);
+
 #endif /* buffers_h */
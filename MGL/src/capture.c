@@ -0,0 +1,1615 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * capture.c
+ * MGL
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "glm_context.h"
+#include "capture.h"
+#include "pixel_utils.h"
+#include "pixel_store.h"
+
+#ifdef MGL_GL_CORE
+
+extern GLuint bufferIndexFromTarget(GLMContext ctx, GLenum target);
+extern bool checkTarget(GLMContext ctx, GLenum target);
+extern Buffer *findBuffer(GLMContext ctx, GLuint buffer);
+extern bool vao_client_arrays(GLMContext ctx);
+extern bool client_indices(GLMContext ctx, const void *indices);
+extern GLsizei genStrideFromTypeSize(GLenum type, GLint size);
+
+// trace layout, everything little endian at its native size
+//
+// header   u32 magic, u32 version, u32 command count
+// command  u16 id, then each arg by kind
+//              value / sync / proc     sizeof the param
+//              in / string             u64 pointer, u32 size, size bytes, size 0 passes the pointer through
+//              out                     u64 pointer, u32 scratch size, 0 passes the pointer through
+//              strings                 u64 pointer, u32 count, count * (u32 length, length bytes)
+//          then the return value, then for glGen* / glCreate* u32 size and the names written to each out param
+// frame    u16 CAPTURE_FRAME
+// mapped   u16 CAPTURE_MAPPED, u32 buffer, u64 offset, u32 size, size bytes
+// client   u16 CAPTURE_CLIENT_ARRAY, u32 attrib, u64 offset from the attrib pointer, u32 size, size bytes
+//          u16 CAPTURE_CLIENT_INDICES, u32 sub draw, u32 size, size bytes
+//          ahead of the draw that reads them
+
+typedef struct CaptureHeader_t {
+    GLuint  magic;
+    GLuint  version;
+    GLuint  commands;
+} CaptureHeader;
+
+#pragma mark argument helpers
+
+static GLint argIndex(const CaptureCommand *cmd, const char *name)
+{
+    for(GLuint i=0; i<cmd->arg_count; i++)
+    {
+        if (!strcmp(cmd->args[i].name, name))
+            return i;
+    }
+
+    return -1;
+}
+
+// sign extended, counts and sizes are GLsizei / GLsizeiptr
+static GLint64 argInt(const CaptureCommand *cmd, const GLuint64 *args, GLint index)
+{
+    switch(cmd->args[index].size)
+    {
+        case 1: { GLbyte v; memcpy(&v, &args[index], sizeof(v)); return v; }
+        case 2: { GLshort v; memcpy(&v, &args[index], sizeof(v)); return v; }
+        case 4: { GLint v; memcpy(&v, &args[index], sizeof(v)); return v; }
+        default: { GLint64 v; memcpy(&v, &args[index], sizeof(v)); return v; }
+    }
+}
+
+static GLint64 namedInt(const CaptureCommand *cmd, const GLuint64 *args, const char *name, GLint64 def)
+{
+    GLint index;
+
+    index = argIndex(cmd, name);
+
+    if (index < 0)
+        return def;
+
+    return argInt(cmd, args, index);
+}
+
+static size_t positive(GLint64 value)
+{
+    return value > 0 ? (size_t)value : 0;
+}
+
+static GLboolean isGenCommand(const CaptureCommand *cmd)
+{
+    return !strncmp(cmd->name, "glGen", 5) || !strncmp(cmd->name, "glCreate", 8);
+}
+
+static Buffer *boundBuffer(GLMContext ctx, GLuint index)
+{
+    return STATE(buffers[index]);
+}
+
+#pragma mark size rules
+
+// client memory a pixel transfer reads or writes, or 0 when a pixel buffer holds it
+static size_t pixelsSize(GLMContext ctx, const CaptureCommand *cmd, const GLuint64 *args, GLboolean pack)
+{
+    PixelStoreLayout layout;
+    GLint64 width, height, depth;
+    GLuint dims;
+
+    if (boundBuffer(ctx, pack ? _PIXEL_PACK_BUFFER : _PIXEL_UNPACK_BUFFER))
+        return 0;
+
+    width = namedInt(cmd, args, "width", -1);
+    height = namedInt(cmd, args, "height", 1);
+    depth = namedInt(cmd, args, "depth", 1);
+
+    // glGetTexImage sizes come from the texture
+    if (width < 0)
+        return pack ? CAPTURE_OUT_PIXELS : 0;
+
+    dims = argIndex(cmd, "depth") >= 0 ? 3 : (argIndex(cmd, "height") >= 0 ? 2 : 1);
+
+    if (pixelStoreLayout(pack ? &STATE(pack) : &STATE(unpack), dims,
+                         (GLenum)namedInt(cmd, args, "format", 0), (GLenum)namedInt(cmd, args, "type", 0),
+                         (GLsizei)width, (GLsizei)height, &layout) == false)
+    {
+        return 0;
+    }
+
+    return pixelStoreSpan(&layout, (GLsizei)width, (GLsizei)height, (GLsizei)depth);
+}
+
+// glUniform4fv, glUniformMatrix3x4fv, glVertexAttrib4Nubv.. the components are in the name
+static GLuint componentsFromName(const char *name)
+{
+    const char *str;
+
+    if ((str = strstr(name, "Matrix")))
+    {
+        GLuint cols, rows;
+
+        str += 6;
+        cols = str[0] - '0';
+        rows = str[1] == 'x' ? str[2] - '0' : cols;
+
+        return cols * rows;
+    }
+
+    if ((str = strstr(name, "Uniform")) || (str = strstr(name, "VertexAttrib")))
+    {
+        str += str[0] == 'U' ? 7 : 12;
+
+        // glVertexAttribI4iv, glVertexAttribL1dv, glVertexAttrib4Nubv
+        if (*str == 'I' || *str == 'L')
+            str++;
+
+        if (*str >= '1' && *str <= '4')
+            return *str - '0';
+
+        // glVertexAttribP4uiv packs the components into one element
+        if (*str == 'P')
+            return 1;
+    }
+
+    return 0;
+}
+
+static size_t inSize(GLMContext ctx, Capture *cap, GLuint command, GLuint index, const GLuint64 *args)
+{
+    const CaptureCommand *cmd;
+    const CaptureArg *arg;
+    const void *ptr;
+    GLint64 value;
+    GLuint components;
+
+    cmd = &capture_commands[command];
+    arg = &cmd->args[index];
+    ptr = (const void *)(uintptr_t)args[index];
+
+    if (ptr == NULL)
+        return 0;
+
+    if (arg->kind == CAPTURE_STRING)
+    {
+        value = namedInt(cmd, args, "length", -1);
+
+        return value >= 0 ? (size_t)value : strlen((const char *)ptr) + 1;
+    }
+
+    if (!strcmp(arg->name, "pixels"))
+        return pixelsSize(ctx, cmd, args, false);
+
+    // compressed images
+    if ((value = namedInt(cmd, args, "imageSize", -1)) >= 0)
+        return boundBuffer(ctx, _PIXEL_UNPACK_BUFFER) ? 0 : (size_t)value;
+
+    // a buffer offset once an element array buffer is bound
+    if (!strcmp(arg->name, "indices") && arg->elem_size == 1)
+    {
+        if (VAO() == NULL || VAO_STATE(element_array.buffer))
+            return 0;
+
+        return positive(namedInt(cmd, args, "count", 0)) * sizeForType((GLenum)namedInt(cmd, args, "type", 0));
+    }
+
+    // offsets into bound buffers, client arrays are written ahead of the draw in captureCall
+    if (!strcmp(arg->name, "indirect") || !strcmp(arg->name, "pointer") || !strcmp(arg->name, "userParam"))
+        return 0;
+
+    if (!strcmp(arg->name, "data"))
+    {
+        // glClearBufferData, glClearTexImage, one element of format / type
+        if (argIndex(cmd, "format") >= 0 && argIndex(cmd, "type") >= 0)
+            return sizeForFormatType((GLenum)namedInt(cmd, args, "format", 0), (GLenum)namedInt(cmd, args, "type", 0));
+
+        if (argIndex(cmd, "size") >= 0)
+            return positive(namedInt(cmd, args, "size", 0));
+    }
+
+    // glProgramBinary, glShaderBinary
+    if (!strcmp(arg->name, "binary"))
+        return positive(namedInt(cmd, args, "length", 0));
+
+    if ((components = componentsFromName(cmd->name)) && (!strcmp(arg->name, "value") || !strcmp(arg->name, "v")))
+        return positive(namedInt(cmd, args, "count", 1)) * components * arg->elem_size;
+
+    // glClearBufferfv, a color or a depth / stencil value
+    if (!strncmp(cmd->name, "glClear", 7) && !strcmp(arg->name, "value"))
+        return (namedInt(cmd, args, "buffer", 0) == GL_COLOR ? 4 : 1) * arg->elem_size;
+
+    // glTexParameterfv, glSamplerParameterIiv, glPatchParameterfv
+    if (strstr(cmd->name, "Parameter") && (!strcmp(arg->name, "params") || !strcmp(arg->name, "param") || !strcmp(arg->name, "values")))
+    {
+        switch(namedInt(cmd, args, "pname", 0))
+        {
+            case GL_TEXTURE_BORDER_COLOR:
+            case GL_TEXTURE_SWIZZLE_RGBA:
+            case GL_PATCH_DEFAULT_OUTER_LEVEL:
+                return 4 * arg->elem_size;
+
+            case GL_PATCH_DEFAULT_INNER_LEVEL:
+                return 2 * arg->elem_size;
+
+            default:
+                return arg->elem_size;
+        }
+    }
+
+    // glViewportArrayv, glScissorArrayv, glDepthRangeArrayv
+    if (strstr(cmd->name, "Arrayv"))
+        return positive(namedInt(cmd, args, "count", 0)) * (strstr(cmd->name, "DepthRange") ? 2 : 4) * arg->elem_size;
+
+    if ((value = namedInt(cmd, args, "drawcount", -1)) >= 0)
+        return positive(value) * arg->elem_size;
+
+    if ((value = namedInt(cmd, args, "count", -1)) >= 0 ||
+        (value = namedInt(cmd, args, "n", -1)) >= 0 ||
+        (value = namedInt(cmd, args, "numAttachments", -1)) >= 0)
+    {
+        return positive(value) * arg->elem_size;
+    }
+
+    if (cap && cap->warned[command] == GL_FALSE)
+    {
+        fprintf(stderr, "MGL WARNING: capture doesn't know how much memory %s reads from %s, only the pointer is recorded\n",
+                cmd->name, arg->name);
+        cap->warned[command] = GL_TRUE;
+    }
+
+    return 0;
+}
+
+// scratch for the replay to write into, 0 passes the pointer through
+static size_t outSize(GLMContext ctx, GLuint command, GLuint index, const GLuint64 *args)
+{
+    const CaptureCommand *cmd;
+    const CaptureArg *arg;
+    GLint64 value;
+
+    cmd = &capture_commands[command];
+    arg = &cmd->args[index];
+
+    if (args[index] == 0)
+        return 0;
+
+    if (!strcmp(arg->name, "pixels"))
+        return pixelsSize(ctx, cmd, args, true);
+
+    if ((value = namedInt(cmd, args, "bufSize", -1)) >= 0)
+        return positive(value) * arg->elem_size;
+
+    // glGetBufferSubData
+    if (!strcmp(arg->name, "data") && (value = namedInt(cmd, args, "size", -1)) >= 0)
+        return positive(value);
+
+    // glGenBuffers, glCreateTextures
+    if (isGenCommand(cmd) && (value = namedInt(cmd, args, "n", -1)) >= 0)
+        return positive(value) * arg->elem_size;
+
+    return CAPTURE_OUT_SCRATCH;
+}
+
+// glDrawArrays, glMultiDrawElementsIndirect.. not glDrawBuffers or glDrawPixels
+static GLboolean isDrawCommand(const CaptureCommand *cmd)
+{
+    if (strncmp(cmd->name, "glDraw", 6) && strncmp(cmd->name, "glMultiDraw", 11))
+        return GL_FALSE;
+
+    return strstr(cmd->name, "Arrays") || strstr(cmd->name, "Elements");
+}
+
+// glMultiDrawElements indices are an array of pointers
+static GLboolean isMultiDrawElements(GLuint command)
+{
+    return command == CAPTURE_glMultiDrawElements || command == CAPTURE_glMultiDrawElementsBaseVertex;
+}
+
+// client arrays are only read at the draw, the multi draws' indices are an array of client pointers
+static GLboolean drawsClientMemory(GLMContext ctx, GLuint command, const GLuint64 *args)
+{
+    const CaptureCommand *cmd;
+    GLint index;
+
+    cmd = &capture_commands[command];
+
+    if (isDrawCommand(cmd) == GL_FALSE)
+        return GL_FALSE;
+
+    if (vao_client_arrays(ctx))
+        return GL_TRUE;
+
+    if (isMultiDrawElements(command) == GL_FALSE)
+        return GL_FALSE;
+
+    index = argIndex(cmd, "indices");
+
+    return index >= 0 && client_indices(ctx, (const void *)(uintptr_t)args[index]);
+}
+
+// replay hands out names in order, a context that already has some can't be replayed
+static GLboolean namedObjects(GLMContext ctx)
+{
+    HashTable *tables[] = {
+        &STATE(vao_table), &STATE(buffer_table), &STATE(texture_table), &STATE(shader_table),
+        &STATE(program_table), &STATE(program_pipeline_table), &STATE(transform_feedback_table),
+        &STATE(renderbuffer_table), &STATE(framebuffer_table), &STATE(sampler_table), &STATE(query_table)
+    };
+
+    for(GLuint i=0; i<sizeof(tables) / sizeof(tables[0]); i++)
+    {
+        if (tables[i]->current_name > 1)
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+static const void *namedPointer(const CaptureCommand *cmd, const GLuint64 *args, const char *name)
+{
+    GLint index;
+
+    index = argIndex(cmd, name);
+
+    return index >= 0 ? (const void *)(uintptr_t)args[index] : NULL;
+}
+
+// indices in client memory or in the element buffer's cpu copy, NULL if they aren't readable here
+static const void *indexData(GLMContext ctx, GLenum type, const void *indices, GLsizei count)
+{
+    Buffer *buf;
+    size_t offset;
+
+    buf = VAO_STATE(element_array.buffer);
+
+    if (buf == NULL)
+        return indices;
+
+    offset = (uintptr_t)indices;
+
+    if (buf->data.buffer_data == 0 || offset + (size_t)count * sizeForType(type) > (size_t)buf->size)
+        return NULL;
+
+    return (const GLubyte *)buf->data.buffer_data + offset;
+}
+
+// the vertices a draw reads, last < first when it reads none, false when that can't be known here
+static GLboolean drawRange(GLMContext ctx, const CaptureCommand *cmd, const GLuint64 *args, GLint64 *first, GLint64 *last)
+{
+    const GLsizei *counts;
+    const GLint *firsts, *basevertices;
+    const void *const *indices;
+    GLint64 drawcount, lo, hi;
+    GLuint restart_index;
+    GLboolean multi, restart;
+    GLenum type;
+
+    // indirect draws take their counts from a buffer
+    if (argIndex(cmd, "indirect") >= 0)
+        return GL_FALSE;
+
+    multi = argIndex(cmd, "drawcount") >= 0;
+    drawcount = multi ? namedInt(cmd, args, "drawcount", 0) : 1;
+    type = (GLenum)namedInt(cmd, args, "type", 0);
+
+    counts = (const GLsizei *)namedPointer(cmd, args, "count");
+    firsts = (const GLint *)namedPointer(cmd, args, "first");
+    indices = (const void *const *)namedPointer(cmd, args, "indices");
+    basevertices = (const GLint *)namedPointer(cmd, args, "basevertex");
+
+    if (multi && (counts == NULL || (type ? indices : (const void *)firsts) == NULL))
+        return GL_FALSE;
+
+    // the restart index the renderer skips
+    if (STATE(caps.primitive_restart_fixed_index))
+    {
+        restart = GL_TRUE;
+        restart_index = type == GL_UNSIGNED_BYTE ? 0xFF : type == GL_UNSIGNED_SHORT ? 0xFFFF : 0xFFFFFFFF;
+    }
+    else
+    {
+        restart = STATE(caps.primitive_restart);
+        restart_index = STATE_VAR(primitive_restart_index);
+    }
+
+    lo = INT64_MAX;
+    hi = INT64_MIN;
+
+    for(GLint64 d=0; d<drawcount; d++)
+    {
+        GLint64 count, start, end;
+
+        count = multi ? counts[d] : namedInt(cmd, args, "count", 0);
+
+        if (count <= 0)
+            continue;
+
+        if (type)
+        {
+            const void *data;
+            GLint64 basevertex;
+            GLuint min, max;
+
+            data = indexData(ctx, type, multi ? indices[d] : (const void *)indices, (GLsizei)count);
+            if (data == NULL)
+                return GL_FALSE;
+
+            // nothing but restart indices
+            if (scanIndexRange(type, data, (GLuint)count, restart, restart_index, &min, &max) == GL_FALSE)
+                continue;
+
+            basevertex = multi ? (basevertices ? basevertices[d] : 0) : namedInt(cmd, args, "basevertex", 0);
+
+            start = (GLint64)min + basevertex;
+            end = (GLint64)max + basevertex;
+        }
+        else
+        {
+            start = multi ? firsts[d] : namedInt(cmd, args, "first", 0);
+            end = start + count - 1;
+        }
+
+        // the draw fails before it reads anything
+        if (start < 0)
+            continue;
+
+        if (start < lo)
+            lo = start;
+        if (end > hi)
+            hi = end;
+    }
+
+    if (hi < lo)
+    {
+        lo = 0;
+        hi = -1;
+    }
+
+    *first = lo;
+    *last = hi;
+
+    return GL_TRUE;
+}
+
+#pragma mark mappings
+
+// resolves the buffer a map / unmap / flush command names, 0 if it isn't a valid one
+static GLuint mappedBuffer(GLMContext ctx, const CaptureCommand *cmd, const GLuint64 *args)
+{
+    GLint64 value;
+    Buffer *buf;
+
+    if ((value = namedInt(cmd, args, "buffer", -1)) >= 0)
+        return (GLuint)value;
+
+    value = namedInt(cmd, args, "target", 0);
+
+    if (checkTarget(ctx, (GLenum)value) == false)
+        return 0;
+
+    buf = boundBuffer(ctx, bufferIndexFromTarget(ctx, (GLenum)value));
+
+    return buf ? buf->name : 0;
+}
+
+static CaptureMapping *findMapping(CaptureMapping *maps, GLuint count, GLuint buffer)
+{
+    for(GLuint i=0; i<count; i++)
+    {
+        if (maps[i].buffer == buffer)
+            return &maps[i];
+    }
+
+    return NULL;
+}
+
+static void trackMapping(GLMContext ctx, CaptureMapping *maps, GLuint *count, const CaptureCommand *cmd, const GLuint64 *args, void *ptr)
+{
+    CaptureMapping *map;
+    GLuint buffer;
+    GLint64 access;
+    Buffer *buf;
+
+    buffer = mappedBuffer(ctx, cmd, args);
+    buf = findBuffer(ctx, buffer);
+
+    if (ptr == NULL || buf == NULL)
+        return;
+
+    map = findMapping(maps, *count, buffer);
+
+    if (map == NULL)
+    {
+        if (*count == CAPTURE_MAX_MAPS)
+        {
+            fprintf(stderr, "MGL WARNING: more than %d buffers mapped, writes to buffer %u aren't captured\n", CAPTURE_MAX_MAPS, buffer);
+            return;
+        }
+
+        map = &maps[(*count)++];
+    }
+
+    access = namedInt(cmd, args, "access", 0);
+
+    map->buffer = buffer;
+    map->ptr = (GLubyte *)ptr;
+    map->offset = (GLintptr)namedInt(cmd, args, "offset", 0);
+    map->length = (GLsizeiptr)namedInt(cmd, args, "length", buf->size);
+
+    // glMapBuffer takes GL_READ_ONLY.., glMapBufferRange access bits
+    if (strstr(cmd->name, "Range"))
+    {
+        map->write = (access & GL_MAP_WRITE_BIT) != 0;
+        map->persistent = (access & GL_MAP_PERSISTENT_BIT) != 0;
+        map->explicit_flush = (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0;
+    }
+    else
+    {
+        map->write = access != GL_READ_ONLY;
+        map->persistent = GL_FALSE;
+        map->explicit_flush = GL_FALSE;
+    }
+}
+
+static void untrackMapping(CaptureMapping *maps, GLuint *count, GLuint buffer)
+{
+    CaptureMapping *map;
+
+    map = findMapping(maps, *count, buffer);
+
+    if (map)
+        *map = maps[--(*count)];
+}
+
+static GLboolean isMapCommand(GLuint command)
+{
+    return command == CAPTURE_glMapBuffer || command == CAPTURE_glMapBufferRange ||
+           command == CAPTURE_glMapNamedBuffer || command == CAPTURE_glMapNamedBufferRange;
+}
+
+static GLboolean isUnmapCommand(GLuint command)
+{
+    return command == CAPTURE_glUnmapBuffer || command == CAPTURE_glUnmapNamedBuffer;
+}
+
+static GLboolean isFlushCommand(GLuint command)
+{
+    return command == CAPTURE_glFlushMappedBufferRange || command == CAPTURE_glFlushMappedNamedBufferRange;
+}
+
+#pragma mark capture
+
+static void writeCapture(Capture *cap, const void *data, size_t size)
+{
+    fwrite(data, size, 1, cap->fp);
+    cap->bytes += size;
+}
+
+static void writePointer(Capture *cap, GLuint64 value, size_t size, const void *data)
+{
+    GLuint size32;
+
+    size32 = (GLuint)size;
+
+    writeCapture(cap, &value, sizeof(value));
+    writeCapture(cap, &size32, sizeof(size32));
+
+    if (data && size32)
+        writeCapture(cap, data, size32);
+}
+
+static void writeStrings(Capture *cap, const CaptureCommand *cmd, const GLuint64 *args, GLuint index)
+{
+    const GLchar *const *strings;
+    const GLint *lengths;
+    GLuint count;
+    GLint length_index;
+
+    strings = (const GLchar *const *)(uintptr_t)args[index];
+    count = strings ? (GLuint)positive(namedInt(cmd, args, "count", 0)) : 0;
+
+    // glShaderSource lengths, NULL or negative for nul terminated
+    length_index = argIndex(cmd, "length");
+    lengths = length_index >= 0 ? (const GLint *)(uintptr_t)args[length_index] : NULL;
+
+    writeCapture(cap, &args[index], sizeof(GLuint64));
+    writeCapture(cap, &count, sizeof(count));
+
+    for(GLuint i=0; i<count; i++)
+    {
+        GLuint len;
+
+        len = (lengths && lengths[i] >= 0) ? (GLuint)lengths[i] : (GLuint)strlen(strings[i]);
+
+        writeCapture(cap, &len, sizeof(len));
+        writeCapture(cap, strings[i], len);
+    }
+}
+
+static void writeMapped(Capture *cap, const CaptureMapping *map, GLintptr offset, GLsizeiptr length)
+{
+    GLushort id;
+    GLuint64 offset64;
+    GLuint size;
+
+    if (offset < 0 || length <= 0 || offset + length > map->length)
+        return;
+
+    id = CAPTURE_MAPPED;
+    offset64 = map->offset + offset;
+    size = (GLuint)length;
+
+    writeCapture(cap, &id, sizeof(id));
+    writeCapture(cap, &map->buffer, sizeof(map->buffer));
+    writeCapture(cap, &offset64, sizeof(offset64));
+    writeCapture(cap, &size, sizeof(size));
+    writeCapture(cap, map->ptr + offset, size);
+}
+
+// the parts of the client arrays a draw reads, the same ranges drawStreamed copies
+static void writeClientArrays(GLMContext ctx, Capture *cap, const CaptureCommand *cmd, const GLuint64 *args)
+{
+    GLint64 first, last, instancecount, baseinstance;
+    GLushort id;
+
+    if (drawRange(ctx, cmd, args, &first, &last) == GL_FALSE)
+    {
+        if (cap->client_unsized == GL_FALSE)
+        {
+            fprintf(stderr, "MGL WARNING: capture can't tell which vertices %s reads from client arrays, replay skips it\n", cmd->name);
+            cap->client_unsized = GL_TRUE;
+        }
+
+        return;
+    }
+
+    instancecount = namedInt(cmd, args, "instancecount", 1);
+    baseinstance = namedInt(cmd, args, "baseinstance", 0);
+
+    for(GLuint i=0; i<(GLuint)ctx->state.max_vertex_attribs; i++)
+    {
+        VertexAttrib *attrib;
+        GLuint64 start, elements, offset;
+        GLuint element_size, size;
+
+        if ((VAO_STATE(client_attribs) & VAO_STATE(enabled_attribs) & (0x1 << i)) == 0)
+            continue;
+
+        attrib = &VAO_ATTRIB_STATE(i);
+
+        if (attrib->divisor)
+        {
+            start = 0;
+            elements = instancecount > 0 ? baseinstance + (instancecount - 1) / attrib->divisor + 1 : 0;
+        }
+        else
+        {
+            start = first;
+            elements = last - first + 1;
+        }
+
+        // the last element is only as long as the attrib, not the stride
+        element_size = genStrideFromTypeSize(attrib->type, attrib->size);
+        if (element_size > attrib->stride)
+            element_size = attrib->stride;
+
+        offset = start * attrib->stride;
+        size = elements ? (GLuint)((elements - 1) * attrib->stride + element_size) : 0;
+
+        id = CAPTURE_CLIENT_ARRAY;
+        writeCapture(cap, &id, sizeof(id));
+        writeCapture(cap, &i, sizeof(i));
+        writeCapture(cap, &offset, sizeof(offset));
+        writeCapture(cap, &size, sizeof(size));
+        if (size)
+            writeCapture(cap, (const GLubyte *)attrib->ptr + offset, size);
+    }
+}
+
+// the pointer array goes in with the call, what each one points at goes in here
+static void writeClientIndices(Capture *cap, const CaptureCommand *cmd, const GLuint64 *args)
+{
+    const void *const *indices;
+    const GLsizei *counts;
+    GLuint drawcount;
+    GLenum type;
+    GLushort id;
+
+    indices = (const void *const *)namedPointer(cmd, args, "indices");
+    counts = (const GLsizei *)namedPointer(cmd, args, "count");
+    drawcount = (GLuint)positive(namedInt(cmd, args, "drawcount", 0));
+    type = (GLenum)namedInt(cmd, args, "type", 0);
+
+    if (counts == NULL)
+        return;
+
+    for(GLuint d=0; d<drawcount; d++)
+    {
+        GLuint size;
+
+        if (indices[d] == NULL || counts[d] <= 0)
+            continue;
+
+        size = (GLuint)(counts[d] * sizeForType(type));
+
+        id = CAPTURE_CLIENT_INDICES;
+        writeCapture(cap, &id, sizeof(id));
+        writeCapture(cap, &d, sizeof(d));
+        writeCapture(cap, &size, sizeof(size));
+        writeCapture(cap, indices[d], size);
+    }
+}
+
+GLboolean captureStart(GLMContext ctx, const char *path)
+{
+    CaptureHeader header;
+    Capture *cap;
+
+    if (path == NULL || *path == 0)
+        return GL_FALSE;
+
+    if (ctx->capture)
+    {
+        fprintf(stderr, "MGL WARNING: captureStart context is already capturing\n");
+        return GL_FALSE;
+    }
+
+    if (namedObjects(ctx))
+    {
+        fprintf(stderr, "MGL WARNING: captureStart context already has objects, start the capture before the first gl call\n");
+        return GL_FALSE;
+    }
+
+    cap = (Capture *)calloc(1, sizeof(Capture));
+    assert(cap);
+
+    cap->fp = fopen(path, "wb");
+    if (cap->fp == NULL)
+    {
+        fprintf(stderr, "MGL ERROR: captureStart couldn't open %s\n", path);
+        free(cap);
+        return GL_FALSE;
+    }
+
+    // the writes are small, let them batch up
+    setvbuf(cap->fp, NULL, _IOFBF, 1024 * 1024);
+
+    header.magic = CAPTURE_MAGIC;
+    header.version = CAPTURE_VERSION;
+    header.commands = CAPTURE_COMMANDS;
+    writeCapture(cap, &header, sizeof(header));
+
+    ctx->capture = cap;
+
+    init_capture_dispatch(ctx);
+
+    fprintf(stderr, "MGL INFO: capturing gl calls to %s\n", path);
+
+    return GL_TRUE;
+}
+
+void captureStop(GLMContext ctx)
+{
+    Capture *cap;
+
+    cap = ctx->capture;
+
+    if (cap == NULL)
+        return;
+
+    ctx->dispatch = ctx->capture_dispatch;
+    ctx->capture = NULL;
+
+    fclose(cap->fp);
+
+    fprintf(stderr, "MGL INFO: captured %llu calls in %llu frames, %llu bytes\n", cap->calls, cap->frames, cap->bytes);
+
+    free(cap);
+}
+
+void captureCall(GLMContext ctx, GLuint command, const GLuint64 *args)
+{
+    const CaptureCommand *cmd;
+    Capture *cap;
+    GLushort id;
+
+    cap = ctx->capture;
+    cmd = &capture_commands[command];
+
+    // the client's writes go in ahead of the call that hands them to the gl
+    if (isUnmapCommand(command) || isFlushCommand(command))
+    {
+        CaptureMapping *map;
+
+        map = findMapping(cap->maps, cap->map_count, mappedBuffer(ctx, cmd, args));
+
+        if (map && map->write)
+        {
+            if (isFlushCommand(command))
+                writeMapped(cap, map, (GLintptr)namedInt(cmd, args, "offset", 0), (GLsizeiptr)namedInt(cmd, args, "length", 0));
+            else if (map->explicit_flush == GL_FALSE)
+                writeMapped(cap, map, 0, map->length);
+        }
+    }
+
+    // client memory is only read at the draw, it goes in just ahead of it
+    if (drawsClientMemory(ctx, command, args))
+    {
+        if (vao_client_arrays(ctx))
+            writeClientArrays(ctx, cap, cmd, args);
+
+        if (isMultiDrawElements(command) && client_indices(ctx, namedPointer(cmd, args, "indices")))
+            writeClientIndices(cap, cmd, args);
+    }
+
+    id = (GLushort)command;
+    writeCapture(cap, &id, sizeof(id));
+
+    for(GLuint i=0; i<cmd->arg_count; i++)
+    {
+        const CaptureArg *arg;
+
+        arg = &cmd->args[i];
+
+        switch(arg->kind)
+        {
+            case CAPTURE_VALUE:
+            case CAPTURE_SYNC:
+            case CAPTURE_PROC:
+                writeCapture(cap, &args[i], arg->size);
+                break;
+
+            case CAPTURE_IN:
+            case CAPTURE_STRING:
+                writePointer(cap, args[i], inSize(ctx, cap, command, i, args), (const void *)(uintptr_t)args[i]);
+                break;
+
+            case CAPTURE_OUT:
+                writePointer(cap, args[i], outSize(ctx, command, i, args), NULL);
+                break;
+
+            case CAPTURE_STRINGS:
+                writeStrings(cap, cmd, args, i);
+                break;
+
+            default:
+                assert(0);
+        }
+    }
+
+    cap->calls++;
+}
+
+void captureReturn(GLMContext ctx, GLuint command, const GLuint64 *args, const void *ret)
+{
+    const CaptureCommand *cmd;
+    Capture *cap;
+
+    cap = ctx->capture;
+    cmd = &capture_commands[command];
+
+    // captureStop came in through the dispatch table
+    if (cap == NULL)
+        return;
+
+    if (cmd->ret_kind != CAPTURE_VOID)
+        writeCapture(cap, ret, cmd->ret_size);
+
+    if (isMapCommand(command))
+    {
+        void *ptr;
+
+        memcpy(&ptr, ret, sizeof(ptr));
+        trackMapping(ctx, cap->maps, &cap->map_count, cmd, args, ptr);
+    }
+    else if (isUnmapCommand(command))
+    {
+        untrackMapping(cap->maps, &cap->map_count, mappedBuffer(ctx, cmd, args));
+    }
+
+    // names the gl handed out, replay checks it gets the same ones
+    if (isGenCommand(cmd))
+    {
+        for(GLuint i=0; i<cmd->arg_count; i++)
+        {
+            GLuint size;
+
+            if (cmd->args[i].kind != CAPTURE_OUT)
+                continue;
+
+            size = (GLuint)outSize(ctx, command, i, args);
+
+            writeCapture(cap, &size, sizeof(size));
+            if (size)
+                writeCapture(cap, (const void *)(uintptr_t)args[i], size);
+        }
+    }
+}
+
+void captureFrame(GLMContext ctx)
+{
+    Capture *cap;
+    GLushort id;
+
+    cap = ctx->capture;
+
+    // persistent mappings are never unmapped, their writes go in once a frame
+    for(GLuint i=0; i<cap->map_count; i++)
+    {
+        if (cap->maps[i].persistent && cap->maps[i].write)
+            writeMapped(cap, &cap->maps[i], 0, cap->maps[i].length);
+    }
+
+    id = CAPTURE_FRAME;
+    writeCapture(cap, &id, sizeof(id));
+
+    cap->frames++;
+}
+
+#pragma mark replay
+
+static GLboolean readReplay(Replay *r, void *dst, size_t size)
+{
+    if ((size_t)(r->end - r->ptr) < size)
+        return GL_FALSE;
+
+    memcpy(dst, r->ptr, size);
+    r->ptr += size;
+
+    return GL_TRUE;
+}
+
+static const GLubyte *skipReplay(Replay *r, size_t size)
+{
+    const GLubyte *ptr;
+
+    if ((size_t)(r->end - r->ptr) < size)
+        return NULL;
+
+    ptr = r->ptr;
+    r->ptr += size;
+
+    return ptr;
+}
+
+static void *replayAlloc(Replay *r, size_t size)
+{
+    void *ptr;
+
+    if (r->alloc_count == r->alloc_capacity)
+    {
+        r->alloc_capacity = r->alloc_capacity ? r->alloc_capacity * 2 : 16;
+        r->allocs = (void **)realloc(r->allocs, r->alloc_capacity * sizeof(void *));
+        assert(r->allocs);
+    }
+
+    ptr = calloc(1, size);
+    assert(ptr);
+
+    r->allocs[r->alloc_count++] = ptr;
+
+    return ptr;
+}
+
+static void replayFreeAllocs(Replay *r)
+{
+    for(size_t i=0; i<r->alloc_count; i++)
+        free(r->allocs[i]);
+
+    r->alloc_count = 0;
+}
+
+static GLuint64 replaySync(Replay *r, GLuint64 captured)
+{
+    for(size_t i=0; i<r->sync_count; i++)
+    {
+        if (r->syncs[i*2] == captured)
+            return r->syncs[i*2+1];
+    }
+
+    if (captured)
+        r->mismatches++;
+
+    return 0;
+}
+
+static void addReplaySync(Replay *r, GLuint64 captured, GLuint64 replayed)
+{
+    if (r->sync_count == r->sync_capacity)
+    {
+        r->sync_capacity = r->sync_capacity ? r->sync_capacity * 2 : 16;
+        r->syncs = (GLuint64 *)realloc(r->syncs, r->sync_capacity * 2 * sizeof(GLuint64));
+        assert(r->syncs);
+    }
+
+    r->syncs[r->sync_count*2] = captured;
+    r->syncs[r->sync_count*2+1] = replayed;
+    r->sync_count++;
+}
+
+static void addReplayFrame(Replay *r, GLuint64 ns)
+{
+    if (r->frames == r->frame_capacity)
+    {
+        r->frame_capacity = r->frame_capacity ? r->frame_capacity * 2 : 256;
+        r->frame_ns = (GLuint64 *)realloc(r->frame_ns, r->frame_capacity * sizeof(GLuint64));
+        assert(r->frame_ns);
+    }
+
+    r->frame_ns[r->frames++] = ns;
+}
+
+static GLboolean readReplayArgs(Replay *r, const CaptureCommand *cmd, GLuint64 *args)
+{
+    for(GLuint i=0; i<cmd->arg_count; i++)
+    {
+        const CaptureArg *arg;
+        GLuint64 value;
+        GLuint size;
+
+        arg = &cmd->args[i];
+        args[i] = 0;
+
+        switch(arg->kind)
+        {
+            case CAPTURE_VALUE:
+                if (readReplay(r, &args[i], arg->size) == false)
+                    return GL_FALSE;
+                break;
+
+            case CAPTURE_SYNC:
+                if (readReplay(r, &value, arg->size) == false)
+                    return GL_FALSE;
+                args[i] = replaySync(r, value);
+                break;
+
+            case CAPTURE_PROC:
+                if (skipReplay(r, arg->size) == NULL)
+                    return GL_FALSE;
+                break;
+
+            case CAPTURE_IN:
+            case CAPTURE_STRING:
+                if (readReplay(r, &value, sizeof(value)) == false || readReplay(r, &size, sizeof(size)) == false)
+                    return GL_FALSE;
+
+                if (size)
+                {
+                    const GLubyte *data;
+                    void *ptr;
+
+                    if ((data = skipReplay(r, size)) == NULL)
+                        return GL_FALSE;
+
+                    // records aren't aligned, and strings with a length have no terminator
+                    ptr = replayAlloc(r, size + 1);
+                    memcpy(ptr, data, size);
+                    value = (uintptr_t)ptr;
+                }
+
+                args[i] = value;
+                break;
+
+            case CAPTURE_OUT:
+                if (readReplay(r, &value, sizeof(value)) == false || readReplay(r, &size, sizeof(size)) == false)
+                    return GL_FALSE;
+
+                args[i] = size ? (uintptr_t)replayAlloc(r, size) : value;
+                break;
+
+            case CAPTURE_STRINGS:
+                {
+                    GLchar **strings;
+                    GLuint count;
+
+                    if (readReplay(r, &value, sizeof(value)) == false || readReplay(r, &count, sizeof(count)) == false)
+                        return GL_FALSE;
+
+                    if (value == 0)
+                        break;
+
+                    strings = (GLchar **)replayAlloc(r, (count ? count : 1) * sizeof(GLchar *));
+
+                    for(GLuint j=0; j<count; j++)
+                    {
+                        const GLubyte *data;
+                        GLuint len;
+
+                        if (readReplay(r, &len, sizeof(len)) == false || (data = skipReplay(r, len)) == NULL)
+                            return GL_FALSE;
+
+                        strings[j] = (GLchar *)replayAlloc(r, len + 1);
+                        memcpy(strings[j], data, len);
+                    }
+
+                    args[i] = (uintptr_t)strings;
+                }
+                break;
+
+            default:
+                return GL_FALSE;
+        }
+    }
+
+    return GL_TRUE;
+}
+
+static GLboolean readReplayReturn(Replay *r, GLMContext ctx, GLuint command, const GLuint64 *args, GLuint64 ret)
+{
+    const CaptureCommand *cmd;
+    GLuint64 captured;
+
+    cmd = &capture_commands[command];
+    captured = 0;
+
+    if (cmd->ret_kind != CAPTURE_VOID && readReplay(r, &captured, cmd->ret_size) == false)
+        return GL_FALSE;
+
+    if (cmd->ret_kind == CAPTURE_SYNC)
+        addReplaySync(r, captured, ret);
+
+    if (isMapCommand(command))
+        trackMapping(ctx, r->maps, &r->map_count, cmd, args, (void *)(uintptr_t)ret);
+    else if (isUnmapCommand(command))
+        untrackMapping(r->maps, &r->map_count, mappedBuffer(ctx, cmd, args));
+
+    if (isGenCommand(cmd))
+    {
+        // glCreateShader / glCreateProgram return theirs
+        if (cmd->ret_kind == CAPTURE_VALUE && captured != ret)
+            r->mismatches++;
+
+        for(GLuint i=0; i<cmd->arg_count; i++)
+        {
+            const GLubyte *names;
+            GLuint size;
+
+            if (cmd->args[i].kind != CAPTURE_OUT)
+                continue;
+
+            if (readReplay(r, &size, sizeof(size)) == false || (names = skipReplay(r, size)) == NULL)
+                return GL_FALSE;
+
+            if (size && memcmp(names, (const void *)(uintptr_t)args[i], size))
+                r->mismatches++;
+        }
+    }
+
+    return GL_TRUE;
+}
+
+static GLboolean replayMapped(Replay *r)
+{
+    const CaptureMapping *map;
+    const GLubyte *data;
+    GLuint64 offset;
+    GLuint buffer, size;
+
+    if (readReplay(r, &buffer, sizeof(buffer)) == false ||
+        readReplay(r, &offset, sizeof(offset)) == false ||
+        readReplay(r, &size, sizeof(size)) == false ||
+        (data = skipReplay(r, size)) == NULL)
+    {
+        return GL_FALSE;
+    }
+
+    map = findMapping(r->maps, r->map_count, buffer);
+
+    if (map == NULL || offset < (GLuint64)map->offset || offset + size > (GLuint64)(map->offset + map->length))
+    {
+        r->mismatches++;
+        return GL_TRUE;
+    }
+
+    memcpy(map->ptr + (offset - map->offset), data, size);
+
+    return GL_TRUE;
+}
+
+// points the attrib at a copy of what the capture read from it, the captured pointer comes back after the draw
+static GLboolean replayClientArray(Replay *r, GLMContext ctx)
+{
+    const GLubyte *data;
+    GLuint64 offset;
+    GLuint attrib, size;
+    void *copy;
+
+    if (readReplay(r, &attrib, sizeof(attrib)) == false ||
+        readReplay(r, &offset, sizeof(offset)) == false ||
+        readReplay(r, &size, sizeof(size)) == false ||
+        (data = skipReplay(r, size)) == NULL)
+    {
+        return GL_FALSE;
+    }
+
+    if (attrib >= MAX_ATTRIBS || VAO() == NULL || (VAO_STATE(client_attribs) & (0x1 << attrib)) == 0)
+    {
+        r->mismatches++;
+        return GL_TRUE;
+    }
+
+    copy = replayAlloc(r, size);
+    memcpy(copy, data, size);
+
+    if ((r->client_attribs & (0x1 << attrib)) == 0)
+        r->client_ptrs[attrib] = VAO_ATTRIB_STATE(attrib).ptr;
+
+    r->client_attribs |= (0x1 << attrib);
+
+    // the draw reads from offset on
+    VAO_ATTRIB_STATE(attrib).ptr = (const void *)((uintptr_t)copy - (uintptr_t)offset);
+
+    return GL_TRUE;
+}
+
+static void replayRestoreClientArrays(Replay *r, GLMContext ctx)
+{
+    for(GLuint i=0; r->client_attribs && i<MAX_ATTRIBS; i++)
+    {
+        if (r->client_attribs & (0x1 << i))
+            VAO_ATTRIB_STATE(i).ptr = r->client_ptrs[i];
+    }
+
+    r->client_attribs = 0;
+}
+
+static GLboolean replayClientIndices(Replay *r)
+{
+    const GLubyte *data;
+    GLuint draw, size;
+    void *copy;
+
+    if (readReplay(r, &draw, sizeof(draw)) == false ||
+        readReplay(r, &size, sizeof(size)) == false ||
+        (data = skipReplay(r, size)) == NULL)
+    {
+        return GL_FALSE;
+    }
+
+    if (draw >= r->client_index_capacity)
+    {
+        size_t capacity;
+
+        capacity = r->client_index_capacity ? r->client_index_capacity : 16;
+        while(capacity <= draw)
+            capacity *= 2;
+
+        r->client_indices = (void **)realloc(r->client_indices, capacity * sizeof(void *));
+        assert(r->client_indices);
+
+        memset(r->client_indices + r->client_index_capacity, 0, (capacity - r->client_index_capacity) * sizeof(void *));
+        r->client_index_capacity = capacity;
+    }
+
+    copy = replayAlloc(r, size);
+    memcpy(copy, data, size);
+
+    r->client_indices[draw] = copy;
+    if (draw >= r->client_index_count)
+        r->client_index_count = draw + 1;
+
+    return GL_TRUE;
+}
+
+// the multi draw's pointer array was read into scratch, its entries go to the copies
+static void replayPatchClientIndices(Replay *r, const CaptureCommand *cmd, GLuint64 *args)
+{
+    const void **indices;
+    GLuint64 drawcount;
+
+    indices = (const void **)namedPointer(cmd, args, "indices");
+    drawcount = positive(namedInt(cmd, args, "drawcount", 0));
+
+    for(size_t d=0; indices && d<r->client_index_count && d<drawcount; d++)
+    {
+        if (r->client_indices[d])
+            indices[d] = r->client_indices[d];
+    }
+}
+
+static void replayClearClientIndices(Replay *r)
+{
+    if (r->client_index_count)
+        memset(r->client_indices, 0, r->client_index_count * sizeof(void *));
+
+    r->client_index_count = 0;
+}
+
+Replay *replayOpen(const char *path)
+{
+    const CaptureHeader *header;
+    struct stat st;
+    Replay *r;
+    void *data;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "MGL ERROR: replayOpen couldn't open %s\n", path);
+        return NULL;
+    }
+
+    if (fstat(fd, &st) || (size_t)st.st_size < sizeof(CaptureHeader))
+    {
+        fprintf(stderr, "MGL ERROR: replayOpen %s isn't a capture\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "MGL ERROR: replayOpen couldn't map %s\n", path);
+        return NULL;
+    }
+
+    header = (const CaptureHeader *)data;
+
+    if (header->magic != CAPTURE_MAGIC || header->version != CAPTURE_VERSION || header->commands != CAPTURE_COMMANDS)
+    {
+        fprintf(stderr, "MGL ERROR: replayOpen %s is version %u with %u commands, this build replays version %u with %u\n",
+                path, header->version, header->commands, CAPTURE_VERSION, CAPTURE_COMMANDS);
+        munmap(data, st.st_size);
+        return NULL;
+    }
+
+    r = (Replay *)calloc(1, sizeof(Replay));
+    assert(r);
+
+    r->data = (const GLubyte *)data;
+    r->size = st.st_size;
+    r->end = r->data + r->size;
+
+    return r;
+}
+
+GLboolean replayRun(Replay *r, GLMContext ctx)
+{
+    GLuint64 args[CAPTURE_MAX_ARGS];
+    GLuint64 frame_start;
+    GLMContext save;
+    GLboolean ok;
+
+    save = MGLgetCurrentContext();
+    MGLsetCurrentContext(ctx);
+
+    r->ptr = r->data + sizeof(CaptureHeader);
+    r->map_count = 0;
+    r->sync_count = 0;
+    r->client_attribs = 0;
+    r->client_index_count = 0;
+
+    frame_start = traceTime();
+    ok = GL_TRUE;
+
+    while(r->ptr < r->end)
+    {
+        const CaptureCommand *cmd;
+        GLuint64 start, ns, ret;
+        GLushort id;
+
+        if (readReplay(r, &id, sizeof(id)) == false)
+        {
+            ok = GL_FALSE;
+            break;
+        }
+
+        if (id == CAPTURE_FRAME)
+        {
+            GLuint64 now;
+
+            MGLswapBuffers(ctx);
+
+            now = traceTime();
+            addReplayFrame(r, now - frame_start);
+            frame_start = now;
+            continue;
+        }
+
+        if (id == CAPTURE_MAPPED)
+        {
+            if (replayMapped(r) == false)
+            {
+                ok = GL_FALSE;
+                break;
+            }
+            continue;
+        }
+
+        if (id == CAPTURE_CLIENT_ARRAY || id == CAPTURE_CLIENT_INDICES)
+        {
+            if ((id == CAPTURE_CLIENT_ARRAY ? replayClientArray(r, ctx) : replayClientIndices(r)) == false)
+            {
+                ok = GL_FALSE;
+                break;
+            }
+            continue;
+        }
+
+        if (id >= CAPTURE_COMMANDS)
+        {
+            ok = GL_FALSE;
+            break;
+        }
+
+        cmd = &capture_commands[id];
+
+        if (readReplayArgs(r, cmd, args) == false)
+        {
+            ok = GL_FALSE;
+            break;
+        }
+
+        if (r->client_index_count && isMultiDrawElements(id))
+            replayPatchClientIndices(r, cmd, args);
+
+        ret = 0;
+
+        start = traceTime();
+
+        // client arrays the capture couldn't size hold stale pointers
+        if (isDrawCommand(cmd) && VAO() && (VAO_STATE(client_attribs) & VAO_STATE(enabled_attribs) & ~r->client_attribs))
+            r->mismatches++;
+        else
+            replay_command(ctx, id, args, &ret);
+
+        ns = traceTime() - start;
+
+        replayRestoreClientArrays(r, ctx);
+        replayClearClientIndices(r);
+
+        r->commands[id].calls++;
+        r->commands[id].ns += ns;
+        if (ns > r->commands[id].max_ns)
+            r->commands[id].max_ns = ns;
+        r->calls++;
+
+        ok = readReplayReturn(r, ctx, id, args, ret);
+
+        replayFreeAllocs(r);
+
+        if (ok == false)
+            break;
+    }
+
+    if (ok == false)
+        fprintf(stderr, "MGL ERROR: replayRun trace is truncated or corrupt at offset %ld\n", (long)(r->ptr - r->data));
+
+    MGLsetCurrentContext(save);
+
+    return ok;
+}
+
+static int compareNs(const void *a, const void *b)
+{
+    GLuint64 x = *(const GLuint64 *)a, y = *(const GLuint64 *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static int compareCommandTime(const void *a, const void *b, void *arg)
+{
+    const ReplayCommandStats *stats = (const ReplayCommandStats *)arg;
+    GLuint64 x = stats[*(const GLuint *)a].ns, y = stats[*(const GLuint *)b].ns;
+
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void sortCommands(GLuint *order, GLuint count, const ReplayCommandStats *stats)
+{
+    // insertion sort, only the commands the trace used are in here
+    for(GLuint i=1; i<count; i++)
+    {
+        GLuint key = order[i];
+        GLint j = i - 1;
+
+        while(j >= 0 && compareCommandTime(&order[j], &key, (void *)stats) > 0)
+        {
+            order[j+1] = order[j];
+            j--;
+        }
+
+        order[j+1] = key;
+    }
+}
+
+void replayReport(const Replay *r, FILE *fp)
+{
+    GLuint64 *sorted, total;
+    GLuint order[CAPTURE_COMMANDS];
+    GLuint count;
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"calls\": %llu,\n", r->calls);
+    fprintf(fp, "  \"frames\": %llu,\n", r->frames);
+    fprintf(fp, "  \"mismatches\": %llu,\n", r->mismatches);
+
+    if (r->frames)
+    {
+        sorted = (GLuint64 *)malloc(r->frames * sizeof(GLuint64));
+        assert(sorted);
+
+        memcpy(sorted, r->frame_ns, r->frames * sizeof(GLuint64));
+        qsort(sorted, r->frames, sizeof(GLuint64), compareNs);
+
+        total = 0;
+        for(GLuint64 i=0; i<r->frames; i++)
+            total += sorted[i];
+
+        fprintf(fp, "  \"frame_ms\": { \"min\": %.3f, \"mean\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f },\n",
+                sorted[0] / 1e6, total / 1e6 / r->frames,
+                sorted[r->frames / 2] / 1e6, sorted[(r->frames * 95) / 100] / 1e6, sorted[(r->frames * 99) / 100] / 1e6,
+                sorted[r->frames - 1] / 1e6);
+
+        free(sorted);
+    }
+
+    count = 0;
+    for(GLuint i=0; i<CAPTURE_COMMANDS; i++)
+    {
+        if (r->commands[i].calls)
+            order[count++] = i;
+    }
+
+    sortCommands(order, count, r->commands);
+
+    fprintf(fp, "  \"commands\": [\n");
+
+    for(GLuint i=0; i<count; i++)
+    {
+        const ReplayCommandStats *stats = &r->commands[order[i]];
+
+        fprintf(fp, "    { \"name\": \"%s\", \"calls\": %llu, \"total_us\": %.3f, \"mean_ns\": %llu, \"max_ns\": %llu }%s\n",
+                capture_commands[order[i]].name, stats->calls, stats->ns / 1e3,
+                stats->ns / stats->calls, stats->max_ns, i + 1 < count ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+void replayClose(Replay *r)
+{
+    if (r == NULL)
+        return;
+
+    replayFreeAllocs(r);
+
+    munmap((void *)r->data, r->size);
+
+    free(r->allocs);
+    free(r->client_indices);
+    free(r->syncs);
+    free(r->frame_ns);
+    free(r);
+}
+
+#endif /* MGL_GL_CORE */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * depth_stencil_cache.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "depth_stencil_cache.h"
+
+#define COMPARE_ALWAYS  (GL_ALWAYS - GL_NEVER)
+
+// MTLStencilOperation order
+static GLubyte stencilOpIndex(GLenum op)
+{
+    switch(op)
+    {
+        case GL_KEEP: return 0;
+        case GL_ZERO: return 1;
+        case GL_REPLACE: return 2;
+        case GL_INCR: return 3;
+        case GL_DECR: return 4;
+        case GL_INVERT: return 5;
+        case GL_INCR_WRAP: return 6;
+        case GL_DECR_WRAP: return 7;
+    }
+
+    return 0;
+}
+
+static GLubyte compareFuncIndex(GLenum func)
+{
+    if (func < GL_NEVER || func > GL_ALWAYS)
+        return COMPARE_ALWAYS;
+
+    return func - GL_NEVER;
+}
+
+static void initFace(DepthStencilFace *face, GLboolean enabled,
+                     GLenum func, GLenum fail, GLenum depth_fail, GLenum pass, GLuint read_mask, GLuint write_mask)
+{
+    if (enabled == GL_FALSE)
+    {
+        face->func = COMPARE_ALWAYS;
+        face->fail = face->depth_fail = face->pass = 0;
+        face->read_mask = face->write_mask = 0xff;
+
+        return;
+    }
+
+    face->func = compareFuncIndex(func);
+    face->fail = stencilOpIndex(fail);
+    face->depth_fail = stencilOpIndex(depth_fail);
+    face->pass = stencilOpIndex(pass);
+
+    // 8 bit stencil, the upper bits of the gl masks don't matter
+    face->read_mask = read_mask & 0xff;
+    face->write_mask = write_mask & 0xff;
+}
+
+void initDepthStencilDesc(DepthStencilDesc *desc,
+                          GLboolean depth_test, GLenum depth_func, GLboolean depth_writemask,
+                          GLboolean stencil_test,
+                          GLenum func, GLenum fail, GLenum depth_fail, GLenum pass, GLuint read_mask, GLuint write_mask,
+                          GLenum back_func, GLenum back_fail, GLenum back_depth_fail, GLenum back_pass, GLuint back_read_mask, GLuint back_write_mask)
+{
+    memset(desc, 0, sizeof(DepthStencilDesc));
+
+    // gl doesn't write depth with the test disabled
+    if (depth_test)
+    {
+        desc->depth_func = compareFuncIndex(depth_func);
+        desc->depth_write = depth_writemask ? 1 : 0;
+    }
+    else
+    {
+        desc->depth_func = COMPARE_ALWAYS;
+        desc->depth_write = 0;
+    }
+
+    initFace(&desc->front, stencil_test, func, fail, depth_fail, pass, read_mask, write_mask);
+    initFace(&desc->back, stencil_test, back_func, back_fail, back_depth_fail, back_pass, back_read_mask, back_write_mask);
+}
+
+static GLuint64 packFace(const DepthStencilFace *face)
+{
+    return (GLuint64)(face->func & 0x7) |
+           ((GLuint64)(face->fail & 0x7) << 3) |
+           ((GLuint64)(face->depth_fail & 0x7) << 6) |
+           ((GLuint64)(face->pass & 0x7) << 9) |
+           ((GLuint64)face->read_mask << 12) |
+           ((GLuint64)face->write_mask << 20);
+}
+
+static void unpackFace(GLuint64 bits, DepthStencilFace *face)
+{
+    face->func = bits & 0x7;
+    face->fail = (bits >> 3) & 0x7;
+    face->depth_fail = (bits >> 6) & 0x7;
+    face->pass = (bits >> 9) & 0x7;
+    face->read_mask = (bits >> 12) & 0xff;
+    face->write_mask = (bits >> 20) & 0xff;
+}
+
+GLuint64 packDepthStencilDesc(const DepthStencilDesc *desc)
+{
+    return (GLuint64)(desc->depth_func & 0x7) |
+           ((GLuint64)(desc->depth_write & 0x1) << 3) |
+           (packFace(&desc->front) << 4) |
+           (packFace(&desc->back) << 32);
+}
+
+void unpackDepthStencilKey(GLuint64 key, DepthStencilDesc *desc)
+{
+    desc->depth_func = key & 0x7;
+    desc->depth_write = (key >> 3) & 0x1;
+
+    unpackFace((key >> 4) & 0xfffffff, &desc->front);
+    unpackFace((key >> 32) & 0xfffffff, &desc->back);
+}
+
+void initDepthStencilCache(DepthStencilCache *cache)
+{
+    memset(cache, 0, sizeof(DepthStencilCache));
+}
+
+static GLuint hashKey(GLuint64 key)
+{
+    // fibonacci hashing, the low bits of a key barely change between configurations
+    return (GLuint)((key * 0x9E3779B97F4A7C15ULL) >> 40) & (DEPTH_STENCIL_CACHE_SIZE - 1);
+}
+
+void *depthStencilCacheFind(DepthStencilCache *cache, GLuint64 key)
+{
+    GLuint index;
+
+    index = hashKey(key);
+
+    // linear probe, the table is never allowed to fill so an empty slot ends the search
+    while(cache->entries[index].state)
+    {
+        if (cache->entries[index].key == key)
+        {
+            cache->hits++;
+
+            return cache->entries[index].state;
+        }
+
+        index = (index + 1) & (DEPTH_STENCIL_CACHE_SIZE - 1);
+    }
+
+    cache->misses++;
+
+    return NULL;
+}
+
+void depthStencilCacheInsert(DepthStencilCache *cache, GLuint64 key, void *state, void (*release)(void *state))
+{
+    GLuint index;
+
+    // an app cycling through lots of configurations starts over rather than probing forever
+    if (cache->count >= DEPTH_STENCIL_CACHE_SIZE * 3 / 4)
+    {
+        depthStencilCacheClear(cache, release);
+    }
+
+    index = hashKey(key);
+
+    while(cache->entries[index].state)
+    {
+        index = (index + 1) & (DEPTH_STENCIL_CACHE_SIZE - 1);
+    }
+
+    cache->entries[index].key = key;
+    cache->entries[index].state = state;
+    cache->count++;
+}
+
+void depthStencilCacheClear(DepthStencilCache *cache, void (*release)(void *state))
+{
+    for(int i=0; i<DEPTH_STENCIL_CACHE_SIZE; i++)
+    {
+        if (cache->entries[i].state && release)
+        {
+            release(cache->entries[i].state);
+        }
+
+        cache->entries[i].key = 0;
+        cache->entries[i].state = NULL;
+    }
+
+    cache->count = 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * depth_stencil_cache.h
+ * MGL
+ *
+ */
+
+#ifndef depth_stencil_cache_h
+#define depth_stencil_cache_h
+
+#include "glcorearb.h"
+
+// power of 2, a frame rarely uses more than a handful of configurations
+#define DEPTH_STENCIL_CACHE_SIZE    256
+
+// compare funcs are GL_NEVER relative and stencil ops are in MTLStencilOperation order,
+// both map straight onto metal
+typedef struct DepthStencilFace_t {
+    GLubyte     func;
+    GLubyte     fail;
+    GLubyte     depth_fail;
+    GLubyte     pass;
+    GLubyte     read_mask;
+    GLubyte     write_mask;
+} DepthStencilFace;
+
+typedef struct DepthStencilDesc_t {
+    GLubyte             depth_func;
+    GLubyte             depth_write;
+    DepthStencilFace    front;
+    DepthStencilFace    back;
+} DepthStencilDesc;
+
+typedef struct DepthStencilCacheEntry_t {
+    GLuint64    key;
+    void        *state;     // NULL for an empty slot
+} DepthStencilCacheEntry;
+
+typedef struct DepthStencilCache_t {
+    DepthStencilCacheEntry  entries[DEPTH_STENCIL_CACHE_SIZE];
+    GLuint                  count;
+
+    GLuint64                hits;
+    GLuint64                misses;
+} DepthStencilCache;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// gl state in, disabled tests are folded into the metal defaults so they share a key
+void initDepthStencilDesc(DepthStencilDesc *desc,
+                          GLboolean depth_test, GLenum depth_func, GLboolean depth_writemask,
+                          GLboolean stencil_test,
+                          GLenum func, GLenum fail, GLenum depth_fail, GLenum pass, GLuint read_mask, GLuint write_mask,
+                          GLenum back_func, GLenum back_fail, GLenum back_depth_fail, GLenum back_pass, GLuint back_read_mask, GLuint back_write_mask);
+
+// 60 bits, depth func / write then 28 bits per stencil face
+GLuint64 packDepthStencilDesc(const DepthStencilDesc *desc);
+void unpackDepthStencilKey(GLuint64 key, DepthStencilDesc *desc);
+
+void initDepthStencilCache(DepthStencilCache *cache);
+
+// NULL on a miss
+void *depthStencilCacheFind(DepthStencilCache *cache, GLuint64 key);
+
+// the cache takes the reference to state, a full cache is emptied first
+void depthStencilCacheInsert(DepthStencilCache *cache, GLuint64 key, void *state, void (*release)(void *state));
+
+void depthStencilCacheClear(DepthStencilCache *cache, void (*release)(void *state));
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* depth_stencil_cache_h */
@@ -23,6 +23,7 @@
 #include <mach/vm_map.h>
 
 #include "glm_context.h"
+#include "queries.h"
 
 bool check_draw_modes(GLenum mode)
 {
@@ -49,6 +50,20 @@ bool check_draw_modes(GLenum mode)
 }
 
 bool check_element_type(GLenum mode)
+{
+    switch(mode)
+    {
+        case GL_UNSIGNED_BYTE:  // widened before drawing
+        case GL_UNSIGNED_SHORT:
+        case GL_UNSIGNED_INT:
+            return true;
+    }
+
+    return false;
+}
+
+// indirect and multi draws go straight to metal, no index translation
+bool check_native_element_type(GLenum mode)
 {
     switch(mode)
     {
@@ -74,7 +89,8 @@ bool processVAO(GLMContext ctx)
         {
             if (vao->enabled_attribs & (0x1 << i))
             {
-                if (vao->attrib[i].buffer == NULL)
+                if (vao->attrib[i].buffer == NULL &&
+                    (vao->client_attribs & (0x1 << i)) == 0)
                 {
                     // no buffer bound to active attrib...
                     return false;
@@ -122,7 +138,7 @@ bool validate_vao(GLMContext ctx, bool uses_elements)
         if (enabled_attribs & 0x1)
         {
             // mapped buffers cannot be used during draw calls
-            if (VAO_ATTRIB_STATE(i).buffer->mapped) {
+            if (VAO_ATTRIB_STATE(i).buffer && VAO_ATTRIB_STATE(i).buffer->mapped) {
                 fprintf(stderr, "MGL Error: validate_vao: attrib %d buffer mapped\n", i);
                 return false;
             }
@@ -143,6 +159,22 @@ bool validate_vao(GLMContext ctx, bool uses_elements)
     return true;
 }
 
+// client arrays are copied per draw, multi draws copy per sub draw, the indirect draws
+// reading indices or counts from the gpu can't know the range to copy
+bool vao_client_arrays(GLMContext ctx)
+{
+    if (VAO() == NULL)
+        return false;
+
+    return (VAO_STATE(client_attribs) & VAO_STATE(enabled_attribs)) != 0;
+}
+
+// with no element buffer bound indices is a pointer to client memory
+bool client_indices(GLMContext ctx, const void *indices)
+{
+    return VAO() && VAO_STATE(element_array.buffer) == NULL && indices != NULL;
+}
+
 bool validate_program(GLMContext ctx)
 {
     if (ctx->state.program) {
@@ -157,6 +189,50 @@ bool validate_program(GLMContext ctx)
     return true;
 }
 
+bool validate_draw(GLMContext ctx, bool uses_elements)
+{
+    DrawValidation *last;
+
+    // no error contexts make invalid draws undefined behavior instead of checking them
+    if (ctx->context_flags & GL_CONTEXT_FLAG_NO_ERROR_BIT)
+        return true;
+
+    last = &STATE(last_validation);
+
+    // nothing the checks below look at changed since the last draw passed them
+    if (VAO() &&
+        last->vao == VAO() &&
+        last->vao_generation == VAO_STATE(generation) &&
+        last->program == STATE(program) &&
+        (STATE(program) == NULL || last->program_generation == STATE(program)->generation) &&
+        last->map_generation == STATE(map_generation) &&
+        (last->uses_elements || uses_elements == false))
+    {
+        STATE(validations_skipped)++;
+
+        return true;
+    }
+
+    STATE(validations)++;
+
+    last->vao = NULL;
+
+    if (validate_vao(ctx, uses_elements) == false)
+        return false;
+
+    if (validate_program(ctx) == false)
+        return false;
+
+    last->vao = VAO();
+    last->vao_generation = VAO_STATE(generation);
+    last->program = STATE(program);
+    last->program_generation = STATE(program) ? STATE(program)->generation : 0;
+    last->map_generation = STATE(map_generation);
+    last->uses_elements = uses_elements;
+
+    return true;
+}
+
 GLsizei getTypeSize(GLenum type)
 {
     switch(type)
@@ -173,6 +249,23 @@ GLsizei getTypeSize(GLenum type)
     return 0;
 }
 
+// every direct draw comes through here, queries are rare so keep the draw path to two
+// loads when none are active
+static inline void count_primitives(GLMContext ctx, GLenum mode, GLsizei count, GLsizei instancecount)
+{
+    STATS_ADD(draws, 1);
+
+    if (STATE(active_queries[_PRIMITIVES_GENERATED_QUERY]) ||
+        STATE(active_queries[_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_QUERY]))
+        countPrimitives(ctx, mode, count, instancecount);
+}
+
+static void count_multi_primitives(GLMContext ctx, GLenum mode, const GLsizei *count, GLsizei drawcount)
+{
+    for(GLsizei i=0; i<drawcount; i++)
+        count_primitives(ctx, mode, count[i], 1);
+}
+
 void mglDrawArrays(GLMContext ctx, GLenum mode, GLint first, GLsizei count)
 {
     // fprintf(stderr, "DEBUG: mglDrawArrays ctx=%p prog=%p dirty=%x\n", ctx, ctx->state.program, ctx->state.dirty_bits);
@@ -193,18 +286,13 @@ void mglDrawArrays(GLMContext ctx, GLenum mode, GLint first, GLsizei count)
 
     if (count == 0) { return; }
 
-    if(validate_vao(ctx, false) == false)
+    if (validate_draw(ctx, false) == false)
     {
-        fprintf(stderr, "MGL Error: mglDrawArrays: validate_vao failed\n");
         ERROR_RETURN(GL_INVALID_OPERATION);
         return;
     }
 
-    if (!validate_program(ctx)) {
-        fprintf(stderr, "MGL Error: mglDrawArrays: validate_program failed\n");
-        ERROR_RETURN(GL_INVALID_OPERATION);
-        return;
-    }
+    count_primitives(ctx, mode, count, 1);
 
     ctx->mtl_funcs.mtlDrawArrays(ctx, mode, first, count);
 }
@@ -223,13 +311,13 @@ void mglDrawElements(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, co
 
     if (!check_element_type(type)) { ERROR_RETURN(GL_INVALID_VALUE); return; }
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
         return;
     }
 
-    if (!validate_program(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
+    count_primitives(ctx, mode, count, 1);
 
     ctx->mtl_funcs.mtlDrawElements(ctx, mode, count, type, indices);
 }
@@ -245,13 +333,13 @@ void mglDrawRangeElements(GLMContext ctx, GLenum mode, GLuint start, GLuint end,
 
     if (!check_element_type(type)) { ERROR_RETURN(GL_INVALID_VALUE); return; }
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
         return;
     }
 
-    if (!validate_program(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
+    count_primitives(ctx, mode, count, 1);
 
     ctx->mtl_funcs.mtlDrawRangeElements(ctx, mode, start, end, count, type, indices);
 }
@@ -278,13 +366,13 @@ void mglDrawArraysInstanced(GLMContext ctx, GLenum mode, GLint first, GLsizei co
 
     if (instancecount == 0) { return; }
 
-    if(validate_vao(ctx, false) == false)
+    if (validate_draw(ctx, false) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
         return;
     }
 
-    if (!validate_program(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawArraysInstanced(ctx, mode, first, count, instancecount);
 }
@@ -303,13 +391,13 @@ void mglDrawElementsInstanced(GLMContext ctx, GLenum mode, GLsizei count, GLenum
 
     if (instancecount == 0) { return; }
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
         return;
     }
 
-    if (!validate_program(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawElementsInstanced(ctx, mode, count, type, indices, instancecount);
 }
@@ -323,12 +411,13 @@ void mglDrawElementsBaseVertex(GLMContext ctx, GLenum mode, GLsizei count, GLenu
 
     ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, 1);
 
     ctx->mtl_funcs.mtlDrawElementsBaseVertex(ctx, mode, count, type, indices, basevertex);
 }
@@ -343,12 +432,13 @@ void mglDrawRangeElementsBaseVertex(GLMContext ctx, GLenum mode, GLuint start, G
 
     ERROR_CHECK_RETURN(end > start, GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, 1);
 
     ctx->mtl_funcs.mtlDrawRangeElementsBaseVertex(ctx, mode, start, end, count, type, indices, basevertex);
 }
@@ -361,12 +451,13 @@ void mglDrawElementsInstancedBaseVertex(GLMContext ctx, GLenum mode, GLsizei cou
 
     ERROR_CHECK_RETURN(instancecount > 0, GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawElementsInstancedBaseVertex(ctx, mode, count, type, indices, instancecount, basevertex);
 }
@@ -377,12 +468,15 @@ void mglDrawArraysIndirect(GLMContext ctx, GLenum mode, const void *indirect)
 
     ERROR_CHECK_RETURN(STATE(buffers[_DRAW_INDIRECT_BUFFER]), GL_INVALID_OPERATION);
 
-    if(validate_vao(ctx, false) == false)
+    if (vao_client_arrays(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
+
+    if (validate_draw(ctx, false) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    STATS_ADD(draws, 1);
 
     ctx->mtl_funcs.mtlDrawArraysIndirect(ctx, mode, indirect);
 }
@@ -391,18 +485,21 @@ void mglDrawElementsIndirect(GLMContext ctx, GLenum mode, GLenum type, const voi
 {
     ERROR_CHECK_RETURN(check_draw_modes(mode), GL_INVALID_ENUM);
 
-    ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
+    ERROR_CHECK_RETURN(check_native_element_type(type), GL_INVALID_VALUE);
+
+    if (vao_client_arrays(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, true) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
-
     ERROR_CHECK_RETURN(STATE(buffers[_DRAW_INDIRECT_BUFFER]), GL_INVALID_OPERATION);
 
-    ctx->mtl_funcs.mtlDrawArraysIndirect(ctx, mode, indirect);
+    STATS_ADD(draws, 1);
+
+    ctx->mtl_funcs.mtlDrawElementsIndirect(ctx, mode, type, indirect);
 }
 
 void mglDrawArraysInstancedBaseInstance(GLMContext ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
@@ -417,12 +514,13 @@ void mglDrawArraysInstancedBaseInstance(GLMContext ctx, GLenum mode, GLint first
 
     ERROR_CHECK_RETURN(check_draw_modes(mode), GL_INVALID_ENUM);
 
-    if(validate_vao(ctx, false) == false)
+    if (validate_draw(ctx, false) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawArraysInstancedBaseInstance(ctx, mode, first, count, instancecount, baseinstance);
 }
@@ -439,12 +537,13 @@ void mglDrawElementsInstancedBaseInstance(GLMContext ctx, GLenum mode, GLsizei c
 
     ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawElementsInstancedBaseInstance(ctx, mode, count, type, indices, instancecount, baseinstance);
 }
@@ -461,12 +560,13 @@ void mglDrawElementsInstancedBaseVertexBaseInstance(GLMContext ctx, GLenum mode,
 
     ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices)) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_primitives(ctx, mode, count, instancecount);
 
     ctx->mtl_funcs.mtlDrawElementsInstancedBaseVertexBaseInstance(ctx, mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
@@ -475,12 +575,13 @@ void mglMultiDrawArrays(GLMContext ctx, GLenum mode, const GLint *first, const G
 {
     ERROR_CHECK_RETURN(check_draw_modes(mode), GL_INVALID_ENUM);
 
-    if(validate_vao(ctx, false) == false)
+    if (validate_draw(ctx, false) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_multi_primitives(ctx, mode, count, drawcount);
 
     ctx->mtl_funcs.mtlMultiDrawArrays(ctx, mode, first, count, drawcount);
 }
@@ -493,14 +594,17 @@ void mglMultiDrawElements(GLMContext ctx, GLenum mode, const GLsizei *count, GLe
 
     ERROR_CHECK_RETURN(drawcount > 0, GL_INVALID_VALUE);
 
-    ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
+    if (drawcount <= 0) { return; }
+
+    ERROR_CHECK_RETURN(check_native_element_type(type), GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices[0])) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_multi_primitives(ctx, mode, count, drawcount);
 
     ctx->mtl_funcs.mtlMultiDrawElements(ctx, mode, count, type, indices, drawcount);
 }
@@ -513,57 +617,174 @@ void mglMultiDrawElementsBaseVertex(GLMContext ctx, GLenum mode, const GLsizei *
 
     ERROR_CHECK_RETURN(drawcount > 0, GL_INVALID_VALUE);
 
-    ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
+    if (drawcount <= 0) { return; }
+
+    ERROR_CHECK_RETURN(check_native_element_type(type), GL_INVALID_VALUE);
 
-    if(validate_vao(ctx, true) == false)
+    if (validate_draw(ctx, !client_indices(ctx, indices[0])) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    count_multi_primitives(ctx, mode, count, drawcount);
 
     ctx->mtl_funcs.mtlMultiDrawElementsBaseVertex(ctx, mode, count, type, indices, drawcount, basevertex);
 }
 
-void mglMultiDrawArraysIndirect(GLMContext ctx, GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+// only persistent mappings can be drawn from
+static bool buffer_mapped(Buffer *buf)
+{
+    return buf->mapped && (buf->access_flags & GL_MAP_PERSISTENT_BIT) == 0;
+}
+
+// the commands and the draw count have to be inside the bound buffers
+static bool validate_multi_draw_indirect(GLMContext ctx, const MultiDrawIndirect *mdi)
+{
+    Buffer *indirect_buffer, *parameter_buffer;
+
+    indirect_buffer = STATE(buffers[_DRAW_INDIRECT_BUFFER]);
+
+    if (indirect_buffer == NULL || buffer_mapped(indirect_buffer))
+        return false;
+
+    if (multiDrawIndirectEnd(mdi) > (GLuint64)indirect_buffer->size)
+        return false;
+
+    if (mdi->count_offset == MDI_NO_COUNT_BUFFER)
+        return true;
+
+    parameter_buffer = STATE(buffers[_PARAMETER_BUFFER]);
+
+    if (parameter_buffer == NULL || buffer_mapped(parameter_buffer))
+        return false;
+
+    return mdi->count_offset + sizeof(GLuint) <= (GLuint64)parameter_buffer->size;
+}
+
+static void multi_draw_indirect(GLMContext ctx, GLenum mode, GLenum type, const void *indirect,
+                                GLintptr drawcount_offset, GLsizei drawcount, GLsizei stride, bool count_buffer)
 {
+    MultiDrawIndirect mdi;
+
     ERROR_CHECK_RETURN(check_draw_modes(mode), GL_INVALID_ENUM);
 
-    ERROR_CHECK_RETURN(drawcount > 0, GL_INVALID_VALUE);
+    if (type)
+    {
+        if (check_native_element_type(type) == false) { ERROR_RETURN(GL_INVALID_VALUE); return; }
+    }
+
+    if (drawcount < 0 || stride < 0 || stride % 4 || (uintptr_t)indirect % 4)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
+
+    if (count_buffer && (drawcount_offset < 0 || drawcount_offset % 4))
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
 
-    ERROR_CHECK_RETURN(stride % 4 == 0, GL_INVALID_VALUE);
+    if (vao_client_arrays(ctx)) { ERROR_RETURN(GL_INVALID_OPERATION); return; }
 
-    if(validate_vao(ctx, false) == false)
+    if (validate_draw(ctx, type != 0) == false)
     {
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    initMultiDrawIndirect(&mdi, mode, type, (GLuint64)(uintptr_t)indirect, drawcount, stride);
 
-    ERROR_CHECK_RETURN(STATE(buffers[_DRAW_INDIRECT_BUFFER]), GL_INVALID_OPERATION);
+    if (count_buffer)
+        multiDrawIndirectSetCountBuffer(&mdi, drawcount_offset);
 
-    ctx->mtl_funcs.mtlMultiDrawArraysIndirect(ctx, mode, indirect, drawcount, stride);
+    if (validate_multi_draw_indirect(ctx, &mdi) == false)
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    if (drawcount == 0)
+        return;
+
+    STATS_ADD(draws, drawcount);
+
+    ctx->mtl_funcs.mtlMultiDrawIndirect(ctx, &mdi);
+}
+
+void mglMultiDrawArraysIndirect(GLMContext ctx, GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    multi_draw_indirect(ctx, mode, 0, indirect, 0, drawcount, stride, false);
 }
 
 void mglMultiDrawElementsIndirect(GLMContext ctx, GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
 {
-    ERROR_CHECK_RETURN(check_draw_modes(mode), GL_INVALID_ENUM);
+    multi_draw_indirect(ctx, mode, type, indirect, 0, drawcount, stride, false);
+}
 
-    ERROR_CHECK_RETURN(drawcount > 0, GL_INVALID_VALUE);
+void mglMultiDrawArraysIndirectCount(GLMContext ctx, GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    multi_draw_indirect(ctx, mode, 0, indirect, drawcount, maxdrawcount, stride, true);
+}
+
+void mglMultiDrawElementsIndirectCount(GLMContext ctx, GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    multi_draw_indirect(ctx, mode, type, indirect, drawcount, maxdrawcount, stride, true);
+}
 
-    ERROR_CHECK_RETURN(stride % 4 == 0, GL_INVALID_VALUE);
 
-    ERROR_CHECK_RETURN(check_element_type(type), GL_INVALID_VALUE);
+// no error variants, the app promises the vao, program and arguments are valid
+void mglDrawArrays_no_error(GLMContext ctx, GLenum mode, GLint first, GLsizei count)
+{
+    if (count == 0) { return; }
 
-    if(validate_vao(ctx, true) == false)
-    {
-        ERROR_RETURN(GL_INVALID_OPERATION);
-    }
+    count_primitives(ctx, mode, count, 1);
 
-    ERROR_CHECK_RETURN(validate_program(ctx), GL_INVALID_OPERATION);
+    ctx->mtl_funcs.mtlDrawArrays(ctx, mode, first, count);
+}
 
-    ERROR_CHECK_RETURN(STATE(buffers[_DRAW_INDIRECT_BUFFER]), GL_INVALID_OPERATION);
+void mglDrawElements_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    if (count == 0) { return; }
+
+    count_primitives(ctx, mode, count, 1);
 
-    ctx->mtl_funcs.mtlMultiDrawElementsIndirect(ctx, mode, type, indirect, drawcount, stride);
+    ctx->mtl_funcs.mtlDrawElements(ctx, mode, count, type, indices);
 }
 
+void mglDrawRangeElements_no_error(GLMContext ctx, GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    if (count == 0) { return; }
+
+    count_primitives(ctx, mode, count, 1);
+
+    ctx->mtl_funcs.mtlDrawRangeElements(ctx, mode, start, end, count, type, indices);
+}
+
+void mglDrawArraysInstanced_no_error(GLMContext ctx, GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    if (count == 0 || instancecount == 0) { return; }
+
+    count_primitives(ctx, mode, count, instancecount);
+
+    ctx->mtl_funcs.mtlDrawArraysInstanced(ctx, mode, first, count, instancecount);
+}
+
+void mglDrawElementsInstanced_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    if (count == 0 || instancecount == 0) { return; }
+
+    count_primitives(ctx, mode, count, instancecount);
+
+    ctx->mtl_funcs.mtlDrawElementsInstanced(ctx, mode, count, type, indices, instancecount);
+}
+
+void mglDrawElementsBaseVertex_no_error(GLMContext ctx, GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    if (count == 0) { return; }
+
+    count_primitives(ctx, mode, count, 1);
+
+    ctx->mtl_funcs.mtlDrawElementsBaseVertex(ctx, mode, count, type, indices, basevertex);
+}
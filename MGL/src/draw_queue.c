@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * draw_queue.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "draw_queue.h"
+
+void initDrawQueue(DrawQueue *queue)
+{
+    memset(queue, 0, sizeof(DrawQueue));
+}
+
+GLboolean drawQueueCanAppend(const DrawQueue *queue, GLenum mode, GLenum type, void *elements)
+{
+    if (queue->count == 0 || queue->count >= DRAW_QUEUE_SIZE)
+        return GL_FALSE;
+
+    return (queue->mode == mode && queue->type == type && queue->elements == elements);
+}
+
+GLboolean drawQueueAdd(DrawQueue *queue, GLenum mode, GLenum type, void *elements,
+                       GLuint64 start, GLuint count, GLint basevertex)
+{
+    DrawQueueEntry *entry;
+
+    if (queue->count == 0)
+    {
+        queue->mode = mode;
+        queue->type = type;
+        queue->elements = elements;
+    }
+    else if (drawQueueCanAppend(queue, mode, type, elements) == GL_FALSE)
+    {
+        return GL_FALSE;
+    }
+
+    entry = &queue->entries[queue->count++];
+    entry->start = start;
+    entry->count = count;
+    entry->basevertex = basevertex;
+
+    queue->queued++;
+
+    return GL_TRUE;
+}
+
+// vertices per primitive, 0 for strips / fans / loops which share vertices across a join
+static GLuint listPrimitiveSize(GLenum mode)
+{
+    switch(mode)
+    {
+        case GL_POINTS: return 1;
+        case GL_LINES: return 2;
+        case GL_TRIANGLES: return 3;
+    }
+
+    return 0;
+}
+
+static GLuint64 startStride(GLenum type)
+{
+    switch(type)
+    {
+        case GL_UNSIGNED_BYTE: return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        case GL_UNSIGNED_INT: return 4;
+    }
+
+    // array draws count in vertices
+    return 1;
+}
+
+GLuint drawQueueFlush(DrawQueue *queue, DrawQueueEmitFunc emit, DrawQueueBatchFunc batch, void *user)
+{
+    DrawQueueEntry *current;
+    GLuint prim_size, count, emitted;
+    GLuint64 stride;
+
+    if (queue->count == 0)
+        return 0;
+
+    prim_size = listPrimitiveSize(queue->mode);
+    stride = startStride(queue->type);
+
+    // merged in place, entries[0 .. count) are what's left to draw
+    count = 1;
+    current = &queue->entries[0];
+
+    for(GLuint i=1; i<queue->count; i++)
+    {
+        const DrawQueueEntry *next;
+
+        next = &queue->entries[i];
+
+        // a partial primitive at the end of a draw is dropped by gl, it can't be joined to the next one
+        if (prim_size &&
+            (current->count % prim_size) == 0 &&
+            next->basevertex == current->basevertex &&
+            next->start == current->start + current->count * stride)
+        {
+            current->count += next->count;
+            queue->merged++;
+
+            continue;
+        }
+
+        current = &queue->entries[count++];
+        *current = *next;
+    }
+
+    // what's left shares mode, type and element buffer, only the ranges and base vertex differ
+    if (batch && count > 1 && batch(user, queue, queue->entries, count))
+    {
+        queue->batched += count;
+        emitted = 1;
+    }
+    else
+    {
+        for(GLuint i=0; i<count; i++)
+            emit(user, queue, &queue->entries[i]);
+
+        emitted = count;
+    }
+
+    queue->batches++;
+
+    drawQueueDiscard(queue);
+
+    return emitted;
+}
+
+void drawQueueDiscard(DrawQueue *queue)
+{
+    queue->count = 0;
+    queue->elements = NULL;
+}
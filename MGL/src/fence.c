@@ -19,9 +19,21 @@
  */
 
 #include <strings.h>
+#include <pthread.h>
 
 #include "glm_context.h"
 
+// syncs are shared between contexts, one table hands out the handles for all of them
+// so a handle from one context means the same fence in any other
+static SyncTable sync_table;
+static pthread_mutex_t sync_table_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t sync_table_once = PTHREAD_ONCE_INIT;
+
+static void initSyncs(void)
+{
+    initSyncTable(&sync_table, 64);
+}
+
 Sync *newSync(GLMContext ctx)
 {
     Sync *ptr;
@@ -35,197 +47,226 @@ Sync *newSync(GLMContext ctx)
 
     bzero(ptr, sizeof(Sync));
 
-    ptr->name = STATE(sync_name)++;
+    // the table's
+    ptr->refcount = 1;
+
+    return ptr;
+}
+
+// handles are looked up, never dereferenced, so a deleted sync is just not found
+// the sync comes back with a reference, releaseSync it when done
+Sync *getSync(GLMContext ctx, GLsync sync)
+{
+    Sync *ptr;
+
+    if (sync == NULL)
+        return NULL;
+
+    pthread_once(&sync_table_once, initSyncs);
+
+    pthread_mutex_lock(&sync_table_lock);
+    ptr = (Sync *)syncTableLookup(&sync_table, sync);
+    if (ptr)
+        ptr->refcount++;
+    pthread_mutex_unlock(&sync_table_lock);
 
     return ptr;
 }
 
-int isSync(GLMContext ctx, GLsync sync)
+// a sync deleted by another thread while this one waits on it goes once the wait is done
+void releaseSync(GLMContext ctx, Sync *ptr)
 {
-    if (sync->name < STATE(sync_name))
-        return 1;
+    GLuint refcount;
+
+    pthread_mutex_lock(&sync_table_lock);
+    refcount = --ptr->refcount;
+    pthread_mutex_unlock(&sync_table_lock);
+
+    if (refcount)
+        return;
 
-    return 0;
+    ctx->mtl_funcs.mtlDeleteSync(ctx, ptr);
+
+    free(ptr);
 }
 
 GLsync mglFenceSync(GLMContext ctx, GLenum condition, GLbitfield flags)
 {
     Sync *ptr;
+    GLsync handle;
 
-    switch(condition)
-    {
-        case GL_SYNC_GPU_COMMANDS_COMPLETE:
-            break;
+    ERROR_CHECK_RETURN_VALUE(condition == GL_SYNC_GPU_COMMANDS_COMPLETE, GL_INVALID_ENUM, NULL);
 
-        default:
-            // CRITICAL FIX: Handle unknown fence conditions gracefully instead of crashing
-            fprintf(stderr, "MGL ERROR: Unknown fence sync condition 0x%x, defaulting to GPU_COMMANDS_COMPLETE\n", condition);
-            condition = GL_SYNC_GPU_COMMANDS_COMPLETE;
-            break;
+    // must be zero
+    ERROR_CHECK_RETURN_VALUE(flags == 0, GL_INVALID_VALUE, NULL);
+
+    ptr = newSync(ctx);
+    if (ptr == NULL)
+    {
+        ERROR_RETURN_VALUE(GL_OUT_OF_MEMORY, NULL);
     }
 
-    // must be zero
-    if (flags != 0) {
-        // CRITICAL FIX: Handle invalid flags gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Fence sync flags must be zero, got 0x%x, continuing with zero\n", flags);
-        flags = 0;
+    // the fence is the end of the command buffer being recorded, without one
+    // there is nothing that would ever signal it
+    if (ctx->mtl_funcs.mtlGetSync(ctx, ptr) == false)
+    {
+        free(ptr);
+        ERROR_RETURN_VALUE(GL_OUT_OF_MEMORY, NULL);
     }
 
-    ptr = newSync(ctx);
+    pthread_once(&sync_table_once, initSyncs);
 
-    ctx->mtl_funcs.mtlGetSync(ctx, ptr);
+    pthread_mutex_lock(&sync_table_lock);
+    handle = syncTableInsert(&sync_table, ptr);
+    pthread_mutex_unlock(&sync_table_lock);
 
-    return ptr;
-}
+    if (handle == NULL)
+    {
+        ctx->mtl_funcs.mtlDeleteSync(ctx, ptr);
+        free(ptr);
+        ERROR_RETURN_VALUE(GL_OUT_OF_MEMORY, NULL);
+    }
 
+    return handle;
+}
 
 GLboolean mglIsSync(GLMContext ctx, GLsync sync)
 {
-    if (sync == NULL)
-    {
-        return false;
-    }
+    Sync *ptr;
+
+    ptr = getSync(ctx, sync);
+
+    if (ptr == NULL)
+        return GL_FALSE;
+
+    releaseSync(ctx, ptr);
 
-    return isSync(ctx, sync);
+    return GL_TRUE;
 }
 
 void mglDeleteSync(GLMContext ctx, GLsync sync)
 {
-    if (isSync(ctx, sync) == GL_FALSE)
-    {
-        // CRITICAL FIX: Handle invalid sync gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Attempting to delete invalid sync object %p\n", sync);
+    Sync *ptr;
+
+    // deleting 0 is silently ignored
+    if (sync == NULL)
         return;
-    }
 
-    if (sync->mtl_event)
-    {
-        ctx->mtl_funcs.mtlWaitForSync(ctx, sync);
+    pthread_once(&sync_table_once, initSyncs);
+
+    pthread_mutex_lock(&sync_table_lock);
+    ptr = (Sync *)syncTableRemove(&sync_table, sync);
+    pthread_mutex_unlock(&sync_table_lock);
 
-        // should be null - but handle gracefully if not
-        if (sync->mtl_event != NULL) {
-            fprintf(stderr, "MGL WARNING: sync->mtl_event should be NULL after wait, but is %p\n", sync->mtl_event);
-        }
+    if (ptr == NULL)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
     }
 
-    free(sync);
+    // the handle is gone now, waits still holding it finish first
+    releaseSync(ctx, ptr);
 }
 
-GLenum  mglClientWaitSync(GLMContext ctx, GLsync sync, GLbitfield flags, GLuint64 timeout)
+GLenum mglClientWaitSync(GLMContext ctx, GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
-    if (flags & ~GL_SYNC_FLUSH_COMMANDS_BIT)
-    {
-        // CRITICAL FIX: Handle invalid flags gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Invalid sync flags 0x%x, only GL_SYNC_FLUSH_COMMANDS_BIT allowed\n", flags);
-        return GL_INVALID_VALUE;
-    }
+    Sync *ptr;
+    GLenum result;
 
-    if (isSync(ctx, sync) == GL_FALSE)
-    {
-        // CRITICAL FIX: Handle invalid sync gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Invalid sync object %p passed to client wait sync\n", sync);
-        return GL_INVALID_VALUE;
-    }
+    ERROR_CHECK_RETURN_VALUE((flags & ~GL_SYNC_FLUSH_COMMANDS_BIT) == 0, GL_INVALID_VALUE, GL_WAIT_FAILED);
 
-    if (sync->mtl_event == NULL)
-    {
-        return GL_ALREADY_SIGNALED;
-    }
+    ptr = getSync(ctx, sync);
 
-    ctx->mtl_funcs.mtlWaitForSync(ctx, sync);
+    ERROR_CHECK_RETURN_VALUE(ptr, GL_INVALID_VALUE, GL_WAIT_FAILED);
 
-    assert(sync->mtl_event == NULL);
+    // polling with a 0 timeout never blocks
+    if (ctx->mtl_funcs.mtlSyncSignaled(ctx, ptr))
+        result = GL_ALREADY_SIGNALED;
+    else
+        result = ctx->mtl_funcs.mtlClientWaitSync(ctx, ptr, (flags & GL_SYNC_FLUSH_COMMANDS_BIT) != 0, timeout);
 
-    return GL_CONDITION_SATISFIED;
+    releaseSync(ctx, ptr);
+
+    return result;
 }
 
 void mglWaitSync(GLMContext ctx, GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
-    if (isSync(ctx, sync) == GL_FALSE)
+    Sync *ptr;
+
+    ptr = getSync(ctx, sync);
+
+    if (ptr == NULL || flags != 0 || timeout != GL_TIMEOUT_IGNORED)
     {
-        // CRITICAL FIX: Handle invalid sync gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Invalid sync object %p passed to wait sync\n", sync);
-        return;
-    }
+        if (ptr)
+            releaseSync(ctx, ptr);
 
-    if (timeout != GL_TIMEOUT_IGNORED) {
-        // CRITICAL FIX: Handle invalid timeout gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Server wait sync timeout must be GL_TIMEOUT_IGNORED, got 0x%llx\n", timeout);
-        // Continue with GL_TIMEOUT_IGNORED behavior
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
     }
 
-    ctx->mtl_funcs.mtlWaitForSync(ctx, sync);
+    // the gpu waits, the cpu carries on
+    if (ctx->mtl_funcs.mtlSyncSignaled(ctx, ptr) == false)
+        ctx->mtl_funcs.mtlWaitSync(ctx, ptr);
 
-    // Handle gracefully if event is not null after wait
-    if (sync->mtl_event != NULL) {
-        fprintf(stderr, "MGL WARNING: sync->mtl_event should be NULL after server wait, but is %p\n", sync->mtl_event);
-    }
+    releaseSync(ctx, ptr);
 }
 
 void mglGetSynciv(GLMContext ctx, GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
 {
-    if (isSync(ctx, sync) == GL_FALSE)
+    Sync *ptr;
+    GLint value;
+
+    ptr = getSync(ctx, sync);
+
+    if (ptr == NULL || count < 0)
     {
-        // CRITICAL FIX: Handle invalid sync gracefully instead of crashing
-        fprintf(stderr, "MGL ERROR: Invalid sync object %p passed to get sync iv\n", sync);
-        return;
-    }
+        if (ptr)
+            releaseSync(ctx, ptr);
 
-    // CRITICAL FIX: Add parameter validation with graceful handling
-    if (!count || count < 0) {
-        fprintf(stderr, "MGL ERROR: Invalid count %d in get sync iv\n", count);
-        return;
-    }
-    if (!length) {
-        fprintf(stderr, "MGL ERROR: NULL length pointer in get sync iv\n");
-        return;
-    }
-    if (!values) {
-        fprintf(stderr, "MGL ERROR: NULL values pointer in get sync iv\n");
+        ERROR_RETURN(GL_INVALID_VALUE);
         return;
     }
 
-    if (*length < count * sizeof(GLuint))
+    // the status is read under the reference, the rest is constant
+    value = ctx->mtl_funcs.mtlSyncSignaled(ctx, ptr) ? GL_SIGNALED : GL_UNSIGNALED;
+
+    releaseSync(ctx, ptr);
+
+    switch(pname)
     {
-        // CRITICAL FIX: Handle insufficient buffer size gracefully
-        fprintf(stderr, "MGL ERROR: Insufficient buffer size %d for %d values in get sync iv\n", *length, count);
-        *length = count * sizeof(GLuint);
-        return;
+        case GL_OBJECT_TYPE:
+            value = GL_SYNC_FENCE;
+            break;
+
+        case GL_SYNC_STATUS:
+            // only looks at the timeline, never waits
+            break;
+
+        case GL_SYNC_CONDITION:
+            value = GL_SYNC_GPU_COMMANDS_COMPLETE;
+            break;
+
+        case GL_SYNC_FLAGS:
+            value = 0;
+            break;
+
+        default:
+            ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    while(count--)
+    if (count == 0)
     {
-        switch(pname)
-        {
-            case GL_OBJECT_TYPE:
-                *values = GL_SYNC_FENCE;
-                break;
-
-            case GL_SYNC_STATUS:
-                if (sync->mtl_event)
-                    *values = GL_UNSIGNALED;
-                else
-                    *values = GL_SIGNALED;
-                break;
-
-            case GL_SYNC_CONDITION:
-                if (sync->mtl_event == NULL)
-                    *values = GL_SYNC_GPU_COMMANDS_COMPLETE;
-                break;
-
-            case GL_SYNC_FLAGS:
-                *values = 0;
-                break;
-
-            default:
-                // CRITICAL FIX: Handle unknown sync parameters gracefully instead of crashing
-                fprintf(stderr, "MGL ERROR: Unknown sync parameter 0x%x in get sync iv\n", pname);
-                *values = 0; // Return safe default value
-                break;
-        }
-
-        values++;
+        if (length)
+            *length = 0;
+        return;
     }
+
+    *values = value;
+
+    if (length)
+        *length = 1;
 }
 
 void mglTextureBarrier(GLMContext ctx)
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * frame_pacing.c
+ * MGL
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame_pacing.h"
+
+void initFramePacing(FramePacing *fp, const char *max_frames, const char *low_latency)
+{
+    memset(fp, 0, sizeof(FramePacing));
+
+    fp->max_frames = FRAME_PACING_DEFAULT_FRAMES;
+
+    if (max_frames && *max_frames)
+        framePacingSetMaxFrames(fp, (GLuint)strtoul(max_frames, NULL, 10));
+
+    if (low_latency && *low_latency)
+        fp->low_latency = strtol(low_latency, NULL, 10) != 0;
+}
+
+void framePacingSetMaxFrames(FramePacing *fp, GLuint max_frames)
+{
+    if (max_frames < 1)
+        max_frames = 1;
+    else if (max_frames > FRAME_PACING_MAX_FRAMES)
+        max_frames = FRAME_PACING_MAX_FRAMES;
+
+    fp->max_frames = max_frames;
+}
+
+void framePacingSubmit(FramePacing *fp, GLuint64 serial)
+{
+    fp->serials[fp->frames % FRAME_PACING_MAX_FRAMES] = serial;
+    fp->frames++;
+}
+
+static GLuint64 firstTrackedFrame(const FramePacing *fp)
+{
+    return fp->frames > FRAME_PACING_MAX_FRAMES ? fp->frames - FRAME_PACING_MAX_FRAMES : 0;
+}
+
+GLuint64 framePacingWaitSerial(const FramePacing *fp, GLuint64 completed)
+{
+    GLuint64 oldest;
+
+    // oldest frame still on the gpu
+    for(oldest = firstTrackedFrame(fp); oldest < fp->frames; oldest++)
+    {
+        if (fp->serials[oldest % FRAME_PACING_MAX_FRAMES] > completed)
+            break;
+    }
+
+    if (oldest == fp->frames)
+        return 0;
+
+    // the cpu never gets ahead of the gpu
+    if (fp->low_latency)
+        return fp->serials[oldest % FRAME_PACING_MAX_FRAMES];
+
+    // the frame about to be recorded counts against the limit
+    if (fp->frames - oldest < fp->max_frames)
+        return 0;
+
+    return fp->serials[(fp->frames - fp->max_frames) % FRAME_PACING_MAX_FRAMES];
+}
+
+GLboolean framePacingCompletedFrame(const FramePacing *fp, GLuint64 completed, GLuint64 *first, GLuint64 *last)
+{
+    GLuint64 tracked, frame;
+
+    tracked = firstTrackedFrame(fp);
+
+    for(frame = fp->frames; frame > tracked; frame--)
+    {
+        *last = fp->serials[(frame - 1) % FRAME_PACING_MAX_FRAMES];
+
+        if (*last > completed)
+            continue;
+
+        // a frame is every command buffer after the previous frame's
+        if (frame - 1 == 0)
+            *first = 1;
+        else if (frame - 1 > tracked)
+            *first = fp->serials[(frame - 2) % FRAME_PACING_MAX_FRAMES] + 1;
+        else
+            *first = *last;
+
+        return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
@@ -23,6 +23,7 @@
 
 #include "glm_context.h"
 #include "pixel_utils.h"
+#include "pixel_formats.h"
 #include "utils.h"
 
 #define RENDBUF_STATE(_val_)    ctx->state.renderbuffer->_val_
@@ -154,6 +155,22 @@ Framebuffer *findFrameBuffer(GLMContext ctx, GLuint framebuffer)
     return ptr;
 }
 
+// clears are load actions of the next pass, a pass on the framebuffer being unbound applies them
+// before they can land on the new one
+static void bindDrawFramebuffer(GLMContext ctx, Framebuffer *ptr)
+{
+    if (ctx->state.framebuffer == ptr)
+        return;
+
+    if (renderPassNeedsRestart(&STATE(render_pass)) && ctx->mtl_funcs.mtlClearBuffer)
+        ctx->mtl_funcs.mtlClearBuffer(ctx, 0, 0);
+
+    renderPassDropPending(&STATE(render_pass));
+
+    ctx->state.framebuffer = ptr;
+    STATE(dirty_bits) |= DIRTY_FBO;
+}
+
 #pragma mark Framebuffer calls
 GLboolean mglIsFramebuffer(GLMContext ctx, GLuint framebuffer)
 {
@@ -187,20 +204,19 @@ void mglBindFramebuffer(GLMContext ctx, GLenum target, GLuint framebuffer)
 
     switch(target) {
         case GL_DRAW_FRAMEBUFFER:
-            ctx->state.framebuffer = ptr;
+            bindDrawFramebuffer(ctx, ptr);
             break;
 
         case GL_READ_FRAMEBUFFER:
+            // reads go through blits and readbacks, no render pass to restart
             ctx->state.readbuffer = ptr;
             break;
 
         case GL_FRAMEBUFFER:
-            ctx->state.framebuffer = ptr;
             ctx->state.readbuffer = ptr;
+            bindDrawFramebuffer(ctx, ptr);
             break;
     }
-    
-    STATE(dirty_bits) |= DIRTY_FBO;
 }
 
 void mglDeleteFramebuffers(GLMContext ctx, GLsizei n, const GLuint *framebuffers)
@@ -215,8 +231,12 @@ void mglDeleteFramebuffers(GLMContext ctx, GLsizei n, const GLuint *framebuffers
             continue;
             
         // Unbind if currently bound
+        // its pending clears go with it
         if (ctx->state.framebuffer == fbo)
+        {
+            renderPassDropPending(&STATE(render_pass));
             ctx->state.framebuffer = NULL;
+        }
         if (ctx->state.readbuffer == fbo)
             ctx->state.readbuffer = NULL;
             
@@ -586,11 +606,6 @@ void framebufferTexture(GLMContext ctx, GLenum target, GLenum attachment_type, G
     fbo_attachment_ptr->textarget = textarget;
     fbo_attachment_ptr->level = level;
     fbo_attachment_ptr->layer = layer;
-    fbo_attachment_ptr->clear_bitmask = 0;
-    fbo_attachment_ptr->clear_color[0] = 0.f;
-    fbo_attachment_ptr->clear_color[1] = 0.f;
-    fbo_attachment_ptr->clear_color[2] = 0.f;
-    fbo_attachment_ptr->clear_color[3] = 0.f;
     fbo_attachment_ptr->buf.tex = tex;
 
     if (attachment == GL_DEPTH_STENCIL_ATTACHMENT)
@@ -599,6 +614,10 @@ void framebufferTexture(GLMContext ctx, GLenum target, GLenum attachment_type, G
     }
 
     fbo->dirty_bits |= DIRTY_FBO_BINDING;
+
+    // new attachments on the draw framebuffer need a new render pass
+    if (fbo == ctx->state.framebuffer)
+        STATE(dirty_bits) |= DIRTY_FBO;
 }
 
 /*
@@ -729,6 +748,10 @@ void mglFramebufferRenderbuffer(GLMContext ctx, GLenum target, GLenum attachment
     }
 
     fbo->dirty_bits |= DIRTY_FBO_BINDING;
+
+    // new attachments on the draw framebuffer need a new render pass
+    if (fbo == ctx->state.framebuffer)
+        STATE(dirty_bits) |= DIRTY_FBO;
 }
 
 #pragma mark =====
@@ -820,12 +843,47 @@ void getFramebufferAttachmentParameteriv(GLMContext ctx, GLuint framebuffer, GLe
                 return;
 
             case GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE:
+                *params = bitcountForInternalFormat(tex->internalformat, GL_DEPTH_COMPONENT);
+                return;
+
             case GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE:
-                *params = bitcountForInternalFormat(tex->internalformat, GL_NONE);
+                *params = bitcountForInternalFormat(tex->internalformat, GL_STENCIL_INDEX);
                 return;
 
             case GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE:
+                {
+                    const PixelFormatDesc *desc;
+
+                    desc = pixelFormatDesc(tex->internalformat);
+
+                    // the stencil only attachment has no component type
+                    if (desc == NULL)
+                        *params = GL_UNSIGNED_NORMALIZED;
+                    else if (desc->base_format == GL_STENCIL_INDEX)
+                        *params = GL_NONE;
+                    else if (desc->flags & PIXEL_FORMAT_UINT)
+                        *params = GL_UNSIGNED_INT;
+                    else if (desc->flags & PIXEL_FORMAT_SINT)
+                        *params = GL_INT;
+                    else if (desc->flags & PIXEL_FORMAT_FLOAT)
+                        *params = GL_FLOAT;
+                    else if (desc->flags & PIXEL_FORMAT_SNORM)
+                        *params = GL_SIGNED_NORMALIZED;
+                    else
+                        *params = GL_UNSIGNED_NORMALIZED;
+                }
+                return;
+
             case GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING:
+                {
+                    const PixelFormatDesc *desc;
+
+                    desc = pixelFormatDesc(tex->internalformat);
+
+                    *params = (desc && (desc->flags & PIXEL_FORMAT_SRGB)) ? GL_SRGB : GL_LINEAR;
+                }
+                return;
+
             case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE:
                 assert(0);
                 // need to fill these in
@@ -940,16 +998,177 @@ void mglGetFramebufferParameteriv(GLMContext ctx, GLenum target, GLenum pname, G
     assert(0);
 }
 
+// render pass slots for an invalidate attachment list, -1 on an invalid enum
+static GLint invalidateAttachmentSlots(GLMContext ctx, Framebuffer *fbo, GLsizei numAttachments, const GLenum *attachments, GLbitfield *slots)
+{
+    *slots = 0;
+
+    for (GLsizei i=0; i<numAttachments; i++)
+    {
+        GLenum attachment = attachments[i];
+
+        if (fbo == NULL)
+        {
+            switch(attachment)
+            {
+                case GL_COLOR: *slots |= 0x1; break;
+                case GL_DEPTH: *slots |= RENDER_PASS_DEPTH_BIT; break;
+                case GL_STENCIL: *slots |= RENDER_PASS_STENCIL_BIT; break;
+                default:
+                    return -1;
+            }
+        }
+        else
+        {
+            switch(attachment)
+            {
+                case GL_DEPTH_ATTACHMENT: *slots |= RENDER_PASS_DEPTH_BIT; break;
+                case GL_STENCIL_ATTACHMENT: *slots |= RENDER_PASS_STENCIL_BIT; break;
+                case GL_DEPTH_STENCIL_ATTACHMENT: *slots |= RENDER_PASS_DEPTH_BIT | RENDER_PASS_STENCIL_BIT; break;
+                default:
+                    if (attachment < GL_COLOR_ATTACHMENT0 || attachment > GL_COLOR_ATTACHMENT31)
+                        return -1;
+
+                    if (attachment - GL_COLOR_ATTACHMENT0 >= STATE(max_color_attachments))
+                        return 0;
+
+                    *slots |= 0x1 << (attachment - GL_COLOR_ATTACHMENT0);
+                    break;
+            }
+        }
+    }
+
+    return 1;
+}
+
+// true if the rect covers every attachment named in slots
+static bool invalidateRectCoversAttachments(Framebuffer *fbo, GLbitfield slots, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    // we don't know the drawable size here, partial invalidates of the default framebuffer are dropped
+    if (fbo == NULL)
+        return false;
+
+    if (x > 0 || y > 0)
+        return false;
+
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        FBOAttachment *fboa;
+        Texture *tex;
+
+        if ((slots & (0x1 << i)) == 0)
+            continue;
+
+        if (i == RENDER_PASS_DEPTH)
+            fboa = &fbo->depth;
+        else if (i == RENDER_PASS_STENCIL)
+            fboa = &fbo->stencil;
+        else
+            fboa = &fbo->color_attachments[i];
+
+        if (fboa->textarget == GL_RENDERBUFFER)
+            tex = fboa->buf.rbo ? fboa->buf.rbo->tex : NULL;
+        else
+            tex = fboa->buf.tex;
+
+        // an empty attachment has nothing to keep
+        if (tex == NULL)
+            continue;
+
+        if ((GLint64)x + width < (GLint)(tex->width >> fboa->level) ||
+            (GLint64)y + height < (GLint)(tex->height >> fboa->level))
+            return false;
+    }
+
+    return true;
+}
+
+static void invalidateFramebuffer(GLMContext ctx, Framebuffer *fbo, GLsizei numAttachments, const GLenum *attachments, bool full, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLbitfield slots;
+    GLint ret;
+
+    if (numAttachments < 0 || width < 0 || height < 0)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
+
+    ret = invalidateAttachmentSlots(ctx, fbo, numAttachments, attachments, &slots);
+
+    if (ret < 0)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+    else if (ret == 0)
+    {
+        // color attachment beyond GL_MAX_COLOR_ATTACHMENTS
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    // only the draw framebuffer has render pass history, invalidating anything else is a hint we can drop
+    if (fbo != ctx->state.framebuffer)
+        return;
+
+    // a partial invalidate still needs the rest of the attachment loaded and stored
+    if (full == false &&
+        invalidateRectCoversAttachments(fbo, slots, x, y, width, height) == false)
+        return;
+
+    renderPassInvalidate(&STATE(render_pass), slots);
+}
+
+static Framebuffer *invalidateTargetFBO(GLMContext ctx, GLenum target, bool *valid)
+{
+    *valid = true;
+
+    switch(target)
+    {
+        case GL_FRAMEBUFFER:
+        case GL_DRAW_FRAMEBUFFER:
+            return ctx->state.framebuffer;
+
+        case GL_READ_FRAMEBUFFER:
+            return ctx->state.readbuffer;
+    }
+
+    *valid = false;
+
+    return NULL;
+}
+
 void mglInvalidateFramebuffer(GLMContext ctx, GLenum target, GLsizei numAttachments, const GLenum *attachments)
 {
-    // Unimplemented function
-    assert(0);
+    Framebuffer *fbo;
+    bool valid;
+
+    fbo = invalidateTargetFBO(ctx, target, &valid);
+
+    if (valid == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    invalidateFramebuffer(ctx, fbo, numAttachments, attachments, true, 0, 0, 0, 0);
 }
 
 void mglInvalidateSubFramebuffer(GLMContext ctx, GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    // Unimplemented function
-    assert(0);
+    Framebuffer *fbo;
+    bool valid;
+
+    fbo = invalidateTargetFBO(ctx, target, &valid);
+
+    if (valid == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    invalidateFramebuffer(ctx, fbo, numAttachments, attachments, false, x, y, width, height);
 }
 
 void mglCreateFramebuffers(GLMContext ctx, GLsizei n, GLuint *framebuffers)
@@ -1002,14 +1221,42 @@ void mglNamedFramebufferReadBuffer(GLMContext ctx, GLuint framebuffer, GLenum sr
 
 void mglInvalidateNamedFramebufferData(GLMContext ctx, GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
 {
-    // Unimplemented function
-    assert(0);
+    Framebuffer *fbo;
+
+    fbo = NULL;
+
+    if (framebuffer)
+    {
+        fbo = findFrameBuffer(ctx, framebuffer);
+
+        if (fbo == NULL)
+        {
+            ERROR_RETURN(GL_INVALID_OPERATION);
+            return;
+        }
+    }
+
+    invalidateFramebuffer(ctx, fbo, numAttachments, attachments, true, 0, 0, 0, 0);
 }
 
 void mglInvalidateNamedFramebufferSubData(GLMContext ctx, GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    // Unimplemented function
-    assert(0);
+    Framebuffer *fbo;
+
+    fbo = NULL;
+
+    if (framebuffer)
+    {
+        fbo = findFrameBuffer(ctx, framebuffer);
+
+        if (fbo == NULL)
+        {
+            ERROR_RETURN(GL_INVALID_OPERATION);
+            return;
+        }
+    }
+
+    invalidateFramebuffer(ctx, fbo, numAttachments, attachments, false, x, y, width, height);
 }
 
 void mglClearNamedFramebufferiv(GLMContext ctx, GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
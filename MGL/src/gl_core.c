@@ -21,6 +21,8 @@ void glCullFace(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.cull_face(ctx, mode);
 }
 
@@ -28,6 +30,8 @@ void glFrontFace(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.front_face(ctx, mode);
 }
 
@@ -35,6 +39,8 @@ void glHint(GLenum target, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.hint(ctx, target, mode);
 }
 
@@ -42,6 +48,8 @@ void glLineWidth(GLfloat width)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.line_width(ctx, width);
 }
 
@@ -49,6 +57,8 @@ void glPointSize(GLfloat size)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.point_size(ctx, size);
 }
 
@@ -56,6 +66,8 @@ void glPolygonMode(GLenum face, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.polygon_mode(ctx, face, mode);
 }
 
@@ -63,6 +75,8 @@ void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scissor(ctx, x, y, width, height);
 }
 
@@ -70,6 +84,8 @@ void glTexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameterf(ctx, target, pname, param);
 }
 
@@ -77,6 +93,8 @@ void glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameterfv(ctx, target, pname, params);
 }
 
@@ -84,6 +102,8 @@ void glTexParameteri(GLenum target, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameteri(ctx, target, pname, param);
 }
 
@@ -91,6 +111,8 @@ void glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameteriv(ctx, target, pname, params);
 }
 
@@ -98,6 +120,8 @@ void glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei widt
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_image1D(ctx, target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -105,6 +129,8 @@ void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei widt
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_image2D(ctx, target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -112,6 +138,8 @@ void glDrawBuffer(GLenum buf)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_buffer(ctx, buf);
 }
 
@@ -119,6 +147,8 @@ void glClear(GLbitfield mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear(ctx, mask);
 }
 
@@ -126,6 +156,8 @@ void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_color(ctx, red, green, blue, alpha);
 }
 
@@ -133,6 +165,8 @@ void glClearStencil(GLint s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_stencil(ctx, s);
 }
 
@@ -140,6 +174,8 @@ void glClearDepth(GLdouble depth)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_depth(ctx, depth);
 }
 
@@ -147,6 +183,8 @@ void glStencilMask(GLuint mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_mask(ctx, mask);
 }
 
@@ -154,6 +192,8 @@ void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_mask(ctx, red, green, blue, alpha);
 }
 
@@ -161,6 +201,8 @@ void glDepthMask(GLboolean flag)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_mask(ctx, flag);
 }
 
@@ -168,6 +210,8 @@ void glDisable(GLenum cap)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.disable(ctx, cap);
 }
 
@@ -175,6 +219,8 @@ void glEnable(GLenum cap)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.enable(ctx, cap);
 }
 
@@ -182,6 +228,8 @@ void glFinish()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.finish(ctx);
 }
 
@@ -189,6 +237,8 @@ void glFlush()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.flush(ctx);
 }
 
@@ -196,6 +246,8 @@ void glBlendFunc(GLenum sfactor, GLenum dfactor)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_func(ctx, sfactor, dfactor);
 }
 
@@ -203,6 +255,8 @@ void glLogicOp(GLenum opcode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.logic_op(ctx, opcode);
 }
 
@@ -210,6 +264,8 @@ void glStencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_func(ctx, func, ref, mask);
 }
 
@@ -217,6 +273,8 @@ void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_op(ctx, fail, zfail, zpass);
 }
 
@@ -224,6 +282,8 @@ void glDepthFunc(GLenum func)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_func(ctx, func);
 }
 
@@ -231,6 +291,8 @@ void glPixelStoref(GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_storef(ctx, pname, param);
 }
 
@@ -238,6 +300,8 @@ void glPixelStorei(GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_storei(ctx, pname, param);
 }
 
@@ -245,6 +309,8 @@ void glReadBuffer(GLenum src)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.read_buffer(ctx, src);
 }
 
@@ -252,6 +318,8 @@ void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.read_pixels(ctx, x, y, width, height, format, type, pixels);
 }
 
@@ -259,6 +327,8 @@ void glGetBooleanv(GLenum pname, GLboolean *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_booleanv(ctx, pname, data);
 }
 
@@ -266,6 +336,8 @@ void glGetDoublev(GLenum pname, GLdouble *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_doublev(ctx, pname, data);
 }
 
@@ -273,6 +345,8 @@ GLenum  glGetError()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_error(ctx);
 }
 
@@ -280,6 +354,8 @@ void glGetFloatv(GLenum pname, GLfloat *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_floatv(ctx, pname, data);
 }
 
@@ -287,6 +363,8 @@ void glGetIntegerv(GLenum pname, GLint *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_integerv(ctx, pname, data);
 }
 
@@ -294,6 +372,8 @@ GLubyte const  *glGetString(GLenum name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_string(ctx, name);
 }
 
@@ -301,6 +381,8 @@ void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_image(ctx, target, level, format, type, pixels);
 }
 
@@ -308,6 +390,8 @@ void glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_parameterfv(ctx, target, pname, params);
 }
 
@@ -315,6 +399,8 @@ void glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_parameteriv(ctx, target, pname, params);
 }
 
@@ -322,6 +408,8 @@ void glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_level_parameterfv(ctx, target, level, pname, params);
 }
 
@@ -329,6 +417,8 @@ void glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *p
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_level_parameteriv(ctx, target, level, pname, params);
 }
 
@@ -336,6 +426,8 @@ GLboolean  glIsEnabled(GLenum cap)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_enabled(ctx, cap);
 }
 
@@ -343,6 +435,8 @@ void glDepthRange(GLdouble n, GLdouble f)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_range(ctx, n, f);
 }
 
@@ -350,6 +444,8 @@ void glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.viewport(ctx, x, y, width, height);
 }
 
@@ -357,6 +453,8 @@ void glNewList(GLuint list, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.new_list(ctx, list, mode);
 }
 
@@ -364,6 +462,8 @@ void glEndList()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end_list(ctx);
 }
 
@@ -371,6 +471,8 @@ void glCallList(GLuint list)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.call_list(ctx, list);
 }
 
@@ -378,6 +480,8 @@ void glCallLists(GLsizei n, GLenum type, const void *lists)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.call_lists(ctx, n, type, lists);
 }
 
@@ -385,6 +489,8 @@ void glDeleteLists(GLuint list, GLsizei range)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_lists(ctx, list, range);
 }
 
@@ -392,6 +498,8 @@ GLuint  glGenLists(GLsizei range)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.gen_lists(ctx, range);
 }
 
@@ -399,6 +507,8 @@ void glListBase(GLuint base)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.list_base(ctx, base);
 }
 
@@ -406,6 +516,8 @@ void glBegin(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.begin(ctx, mode);
 }
 
@@ -413,6 +525,8 @@ void glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLflo
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bitmap(ctx, width, height, xorig, yorig, xmove, ymove, bitmap);
 }
 
@@ -420,6 +534,8 @@ void glColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3b(ctx, red, green, blue);
 }
 
@@ -427,6 +543,8 @@ void glColor3bv(const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3bv(ctx, v);
 }
 
@@ -434,6 +552,8 @@ void glColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3d(ctx, red, green, blue);
 }
 
@@ -441,6 +561,8 @@ void glColor3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3dv(ctx, v);
 }
 
@@ -448,6 +570,8 @@ void glColor3f(GLfloat red, GLfloat green, GLfloat blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3f(ctx, red, green, blue);
 }
 
@@ -455,6 +579,8 @@ void glColor3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3fv(ctx, v);
 }
 
@@ -462,6 +588,8 @@ void glColor3i(GLint red, GLint green, GLint blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3i(ctx, red, green, blue);
 }
 
@@ -469,6 +597,8 @@ void glColor3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3iv(ctx, v);
 }
 
@@ -476,6 +606,8 @@ void glColor3s(GLshort red, GLshort green, GLshort blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3s(ctx, red, green, blue);
 }
 
@@ -483,6 +615,8 @@ void glColor3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3sv(ctx, v);
 }
 
@@ -490,6 +624,8 @@ void glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3ub(ctx, red, green, blue);
 }
 
@@ -497,6 +633,8 @@ void glColor3ubv(const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3ubv(ctx, v);
 }
 
@@ -504,6 +642,8 @@ void glColor3ui(GLuint red, GLuint green, GLuint blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3ui(ctx, red, green, blue);
 }
 
@@ -511,6 +651,8 @@ void glColor3uiv(const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3uiv(ctx, v);
 }
 
@@ -518,6 +660,8 @@ void glColor3us(GLushort red, GLushort green, GLushort blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3us(ctx, red, green, blue);
 }
 
@@ -525,6 +669,8 @@ void glColor3usv(const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color3usv(ctx, v);
 }
 
@@ -532,6 +678,8 @@ void glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4b(ctx, red, green, blue, alpha);
 }
 
@@ -539,6 +687,8 @@ void glColor4bv(const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4bv(ctx, v);
 }
 
@@ -546,6 +696,8 @@ void glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4d(ctx, red, green, blue, alpha);
 }
 
@@ -553,6 +705,8 @@ void glColor4dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4dv(ctx, v);
 }
 
@@ -560,6 +714,8 @@ void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4f(ctx, red, green, blue, alpha);
 }
 
@@ -567,6 +723,8 @@ void glColor4fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4fv(ctx, v);
 }
 
@@ -574,6 +732,8 @@ void glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4i(ctx, red, green, blue, alpha);
 }
 
@@ -581,6 +741,8 @@ void glColor4iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4iv(ctx, v);
 }
 
@@ -588,6 +750,8 @@ void glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4s(ctx, red, green, blue, alpha);
 }
 
@@ -595,6 +759,8 @@ void glColor4sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4sv(ctx, v);
 }
 
@@ -602,6 +768,8 @@ void glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4ub(ctx, red, green, blue, alpha);
 }
 
@@ -609,6 +777,8 @@ void glColor4ubv(const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4ubv(ctx, v);
 }
 
@@ -616,6 +786,8 @@ void glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4ui(ctx, red, green, blue, alpha);
 }
 
@@ -623,6 +795,8 @@ void glColor4uiv(const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4uiv(ctx, v);
 }
 
@@ -630,6 +804,8 @@ void glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4us(ctx, red, green, blue, alpha);
 }
 
@@ -637,6 +813,8 @@ void glColor4usv(const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color4usv(ctx, v);
 }
 
@@ -644,6 +822,8 @@ void glEdgeFlag(GLboolean flag)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.edge_flag(ctx, flag);
 }
 
@@ -651,6 +831,8 @@ void glEdgeFlagv(const GLboolean *flag)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.edge_flagv(ctx, flag);
 }
 
@@ -658,6 +840,8 @@ void glEnd()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end(ctx);
 }
 
@@ -665,6 +849,8 @@ void glIndexd(GLdouble c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexd(ctx, c);
 }
 
@@ -672,6 +858,8 @@ void glIndexdv(const GLdouble *c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexdv(ctx, c);
 }
 
@@ -679,6 +867,8 @@ void glIndexf(GLfloat c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexf(ctx, c);
 }
 
@@ -686,6 +876,8 @@ void glIndexfv(const GLfloat *c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexfv(ctx, c);
 }
 
@@ -693,6 +885,8 @@ void glIndexi(GLint c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexi(ctx, c);
 }
 
@@ -700,6 +894,8 @@ void glIndexiv(const GLint *c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexiv(ctx, c);
 }
 
@@ -707,6 +903,8 @@ void glIndexs(GLshort c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexs(ctx, c);
 }
 
@@ -714,6 +912,8 @@ void glIndexsv(const GLshort *c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexsv(ctx, c);
 }
 
@@ -721,6 +921,8 @@ void glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3b(ctx, nx, ny, nz);
 }
 
@@ -728,6 +930,8 @@ void glNormal3bv(const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3bv(ctx, v);
 }
 
@@ -735,6 +939,8 @@ void glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3d(ctx, nx, ny, nz);
 }
 
@@ -742,6 +948,8 @@ void glNormal3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3dv(ctx, v);
 }
 
@@ -749,6 +957,8 @@ void glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3f(ctx, nx, ny, nz);
 }
 
@@ -756,6 +966,8 @@ void glNormal3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3fv(ctx, v);
 }
 
@@ -763,6 +975,8 @@ void glNormal3i(GLint nx, GLint ny, GLint nz)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3i(ctx, nx, ny, nz);
 }
 
@@ -770,6 +984,8 @@ void glNormal3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3iv(ctx, v);
 }
 
@@ -777,6 +993,8 @@ void glNormal3s(GLshort nx, GLshort ny, GLshort nz)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3s(ctx, nx, ny, nz);
 }
 
@@ -784,6 +1002,8 @@ void glNormal3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal3sv(ctx, v);
 }
 
@@ -791,6 +1011,8 @@ void glRasterPos2d(GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2d(ctx, x, y);
 }
 
@@ -798,6 +1020,8 @@ void glRasterPos2dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2dv(ctx, v);
 }
 
@@ -805,6 +1029,8 @@ void glRasterPos2f(GLfloat x, GLfloat y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2f(ctx, x, y);
 }
 
@@ -812,6 +1038,8 @@ void glRasterPos2fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2fv(ctx, v);
 }
 
@@ -819,6 +1047,8 @@ void glRasterPos2i(GLint x, GLint y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2i(ctx, x, y);
 }
 
@@ -826,6 +1056,8 @@ void glRasterPos2iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2iv(ctx, v);
 }
 
@@ -833,6 +1065,8 @@ void glRasterPos2s(GLshort x, GLshort y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2s(ctx, x, y);
 }
 
@@ -840,6 +1074,8 @@ void glRasterPos2sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos2sv(ctx, v);
 }
 
@@ -847,6 +1083,8 @@ void glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3d(ctx, x, y, z);
 }
 
@@ -854,6 +1092,8 @@ void glRasterPos3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3dv(ctx, v);
 }
 
@@ -861,6 +1101,8 @@ void glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3f(ctx, x, y, z);
 }
 
@@ -868,6 +1110,8 @@ void glRasterPos3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3fv(ctx, v);
 }
 
@@ -875,6 +1119,8 @@ void glRasterPos3i(GLint x, GLint y, GLint z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3i(ctx, x, y, z);
 }
 
@@ -882,6 +1128,8 @@ void glRasterPos3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3iv(ctx, v);
 }
 
@@ -889,6 +1137,8 @@ void glRasterPos3s(GLshort x, GLshort y, GLshort z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3s(ctx, x, y, z);
 }
 
@@ -896,6 +1146,8 @@ void glRasterPos3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos3sv(ctx, v);
 }
 
@@ -903,6 +1155,8 @@ void glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4d(ctx, x, y, z, w);
 }
 
@@ -910,6 +1164,8 @@ void glRasterPos4dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4dv(ctx, v);
 }
 
@@ -917,6 +1173,8 @@ void glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4f(ctx, x, y, z, w);
 }
 
@@ -924,6 +1182,8 @@ void glRasterPos4fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4fv(ctx, v);
 }
 
@@ -931,6 +1191,8 @@ void glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4i(ctx, x, y, z, w);
 }
 
@@ -938,6 +1200,8 @@ void glRasterPos4iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4iv(ctx, v);
 }
 
@@ -945,6 +1209,8 @@ void glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4s(ctx, x, y, z, w);
 }
 
@@ -952,6 +1218,8 @@ void glRasterPos4sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.raster_pos4sv(ctx, v);
 }
 
@@ -959,6 +1227,8 @@ void glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectd(ctx, x1, y1, x2, y2);
 }
 
@@ -966,6 +1236,8 @@ void glRectdv(const GLdouble *v1, const GLdouble *v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectdv(ctx, v1, v2);
 }
 
@@ -973,6 +1245,8 @@ void glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectf(ctx, x1, y1, x2, y2);
 }
 
@@ -980,6 +1254,8 @@ void glRectfv(const GLfloat *v1, const GLfloat *v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectfv(ctx, v1, v2);
 }
 
@@ -987,6 +1263,8 @@ void glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.recti(ctx, x1, y1, x2, y2);
 }
 
@@ -994,6 +1272,8 @@ void glRectiv(const GLint *v1, const GLint *v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectiv(ctx, v1, v2);
 }
 
@@ -1001,6 +1281,8 @@ void glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rects(ctx, x1, y1, x2, y2);
 }
 
@@ -1008,6 +1290,8 @@ void glRectsv(const GLshort *v1, const GLshort *v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rectsv(ctx, v1, v2);
 }
 
@@ -1015,6 +1299,8 @@ void glTexCoord1d(GLdouble s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1d(ctx, s);
 }
 
@@ -1022,6 +1308,8 @@ void glTexCoord1dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1dv(ctx, v);
 }
 
@@ -1029,6 +1317,8 @@ void glTexCoord1f(GLfloat s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1f(ctx, s);
 }
 
@@ -1036,6 +1326,8 @@ void glTexCoord1fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1fv(ctx, v);
 }
 
@@ -1043,6 +1335,8 @@ void glTexCoord1i(GLint s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1i(ctx, s);
 }
 
@@ -1050,6 +1344,8 @@ void glTexCoord1iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1iv(ctx, v);
 }
 
@@ -1057,6 +1353,8 @@ void glTexCoord1s(GLshort s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1s(ctx, s);
 }
 
@@ -1064,6 +1362,8 @@ void glTexCoord1sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord1sv(ctx, v);
 }
 
@@ -1071,6 +1371,8 @@ void glTexCoord2d(GLdouble s, GLdouble t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2d(ctx, s, t);
 }
 
@@ -1078,6 +1380,8 @@ void glTexCoord2dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2dv(ctx, v);
 }
 
@@ -1085,6 +1389,8 @@ void glTexCoord2f(GLfloat s, GLfloat t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2f(ctx, s, t);
 }
 
@@ -1092,6 +1398,8 @@ void glTexCoord2fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2fv(ctx, v);
 }
 
@@ -1099,6 +1407,8 @@ void glTexCoord2i(GLint s, GLint t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2i(ctx, s, t);
 }
 
@@ -1106,6 +1416,8 @@ void glTexCoord2iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2iv(ctx, v);
 }
 
@@ -1113,6 +1425,8 @@ void glTexCoord2s(GLshort s, GLshort t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2s(ctx, s, t);
 }
 
@@ -1120,6 +1434,8 @@ void glTexCoord2sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord2sv(ctx, v);
 }
 
@@ -1127,6 +1443,8 @@ void glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3d(ctx, s, t, r);
 }
 
@@ -1134,6 +1452,8 @@ void glTexCoord3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3dv(ctx, v);
 }
 
@@ -1141,6 +1461,8 @@ void glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3f(ctx, s, t, r);
 }
 
@@ -1148,6 +1470,8 @@ void glTexCoord3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3fv(ctx, v);
 }
 
@@ -1155,6 +1479,8 @@ void glTexCoord3i(GLint s, GLint t, GLint r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3i(ctx, s, t, r);
 }
 
@@ -1162,6 +1488,8 @@ void glTexCoord3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3iv(ctx, v);
 }
 
@@ -1169,6 +1497,8 @@ void glTexCoord3s(GLshort s, GLshort t, GLshort r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3s(ctx, s, t, r);
 }
 
@@ -1176,6 +1506,8 @@ void glTexCoord3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord3sv(ctx, v);
 }
 
@@ -1183,6 +1515,8 @@ void glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4d(ctx, s, t, r, q);
 }
 
@@ -1190,6 +1524,8 @@ void glTexCoord4dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4dv(ctx, v);
 }
 
@@ -1197,6 +1533,8 @@ void glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4f(ctx, s, t, r, q);
 }
 
@@ -1204,6 +1542,8 @@ void glTexCoord4fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4fv(ctx, v);
 }
 
@@ -1211,6 +1551,8 @@ void glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4i(ctx, s, t, r, q);
 }
 
@@ -1218,6 +1560,8 @@ void glTexCoord4iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4iv(ctx, v);
 }
 
@@ -1225,6 +1569,8 @@ void glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4s(ctx, s, t, r, q);
 }
 
@@ -1232,6 +1578,8 @@ void glTexCoord4sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord4sv(ctx, v);
 }
 
@@ -1239,6 +1587,8 @@ void glVertex2d(GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2d(ctx, x, y);
 }
 
@@ -1246,6 +1596,8 @@ void glVertex2dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2dv(ctx, v);
 }
 
@@ -1253,6 +1605,8 @@ void glVertex2f(GLfloat x, GLfloat y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2f(ctx, x, y);
 }
 
@@ -1260,6 +1614,8 @@ void glVertex2fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2fv(ctx, v);
 }
 
@@ -1267,6 +1623,8 @@ void glVertex2i(GLint x, GLint y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2i(ctx, x, y);
 }
 
@@ -1274,6 +1632,8 @@ void glVertex2iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2iv(ctx, v);
 }
 
@@ -1281,6 +1641,8 @@ void glVertex2s(GLshort x, GLshort y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2s(ctx, x, y);
 }
 
@@ -1288,6 +1650,8 @@ void glVertex2sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex2sv(ctx, v);
 }
 
@@ -1295,6 +1659,8 @@ void glVertex3d(GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3d(ctx, x, y, z);
 }
 
@@ -1302,6 +1668,8 @@ void glVertex3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3dv(ctx, v);
 }
 
@@ -1309,6 +1677,8 @@ void glVertex3f(GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3f(ctx, x, y, z);
 }
 
@@ -1316,6 +1686,8 @@ void glVertex3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3fv(ctx, v);
 }
 
@@ -1323,6 +1695,8 @@ void glVertex3i(GLint x, GLint y, GLint z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3i(ctx, x, y, z);
 }
 
@@ -1330,6 +1704,8 @@ void glVertex3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3iv(ctx, v);
 }
 
@@ -1337,6 +1713,8 @@ void glVertex3s(GLshort x, GLshort y, GLshort z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3s(ctx, x, y, z);
 }
 
@@ -1344,6 +1722,8 @@ void glVertex3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex3sv(ctx, v);
 }
 
@@ -1351,6 +1731,8 @@ void glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4d(ctx, x, y, z, w);
 }
 
@@ -1358,6 +1740,8 @@ void glVertex4dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4dv(ctx, v);
 }
 
@@ -1365,6 +1749,8 @@ void glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4f(ctx, x, y, z, w);
 }
 
@@ -1372,6 +1758,8 @@ void glVertex4fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4fv(ctx, v);
 }
 
@@ -1379,6 +1767,8 @@ void glVertex4i(GLint x, GLint y, GLint z, GLint w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4i(ctx, x, y, z, w);
 }
 
@@ -1386,6 +1776,8 @@ void glVertex4iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4iv(ctx, v);
 }
 
@@ -1393,6 +1785,8 @@ void glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4s(ctx, x, y, z, w);
 }
 
@@ -1400,6 +1794,8 @@ void glVertex4sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex4sv(ctx, v);
 }
 
@@ -1407,6 +1803,8 @@ void glClipPlane(GLenum plane, const GLdouble *equation)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clip_plane(ctx, plane, equation);
 }
 
@@ -1414,6 +1812,8 @@ void glColorMaterial(GLenum face, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_material(ctx, face, mode);
 }
 
@@ -1421,6 +1821,8 @@ void glFogf(GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fogf(ctx, pname, param);
 }
 
@@ -1428,6 +1830,8 @@ void glFogfv(GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fogfv(ctx, pname, params);
 }
 
@@ -1435,6 +1839,8 @@ void glFogi(GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fogi(ctx, pname, param);
 }
 
@@ -1442,6 +1848,8 @@ void glFogiv(GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fogiv(ctx, pname, params);
 }
 
@@ -1449,6 +1857,8 @@ void glLightf(GLenum light, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.lightf(ctx, light, pname, param);
 }
 
@@ -1456,6 +1866,8 @@ void glLightfv(GLenum light, GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.lightfv(ctx, light, pname, params);
 }
 
@@ -1463,6 +1875,8 @@ void glLighti(GLenum light, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.lighti(ctx, light, pname, param);
 }
 
@@ -1470,6 +1884,8 @@ void glLightiv(GLenum light, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.lightiv(ctx, light, pname, params);
 }
 
@@ -1477,6 +1893,8 @@ void glLightModelf(GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.light_modelf(ctx, pname, param);
 }
 
@@ -1484,6 +1902,8 @@ void glLightModelfv(GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.light_modelfv(ctx, pname, params);
 }
 
@@ -1491,6 +1911,8 @@ void glLightModeli(GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.light_modeli(ctx, pname, param);
 }
 
@@ -1498,6 +1920,8 @@ void glLightModeliv(GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.light_modeliv(ctx, pname, params);
 }
 
@@ -1505,6 +1929,8 @@ void glLineStipple(GLint factor, GLushort pattern)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.line_stipple(ctx, factor, pattern);
 }
 
@@ -1512,6 +1938,8 @@ void glMaterialf(GLenum face, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.materialf(ctx, face, pname, param);
 }
 
@@ -1519,6 +1947,8 @@ void glMaterialfv(GLenum face, GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.materialfv(ctx, face, pname, params);
 }
 
@@ -1526,6 +1956,8 @@ void glMateriali(GLenum face, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.materiali(ctx, face, pname, param);
 }
 
@@ -1533,6 +1965,8 @@ void glMaterialiv(GLenum face, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.materialiv(ctx, face, pname, params);
 }
 
@@ -1540,6 +1974,8 @@ void glPolygonStipple(const GLubyte *mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.polygon_stipple(ctx, mask);
 }
 
@@ -1547,6 +1983,8 @@ void glShadeModel(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.shade_model(ctx, mode);
 }
 
@@ -1554,6 +1992,8 @@ void glTexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_envf(ctx, target, pname, param);
 }
 
@@ -1561,6 +2001,8 @@ void glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_envfv(ctx, target, pname, params);
 }
 
@@ -1568,6 +2010,8 @@ void glTexEnvi(GLenum target, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_envi(ctx, target, pname, param);
 }
 
@@ -1575,6 +2019,8 @@ void glTexEnviv(GLenum target, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_enviv(ctx, target, pname, params);
 }
 
@@ -1582,6 +2028,8 @@ void glTexGend(GLenum coord, GLenum pname, GLdouble param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_gend(ctx, coord, pname, param);
 }
 
@@ -1589,6 +2037,8 @@ void glTexGendv(GLenum coord, GLenum pname, const GLdouble *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_gendv(ctx, coord, pname, params);
 }
 
@@ -1596,6 +2046,8 @@ void glTexGenf(GLenum coord, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_genf(ctx, coord, pname, param);
 }
 
@@ -1603,6 +2055,8 @@ void glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_genfv(ctx, coord, pname, params);
 }
 
@@ -1610,6 +2064,8 @@ void glTexGeni(GLenum coord, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_geni(ctx, coord, pname, param);
 }
 
@@ -1617,6 +2073,8 @@ void glTexGeniv(GLenum coord, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_geniv(ctx, coord, pname, params);
 }
 
@@ -1624,6 +2082,8 @@ void glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.feedback_buffer(ctx, size, type, buffer);
 }
 
@@ -1631,6 +2091,8 @@ void glSelectBuffer(GLsizei size, GLuint *buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.select_buffer(ctx, size, buffer);
 }
 
@@ -1638,6 +2100,8 @@ GLint  glRenderMode(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.render_mode(ctx, mode);
 }
 
@@ -1645,6 +2109,8 @@ void glInitNames()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.init_names(ctx);
 }
 
@@ -1652,6 +2118,8 @@ void glLoadName(GLuint name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_name(ctx, name);
 }
 
@@ -1659,6 +2127,8 @@ void glPassThrough(GLfloat token)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pass_through(ctx, token);
 }
 
@@ -1666,6 +2136,8 @@ void glPopName()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pop_name(ctx);
 }
 
@@ -1673,6 +2145,8 @@ void glPushName(GLuint name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.push_name(ctx, name);
 }
 
@@ -1680,6 +2154,8 @@ void glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_accum(ctx, red, green, blue, alpha);
 }
 
@@ -1687,6 +2163,8 @@ void glClearIndex(GLfloat c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_index(ctx, c);
 }
 
@@ -1694,6 +2172,8 @@ void glIndexMask(GLuint mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.index_mask(ctx, mask);
 }
 
@@ -1701,6 +2181,8 @@ void glAccum(GLenum op, GLfloat value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.accum(ctx, op, value);
 }
 
@@ -1708,6 +2190,8 @@ void glPopAttrib()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pop_attrib(ctx);
 }
 
@@ -1715,6 +2199,8 @@ void glPushAttrib(GLbitfield mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.push_attrib(ctx, mask);
 }
 
@@ -1722,6 +2208,8 @@ void glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map1d(ctx, target, u1, u2, stride, order, points);
 }
 
@@ -1729,6 +2217,8 @@ void glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, c
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map1f(ctx, target, u1, u2, stride, order, points);
 }
 
@@ -1736,6 +2226,8 @@ void glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorde
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map2d(ctx, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
 }
 
@@ -1743,6 +2235,8 @@ void glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map2f(ctx, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
 }
 
@@ -1750,6 +2244,8 @@ void glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map_grid1d(ctx, un, u1, u2);
 }
 
@@ -1757,6 +2253,8 @@ void glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map_grid1f(ctx, un, u1, u2);
 }
 
@@ -1764,6 +2262,8 @@ void glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdo
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map_grid2d(ctx, un, u1, u2, vn, v1, v2);
 }
 
@@ -1771,6 +2271,8 @@ void glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.map_grid2f(ctx, un, u1, u2, vn, v1, v2);
 }
 
@@ -1778,6 +2280,8 @@ void glEvalCoord1d(GLdouble u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord1d(ctx, u);
 }
 
@@ -1785,6 +2289,8 @@ void glEvalCoord1dv(const GLdouble *u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord1dv(ctx, u);
 }
 
@@ -1792,6 +2298,8 @@ void glEvalCoord1f(GLfloat u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord1f(ctx, u);
 }
 
@@ -1799,6 +2307,8 @@ void glEvalCoord1fv(const GLfloat *u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord1fv(ctx, u);
 }
 
@@ -1806,6 +2316,8 @@ void glEvalCoord2d(GLdouble u, GLdouble v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord2d(ctx, u, v);
 }
 
@@ -1813,6 +2325,8 @@ void glEvalCoord2dv(const GLdouble *u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord2dv(ctx, u);
 }
 
@@ -1820,6 +2334,8 @@ void glEvalCoord2f(GLfloat u, GLfloat v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord2f(ctx, u, v);
 }
 
@@ -1827,6 +2343,8 @@ void glEvalCoord2fv(const GLfloat *u)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_coord2fv(ctx, u);
 }
 
@@ -1834,6 +2352,8 @@ void glEvalMesh1(GLenum mode, GLint i1, GLint i2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_mesh1(ctx, mode, i1, i2);
 }
 
@@ -1841,6 +2361,8 @@ void glEvalPoint1(GLint i)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_point1(ctx, i);
 }
 
@@ -1848,6 +2370,8 @@ void glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_mesh2(ctx, mode, i1, i2, j1, j2);
 }
 
@@ -1855,6 +2379,8 @@ void glEvalPoint2(GLint i, GLint j)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.eval_point2(ctx, i, j);
 }
 
@@ -1862,6 +2388,8 @@ void glAlphaFunc(GLenum func, GLfloat ref)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.alpha_func(ctx, func, ref);
 }
 
@@ -1869,6 +2397,8 @@ void glPixelZoom(GLfloat xfactor, GLfloat yfactor)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_zoom(ctx, xfactor, yfactor);
 }
 
@@ -1876,6 +2406,8 @@ void glPixelTransferf(GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_transferf(ctx, pname, param);
 }
 
@@ -1883,6 +2415,8 @@ void glPixelTransferi(GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_transferi(ctx, pname, param);
 }
 
@@ -1890,6 +2424,8 @@ void glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_mapfv(ctx, map, mapsize, values);
 }
 
@@ -1897,6 +2433,8 @@ void glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_mapuiv(ctx, map, mapsize, values);
 }
 
@@ -1904,6 +2442,8 @@ void glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pixel_mapusv(ctx, map, mapsize, values);
 }
 
@@ -1911,6 +2451,8 @@ void glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_pixels(ctx, x, y, width, height, type);
 }
 
@@ -1918,6 +2460,8 @@ void glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, con
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_pixels(ctx, width, height, format, type, pixels);
 }
 
@@ -1925,6 +2469,8 @@ void glGetClipPlane(GLenum plane, GLdouble *equation)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_clip_plane(ctx, plane, equation);
 }
 
@@ -1932,6 +2478,8 @@ void glGetLightfv(GLenum light, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_lightfv(ctx, light, pname, params);
 }
 
@@ -1939,6 +2487,8 @@ void glGetLightiv(GLenum light, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_lightiv(ctx, light, pname, params);
 }
 
@@ -1946,6 +2496,8 @@ void glGetMapdv(GLenum target, GLenum query, GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_mapdv(ctx, target, query, v);
 }
 
@@ -1953,6 +2505,8 @@ void glGetMapfv(GLenum target, GLenum query, GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_mapfv(ctx, target, query, v);
 }
 
@@ -1960,6 +2514,8 @@ void glGetMapiv(GLenum target, GLenum query, GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_mapiv(ctx, target, query, v);
 }
 
@@ -1967,6 +2523,8 @@ void glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_materialfv(ctx, face, pname, params);
 }
 
@@ -1974,6 +2532,8 @@ void glGetMaterialiv(GLenum face, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_materialiv(ctx, face, pname, params);
 }
 
@@ -1981,6 +2541,8 @@ void glGetPixelMapfv(GLenum map, GLfloat *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_pixel_mapfv(ctx, map, values);
 }
 
@@ -1988,6 +2550,8 @@ void glGetPixelMapuiv(GLenum map, GLuint *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_pixel_mapuiv(ctx, map, values);
 }
 
@@ -1995,6 +2559,8 @@ void glGetPixelMapusv(GLenum map, GLushort *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_pixel_mapusv(ctx, map, values);
 }
 
@@ -2002,6 +2568,8 @@ void glGetPolygonStipple(GLubyte *mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_polygon_stipple(ctx, mask);
 }
 
@@ -2009,6 +2577,8 @@ void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_envfv(ctx, target, pname, params);
 }
 
@@ -2016,6 +2586,8 @@ void glGetTexEnviv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_enviv(ctx, target, pname, params);
 }
 
@@ -2023,6 +2595,8 @@ void glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_gendv(ctx, coord, pname, params);
 }
 
@@ -2030,6 +2604,8 @@ void glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_genfv(ctx, coord, pname, params);
 }
 
@@ -2037,6 +2613,8 @@ void glGetTexGeniv(GLenum coord, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_geniv(ctx, coord, pname, params);
 }
 
@@ -2044,6 +2622,8 @@ GLboolean  glIsList(GLuint list)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_list(ctx, list);
 }
 
@@ -2051,6 +2631,8 @@ void glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLd
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.frustum(ctx, left, right, bottom, top, zNear, zFar);
 }
 
@@ -2058,6 +2640,8 @@ void glLoadIdentity()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_identity(ctx);
 }
 
@@ -2065,6 +2649,8 @@ void glLoadMatrixf(const GLfloat *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_matrixf(ctx, m);
 }
 
@@ -2072,6 +2658,8 @@ void glLoadMatrixd(const GLdouble *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_matrixd(ctx, m);
 }
 
@@ -2079,6 +2667,8 @@ void glMatrixMode(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.matrix_mode(ctx, mode);
 }
 
@@ -2086,6 +2676,8 @@ void glMultMatrixf(const GLfloat *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.mult_matrixf(ctx, m);
 }
 
@@ -2093,6 +2685,8 @@ void glMultMatrixd(const GLdouble *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.mult_matrixd(ctx, m);
 }
 
@@ -2100,6 +2694,8 @@ void glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdou
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.ortho(ctx, left, right, bottom, top, zNear, zFar);
 }
 
@@ -2107,6 +2703,8 @@ void glPopMatrix()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pop_matrix(ctx);
 }
 
@@ -2114,6 +2712,8 @@ void glPushMatrix()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.push_matrix(ctx);
 }
 
@@ -2121,6 +2721,8 @@ void glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rotated(ctx, angle, x, y, z);
 }
 
@@ -2128,6 +2730,8 @@ void glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.rotatef(ctx, angle, x, y, z);
 }
 
@@ -2135,6 +2739,8 @@ void glScaled(GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scaled(ctx, x, y, z);
 }
 
@@ -2142,6 +2748,8 @@ void glScalef(GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scalef(ctx, x, y, z);
 }
 
@@ -2149,6 +2757,8 @@ void glTranslated(GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.translated(ctx, x, y, z);
 }
 
@@ -2156,6 +2766,8 @@ void glTranslatef(GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.translatef(ctx, x, y, z);
 }
 
@@ -2163,6 +2775,8 @@ void glDrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_arrays(ctx, mode, first, count);
 }
 
@@ -2170,6 +2784,8 @@ void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements(ctx, mode, count, type, indices);
 }
 
@@ -2177,6 +2793,8 @@ void glGetPointerv(GLenum pname, void **params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_pointerv(ctx, pname, params);
 }
 
@@ -2184,6 +2802,8 @@ void glPolygonOffset(GLfloat factor, GLfloat units)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.polygon_offset(ctx, factor, units);
 }
 
@@ -2191,6 +2811,8 @@ void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_tex_image1D(ctx, target, level, internalformat, x, y, width, border);
 }
 
@@ -2198,6 +2820,8 @@ void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_tex_image2D(ctx, target, level, internalformat, x, y, width, height, border);
 }
 
@@ -2205,6 +2829,8 @@ void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_tex_sub_image1D(ctx, target, level, xoffset, x, y, width);
 }
 
@@ -2212,6 +2838,8 @@ void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffse
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_tex_sub_image2D(ctx, target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -2219,12 +2847,17 @@ void glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_sub_image1D(ctx, target, level, xoffset, width, format, type, pixels);
 }
 
 void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
 {
     GLMContext ctx = GET_CONTEXT();
+
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_sub_image2D(ctx, target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -2232,6 +2865,8 @@ void glBindTexture(GLenum target, GLuint texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_texture(ctx, target, texture);
 }
 
@@ -2239,6 +2874,8 @@ void glDeleteTextures(GLsizei n, const GLuint *textures)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_textures(ctx, n, textures);
 }
 
@@ -2246,6 +2883,8 @@ void glGenTextures(GLsizei n, GLuint *textures)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_textures(ctx, n, textures);
 }
 
@@ -2253,6 +2892,8 @@ GLboolean  glIsTexture(GLuint texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_texture(ctx, texture);
 }
 
@@ -2260,6 +2901,8 @@ void glArrayElement(GLint i)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.array_element(ctx, i);
 }
 
@@ -2267,6 +2910,8 @@ void glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_pointer(ctx, size, type, stride, pointer);
 }
 
@@ -2274,6 +2919,8 @@ void glDisableClientState(GLenum array)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.disable_client_state(ctx, array);
 }
 
@@ -2281,6 +2928,8 @@ void glEdgeFlagPointer(GLsizei stride, const void *pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.edge_flag_pointer(ctx, stride, pointer);
 }
 
@@ -2288,6 +2937,8 @@ void glEnableClientState(GLenum array)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.enable_client_state(ctx, array);
 }
 
@@ -2295,6 +2946,8 @@ void glIndexPointer(GLenum type, GLsizei stride, const void *pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.index_pointer(ctx, type, stride, pointer);
 }
 
@@ -2302,6 +2955,8 @@ void glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.interleaved_arrays(ctx, format, stride, pointer);
 }
 
@@ -2309,6 +2964,8 @@ void glNormalPointer(GLenum type, GLsizei stride, const void *pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal_pointer(ctx, type, stride, pointer);
 }
 
@@ -2316,6 +2973,8 @@ void glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *poin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_pointer(ctx, size, type, stride, pointer);
 }
 
@@ -2323,6 +2982,8 @@ void glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointe
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_pointer(ctx, size, type, stride, pointer);
 }
 
@@ -2330,6 +2991,8 @@ GLboolean  glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *r
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.are_textures_resident(ctx, n, textures, residences);
 }
 
@@ -2337,6 +3000,8 @@ void glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *prio
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.prioritize_textures(ctx, n, textures, priorities);
 }
 
@@ -2344,6 +3009,8 @@ void glIndexub(GLubyte c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexub(ctx, c);
 }
 
@@ -2351,6 +3018,8 @@ void glIndexubv(const GLubyte *c)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.indexubv(ctx, c);
 }
 
@@ -2358,6 +3027,8 @@ void glPopClientAttrib()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pop_client_attrib(ctx);
 }
 
@@ -2365,6 +3036,8 @@ void glPushClientAttrib(GLbitfield mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.push_client_attrib(ctx, mask);
 }
 
@@ -2372,6 +3045,8 @@ void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_range_elements(ctx, mode, start, end, count, type, indices);
 }
 
@@ -2379,6 +3054,8 @@ void glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei widt
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_image3D(ctx, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -2386,6 +3063,8 @@ void glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -2393,6 +3072,8 @@ void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffse
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -2400,6 +3081,8 @@ void glActiveTexture(GLenum texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.active_texture(ctx, texture);
 }
 
@@ -2407,6 +3090,8 @@ void glSampleCoverage(GLfloat value, GLboolean invert)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sample_coverage(ctx, value, invert);
 }
 
@@ -2414,6 +3099,8 @@ void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_image3D(ctx, target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -2421,6 +3108,8 @@ void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_image2D(ctx, target, level, internalformat, width, height, border, imageSize, data);
 }
 
@@ -2428,6 +3117,8 @@ void glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_image1D(ctx, target, level, internalformat, width, border, imageSize, data);
 }
 
@@ -2435,6 +3126,8 @@ void glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -2442,6 +3135,8 @@ void glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_sub_image2D(ctx, target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -2449,6 +3144,8 @@ void glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_tex_sub_image1D(ctx, target, level, xoffset, width, format, imageSize, data);
 }
 
@@ -2456,6 +3153,8 @@ void glGetCompressedTexImage(GLenum target, GLint level, void *img)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_compressed_tex_image(ctx, target, level, img);
 }
 
@@ -2463,6 +3162,8 @@ void glClientActiveTexture(GLenum texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.client_active_texture(ctx, texture);
 }
 
@@ -2470,6 +3171,8 @@ void glMultiTexCoord1d(GLenum target, GLdouble s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1d(ctx, target, s);
 }
 
@@ -2477,6 +3180,8 @@ void glMultiTexCoord1dv(GLenum target, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1dv(ctx, target, v);
 }
 
@@ -2484,6 +3189,8 @@ void glMultiTexCoord1f(GLenum target, GLfloat s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1f(ctx, target, s);
 }
 
@@ -2491,6 +3198,8 @@ void glMultiTexCoord1fv(GLenum target, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1fv(ctx, target, v);
 }
 
@@ -2498,6 +3207,8 @@ void glMultiTexCoord1i(GLenum target, GLint s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1i(ctx, target, s);
 }
 
@@ -2505,6 +3216,8 @@ void glMultiTexCoord1iv(GLenum target, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1iv(ctx, target, v);
 }
 
@@ -2512,6 +3225,8 @@ void glMultiTexCoord1s(GLenum target, GLshort s)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1s(ctx, target, s);
 }
 
@@ -2519,6 +3234,8 @@ void glMultiTexCoord1sv(GLenum target, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord1sv(ctx, target, v);
 }
 
@@ -2526,6 +3243,8 @@ void glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2d(ctx, target, s, t);
 }
 
@@ -2533,6 +3252,8 @@ void glMultiTexCoord2dv(GLenum target, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2dv(ctx, target, v);
 }
 
@@ -2540,6 +3261,8 @@ void glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2f(ctx, target, s, t);
 }
 
@@ -2547,6 +3270,8 @@ void glMultiTexCoord2fv(GLenum target, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2fv(ctx, target, v);
 }
 
@@ -2554,6 +3279,8 @@ void glMultiTexCoord2i(GLenum target, GLint s, GLint t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2i(ctx, target, s, t);
 }
 
@@ -2561,6 +3288,8 @@ void glMultiTexCoord2iv(GLenum target, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2iv(ctx, target, v);
 }
 
@@ -2568,6 +3297,8 @@ void glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2s(ctx, target, s, t);
 }
 
@@ -2575,6 +3306,8 @@ void glMultiTexCoord2sv(GLenum target, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord2sv(ctx, target, v);
 }
 
@@ -2582,6 +3315,8 @@ void glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3d(ctx, target, s, t, r);
 }
 
@@ -2589,6 +3324,8 @@ void glMultiTexCoord3dv(GLenum target, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3dv(ctx, target, v);
 }
 
@@ -2596,6 +3333,8 @@ void glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3f(ctx, target, s, t, r);
 }
 
@@ -2603,6 +3342,8 @@ void glMultiTexCoord3fv(GLenum target, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3fv(ctx, target, v);
 }
 
@@ -2610,6 +3351,8 @@ void glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3i(ctx, target, s, t, r);
 }
 
@@ -2617,6 +3360,8 @@ void glMultiTexCoord3iv(GLenum target, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3iv(ctx, target, v);
 }
 
@@ -2624,6 +3369,8 @@ void glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3s(ctx, target, s, t, r);
 }
 
@@ -2631,6 +3378,8 @@ void glMultiTexCoord3sv(GLenum target, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord3sv(ctx, target, v);
 }
 
@@ -2638,6 +3387,8 @@ void glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdoub
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4d(ctx, target, s, t, r, q);
 }
 
@@ -2645,6 +3396,8 @@ void glMultiTexCoord4dv(GLenum target, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4dv(ctx, target, v);
 }
 
@@ -2652,6 +3405,8 @@ void glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4f(ctx, target, s, t, r, q);
 }
 
@@ -2659,6 +3414,8 @@ void glMultiTexCoord4fv(GLenum target, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4fv(ctx, target, v);
 }
 
@@ -2666,6 +3423,8 @@ void glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4i(ctx, target, s, t, r, q);
 }
 
@@ -2673,6 +3432,8 @@ void glMultiTexCoord4iv(GLenum target, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4iv(ctx, target, v);
 }
 
@@ -2680,6 +3441,8 @@ void glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4s(ctx, target, s, t, r, q);
 }
 
@@ -2687,6 +3450,8 @@ void glMultiTexCoord4sv(GLenum target, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord4sv(ctx, target, v);
 }
 
@@ -2694,6 +3459,8 @@ void glLoadTransposeMatrixf(const GLfloat *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_transpose_matrixf(ctx, m);
 }
 
@@ -2701,6 +3468,8 @@ void glLoadTransposeMatrixd(const GLdouble *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.load_transpose_matrixd(ctx, m);
 }
 
@@ -2708,6 +3477,8 @@ void glMultTransposeMatrixf(const GLfloat *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.mult_transpose_matrixf(ctx, m);
 }
 
@@ -2715,6 +3486,8 @@ void glMultTransposeMatrixd(const GLdouble *m)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.mult_transpose_matrixd(ctx, m);
 }
 
@@ -2722,6 +3495,8 @@ void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlp
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_func_separate(ctx, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
@@ -2729,6 +3504,8 @@ void glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_arrays(ctx, mode, first, count, drawcount);
 }
 
@@ -2736,6 +3513,8 @@ void glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const v
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_elements(ctx, mode, count, type, indices, drawcount);
 }
 
@@ -2743,6 +3522,8 @@ void glPointParameterf(GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.point_parameterf(ctx, pname, param);
 }
 
@@ -2750,6 +3531,8 @@ void glPointParameterfv(GLenum pname, const GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.point_parameterfv(ctx, pname, params);
 }
 
@@ -2757,6 +3540,8 @@ void glPointParameteri(GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.point_parameteri(ctx, pname, param);
 }
 
@@ -2764,6 +3549,8 @@ void glPointParameteriv(GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.point_parameteriv(ctx, pname, params);
 }
 
@@ -2771,6 +3558,8 @@ void glFogCoordf(GLfloat coord)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fog_coordf(ctx, coord);
 }
 
@@ -2778,6 +3567,8 @@ void glFogCoordfv(const GLfloat *coord)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fog_coordfv(ctx, coord);
 }
 
@@ -2785,6 +3576,8 @@ void glFogCoordd(GLdouble coord)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fog_coordd(ctx, coord);
 }
 
@@ -2792,6 +3585,8 @@ void glFogCoorddv(const GLdouble *coord)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fog_coorddv(ctx, coord);
 }
 
@@ -2799,6 +3594,8 @@ void glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.fog_coord_pointer(ctx, type, stride, pointer);
 }
 
@@ -2806,6 +3603,8 @@ void glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3b(ctx, red, green, blue);
 }
 
@@ -2813,6 +3612,8 @@ void glSecondaryColor3bv(const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3bv(ctx, v);
 }
 
@@ -2820,6 +3621,8 @@ void glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3d(ctx, red, green, blue);
 }
 
@@ -2827,6 +3630,8 @@ void glSecondaryColor3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3dv(ctx, v);
 }
 
@@ -2834,6 +3639,8 @@ void glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3f(ctx, red, green, blue);
 }
 
@@ -2841,6 +3648,8 @@ void glSecondaryColor3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3fv(ctx, v);
 }
 
@@ -2848,6 +3657,8 @@ void glSecondaryColor3i(GLint red, GLint green, GLint blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3i(ctx, red, green, blue);
 }
 
@@ -2855,6 +3666,8 @@ void glSecondaryColor3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3iv(ctx, v);
 }
 
@@ -2862,6 +3675,8 @@ void glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3s(ctx, red, green, blue);
 }
 
@@ -2869,6 +3684,8 @@ void glSecondaryColor3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3sv(ctx, v);
 }
 
@@ -2876,6 +3693,8 @@ void glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3ub(ctx, red, green, blue);
 }
 
@@ -2883,6 +3702,8 @@ void glSecondaryColor3ubv(const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3ubv(ctx, v);
 }
 
@@ -2890,6 +3711,8 @@ void glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3ui(ctx, red, green, blue);
 }
 
@@ -2897,6 +3720,8 @@ void glSecondaryColor3uiv(const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3uiv(ctx, v);
 }
 
@@ -2904,6 +3729,8 @@ void glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3us(ctx, red, green, blue);
 }
 
@@ -2911,6 +3738,8 @@ void glSecondaryColor3usv(const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color3usv(ctx, v);
 }
 
@@ -2918,6 +3747,8 @@ void glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color_pointer(ctx, size, type, stride, pointer);
 }
 
@@ -2925,6 +3756,8 @@ void glWindowPos2d(GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2d(ctx, x, y);
 }
 
@@ -2932,6 +3765,8 @@ void glWindowPos2dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2dv(ctx, v);
 }
 
@@ -2939,6 +3774,8 @@ void glWindowPos2f(GLfloat x, GLfloat y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2f(ctx, x, y);
 }
 
@@ -2946,6 +3783,8 @@ void glWindowPos2fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2fv(ctx, v);
 }
 
@@ -2953,6 +3792,8 @@ void glWindowPos2i(GLint x, GLint y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2i(ctx, x, y);
 }
 
@@ -2960,6 +3801,8 @@ void glWindowPos2iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2iv(ctx, v);
 }
 
@@ -2967,6 +3810,8 @@ void glWindowPos2s(GLshort x, GLshort y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2s(ctx, x, y);
 }
 
@@ -2974,6 +3819,8 @@ void glWindowPos2sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos2sv(ctx, v);
 }
 
@@ -2981,6 +3828,8 @@ void glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3d(ctx, x, y, z);
 }
 
@@ -2988,6 +3837,8 @@ void glWindowPos3dv(const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3dv(ctx, v);
 }
 
@@ -2995,6 +3846,8 @@ void glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3f(ctx, x, y, z);
 }
 
@@ -3002,6 +3855,8 @@ void glWindowPos3fv(const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3fv(ctx, v);
 }
 
@@ -3009,6 +3864,8 @@ void glWindowPos3i(GLint x, GLint y, GLint z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3i(ctx, x, y, z);
 }
 
@@ -3016,6 +3873,8 @@ void glWindowPos3iv(const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3iv(ctx, v);
 }
 
@@ -3023,6 +3882,8 @@ void glWindowPos3s(GLshort x, GLshort y, GLshort z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3s(ctx, x, y, z);
 }
 
@@ -3030,6 +3891,8 @@ void glWindowPos3sv(const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.window_pos3sv(ctx, v);
 }
 
@@ -3037,6 +3900,8 @@ void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_color(ctx, red, green, blue, alpha);
 }
 
@@ -3044,6 +3909,8 @@ void glBlendEquation(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_equation(ctx, mode);
 }
 
@@ -3051,6 +3918,8 @@ void glGenQueries(GLsizei n, GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_queries(ctx, n, ids);
 }
 
@@ -3058,6 +3927,8 @@ void glDeleteQueries(GLsizei n, const GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_queries(ctx, n, ids);
 }
 
@@ -3065,6 +3936,8 @@ GLboolean  glIsQuery(GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_query(ctx, id);
 }
 
@@ -3072,6 +3945,8 @@ void glBeginQuery(GLenum target, GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.begin_query(ctx, target, id);
 }
 
@@ -3079,6 +3954,8 @@ void glEndQuery(GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end_query(ctx, target);
 }
 
@@ -3086,6 +3963,8 @@ void glGetQueryiv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_queryiv(ctx, target, pname, params);
 }
 
@@ -3093,6 +3972,8 @@ void glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_objectiv(ctx, id, pname, params);
 }
 
@@ -3100,6 +3981,8 @@ void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_objectuiv(ctx, id, pname, params);
 }
 
@@ -3107,6 +3990,8 @@ void glBindBuffer(GLenum target, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_buffer(ctx, target, buffer);
 }
 
@@ -3114,6 +3999,8 @@ void glDeleteBuffers(GLsizei n, const GLuint *buffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_buffers(ctx, n, buffers);
 }
 
@@ -3121,6 +4008,8 @@ void glGenBuffers(GLsizei n, GLuint *buffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_buffers(ctx, n, buffers);
 }
 
@@ -3128,6 +4017,8 @@ GLboolean  glIsBuffer(GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_buffer(ctx, buffer);
 }
 
@@ -3135,6 +4026,8 @@ void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.buffer_data(ctx, target, size, data, usage);
 }
 
@@ -3142,6 +4035,8 @@ void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.buffer_sub_data(ctx, target, offset, size, data);
 }
 
@@ -3149,6 +4044,8 @@ void glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *d
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_buffer_sub_data(ctx, target, offset, size, data);
 }
 
@@ -3156,6 +4053,8 @@ void *glMapBuffer(GLenum target, GLenum access)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.map_buffer(ctx, target, access);
 }
 
@@ -3163,6 +4062,8 @@ GLboolean glUnmapBuffer(GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.unmap_buffer(ctx, target);
 }
 
@@ -3170,6 +4071,8 @@ void glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_buffer_parameteriv(ctx, target, pname, params);
 }
 
@@ -3177,6 +4080,8 @@ void glGetBufferPointerv(GLenum target, GLenum pname, void **params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_buffer_pointerv(ctx, target, pname, params);
 }
 
@@ -3184,6 +4089,8 @@ void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_equation_separate(ctx, modeRGB, modeAlpha);
 }
 
@@ -3191,6 +4098,8 @@ void glDrawBuffers(GLsizei n, const GLenum *bufs)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_buffers(ctx, n, bufs);
 }
 
@@ -3198,6 +4107,8 @@ void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_op_separate(ctx, face, sfail, dpfail, dppass);
 }
 
@@ -3205,6 +4116,8 @@ void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_func_separate(ctx, face, func, ref, mask);
 }
 
@@ -3212,6 +4125,8 @@ void glStencilMaskSeparate(GLenum face, GLuint mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.stencil_mask_separate(ctx, face, mask);
 }
 
@@ -3219,6 +4134,8 @@ void glAttachShader(GLuint program, GLuint shader)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.attach_shader(ctx, program, shader);
 }
 
@@ -3226,6 +4143,8 @@ void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_attrib_location(ctx, program, index, name);
 }
 
@@ -3233,6 +4152,8 @@ void glCompileShader(GLuint shader)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compile_shader(ctx, shader);
 }
 
@@ -3240,6 +4161,8 @@ GLuint  glCreateProgram()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.create_program(ctx);
 }
 
@@ -3247,6 +4170,8 @@ GLuint  glCreateShader(GLenum type)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.create_shader(ctx, type);
 }
 
@@ -3254,6 +4179,8 @@ void glDeleteProgram(GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_program(ctx, program);
 }
 
@@ -3261,6 +4188,8 @@ void glDeleteShader(GLuint shader)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_shader(ctx, shader);
 }
 
@@ -3268,6 +4197,8 @@ void glDetachShader(GLuint program, GLuint shader)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.detach_shader(ctx, program, shader);
 }
 
@@ -3275,6 +4206,8 @@ void glDisableVertexAttribArray(GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.disable_vertex_attrib_array(ctx, index);
 }
 
@@ -3282,6 +4215,8 @@ void glEnableVertexAttribArray(GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.enable_vertex_attrib_array(ctx, index);
 }
 
@@ -3289,6 +4224,8 @@ void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *l
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_attrib(ctx, program, index, bufSize, length, size, type, name);
 }
 
@@ -3296,6 +4233,8 @@ void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_uniform(ctx, program, index, bufSize, length, size, type, name);
 }
 
@@ -3303,6 +4242,8 @@ void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLui
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_attached_shaders(ctx, program, maxCount, count, shaders);
 }
 
@@ -3310,6 +4251,8 @@ GLint  glGetAttribLocation(GLuint program, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_attrib_location(ctx, program, name);
 }
 
@@ -3317,6 +4260,8 @@ void glGetProgramiv(GLuint program, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_programiv(ctx, program, pname, params);
 }
 
@@ -3324,6 +4269,8 @@ void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLcha
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_info_log(ctx, program, bufSize, length, infoLog);
 }
 
@@ -3331,6 +4278,8 @@ void glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_shaderiv(ctx, shader, pname, params);
 }
 
@@ -3338,6 +4287,8 @@ void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_shader_info_log(ctx, shader, bufSize, length, infoLog);
 }
 
@@ -3345,6 +4296,8 @@ void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_shader_source(ctx, shader, bufSize, length, source);
 }
 
@@ -3352,6 +4305,8 @@ GLint  glGetUniformLocation(GLuint program, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_uniform_location(ctx, program, name);
 }
 
@@ -3359,6 +4314,8 @@ void glGetUniformfv(GLuint program, GLint location, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniformfv(ctx, program, location, params);
 }
 
@@ -3366,6 +4323,8 @@ void glGetUniformiv(GLuint program, GLint location, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniformiv(ctx, program, location, params);
 }
 
@@ -3373,6 +4332,8 @@ void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attribdv(ctx, index, pname, params);
 }
 
@@ -3380,6 +4341,8 @@ void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attribfv(ctx, index, pname, params);
 }
 
@@ -3387,6 +4350,8 @@ void glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attribiv(ctx, index, pname, params);
 }
 
@@ -3394,6 +4359,8 @@ void glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attrib_pointerv(ctx, index, pname, pointer);
 }
 
@@ -3401,6 +4368,8 @@ GLboolean  glIsProgram(GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_program(ctx, program);
 }
 
@@ -3408,6 +4377,8 @@ GLboolean  glIsShader(GLuint shader)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_shader(ctx, shader);
 }
 
@@ -3415,6 +4386,8 @@ void glLinkProgram(GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.link_program(ctx, program);
 }
 
@@ -3422,6 +4395,8 @@ void glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.shader_source(ctx, shader, count, string, length);
 }
 
@@ -3429,6 +4404,8 @@ void glUseProgram(GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.use_program(ctx, program);
 }
 
@@ -3436,6 +4413,8 @@ void glUniform1f(GLint location, GLfloat v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1f(ctx, location, v0);
 }
 
@@ -3443,6 +4422,8 @@ void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2f(ctx, location, v0, v1);
 }
 
@@ -3450,6 +4431,8 @@ void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3f(ctx, location, v0, v1, v2);
 }
 
@@ -3457,6 +4440,8 @@ void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4f(ctx, location, v0, v1, v2, v3);
 }
 
@@ -3464,6 +4449,8 @@ void glUniform1i(GLint location, GLint v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1i(ctx, location, v0);
 }
 
@@ -3471,6 +4458,8 @@ void glUniform2i(GLint location, GLint v0, GLint v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2i(ctx, location, v0, v1);
 }
 
@@ -3478,6 +4467,8 @@ void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3i(ctx, location, v0, v1, v2);
 }
 
@@ -3485,6 +4476,8 @@ void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4i(ctx, location, v0, v1, v2, v3);
 }
 
@@ -3492,6 +4485,8 @@ void glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1fv(ctx, location, count, value);
 }
 
@@ -3499,6 +4494,8 @@ void glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2fv(ctx, location, count, value);
 }
 
@@ -3506,6 +4503,8 @@ void glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3fv(ctx, location, count, value);
 }
 
@@ -3513,6 +4512,8 @@ void glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4fv(ctx, location, count, value);
 }
 
@@ -3520,6 +4521,8 @@ void glUniform1iv(GLint location, GLsizei count, const GLint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1iv(ctx, location, count, value);
 }
 
@@ -3527,6 +4530,8 @@ void glUniform2iv(GLint location, GLsizei count, const GLint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2iv(ctx, location, count, value);
 }
 
@@ -3534,6 +4539,8 @@ void glUniform3iv(GLint location, GLsizei count, const GLint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3iv(ctx, location, count, value);
 }
 
@@ -3541,6 +4548,8 @@ void glUniform4iv(GLint location, GLsizei count, const GLint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4iv(ctx, location, count, value);
 }
 
@@ -3548,6 +4557,8 @@ void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2fv(ctx, location, count, transpose, value);
 }
 
@@ -3555,6 +4566,8 @@ void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3fv(ctx, location, count, transpose, value);
 }
 
@@ -3562,6 +4575,8 @@ void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4fv(ctx, location, count, transpose, value);
 }
 
@@ -3569,6 +4584,8 @@ void glValidateProgram(GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.validate_program(ctx, program);
 }
 
@@ -3576,6 +4593,8 @@ void glVertexAttrib1d(GLuint index, GLdouble x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1d(ctx, index, x);
 }
 
@@ -3583,6 +4602,8 @@ void glVertexAttrib1dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1dv(ctx, index, v);
 }
 
@@ -3590,6 +4611,8 @@ void glVertexAttrib1f(GLuint index, GLfloat x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1f(ctx, index, x);
 }
 
@@ -3597,6 +4620,8 @@ void glVertexAttrib1fv(GLuint index, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1fv(ctx, index, v);
 }
 
@@ -3604,6 +4629,8 @@ void glVertexAttrib1s(GLuint index, GLshort x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1s(ctx, index, x);
 }
 
@@ -3611,6 +4638,8 @@ void glVertexAttrib1sv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib1sv(ctx, index, v);
 }
 
@@ -3618,6 +4647,8 @@ void glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2d(ctx, index, x, y);
 }
 
@@ -3625,6 +4656,8 @@ void glVertexAttrib2dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2dv(ctx, index, v);
 }
 
@@ -3632,6 +4665,8 @@ void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2f(ctx, index, x, y);
 }
 
@@ -3639,6 +4674,8 @@ void glVertexAttrib2fv(GLuint index, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2fv(ctx, index, v);
 }
 
@@ -3646,6 +4683,8 @@ void glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2s(ctx, index, x, y);
 }
 
@@ -3653,6 +4692,8 @@ void glVertexAttrib2sv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib2sv(ctx, index, v);
 }
 
@@ -3660,6 +4701,8 @@ void glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3d(ctx, index, x, y, z);
 }
 
@@ -3667,6 +4710,8 @@ void glVertexAttrib3dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3dv(ctx, index, v);
 }
 
@@ -3674,6 +4719,8 @@ void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3f(ctx, index, x, y, z);
 }
 
@@ -3681,6 +4728,8 @@ void glVertexAttrib3fv(GLuint index, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3fv(ctx, index, v);
 }
 
@@ -3688,6 +4737,8 @@ void glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3s(ctx, index, x, y, z);
 }
 
@@ -3695,6 +4746,8 @@ void glVertexAttrib3sv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib3sv(ctx, index, v);
 }
 
@@ -3702,6 +4755,8 @@ void glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nbv(ctx, index, v);
 }
 
@@ -3709,6 +4764,8 @@ void glVertexAttrib4Niv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_niv(ctx, index, v);
 }
 
@@ -3716,6 +4773,8 @@ void glVertexAttrib4Nsv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nsv(ctx, index, v);
 }
 
@@ -3723,6 +4782,8 @@ void glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nub(ctx, index, x, y, z, w);
 }
 
@@ -3730,6 +4791,8 @@ void glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nubv(ctx, index, v);
 }
 
@@ -3737,6 +4800,8 @@ void glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nuiv(ctx, index, v);
 }
 
@@ -3744,6 +4809,8 @@ void glVertexAttrib4Nusv(GLuint index, const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4_nusv(ctx, index, v);
 }
 
@@ -3751,6 +4818,8 @@ void glVertexAttrib4bv(GLuint index, const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4bv(ctx, index, v);
 }
 
@@ -3758,6 +4827,8 @@ void glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4d(ctx, index, x, y, z, w);
 }
 
@@ -3765,6 +4836,8 @@ void glVertexAttrib4dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4dv(ctx, index, v);
 }
 
@@ -3772,6 +4845,8 @@ void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4f(ctx, index, x, y, z, w);
 }
 
@@ -3779,6 +4854,8 @@ void glVertexAttrib4fv(GLuint index, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4fv(ctx, index, v);
 }
 
@@ -3786,6 +4863,8 @@ void glVertexAttrib4iv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4iv(ctx, index, v);
 }
 
@@ -3793,6 +4872,8 @@ void glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4s(ctx, index, x, y, z, w);
 }
 
@@ -3800,6 +4881,8 @@ void glVertexAttrib4sv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4sv(ctx, index, v);
 }
 
@@ -3807,6 +4890,8 @@ void glVertexAttrib4ubv(GLuint index, const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4ubv(ctx, index, v);
 }
 
@@ -3814,6 +4899,8 @@ void glVertexAttrib4uiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4uiv(ctx, index, v);
 }
 
@@ -3821,6 +4908,8 @@ void glVertexAttrib4usv(GLuint index, const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib4usv(ctx, index, v);
 }
 
@@ -3828,6 +4917,8 @@ void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean norm
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_pointer(ctx, index, size, type, normalized, stride, pointer);
 }
 
@@ -3835,6 +4926,8 @@ void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2x3fv(ctx, location, count, transpose, value);
 }
 
@@ -3842,6 +4935,8 @@ void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3x2fv(ctx, location, count, transpose, value);
 }
 
@@ -3849,6 +4944,8 @@ void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2x4fv(ctx, location, count, transpose, value);
 }
 
@@ -3856,6 +4953,8 @@ void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4x2fv(ctx, location, count, transpose, value);
 }
 
@@ -3863,6 +4962,8 @@ void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3x4fv(ctx, location, count, transpose, value);
 }
 
@@ -3870,6 +4971,8 @@ void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4x3fv(ctx, location, count, transpose, value);
 }
 
@@ -3877,6 +4980,8 @@ void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_maski(ctx, index, r, g, b, a);
 }
 
@@ -3884,6 +4989,8 @@ void glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_booleani_v(ctx, target, index, data);
 }
 
@@ -3891,6 +4998,8 @@ void glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_integeri_v(ctx, target, index, data);
 }
 
@@ -3898,6 +5007,8 @@ void glEnablei(GLenum target, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.enablei(ctx, target, index);
 }
 
@@ -3905,6 +5016,8 @@ void glDisablei(GLenum target, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.disablei(ctx, target, index);
 }
 
@@ -3912,6 +5025,8 @@ GLboolean  glIsEnabledi(GLenum target, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_enabledi(ctx, target, index);
 }
 
@@ -3919,6 +5034,8 @@ void glBeginTransformFeedback(GLenum primitiveMode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.begin_transform_feedback(ctx, primitiveMode);
 }
 
@@ -3926,6 +5043,8 @@ void glEndTransformFeedback()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end_transform_feedback(ctx);
 }
 
@@ -3933,6 +5052,8 @@ void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offs
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_buffer_range(ctx, target, index, buffer, offset, size);
 }
 
@@ -3940,6 +5061,8 @@ void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_buffer_base(ctx, target, index, buffer);
 }
 
@@ -3947,6 +5070,8 @@ void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.transform_feedback_varyings(ctx, program, count, varyings, bufferMode);
 }
 
@@ -3954,6 +5079,8 @@ void glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_transform_feedback_varying(ctx, program, index, bufSize, length, size, type, name);
 }
 
@@ -3961,6 +5088,8 @@ void glClampColor(GLenum target, GLenum clamp)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clamp_color(ctx, target, clamp);
 }
 
@@ -3968,6 +5097,8 @@ void glBeginConditionalRender(GLuint id, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.begin_conditional_render(ctx, id, mode);
 }
 
@@ -3975,6 +5106,8 @@ void glEndConditionalRender()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end_conditional_render(ctx);
 }
 
@@ -3982,6 +5115,8 @@ void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei strid
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i_pointer(ctx, index, size, type, stride, pointer);
 }
 
@@ -3989,6 +5124,8 @@ void glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attrib_iiv(ctx, index, pname, params);
 }
 
@@ -3996,6 +5133,8 @@ void glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attrib_iuiv(ctx, index, pname, params);
 }
 
@@ -4003,6 +5142,8 @@ void glVertexAttribI1i(GLuint index, GLint x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i1i(ctx, index, x);
 }
 
@@ -4010,6 +5151,8 @@ void glVertexAttribI2i(GLuint index, GLint x, GLint y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i2i(ctx, index, x, y);
 }
 
@@ -4017,6 +5160,8 @@ void glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i3i(ctx, index, x, y, z);
 }
 
@@ -4024,6 +5169,8 @@ void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4i(ctx, index, x, y, z, w);
 }
 
@@ -4031,6 +5178,8 @@ void glVertexAttribI1ui(GLuint index, GLuint x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i1ui(ctx, index, x);
 }
 
@@ -4038,6 +5187,8 @@ void glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i2ui(ctx, index, x, y);
 }
 
@@ -4045,6 +5196,8 @@ void glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i3ui(ctx, index, x, y, z);
 }
 
@@ -4052,6 +5205,8 @@ void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4ui(ctx, index, x, y, z, w);
 }
 
@@ -4059,6 +5214,8 @@ void glVertexAttribI1iv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i1iv(ctx, index, v);
 }
 
@@ -4066,6 +5223,8 @@ void glVertexAttribI2iv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i2iv(ctx, index, v);
 }
 
@@ -4073,6 +5232,8 @@ void glVertexAttribI3iv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i3iv(ctx, index, v);
 }
 
@@ -4080,6 +5241,8 @@ void glVertexAttribI4iv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4iv(ctx, index, v);
 }
 
@@ -4087,6 +5250,8 @@ void glVertexAttribI1uiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i1uiv(ctx, index, v);
 }
 
@@ -4094,6 +5259,8 @@ void glVertexAttribI2uiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i2uiv(ctx, index, v);
 }
 
@@ -4101,6 +5268,8 @@ void glVertexAttribI3uiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i3uiv(ctx, index, v);
 }
 
@@ -4108,6 +5277,8 @@ void glVertexAttribI4uiv(GLuint index, const GLuint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4uiv(ctx, index, v);
 }
 
@@ -4115,6 +5286,8 @@ void glVertexAttribI4bv(GLuint index, const GLbyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4bv(ctx, index, v);
 }
 
@@ -4122,6 +5295,8 @@ void glVertexAttribI4sv(GLuint index, const GLshort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4sv(ctx, index, v);
 }
 
@@ -4129,6 +5304,8 @@ void glVertexAttribI4ubv(GLuint index, const GLubyte *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4ubv(ctx, index, v);
 }
 
@@ -4136,6 +5313,8 @@ void glVertexAttribI4usv(GLuint index, const GLushort *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i4usv(ctx, index, v);
 }
 
@@ -4143,6 +5322,8 @@ void glGetUniformuiv(GLuint program, GLint location, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniformuiv(ctx, program, location, params);
 }
 
@@ -4150,6 +5331,8 @@ void glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_frag_data_location(ctx, program, color, name);
 }
 
@@ -4157,6 +5340,8 @@ GLint  glGetFragDataLocation(GLuint program, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_frag_data_location(ctx, program, name);
 }
 
@@ -4164,6 +5349,8 @@ void glUniform1ui(GLint location, GLuint v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1ui(ctx, location, v0);
 }
 
@@ -4171,6 +5358,8 @@ void glUniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2ui(ctx, location, v0, v1);
 }
 
@@ -4178,6 +5367,8 @@ void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3ui(ctx, location, v0, v1, v2);
 }
 
@@ -4185,6 +5376,8 @@ void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4ui(ctx, location, v0, v1, v2, v3);
 }
 
@@ -4192,6 +5385,8 @@ void glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1uiv(ctx, location, count, value);
 }
 
@@ -4199,6 +5394,8 @@ void glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2uiv(ctx, location, count, value);
 }
 
@@ -4206,6 +5403,8 @@ void glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3uiv(ctx, location, count, value);
 }
 
@@ -4213,6 +5412,8 @@ void glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4uiv(ctx, location, count, value);
 }
 
@@ -4220,6 +5421,8 @@ void glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameter_iiv(ctx, target, pname, params);
 }
 
@@ -4227,6 +5430,8 @@ void glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_parameter_iuiv(ctx, target, pname, params);
 }
 
@@ -4234,6 +5439,8 @@ void glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_parameter_iiv(ctx, target, pname, params);
 }
 
@@ -4241,6 +5448,8 @@ void glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_tex_parameter_iuiv(ctx, target, pname, params);
 }
 
@@ -4248,6 +5457,8 @@ void glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_bufferiv(ctx, buffer, drawbuffer, value);
 }
 
@@ -4255,6 +5466,8 @@ void glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_bufferuiv(ctx, buffer, drawbuffer, value);
 }
 
@@ -4262,6 +5475,8 @@ void glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_bufferfv(ctx, buffer, drawbuffer, value);
 }
 
@@ -4269,6 +5484,8 @@ void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stenc
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_bufferfi(ctx, buffer, drawbuffer, depth, stencil);
 }
 
@@ -4276,6 +5493,8 @@ GLubyte const  *glGetStringi(GLenum name, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_stringi(ctx, name, index);
 }
 
@@ -4283,6 +5502,8 @@ GLboolean  glIsRenderbuffer(GLuint renderbuffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_renderbuffer(ctx, renderbuffer);
 }
 
@@ -4290,6 +5511,8 @@ void glBindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_renderbuffer(ctx, target, renderbuffer);
 }
 
@@ -4297,6 +5520,8 @@ void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_renderbuffers(ctx, n, renderbuffers);
 }
 
@@ -4304,6 +5529,8 @@ void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_renderbuffers(ctx, n, renderbuffers);
 }
 
@@ -4311,6 +5538,8 @@ void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.renderbuffer_storage(ctx, target, internalformat, width, height);
 }
 
@@ -4318,6 +5547,8 @@ void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_renderbuffer_parameteriv(ctx, target, pname, params);
 }
 
@@ -4325,6 +5556,8 @@ GLboolean  glIsFramebuffer(GLuint framebuffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_framebuffer(ctx, framebuffer);
 }
 
@@ -4332,6 +5565,8 @@ void glBindFramebuffer(GLenum target, GLuint framebuffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_framebuffer(ctx, target, framebuffer);
 }
 
@@ -4339,6 +5574,8 @@ void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_framebuffers(ctx, n, framebuffers);
 }
 
@@ -4346,6 +5583,8 @@ void glGenFramebuffers(GLsizei n, GLuint *framebuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_framebuffers(ctx, n, framebuffers);
 }
 
@@ -4353,6 +5592,8 @@ GLenum  glCheckFramebufferStatus(GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.check_framebuffer_status(ctx, target);
 }
 
@@ -4360,6 +5601,8 @@ void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_texture1D(ctx, target, attachment, textarget, texture, level);
 }
 
@@ -4367,6 +5610,8 @@ void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_texture2D(ctx, target, attachment, textarget, texture, level);
 }
 
@@ -4374,6 +5619,8 @@ void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_texture3D(ctx, target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -4381,6 +5628,8 @@ void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbu
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_renderbuffer(ctx, target, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -4388,6 +5637,8 @@ void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLe
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_framebuffer_attachment_parameteriv(ctx, target, attachment, pname, params);
 }
 
@@ -4395,6 +5646,8 @@ void glGenerateMipmap(GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.generate_mipmap(ctx, target);
 }
 
@@ -4402,6 +5655,8 @@ void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blit_framebuffer(ctx, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -4409,6 +5664,8 @@ void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum int
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.renderbuffer_storage_multisample(ctx, target, samples, internalformat, width, height);
 }
 
@@ -4416,6 +5673,8 @@ void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_texture_layer(ctx, target, attachment, texture, level, layer);
 }
 
@@ -4423,6 +5682,8 @@ void *glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitf
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.map_buffer_range(ctx, target, offset, length, access);
 }
 
@@ -4430,6 +5691,8 @@ void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.flush_mapped_buffer_range(ctx, target, offset, length);
 }
 
@@ -4437,6 +5700,8 @@ void glBindVertexArray(GLuint array)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_vertex_array(ctx, array);
 }
 
@@ -4444,6 +5709,8 @@ void glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_vertex_arrays(ctx, n, arrays);
 }
 
@@ -4451,6 +5718,8 @@ void glGenVertexArrays(GLsizei n, GLuint *arrays)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_vertex_arrays(ctx, n, arrays);
 }
 
@@ -4458,6 +5727,8 @@ GLboolean  glIsVertexArray(GLuint array)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_vertex_array(ctx, array);
 }
 
@@ -4465,6 +5736,8 @@ void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei inst
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_arrays_instanced(ctx, mode, first, count, instancecount);
 }
 
@@ -4472,6 +5745,8 @@ void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_instanced(ctx, mode, count, type, indices, instancecount);
 }
 
@@ -4479,6 +5754,8 @@ void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_buffer(ctx, target, internalformat, buffer);
 }
 
@@ -4486,6 +5763,8 @@ void glPrimitiveRestartIndex(GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.primitive_restart_index(ctx, index);
 }
 
@@ -4493,6 +5772,8 @@ void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOff
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_buffer_sub_data(ctx, readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
@@ -4500,6 +5781,8 @@ void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *con
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniform_indices(ctx, program, uniformCount, uniformNames, uniformIndices);
 }
 
@@ -4507,6 +5790,8 @@ void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *u
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_uniformsiv(ctx, program, uniformCount, uniformIndices, pname, params);
 }
 
@@ -4514,6 +5799,8 @@ void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_uniform_name(ctx, program, uniformIndex, bufSize, length, uniformName);
 }
 
@@ -4521,6 +5808,8 @@ GLuint  glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_uniform_block_index(ctx, program, uniformBlockName);
 }
 
@@ -4528,6 +5817,8 @@ void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_uniform_blockiv(ctx, program, uniformBlockIndex, pname, params);
 }
 
@@ -4535,6 +5826,8 @@ void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsiz
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_uniform_block_name(ctx, program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
@@ -4542,6 +5835,8 @@ void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint unif
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_block_binding(ctx, program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -4549,6 +5844,8 @@ void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const voi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_base_vertex(ctx, mode, count, type, indices, basevertex);
 }
 
@@ -4556,6 +5853,8 @@ void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_range_elements_base_vertex(ctx, mode, start, end, count, type, indices, basevertex);
 }
 
@@ -4563,6 +5862,8 @@ void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_instanced_base_vertex(ctx, mode, count, type, indices, instancecount, basevertex);
 }
 
@@ -4570,6 +5871,8 @@ void glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum typ
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_elements_base_vertex(ctx, mode, count, type, indices, drawcount, basevertex);
 }
 
@@ -4577,6 +5880,8 @@ void glProvokingVertex(GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.provoking_vertex(ctx, mode);
 }
 
@@ -4584,6 +5889,8 @@ GLsync  glFenceSync(GLenum condition, GLbitfield flags)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.fence_sync(ctx, condition, flags);
 }
 
@@ -4591,6 +5898,8 @@ GLboolean  glIsSync(GLsync sync)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_sync(ctx, sync);
 }
 
@@ -4598,6 +5907,8 @@ void glDeleteSync(GLsync sync)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_sync(ctx, sync);
 }
 
@@ -4605,6 +5916,8 @@ GLenum  glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.client_wait_sync(ctx, sync, flags, timeout);
 }
 
@@ -4612,6 +5925,8 @@ void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.wait_sync(ctx, sync, flags, timeout);
 }
 
@@ -4619,6 +5934,8 @@ void glGetInteger64v(GLenum pname, GLint64 *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_integer64v(ctx, pname, data);
 }
 
@@ -4626,6 +5943,8 @@ void glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_synciv(ctx, sync, pname, count, length, values);
 }
 
@@ -4633,6 +5952,8 @@ void glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_integer64i_v(ctx, target, index, data);
 }
 
@@ -4640,6 +5961,8 @@ void glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_buffer_parameteri64v(ctx, target, pname, params);
 }
 
@@ -4647,6 +5970,8 @@ void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_texture(ctx, target, attachment, texture, level);
 }
 
@@ -4654,6 +5979,8 @@ void glTexImage2DMultisample(GLenum target, GLsizei samples, GLint internalforma
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_image2_d_multisample(ctx, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -4661,6 +5988,8 @@ void glTexImage3DMultisample(GLenum target, GLsizei samples, GLint internalforma
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_image3_d_multisample(ctx, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -4668,6 +5997,8 @@ void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_multisamplefv(ctx, pname, index, val);
 }
 
@@ -4675,6 +6006,8 @@ void glSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sample_maski(ctx, maskNumber, mask);
 }
 
@@ -4682,6 +6015,8 @@ void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint in
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_frag_data_location_indexed(ctx, program, colorNumber, index, name);
 }
 
@@ -4689,6 +6024,8 @@ GLint  glGetFragDataIndex(GLuint program, const GLchar *name)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_frag_data_index(ctx, program, name);
 }
 
@@ -4696,6 +6033,8 @@ void glGenSamplers(GLsizei count, GLuint *samplers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_samplers(ctx, count, samplers);
 }
 
@@ -4703,6 +6042,8 @@ void glDeleteSamplers(GLsizei count, const GLuint *samplers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_samplers(ctx, count, samplers);
 }
 
@@ -4710,6 +6051,8 @@ GLboolean  glIsSampler(GLuint sampler)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_sampler(ctx, sampler);
 }
 
@@ -4717,6 +6060,8 @@ void glBindSampler(GLuint unit, GLuint sampler)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_sampler(ctx, unit, sampler);
 }
 
@@ -4724,6 +6069,8 @@ void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameteri(ctx, sampler, pname, param);
 }
 
@@ -4731,6 +6078,8 @@ void glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameteriv(ctx, sampler, pname, param);
 }
 
@@ -4738,6 +6087,8 @@ void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameterf(ctx, sampler, pname, param);
 }
 
@@ -4745,6 +6096,8 @@ void glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameterfv(ctx, sampler, pname, param);
 }
 
@@ -4752,6 +6105,8 @@ void glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameter_iiv(ctx, sampler, pname, param);
 }
 
@@ -4759,6 +6114,8 @@ void glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.sampler_parameter_iuiv(ctx, sampler, pname, param);
 }
 
@@ -4766,6 +6123,8 @@ void glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_sampler_parameteriv(ctx, sampler, pname, params);
 }
 
@@ -4773,6 +6132,8 @@ void glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_sampler_parameter_iiv(ctx, sampler, pname, params);
 }
 
@@ -4780,6 +6141,8 @@ void glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_sampler_parameterfv(ctx, sampler, pname, params);
 }
 
@@ -4787,6 +6150,8 @@ void glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_sampler_parameter_iuiv(ctx, sampler, pname, params);
 }
 
@@ -4794,6 +6159,8 @@ void glQueryCounter(GLuint id, GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.query_counter(ctx, id, target);
 }
 
@@ -4801,6 +6168,8 @@ void glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_objecti64v(ctx, id, pname, params);
 }
 
@@ -4808,6 +6177,8 @@ void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_objectui64v(ctx, id, pname, params);
 }
 
@@ -4815,6 +6186,8 @@ void glVertexAttribDivisor(GLuint index, GLuint divisor)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_divisor(ctx, index, divisor);
 }
 
@@ -4822,6 +6195,8 @@ void glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p1ui(ctx, index, type, normalized, value);
 }
 
@@ -4829,6 +6204,8 @@ void glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p1uiv(ctx, index, type, normalized, value);
 }
 
@@ -4836,6 +6213,8 @@ void glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p2ui(ctx, index, type, normalized, value);
 }
 
@@ -4843,6 +6222,8 @@ void glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p2uiv(ctx, index, type, normalized, value);
 }
 
@@ -4850,6 +6231,8 @@ void glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p3ui(ctx, index, type, normalized, value);
 }
 
@@ -4857,6 +6240,8 @@ void glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p3uiv(ctx, index, type, normalized, value);
 }
 
@@ -4864,6 +6249,8 @@ void glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p4ui(ctx, index, type, normalized, value);
 }
 
@@ -4871,6 +6258,8 @@ void glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_p4uiv(ctx, index, type, normalized, value);
 }
 
@@ -4878,6 +6267,8 @@ void glVertexP2ui(GLenum type, GLuint value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p2ui(ctx, type, value);
 }
 
@@ -4885,6 +6276,8 @@ void glVertexP2uiv(GLenum type, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p2uiv(ctx, type, value);
 }
 
@@ -4892,6 +6285,8 @@ void glVertexP3ui(GLenum type, GLuint value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p3ui(ctx, type, value);
 }
 
@@ -4899,6 +6294,8 @@ void glVertexP3uiv(GLenum type, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p3uiv(ctx, type, value);
 }
 
@@ -4906,6 +6303,8 @@ void glVertexP4ui(GLenum type, GLuint value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p4ui(ctx, type, value);
 }
 
@@ -4913,6 +6312,8 @@ void glVertexP4uiv(GLenum type, const GLuint *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_p4uiv(ctx, type, value);
 }
 
@@ -4920,6 +6321,8 @@ void glTexCoordP1ui(GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p1ui(ctx, type, coords);
 }
 
@@ -4927,6 +6330,8 @@ void glTexCoordP1uiv(GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p1uiv(ctx, type, coords);
 }
 
@@ -4934,6 +6339,8 @@ void glTexCoordP2ui(GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p2ui(ctx, type, coords);
 }
 
@@ -4941,6 +6348,8 @@ void glTexCoordP2uiv(GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p2uiv(ctx, type, coords);
 }
 
@@ -4948,6 +6357,8 @@ void glTexCoordP3ui(GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p3ui(ctx, type, coords);
 }
 
@@ -4955,6 +6366,8 @@ void glTexCoordP3uiv(GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p3uiv(ctx, type, coords);
 }
 
@@ -4962,6 +6375,8 @@ void glTexCoordP4ui(GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p4ui(ctx, type, coords);
 }
 
@@ -4969,6 +6384,8 @@ void glTexCoordP4uiv(GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_coord_p4uiv(ctx, type, coords);
 }
 
@@ -4976,6 +6393,8 @@ void glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p1ui(ctx, texture, type, coords);
 }
 
@@ -4983,6 +6402,8 @@ void glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p1uiv(ctx, texture, type, coords);
 }
 
@@ -4990,6 +6411,8 @@ void glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p2ui(ctx, texture, type, coords);
 }
 
@@ -4997,6 +6420,8 @@ void glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p2uiv(ctx, texture, type, coords);
 }
 
@@ -5004,6 +6429,8 @@ void glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p3ui(ctx, texture, type, coords);
 }
 
@@ -5011,6 +6438,8 @@ void glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p3uiv(ctx, texture, type, coords);
 }
 
@@ -5018,6 +6447,8 @@ void glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p4ui(ctx, texture, type, coords);
 }
 
@@ -5025,6 +6456,8 @@ void glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_tex_coord_p4uiv(ctx, texture, type, coords);
 }
 
@@ -5032,6 +6465,8 @@ void glNormalP3ui(GLenum type, GLuint coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal_p3ui(ctx, type, coords);
 }
 
@@ -5039,6 +6474,8 @@ void glNormalP3uiv(GLenum type, const GLuint *coords)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.normal_p3uiv(ctx, type, coords);
 }
 
@@ -5046,6 +6483,8 @@ void glColorP3ui(GLenum type, GLuint color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_p3ui(ctx, type, color);
 }
 
@@ -5053,6 +6492,8 @@ void glColorP3uiv(GLenum type, const GLuint *color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_p3uiv(ctx, type, color);
 }
 
@@ -5060,6 +6501,8 @@ void glColorP4ui(GLenum type, GLuint color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_p4ui(ctx, type, color);
 }
 
@@ -5067,6 +6510,8 @@ void glColorP4uiv(GLenum type, const GLuint *color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.color_p4uiv(ctx, type, color);
 }
 
@@ -5074,6 +6519,8 @@ void glSecondaryColorP3ui(GLenum type, GLuint color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color_p3ui(ctx, type, color);
 }
 
@@ -5081,6 +6528,8 @@ void glSecondaryColorP3uiv(GLenum type, const GLuint *color)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.secondary_color_p3uiv(ctx, type, color);
 }
 
@@ -5088,6 +6537,8 @@ void glMinSampleShading(GLfloat value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.min_sample_shading(ctx, value);
 }
 
@@ -5095,6 +6546,8 @@ void glBlendEquationi(GLuint buf, GLenum mode)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_equationi(ctx, buf, mode);
 }
 
@@ -5102,6 +6555,8 @@ void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_equation_separatei(ctx, buf, modeRGB, modeAlpha);
 }
 
@@ -5109,6 +6564,8 @@ void glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_funci(ctx, buf, src, dst);
 }
 
@@ -5116,6 +6573,8 @@ void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAl
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blend_func_separatei(ctx, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -5123,6 +6582,8 @@ void glDrawArraysIndirect(GLenum mode, const void *indirect)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_arrays_indirect(ctx, mode, indirect);
 }
 
@@ -5130,6 +6591,8 @@ void glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_indirect(ctx, mode, type, indirect);
 }
 
@@ -5137,6 +6600,8 @@ void glUniform1d(GLint location, GLdouble x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1d(ctx, location, x);
 }
 
@@ -5144,6 +6609,8 @@ void glUniform2d(GLint location, GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2d(ctx, location, x, y);
 }
 
@@ -5151,6 +6618,8 @@ void glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3d(ctx, location, x, y, z);
 }
 
@@ -5158,6 +6627,8 @@ void glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4d(ctx, location, x, y, z, w);
 }
 
@@ -5165,6 +6636,8 @@ void glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform1dv(ctx, location, count, value);
 }
 
@@ -5172,6 +6645,8 @@ void glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform2dv(ctx, location, count, value);
 }
 
@@ -5179,6 +6654,8 @@ void glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform3dv(ctx, location, count, value);
 }
 
@@ -5186,6 +6663,8 @@ void glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform4dv(ctx, location, count, value);
 }
 
@@ -5193,6 +6672,8 @@ void glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2dv(ctx, location, count, transpose, value);
 }
 
@@ -5200,6 +6681,8 @@ void glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3dv(ctx, location, count, transpose, value);
 }
 
@@ -5207,6 +6690,8 @@ void glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, cons
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4dv(ctx, location, count, transpose, value);
 }
 
@@ -5214,6 +6699,8 @@ void glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2x3dv(ctx, location, count, transpose, value);
 }
 
@@ -5221,6 +6708,8 @@ void glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix2x4dv(ctx, location, count, transpose, value);
 }
 
@@ -5228,6 +6717,8 @@ void glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3x2dv(ctx, location, count, transpose, value);
 }
 
@@ -5235,6 +6726,8 @@ void glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix3x4dv(ctx, location, count, transpose, value);
 }
 
@@ -5242,6 +6735,8 @@ void glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4x2dv(ctx, location, count, transpose, value);
 }
 
@@ -5249,6 +6744,8 @@ void glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_matrix4x3dv(ctx, location, count, transpose, value);
 }
 
@@ -5256,6 +6753,8 @@ void glGetUniformdv(GLuint program, GLint location, GLdouble *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniformdv(ctx, program, location, params);
 }
 
@@ -5263,6 +6762,8 @@ GLint  glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_subroutine_uniform_location(ctx, program, shadertype, name);
 }
 
@@ -5270,6 +6771,8 @@ GLuint  glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *na
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_subroutine_index(ctx, program, shadertype, name);
 }
 
@@ -5277,6 +6780,8 @@ void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint in
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_subroutine_uniformiv(ctx, program, shadertype, index, pname, values);
 }
 
@@ -5284,6 +6789,8 @@ void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_subroutine_uniform_name(ctx, program, shadertype, index, bufSize, length, name);
 }
 
@@ -5291,6 +6798,8 @@ void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_subroutine_name(ctx, program, shadertype, index, bufSize, length, name);
 }
 
@@ -5298,6 +6807,8 @@ void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *ind
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.uniform_subroutinesuiv(ctx, shadertype, count, indices);
 }
 
@@ -5305,6 +6816,8 @@ void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_uniform_subroutineuiv(ctx, shadertype, location, params);
 }
 
@@ -5312,6 +6825,8 @@ void glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_stageiv(ctx, program, shadertype, pname, values);
 }
 
@@ -5319,6 +6834,8 @@ void glPatchParameteri(GLenum pname, GLint value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.patch_parameteri(ctx, pname, value);
 }
 
@@ -5326,6 +6843,8 @@ void glPatchParameterfv(GLenum pname, const GLfloat *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.patch_parameterfv(ctx, pname, values);
 }
 
@@ -5333,6 +6852,8 @@ void glBindTransformFeedback(GLenum target, GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_transform_feedback(ctx, target, id);
 }
 
@@ -5340,6 +6861,8 @@ void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_transform_feedbacks(ctx, n, ids);
 }
 
@@ -5347,6 +6870,8 @@ void glGenTransformFeedbacks(GLsizei n, GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_transform_feedbacks(ctx, n, ids);
 }
 
@@ -5354,6 +6879,8 @@ GLboolean  glIsTransformFeedback(GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_transform_feedback(ctx, id);
 }
 
@@ -5361,6 +6888,8 @@ void glPauseTransformFeedback()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pause_transform_feedback(ctx);
 }
 
@@ -5368,6 +6897,8 @@ void glResumeTransformFeedback()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.resume_transform_feedback(ctx);
 }
 
@@ -5375,6 +6906,8 @@ void glDrawTransformFeedback(GLenum mode, GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_transform_feedback(ctx, mode, id);
 }
 
@@ -5382,6 +6915,8 @@ void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_transform_feedback_stream(ctx, mode, id, stream);
 }
 
@@ -5389,6 +6924,8 @@ void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.begin_query_indexed(ctx, target, index, id);
 }
 
@@ -5396,6 +6933,8 @@ void glEndQueryIndexed(GLenum target, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.end_query_indexed(ctx, target, index);
 }
 
@@ -5403,6 +6942,8 @@ void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *param
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_indexediv(ctx, target, index, pname, params);
 }
 
@@ -5410,6 +6951,8 @@ void glReleaseShaderCompiler()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.release_shader_compiler(ctx);
 }
 
@@ -5417,6 +6960,8 @@ void glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, c
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.shader_binary(ctx, count, shaders, binaryFormat, binary, length);
 }
 
@@ -5424,6 +6969,8 @@ void glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_shader_precision_format(ctx, shadertype, precisiontype, range, precision);
 }
 
@@ -5431,6 +6978,8 @@ void glDepthRangef(GLfloat n, GLfloat f)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_rangef(ctx, n, f);
 }
 
@@ -5438,6 +6987,8 @@ void glClearDepthf(GLfloat d)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_depthf(ctx, d);
 }
 
@@ -5445,6 +6996,8 @@ void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_binary(ctx, program, bufSize, length, binaryFormat, binary);
 }
 
@@ -5452,6 +7005,8 @@ void glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_binary(ctx, program, binaryFormat, binary, length);
 }
 
@@ -5459,6 +7014,8 @@ void glProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_parameteri(ctx, program, pname, value);
 }
 
@@ -5466,6 +7023,8 @@ void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.use_program_stages(ctx, pipeline, stages, program);
 }
 
@@ -5473,6 +7032,8 @@ void glActiveShaderProgram(GLuint pipeline, GLuint program)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.active_shader_program(ctx, pipeline, program);
 }
 
@@ -5480,6 +7041,8 @@ GLuint  glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*s
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.create_shader_programv(ctx, type, count, strings);
 }
 
@@ -5487,6 +7050,8 @@ void glBindProgramPipeline(GLuint pipeline)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_program_pipeline(ctx, pipeline);
 }
 
@@ -5494,6 +7059,8 @@ void glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.delete_program_pipelines(ctx, n, pipelines);
 }
 
@@ -5501,6 +7068,8 @@ void glGenProgramPipelines(GLsizei n, GLuint *pipelines)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.gen_program_pipelines(ctx, n, pipelines);
 }
 
@@ -5508,6 +7077,8 @@ GLboolean  glIsProgramPipeline(GLuint pipeline)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.is_program_pipeline(ctx, pipeline);
 }
 
@@ -5515,6 +7086,8 @@ void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_pipelineiv(ctx, pipeline, pname, params);
 }
 
@@ -5522,6 +7095,8 @@ void glProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1i(ctx, program, location, v0);
 }
 
@@ -5529,6 +7104,8 @@ void glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1iv(ctx, program, location, count, value);
 }
 
@@ -5536,6 +7113,8 @@ void glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1f(ctx, program, location, v0);
 }
 
@@ -5543,6 +7122,8 @@ void glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1fv(ctx, program, location, count, value);
 }
 
@@ -5550,6 +7131,8 @@ void glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1d(ctx, program, location, v0);
 }
 
@@ -5557,6 +7140,8 @@ void glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1dv(ctx, program, location, count, value);
 }
 
@@ -5564,6 +7149,8 @@ void glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1ui(ctx, program, location, v0);
 }
 
@@ -5571,6 +7158,8 @@ void glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform1uiv(ctx, program, location, count, value);
 }
 
@@ -5578,6 +7167,8 @@ void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2i(ctx, program, location, v0, v1);
 }
 
@@ -5585,6 +7176,8 @@ void glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2iv(ctx, program, location, count, value);
 }
 
@@ -5592,6 +7185,8 @@ void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2f(ctx, program, location, v0, v1);
 }
 
@@ -5599,6 +7194,8 @@ void glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2fv(ctx, program, location, count, value);
 }
 
@@ -5606,6 +7203,8 @@ void glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2d(ctx, program, location, v0, v1);
 }
 
@@ -5613,6 +7212,8 @@ void glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2dv(ctx, program, location, count, value);
 }
 
@@ -5620,6 +7221,8 @@ void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2ui(ctx, program, location, v0, v1);
 }
 
@@ -5627,6 +7230,8 @@ void glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform2uiv(ctx, program, location, count, value);
 }
 
@@ -5634,6 +7239,8 @@ void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3i(ctx, program, location, v0, v1, v2);
 }
 
@@ -5641,6 +7248,8 @@ void glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3iv(ctx, program, location, count, value);
 }
 
@@ -5648,6 +7257,8 @@ void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3f(ctx, program, location, v0, v1, v2);
 }
 
@@ -5655,6 +7266,8 @@ void glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3fv(ctx, program, location, count, value);
 }
 
@@ -5662,6 +7275,8 @@ void glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3d(ctx, program, location, v0, v1, v2);
 }
 
@@ -5669,6 +7284,8 @@ void glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3dv(ctx, program, location, count, value);
 }
 
@@ -5676,6 +7293,8 @@ void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3ui(ctx, program, location, v0, v1, v2);
 }
 
@@ -5683,6 +7302,8 @@ void glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform3uiv(ctx, program, location, count, value);
 }
 
@@ -5690,6 +7311,8 @@ void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4i(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -5697,6 +7320,8 @@ void glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4iv(ctx, program, location, count, value);
 }
 
@@ -5704,6 +7329,8 @@ void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4f(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -5711,6 +7338,8 @@ void glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4fv(ctx, program, location, count, value);
 }
 
@@ -5718,6 +7347,8 @@ void glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4d(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -5725,6 +7356,8 @@ void glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4dv(ctx, program, location, count, value);
 }
 
@@ -5732,6 +7365,8 @@ void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4ui(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -5739,6 +7374,8 @@ void glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform4uiv(ctx, program, location, count, value);
 }
 
@@ -5746,6 +7383,8 @@ void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5753,6 +7392,8 @@ void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5760,6 +7401,8 @@ void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5767,6 +7410,8 @@ void glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5774,6 +7419,8 @@ void glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5781,6 +7428,8 @@ void glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5788,6 +7437,8 @@ void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2x3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5795,6 +7446,8 @@ void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3x2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5802,6 +7455,8 @@ void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2x4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5809,6 +7464,8 @@ void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4x2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5816,6 +7473,8 @@ void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3x4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5823,6 +7482,8 @@ void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4x3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -5830,6 +7491,8 @@ void glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2x3dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5837,6 +7500,8 @@ void glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3x2dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5844,6 +7509,8 @@ void glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix2x4dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5851,6 +7518,8 @@ void glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4x2dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5858,6 +7527,8 @@ void glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix3x4dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5865,6 +7536,8 @@ void glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.program_uniform_matrix4x3dv(ctx, program, location, count, transpose, value);
 }
 
@@ -5872,6 +7545,8 @@ void glValidateProgramPipeline(GLuint pipeline)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.validate_program_pipeline(ctx, pipeline);
 }
 
@@ -5879,6 +7554,8 @@ void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *leng
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_pipeline_info_log(ctx, pipeline, bufSize, length, infoLog);
 }
 
@@ -5886,6 +7563,8 @@ void glVertexAttribL1d(GLuint index, GLdouble x)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l1d(ctx, index, x);
 }
 
@@ -5893,6 +7572,8 @@ void glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l2d(ctx, index, x, y);
 }
 
@@ -5900,6 +7581,8 @@ void glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l3d(ctx, index, x, y, z);
 }
 
@@ -5907,6 +7590,8 @@ void glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdoubl
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l4d(ctx, index, x, y, z, w);
 }
 
@@ -5914,6 +7599,8 @@ void glVertexAttribL1dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l1dv(ctx, index, v);
 }
 
@@ -5921,6 +7608,8 @@ void glVertexAttribL2dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l2dv(ctx, index, v);
 }
 
@@ -5928,6 +7617,8 @@ void glVertexAttribL3dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l3dv(ctx, index, v);
 }
 
@@ -5935,6 +7626,8 @@ void glVertexAttribL4dv(GLuint index, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l4dv(ctx, index, v);
 }
 
@@ -5942,6 +7635,8 @@ void glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei strid
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l_pointer(ctx, index, size, type, stride, pointer);
 }
 
@@ -5949,6 +7644,8 @@ void glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_attrib_ldv(ctx, index, pname, params);
 }
 
@@ -5956,6 +7653,8 @@ void glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.viewport_arrayv(ctx, first, count, v);
 }
 
@@ -5963,6 +7662,8 @@ void glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.viewport_indexedf(ctx, index, x, y, w, h);
 }
 
@@ -5970,6 +7671,8 @@ void glViewportIndexedfv(GLuint index, const GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.viewport_indexedfv(ctx, index, v);
 }
 
@@ -5977,6 +7680,8 @@ void glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scissor_arrayv(ctx, first, count, v);
 }
 
@@ -5984,6 +7689,8 @@ void glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLs
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scissor_indexed(ctx, index, left, bottom, width, height);
 }
 
@@ -5991,6 +7698,8 @@ void glScissorIndexedv(GLuint index, const GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.scissor_indexedv(ctx, index, v);
 }
 
@@ -5998,6 +7707,8 @@ void glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_range_arrayv(ctx, first, count, v);
 }
 
@@ -6005,6 +7716,8 @@ void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.depth_range_indexed(ctx, index, n, f);
 }
 
@@ -6012,6 +7725,8 @@ void glGetFloati_v(GLenum target, GLuint index, GLfloat *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_floati_v(ctx, target, index, data);
 }
 
@@ -6019,6 +7734,8 @@ void glGetDoublei_v(GLenum target, GLuint index, GLdouble *data)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_doublei_v(ctx, target, index, data);
 }
 
@@ -6026,6 +7743,8 @@ void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_arrays_instanced_base_instance(ctx, mode, first, count, instancecount, baseinstance);
 }
 
@@ -6033,6 +7752,8 @@ void glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_instanced_base_instance(ctx, mode, count, type, indices, instancecount, baseinstance);
 }
 
@@ -6040,6 +7761,8 @@ void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_elements_instanced_base_vertex_base_instance(ctx, mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
 
@@ -6047,6 +7770,8 @@ void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_internalformativ(ctx, target, internalformat, pname, count, params);
 }
 
@@ -6054,6 +7779,8 @@ void glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_active_atomic_counter_bufferiv(ctx, program, bufferIndex, pname, params);
 }
 
@@ -6061,6 +7788,8 @@ void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean laye
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_image_texture(ctx, unit, texture, level, layered, layer, access, format);
 }
 
@@ -6068,6 +7797,8 @@ void glMemoryBarrier(GLbitfield barriers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.memory_barrier(ctx, barriers);
 }
 
@@ -6075,6 +7806,8 @@ void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_storage1D(ctx, target, levels, internalformat, width);
 }
 
@@ -6082,6 +7815,8 @@ void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_storage2D(ctx, target, levels, internalformat, width, height);
 }
 
@@ -6089,6 +7824,8 @@ void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_storage3D(ctx, target, levels, internalformat, width, height, depth);
 }
 
@@ -6096,6 +7833,8 @@ void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instanceco
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_transform_feedback_instanced(ctx, mode, id, instancecount);
 }
 
@@ -6103,6 +7842,8 @@ void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint strea
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.draw_transform_feedback_stream_instanced(ctx, mode, id, stream, instancecount);
 }
 
@@ -6110,6 +7851,8 @@ void glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLen
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_buffer_data(ctx, target, internalformat, format, type, data);
 }
 
@@ -6117,6 +7860,8 @@ void glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_buffer_sub_data(ctx, target, internalformat, offset, size, format, type, data);
 }
 
@@ -6124,6 +7869,8 @@ void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_grou
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.dispatch_compute(ctx, num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -6131,6 +7878,8 @@ void glDispatchComputeIndirect(GLintptr indirect)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.dispatch_compute_indirect(ctx, indirect);
 }
 
@@ -6138,6 +7887,8 @@ void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_image_sub_data(ctx, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -6145,6 +7896,8 @@ void glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.framebuffer_parameteri(ctx, target, pname, param);
 }
 
@@ -6152,6 +7905,8 @@ void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_framebuffer_parameteriv(ctx, target, pname, params);
 }
 
@@ -6159,6 +7914,8 @@ void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_internalformati64v(ctx, target, internalformat, pname, count, params);
 }
 
@@ -6166,6 +7923,8 @@ void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint y
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_tex_sub_image(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
@@ -6173,6 +7932,8 @@ void glInvalidateTexImage(GLuint texture, GLint level)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_tex_image(ctx, texture, level);
 }
 
@@ -6180,6 +7941,8 @@ void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_buffer_sub_data(ctx, buffer, offset, length);
 }
 
@@ -6187,6 +7950,8 @@ void glInvalidateBufferData(GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_buffer_data(ctx, buffer);
 }
 
@@ -6194,6 +7959,8 @@ void glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_framebuffer(ctx, target, numAttachments, attachments);
 }
 
@@ -6201,6 +7968,8 @@ void glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLe
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_sub_framebuffer(ctx, target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -6208,6 +7977,8 @@ void glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawco
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_arrays_indirect(ctx, mode, indirect, drawcount, stride);
 }
 
@@ -6215,6 +7986,8 @@ void glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_elements_indirect(ctx, mode, type, indirect, drawcount, stride);
 }
 
@@ -6222,6 +7995,8 @@ void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pna
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_interfaceiv(ctx, program, programInterface, pname, params);
 }
 
@@ -6229,6 +8004,8 @@ GLuint  glGetProgramResourceIndex(GLuint program, GLenum programInterface, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_program_resource_index(ctx, program, programInterface, name);
 }
 
@@ -6236,6 +8013,8 @@ void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint in
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_resource_name(ctx, program, programInterface, index, bufSize, length, name);
 }
 
@@ -6243,6 +8022,8 @@ void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint inde
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_program_resourceiv(ctx, program, programInterface, index, propCount, props, count, length, params);
 }
 
@@ -6250,6 +8031,8 @@ GLint  glGetProgramResourceLocation(GLuint program, GLenum programInterface, con
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_program_resource_location(ctx, program, programInterface, name);
 }
 
@@ -6257,6 +8040,8 @@ GLint  glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_program_resource_location_index(ctx, program, programInterface, name);
 }
 
@@ -6264,6 +8049,8 @@ void glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.shader_storage_block_binding(ctx, program, storageBlockIndex, storageBlockBinding);
 }
 
@@ -6271,6 +8058,8 @@ void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_buffer_range(ctx, target, internalformat, buffer, offset, size);
 }
 
@@ -6278,6 +8067,8 @@ void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_storage2_d_multisample(ctx, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -6285,6 +8076,8 @@ void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.tex_storage3_d_multisample(ctx, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -6292,6 +8085,8 @@ void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum int
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_view(ctx, texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 }
 
@@ -6299,6 +8094,8 @@ void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLs
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_vertex_buffer(ctx, bindingindex, buffer, offset, stride);
 }
 
@@ -6306,6 +8103,8 @@ void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_format(ctx, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -6313,6 +8112,8 @@ void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint r
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_i_format(ctx, attribindex, size, type, relativeoffset);
 }
 
@@ -6320,6 +8121,8 @@ void glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint r
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_l_format(ctx, attribindex, size, type, relativeoffset);
 }
 
@@ -6327,6 +8130,8 @@ void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_attrib_binding(ctx, attribindex, bindingindex);
 }
 
@@ -6334,6 +8139,8 @@ void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_binding_divisor(ctx, bindingindex, divisor);
 }
 
@@ -6341,6 +8148,8 @@ void glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.debug_message_control(ctx, source, type, severity, count, ids, enabled);
 }
 
@@ -6348,6 +8157,8 @@ void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.debug_message_insert(ctx, source, type, id, severity, length, buf);
 }
 
@@ -6355,6 +8166,8 @@ void glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.debug_message_callback(ctx, callback, userParam);
 }
 
@@ -6362,6 +8175,8 @@ GLuint  glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLe
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_debug_message_log(ctx, count, bufSize, sources, types, ids, severities, lengths, messageLog);
 }
 
@@ -6369,6 +8184,8 @@ void glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *me
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.push_debug_group(ctx, source, id, length, message);
 }
 
@@ -6376,6 +8193,8 @@ void glPopDebugGroup()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.pop_debug_group(ctx);
 }
 
@@ -6383,6 +8202,8 @@ void glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.object_label(ctx, identifier, name, length, label);
 }
 
@@ -6390,6 +8211,8 @@ void glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_object_label(ctx, identifier, name, bufSize, length, label);
 }
 
@@ -6397,6 +8220,8 @@ void glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.object_ptr_label(ctx, ptr, length, label);
 }
 
@@ -6404,6 +8229,8 @@ void glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLch
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_object_ptr_label(ctx, ptr, bufSize, length, label);
 }
 
@@ -6411,6 +8238,8 @@ void glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfiel
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.buffer_storage(ctx, target, size, data, flags);
 }
 
@@ -6418,6 +8247,8 @@ void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, co
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_tex_image(ctx, texture, level, format, type, data);
 }
 
@@ -6425,6 +8256,8 @@ void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffse
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_tex_sub_image(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
 }
 
@@ -6432,6 +8265,8 @@ void glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_buffers_base(ctx, target, first, count, buffers);
 }
 
@@ -6439,6 +8274,8 @@ void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_buffers_range(ctx, target, first, count, buffers, offsets, sizes);
 }
 
@@ -6446,6 +8283,8 @@ void glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_textures(ctx, first, count, textures);
 }
 
@@ -6453,6 +8292,8 @@ void glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_samplers(ctx, first, count, samplers);
 }
 
@@ -6460,6 +8301,8 @@ void glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_image_textures(ctx, first, count, textures);
 }
 
@@ -6467,6 +8310,8 @@ void glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, con
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_vertex_buffers(ctx, first, count, buffers, offsets, strides);
 }
 
@@ -6474,6 +8319,8 @@ void glClipControl(GLenum origin, GLenum depth)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clip_control(ctx, origin, depth);
 }
 
@@ -6481,6 +8328,8 @@ void glCreateTransformFeedbacks(GLsizei n, GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_transform_feedbacks(ctx, n, ids);
 }
 
@@ -6488,6 +8337,8 @@ void glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.transform_feedback_buffer_base(ctx, xfb, index, buffer);
 }
 
@@ -6495,6 +8346,8 @@ void glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.transform_feedback_buffer_range(ctx, xfb, index, buffer, offset, size);
 }
 
@@ -6502,6 +8355,8 @@ void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_transform_feedbackiv(ctx, xfb, pname, param);
 }
 
@@ -6509,6 +8364,8 @@ void glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *pa
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_transform_feedbacki_v(ctx, xfb, pname, index, param);
 }
 
@@ -6516,6 +8373,8 @@ void glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_transform_feedbacki64_v(ctx, xfb, pname, index, param);
 }
 
@@ -6523,6 +8382,8 @@ void glCreateBuffers(GLsizei n, GLuint *buffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_buffers(ctx, n, buffers);
 }
 
@@ -6530,6 +8391,8 @@ void glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_buffer_storage(ctx, buffer, size, data, flags);
 }
 
@@ -6537,6 +8400,8 @@ void glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_buffer_data(ctx, buffer, size, data, usage);
 }
 
@@ -6544,6 +8409,8 @@ void glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_buffer_sub_data(ctx, buffer, offset, size, data);
 }
 
@@ -6551,6 +8418,8 @@ void glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr re
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_named_buffer_sub_data(ctx, readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -6558,6 +8427,8 @@ void glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_buffer_data(ctx, buffer, internalformat, format, type, data);
 }
 
@@ -6565,6 +8436,8 @@ void glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr of
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_buffer_sub_data(ctx, buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -6572,6 +8445,8 @@ void *glMapNamedBuffer(GLuint buffer, GLenum access)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.map_named_buffer(ctx, buffer, access);
 }
 
@@ -6579,6 +8454,8 @@ void *glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.map_named_buffer_range(ctx, buffer, offset, length, access);
 }
 
@@ -6586,6 +8463,8 @@ GLboolean  glUnmapNamedBuffer(GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.unmap_named_buffer(ctx, buffer);
 }
 
@@ -6593,6 +8472,8 @@ void glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr le
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.flush_mapped_named_buffer_range(ctx, buffer, offset, length);
 }
 
@@ -6600,6 +8481,8 @@ void glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_buffer_parameteriv(ctx, buffer, pname, params);
 }
 
@@ -6607,6 +8490,8 @@ void glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_buffer_parameteri64v(ctx, buffer, pname, params);
 }
 
@@ -6614,6 +8499,8 @@ void glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_buffer_pointerv(ctx, buffer, pname, params);
 }
 
@@ -6621,6 +8508,8 @@ void glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, vo
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_buffer_sub_data(ctx, buffer, offset, size, data);
 }
 
@@ -6628,6 +8517,8 @@ void glCreateFramebuffers(GLsizei n, GLuint *framebuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_framebuffers(ctx, n, framebuffers);
 }
 
@@ -6635,6 +8526,8 @@ void glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenu
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_renderbuffer(ctx, framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -6642,6 +8535,8 @@ void glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_parameteri(ctx, framebuffer, pname, param);
 }
 
@@ -6649,6 +8544,8 @@ void glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint tex
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_texture(ctx, framebuffer, attachment, texture, level);
 }
 
@@ -6656,6 +8553,8 @@ void glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_texture_layer(ctx, framebuffer, attachment, texture, level, layer);
 }
 
@@ -6663,6 +8562,8 @@ void glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_draw_buffer(ctx, framebuffer, buf);
 }
 
@@ -6670,6 +8571,8 @@ void glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_draw_buffers(ctx, framebuffer, n, bufs);
 }
 
@@ -6677,6 +8580,8 @@ void glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_framebuffer_read_buffer(ctx, framebuffer, src);
 }
 
@@ -6684,6 +8589,8 @@ void glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_named_framebuffer_data(ctx, framebuffer, numAttachments, attachments);
 }
 
@@ -6691,6 +8598,8 @@ void glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachme
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.invalidate_named_framebuffer_sub_data(ctx, framebuffer, numAttachments, attachments, x, y, width, height);
 }
 
@@ -6698,6 +8607,8 @@ void glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuff
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_framebufferiv(ctx, framebuffer, buffer, drawbuffer, value);
 }
 
@@ -6705,6 +8616,8 @@ void glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuf
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_framebufferuiv(ctx, framebuffer, buffer, drawbuffer, value);
 }
 
@@ -6712,6 +8625,8 @@ void glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuff
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_framebufferfv(ctx, framebuffer, buffer, drawbuffer, value);
 }
 
@@ -6719,6 +8634,8 @@ void glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuff
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.clear_named_framebufferfi(ctx, framebuffer, buffer, drawbuffer, depth, stencil);
 }
 
@@ -6726,6 +8643,8 @@ void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLin
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.blit_named_framebuffer(ctx, readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -6733,6 +8652,8 @@ GLenum  glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.check_named_framebuffer_status(ctx, framebuffer, target);
 }
 
@@ -6740,6 +8661,8 @@ void glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *p
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_framebuffer_parameteriv(ctx, framebuffer, pname, param);
 }
 
@@ -6747,6 +8670,8 @@ void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attac
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_framebuffer_attachment_parameteriv(ctx, framebuffer, attachment, pname, params);
 }
 
@@ -6754,6 +8679,8 @@ void glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_renderbuffers(ctx, n, renderbuffers);
 }
 
@@ -6761,6 +8688,8 @@ void glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_renderbuffer_storage(ctx, renderbuffer, internalformat, width, height);
 }
 
@@ -6768,6 +8697,8 @@ void glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.named_renderbuffer_storage_multisample(ctx, renderbuffer, samples, internalformat, width, height);
 }
 
@@ -6775,6 +8706,8 @@ void glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_named_renderbuffer_parameteriv(ctx, renderbuffer, pname, params);
 }
 
@@ -6782,6 +8715,8 @@ void glCreateTextures(GLenum target, GLsizei n, GLuint *textures)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_textures(ctx, target, n, textures);
 }
 
@@ -6789,6 +8724,8 @@ void glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_buffer(ctx, texture, internalformat, buffer);
 }
 
@@ -6796,6 +8733,8 @@ void glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_buffer_range(ctx, texture, internalformat, buffer, offset, size);
 }
 
@@ -6803,6 +8742,8 @@ void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_storage1D(ctx, texture, levels, internalformat, width);
 }
 
@@ -6810,6 +8751,8 @@ void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_storage2D(ctx, texture, levels, internalformat, width, height);
 }
 
@@ -6817,6 +8760,8 @@ void glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_storage3D(ctx, texture, levels, internalformat, width, height, depth);
 }
 
@@ -6824,6 +8769,8 @@ void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum inter
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_storage2_d_multisample(ctx, texture, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -6831,6 +8778,8 @@ void glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum inter
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_storage3_d_multisample(ctx, texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -6838,6 +8787,8 @@ void glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei wid
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_sub_image1D(ctx, texture, level, xoffset, width, format, type, pixels);
 }
 
@@ -6845,6 +8796,8 @@ void glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffs
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_sub_image2D(ctx, texture, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -6852,6 +8805,8 @@ void glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffs
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_sub_image3D(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -6859,6 +8814,8 @@ void glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_texture_sub_image1D(ctx, texture, level, xoffset, width, format, imageSize, data);
 }
 
@@ -6866,6 +8823,8 @@ void glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_texture_sub_image2D(ctx, texture, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -6873,6 +8832,8 @@ void glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, G
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.compressed_texture_sub_image3D(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -6880,6 +8841,8 @@ void glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_texture_sub_image1D(ctx, texture, level, xoffset, x, y, width);
 }
 
@@ -6887,6 +8850,8 @@ void glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint y
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_texture_sub_image2D(ctx, texture, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -6894,6 +8859,8 @@ void glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint y
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.copy_texture_sub_image3D(ctx, texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -6901,6 +8868,8 @@ void glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameterf(ctx, texture, pname, param);
 }
 
@@ -6908,6 +8877,8 @@ void glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameterfv(ctx, texture, pname, param);
 }
 
@@ -6915,6 +8886,8 @@ void glTextureParameteri(GLuint texture, GLenum pname, GLint param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameteri(ctx, texture, pname, param);
 }
 
@@ -6922,6 +8895,8 @@ void glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameter_iiv(ctx, texture, pname, params);
 }
 
@@ -6929,6 +8904,8 @@ void glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameter_iuiv(ctx, texture, pname, params);
 }
 
@@ -6936,6 +8913,8 @@ void glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_parameteriv(ctx, texture, pname, param);
 }
 
@@ -6943,6 +8922,8 @@ void glGenerateTextureMipmap(GLuint texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.generate_texture_mipmap(ctx, texture);
 }
 
@@ -6950,6 +8931,8 @@ void glBindTextureUnit(GLuint unit, GLuint texture)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.bind_texture_unit(ctx, unit, texture);
 }
 
@@ -6957,6 +8940,8 @@ void glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_image(ctx, texture, level, format, type, bufSize, pixels);
 }
 
@@ -6964,6 +8949,8 @@ void glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, v
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_compressed_texture_image(ctx, texture, level, bufSize, pixels);
 }
 
@@ -6971,6 +8958,8 @@ void glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLf
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_level_parameterfv(ctx, texture, level, pname, params);
 }
 
@@ -6978,6 +8967,8 @@ void glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_level_parameteriv(ctx, texture, level, pname, params);
 }
 
@@ -6985,6 +8976,8 @@ void glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_parameterfv(ctx, texture, pname, params);
 }
 
@@ -6992,6 +8985,8 @@ void glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_parameter_iiv(ctx, texture, pname, params);
 }
 
@@ -6999,6 +8994,8 @@ void glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_parameter_iuiv(ctx, texture, pname, params);
 }
 
@@ -7006,6 +9003,8 @@ void glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_parameteriv(ctx, texture, pname, params);
 }
 
@@ -7013,6 +9012,8 @@ void glCreateVertexArrays(GLsizei n, GLuint *arrays)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_vertex_arrays(ctx, n, arrays);
 }
 
@@ -7020,6 +9021,8 @@ void glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.disable_vertex_array_attrib(ctx, vaobj, index);
 }
 
@@ -7027,6 +9030,8 @@ void glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.enable_vertex_array_attrib(ctx, vaobj, index);
 }
 
@@ -7034,6 +9039,8 @@ void glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_element_buffer(ctx, vaobj, buffer);
 }
 
@@ -7041,6 +9048,8 @@ void glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_vertex_buffer(ctx, vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -7048,6 +9057,8 @@ void glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_vertex_buffers(ctx, vaobj, first, count, buffers, offsets, strides);
 }
 
@@ -7055,6 +9066,8 @@ void glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint binding
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_attrib_binding(ctx, vaobj, attribindex, bindingindex);
 }
 
@@ -7062,6 +9075,8 @@ void glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLe
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_attrib_format(ctx, vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -7069,6 +9084,8 @@ void glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_attrib_i_format(ctx, vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -7076,6 +9093,8 @@ void glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_attrib_l_format(ctx, vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -7083,6 +9102,8 @@ void glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divis
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.vertex_array_binding_divisor(ctx, vaobj, bindingindex, divisor);
 }
 
@@ -7090,6 +9111,8 @@ void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_arrayiv(ctx, vaobj, pname, param);
 }
 
@@ -7097,6 +9120,8 @@ void glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_array_indexediv(ctx, vaobj, index, pname, param);
 }
 
@@ -7104,6 +9129,8 @@ void glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_vertex_array_indexed64iv(ctx, vaobj, index, pname, param);
 }
 
@@ -7111,6 +9138,8 @@ void glCreateSamplers(GLsizei n, GLuint *samplers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_samplers(ctx, n, samplers);
 }
 
@@ -7118,6 +9147,8 @@ void glCreateProgramPipelines(GLsizei n, GLuint *pipelines)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_program_pipelines(ctx, n, pipelines);
 }
 
@@ -7125,6 +9156,8 @@ void glCreateQueries(GLenum target, GLsizei n, GLuint *ids)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.create_queries(ctx, target, n, ids);
 }
 
@@ -7132,6 +9165,8 @@ void glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_buffer_objecti64v(ctx, id, buffer, pname, offset);
 }
 
@@ -7139,6 +9174,8 @@ void glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr o
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_buffer_objectiv(ctx, id, buffer, pname, offset);
 }
 
@@ -7146,6 +9183,8 @@ void glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintpt
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_buffer_objectui64v(ctx, id, buffer, pname, offset);
 }
 
@@ -7153,6 +9192,8 @@ void glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_query_buffer_objectuiv(ctx, id, buffer, pname, offset);
 }
 
@@ -7160,6 +9201,8 @@ void glMemoryBarrierByRegion(GLbitfield barriers)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.memory_barrier_by_region(ctx, barriers);
 }
 
@@ -7167,6 +9210,8 @@ void glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoff
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_texture_sub_image(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
@@ -7174,6 +9219,8 @@ void glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.get_compressed_texture_sub_image(ctx, texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
@@ -7181,6 +9228,8 @@ GLenum  glGetGraphicsResetStatus()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     return ctx->dispatch.get_graphics_reset_status(ctx);
 }
 
@@ -7188,6 +9237,8 @@ void glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *p
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_compressed_tex_image(ctx, target, lod, bufSize, pixels);
 }
 
@@ -7195,6 +9246,8 @@ void glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_tex_image(ctx, target, level, format, type, bufSize, pixels);
 }
 
@@ -7202,6 +9255,8 @@ void glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_uniformdv(ctx, program, location, bufSize, params);
 }
 
@@ -7209,6 +9264,8 @@ void glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *p
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_uniformfv(ctx, program, location, bufSize, params);
 }
 
@@ -7216,6 +9273,8 @@ void glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *par
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_uniformiv(ctx, program, location, bufSize, params);
 }
 
@@ -7223,6 +9282,8 @@ void glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *p
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_uniformuiv(ctx, program, location, bufSize, params);
 }
 
@@ -7230,6 +9291,8 @@ void glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum forma
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.readn_pixels(ctx, x, y, width, height, format, type, bufSize, data);
 }
 
@@ -7237,6 +9300,8 @@ void glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_mapdv(ctx, target, query, bufSize, v);
 }
 
@@ -7244,6 +9309,8 @@ void glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_mapfv(ctx, target, query, bufSize, v);
 }
 
@@ -7251,6 +9318,8 @@ void glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_mapiv(ctx, target, query, bufSize, v);
 }
 
@@ -7258,6 +9327,8 @@ void glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_pixel_mapfv(ctx, map, bufSize, values);
 }
 
@@ -7265,6 +9336,8 @@ void glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_pixel_mapuiv(ctx, map, bufSize, values);
 }
 
@@ -7272,6 +9345,8 @@ void glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_pixel_mapusv(ctx, map, bufSize, values);
 }
 
@@ -7279,6 +9354,8 @@ void glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_polygon_stipple(ctx, bufSize, pattern);
 }
 
@@ -7286,6 +9363,8 @@ void glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_color_table(ctx, target, format, type, bufSize, table);
 }
 
@@ -7293,6 +9372,8 @@ void glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_convolution_filter(ctx, target, format, type, bufSize, image);
 }
 
@@ -7300,6 +9381,8 @@ void glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei ro
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_separable_filter(ctx, target, format, type, rowBufSize, row, columnBufSize, column, span);
 }
 
@@ -7307,6 +9390,8 @@ void glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type,
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_histogram(ctx, target, reset, format, type, bufSize, values);
 }
 
@@ -7314,6 +9399,8 @@ void glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GL
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.getn_minmax(ctx, target, reset, format, type, bufSize, values);
 }
 
@@ -7321,6 +9408,8 @@ void glTextureBarrier()
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.texture_barrier(ctx);
 }
 
@@ -7328,6 +9417,8 @@ void glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpec
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.specialize_shader(ctx, shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
 }
 
@@ -7335,6 +9426,8 @@ void glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_arrays_indirect_count(ctx, mode, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -7342,6 +9435,8 @@ void glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indi
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.multi_draw_elements_indirect_count(ctx, mode, type, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -7349,6 +9444,8 @@ void glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
 {
     GLMContext ctx = GET_CONTEXT();
 
+    TRACE_GL_CALL();
+
     ctx->dispatch.polygon_offset_clamp(ctx, factor, units, clamp);
 }
 
@@ -21,6 +21,8 @@ void glReadBuffer(GLenum src)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.read_buffer(ctx, src);
 }
 
@@ -28,6 +30,8 @@ void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_range_elements(ctx, mode, start, end, count, type, indices);
 }
 
@@ -35,6 +39,8 @@ void glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei widt
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_image3D(ctx, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -42,6 +48,8 @@ void glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -49,6 +57,8 @@ void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffse
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.copy_tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -56,6 +66,8 @@ void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.compressed_tex_image3D(ctx, target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -63,6 +75,8 @@ void glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.compressed_tex_sub_image3D(ctx, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -70,6 +84,8 @@ void glGenQueries(GLsizei n, GLuint *ids)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.gen_queries(ctx, n, ids);
 }
 
@@ -77,6 +93,8 @@ void glDeleteQueries(GLsizei n, const GLuint *ids)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_queries(ctx, n, ids);
 }
 
@@ -84,6 +102,8 @@ GLboolean  glIsQuery(GLuint id)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_query(ctx, id);
 }
 
@@ -91,6 +111,8 @@ void glBeginQuery(GLenum target, GLuint id)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.begin_query(ctx, target, id);
 }
 
@@ -98,6 +120,8 @@ void glEndQuery(GLenum target)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.end_query(ctx, target);
 }
 
@@ -105,6 +129,8 @@ void glGetQueryiv(GLenum target, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_queryiv(ctx, target, pname, params);
 }
 
@@ -112,6 +138,8 @@ void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_query_objectuiv(ctx, id, pname, params);
 }
 
@@ -119,6 +147,8 @@ GLboolean  glUnmapBuffer(GLenum target)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.unmap_buffer(ctx, target);
 }
 
@@ -126,6 +156,8 @@ void glGetBufferPointerv(GLenum target, GLenum pname, void **params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_buffer_pointerv(ctx, target, pname, params);
 }
 
@@ -133,6 +165,8 @@ void glDrawBuffers(GLsizei n, const GLenum *bufs)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_buffers(ctx, n, bufs);
 }
 
@@ -140,6 +174,8 @@ void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix2x3fv(ctx, location, count, transpose, value);
 }
 
@@ -147,6 +183,8 @@ void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix3x2fv(ctx, location, count, transpose, value);
 }
 
@@ -154,6 +192,8 @@ void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix2x4fv(ctx, location, count, transpose, value);
 }
 
@@ -161,6 +201,8 @@ void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix4x2fv(ctx, location, count, transpose, value);
 }
 
@@ -168,6 +210,8 @@ void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix3x4fv(ctx, location, count, transpose, value);
 }
 
@@ -175,6 +219,8 @@ void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_matrix4x3fv(ctx, location, count, transpose, value);
 }
 
@@ -182,6 +228,8 @@ void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blit_framebuffer(ctx, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -189,6 +237,8 @@ void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum int
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.renderbuffer_storage_multisample(ctx, target, samples, internalformat, width, height);
 }
 
@@ -196,6 +246,8 @@ void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.framebuffer_texture_layer(ctx, target, attachment, texture, level, layer);
 }
 
@@ -203,6 +255,8 @@ void *glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitf
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.map_buffer_range(ctx, target, offset, length, access);
 }
 
@@ -210,6 +264,8 @@ void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.flush_mapped_buffer_range(ctx, target, offset, length);
 }
 
@@ -217,6 +273,8 @@ void glBindVertexArray(GLuint array)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_vertex_array(ctx, array);
 }
 
@@ -224,6 +282,8 @@ void glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_vertex_arrays(ctx, n, arrays);
 }
 
@@ -231,6 +291,8 @@ void glGenVertexArrays(GLsizei n, GLuint *arrays)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.gen_vertex_arrays(ctx, n, arrays);
 }
 
@@ -238,6 +300,8 @@ GLboolean  glIsVertexArray(GLuint array)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_vertex_array(ctx, array);
 }
 
@@ -245,6 +309,8 @@ void glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_integeri_v(ctx, target, index, data);
 }
 
@@ -252,6 +318,8 @@ void glBeginTransformFeedback(GLenum primitiveMode)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.begin_transform_feedback(ctx, primitiveMode);
 }
 
@@ -259,6 +327,8 @@ void glEndTransformFeedback()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.end_transform_feedback(ctx);
 }
 
@@ -266,6 +336,8 @@ void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offs
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_buffer_range(ctx, target, index, buffer, offset, size);
 }
 
@@ -273,6 +345,8 @@ void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_buffer_base(ctx, target, index, buffer);
 }
 
@@ -280,6 +354,8 @@ void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *co
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.transform_feedback_varyings(ctx, program, count, varyings, bufferMode);
 }
 
@@ -287,6 +363,8 @@ void glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_transform_feedback_varying(ctx, program, index, bufSize, length, size, type, name);
 }
 
@@ -294,6 +372,8 @@ void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei strid
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i_pointer(ctx, index, size, type, stride, pointer);
 }
 
@@ -301,6 +381,8 @@ void glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_vertex_attrib_iiv(ctx, index, pname, params);
 }
 
@@ -308,6 +390,8 @@ void glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_vertex_attrib_iuiv(ctx, index, pname, params);
 }
 
@@ -315,6 +399,8 @@ void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i4i(ctx, index, x, y, z, w);
 }
 
@@ -322,6 +408,8 @@ void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i4ui(ctx, index, x, y, z, w);
 }
 
@@ -329,6 +417,8 @@ void glVertexAttribI4iv(GLuint index, const GLint *v)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i4iv(ctx, index, v);
 }
 
@@ -336,6 +426,8 @@ void glVertexAttribI4uiv(GLuint index, const GLuint *v)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i4uiv(ctx, index, v);
 }
 
@@ -343,6 +435,8 @@ void glGetUniformuiv(GLuint program, GLint location, GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_uniformuiv(ctx, program, location, params);
 }
 
@@ -350,6 +444,8 @@ GLint  glGetFragDataLocation(GLuint program, const GLchar *name)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_frag_data_location(ctx, program, name);
 }
 
@@ -357,6 +453,8 @@ void glUniform1ui(GLint location, GLuint v0)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform1ui(ctx, location, v0);
 }
 
@@ -364,6 +462,8 @@ void glUniform2ui(GLint location, GLuint v0, GLuint v1)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform2ui(ctx, location, v0, v1);
 }
 
@@ -371,6 +471,8 @@ void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform3ui(ctx, location, v0, v1, v2);
 }
 
@@ -378,6 +480,8 @@ void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform4ui(ctx, location, v0, v1, v2, v3);
 }
 
@@ -385,6 +489,8 @@ void glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform1uiv(ctx, location, count, value);
 }
 
@@ -392,6 +498,8 @@ void glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform2uiv(ctx, location, count, value);
 }
 
@@ -399,6 +507,8 @@ void glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform3uiv(ctx, location, count, value);
 }
 
@@ -406,6 +516,8 @@ void glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform4uiv(ctx, location, count, value);
 }
 
@@ -413,6 +525,8 @@ void glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.clear_bufferiv(ctx, buffer, drawbuffer, value);
 }
 
@@ -420,6 +534,8 @@ void glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.clear_bufferuiv(ctx, buffer, drawbuffer, value);
 }
 
@@ -427,6 +543,8 @@ void glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.clear_bufferfv(ctx, buffer, drawbuffer, value);
 }
 
@@ -434,6 +552,8 @@ void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stenc
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.clear_bufferfi(ctx, buffer, drawbuffer, depth, stencil);
 }
 
@@ -441,6 +561,8 @@ GLubyte const  *glGetStringi(GLenum name, GLuint index)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_stringi(ctx, name, index);
 }
 
@@ -448,6 +570,8 @@ void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOff
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.copy_buffer_sub_data(ctx, readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
@@ -455,6 +579,8 @@ void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *con
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_uniform_indices(ctx, program, uniformCount, uniformNames, uniformIndices);
 }
 
@@ -462,6 +588,8 @@ void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *u
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_active_uniformsiv(ctx, program, uniformCount, uniformIndices, pname, params);
 }
 
@@ -469,6 +597,8 @@ GLuint  glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_uniform_block_index(ctx, program, uniformBlockName);
 }
 
@@ -476,6 +606,8 @@ void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_active_uniform_blockiv(ctx, program, uniformBlockIndex, pname, params);
 }
 
@@ -483,6 +615,8 @@ void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsiz
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_active_uniform_block_name(ctx, program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
@@ -490,6 +624,8 @@ void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint unif
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.uniform_block_binding(ctx, program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -497,6 +633,8 @@ void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei inst
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_arrays_instanced(ctx, mode, first, count, instancecount);
 }
 
@@ -504,6 +642,8 @@ void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_elements_instanced(ctx, mode, count, type, indices, instancecount);
 }
 
@@ -511,6 +651,8 @@ GLsync  glFenceSync(GLenum condition, GLbitfield flags)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.fence_sync(ctx, condition, flags);
 }
 
@@ -518,6 +660,8 @@ GLboolean  glIsSync(GLsync sync)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_sync(ctx, sync);
 }
 
@@ -525,6 +669,8 @@ void glDeleteSync(GLsync sync)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_sync(ctx, sync);
 }
 
@@ -532,6 +678,8 @@ GLenum  glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.client_wait_sync(ctx, sync, flags, timeout);
 }
 
@@ -539,6 +687,8 @@ void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.wait_sync(ctx, sync, flags, timeout);
 }
 
@@ -546,6 +696,8 @@ void glGetInteger64v(GLenum pname, GLint64 *data)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_integer64v(ctx, pname, data);
 }
 
@@ -553,6 +705,8 @@ void glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLin
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_synciv(ctx, sync, pname, count, length, values);
 }
 
@@ -560,6 +714,8 @@ void glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_integer64i_v(ctx, target, index, data);
 }
 
@@ -567,6 +723,8 @@ void glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_buffer_parameteri64v(ctx, target, pname, params);
 }
 
@@ -574,6 +732,8 @@ void glGenSamplers(GLsizei count, GLuint *samplers)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.gen_samplers(ctx, count, samplers);
 }
 
@@ -581,6 +741,8 @@ void glDeleteSamplers(GLsizei count, const GLuint *samplers)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_samplers(ctx, count, samplers);
 }
 
@@ -588,6 +750,8 @@ GLboolean  glIsSampler(GLuint sampler)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_sampler(ctx, sampler);
 }
 
@@ -595,6 +759,8 @@ void glBindSampler(GLuint unit, GLuint sampler)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_sampler(ctx, unit, sampler);
 }
 
@@ -602,6 +768,8 @@ void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameteri(ctx, sampler, pname, param);
 }
 
@@ -609,6 +777,8 @@ void glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameteriv(ctx, sampler, pname, param);
 }
 
@@ -616,6 +786,8 @@ void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameterf(ctx, sampler, pname, param);
 }
 
@@ -623,6 +795,8 @@ void glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameterfv(ctx, sampler, pname, param);
 }
 
@@ -630,6 +804,8 @@ void glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_sampler_parameteriv(ctx, sampler, pname, params);
 }
 
@@ -637,6 +813,8 @@ void glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_sampler_parameterfv(ctx, sampler, pname, params);
 }
 
@@ -644,6 +822,8 @@ void glVertexAttribDivisor(GLuint index, GLuint divisor)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_divisor(ctx, index, divisor);
 }
 
@@ -651,6 +831,8 @@ void glBindTransformFeedback(GLenum target, GLuint id)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_transform_feedback(ctx, target, id);
 }
 
@@ -658,6 +840,8 @@ void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_transform_feedbacks(ctx, n, ids);
 }
 
@@ -665,6 +849,8 @@ void glGenTransformFeedbacks(GLsizei n, GLuint *ids)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.gen_transform_feedbacks(ctx, n, ids);
 }
 
@@ -672,6 +858,8 @@ GLboolean  glIsTransformFeedback(GLuint id)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_transform_feedback(ctx, id);
 }
 
@@ -679,6 +867,8 @@ void glPauseTransformFeedback()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.pause_transform_feedback(ctx);
 }
 
@@ -686,6 +876,8 @@ void glResumeTransformFeedback()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.resume_transform_feedback(ctx);
 }
 
@@ -693,6 +885,8 @@ void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_binary(ctx, program, bufSize, length, binaryFormat, binary);
 }
 
@@ -700,6 +894,8 @@ void glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_binary(ctx, program, binaryFormat, binary, length);
 }
 
@@ -707,6 +903,8 @@ void glProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_parameteri(ctx, program, pname, value);
 }
 
@@ -714,6 +912,8 @@ void glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.invalidate_framebuffer(ctx, target, numAttachments, attachments);
 }
 
@@ -721,6 +921,8 @@ void glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLe
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.invalidate_sub_framebuffer(ctx, target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -728,6 +930,8 @@ void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_storage2D(ctx, target, levels, internalformat, width, height);
 }
 
@@ -735,6 +939,8 @@ void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_storage3D(ctx, target, levels, internalformat, width, height, depth);
 }
 
@@ -742,6 +948,8 @@ void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_internalformativ(ctx, target, internalformat, pname, count, params);
 }
 
@@ -749,6 +957,8 @@ void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_grou
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.dispatch_compute(ctx, num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -756,6 +966,8 @@ void glDispatchComputeIndirect(GLintptr indirect)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.dispatch_compute_indirect(ctx, indirect);
 }
 
@@ -763,6 +975,8 @@ void glDrawArraysIndirect(GLenum mode, const void *indirect)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_arrays_indirect(ctx, mode, indirect);
 }
 
@@ -770,6 +984,8 @@ void glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_elements_indirect(ctx, mode, type, indirect);
 }
 
@@ -777,6 +993,8 @@ void glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.framebuffer_parameteri(ctx, target, pname, param);
 }
 
@@ -784,6 +1002,8 @@ void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_framebuffer_parameteriv(ctx, target, pname, params);
 }
 
@@ -791,6 +1011,8 @@ void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pna
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_interfaceiv(ctx, program, programInterface, pname, params);
 }
 
@@ -798,6 +1020,8 @@ GLuint  glGetProgramResourceIndex(GLuint program, GLenum programInterface, const
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_program_resource_index(ctx, program, programInterface, name);
 }
 
@@ -805,6 +1029,8 @@ void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint in
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_resource_name(ctx, program, programInterface, index, bufSize, length, name);
 }
 
@@ -812,6 +1038,8 @@ void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint inde
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_resourceiv(ctx, program, programInterface, index, propCount, props, count, length, params);
 }
 
@@ -819,6 +1047,8 @@ GLint  glGetProgramResourceLocation(GLuint program, GLenum programInterface, con
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_program_resource_location(ctx, program, programInterface, name);
 }
 
@@ -826,6 +1056,8 @@ void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.use_program_stages(ctx, pipeline, stages, program);
 }
 
@@ -833,6 +1065,8 @@ void glActiveShaderProgram(GLuint pipeline, GLuint program)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.active_shader_program(ctx, pipeline, program);
 }
 
@@ -840,6 +1074,8 @@ GLuint  glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*s
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.create_shader_programv(ctx, type, count, strings);
 }
 
@@ -847,6 +1083,8 @@ void glBindProgramPipeline(GLuint pipeline)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_program_pipeline(ctx, pipeline);
 }
 
@@ -854,6 +1092,8 @@ void glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.delete_program_pipelines(ctx, n, pipelines);
 }
 
@@ -861,6 +1101,8 @@ void glGenProgramPipelines(GLsizei n, GLuint *pipelines)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.gen_program_pipelines(ctx, n, pipelines);
 }
 
@@ -868,6 +1110,8 @@ GLboolean  glIsProgramPipeline(GLuint pipeline)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_program_pipeline(ctx, pipeline);
 }
 
@@ -875,6 +1119,8 @@ void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_pipelineiv(ctx, pipeline, pname, params);
 }
 
@@ -882,6 +1128,8 @@ void glProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1i(ctx, program, location, v0);
 }
 
@@ -889,6 +1137,8 @@ void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2i(ctx, program, location, v0, v1);
 }
 
@@ -896,6 +1146,8 @@ void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3i(ctx, program, location, v0, v1, v2);
 }
 
@@ -903,6 +1155,8 @@ void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4i(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -910,6 +1164,8 @@ void glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1ui(ctx, program, location, v0);
 }
 
@@ -917,6 +1173,8 @@ void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2ui(ctx, program, location, v0, v1);
 }
 
@@ -924,6 +1182,8 @@ void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3ui(ctx, program, location, v0, v1, v2);
 }
 
@@ -931,6 +1191,8 @@ void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4ui(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -938,6 +1200,8 @@ void glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1f(ctx, program, location, v0);
 }
 
@@ -945,6 +1209,8 @@ void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2f(ctx, program, location, v0, v1);
 }
 
@@ -952,6 +1218,8 @@ void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3f(ctx, program, location, v0, v1, v2);
 }
 
@@ -959,6 +1227,8 @@ void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4f(ctx, program, location, v0, v1, v2, v3);
 }
 
@@ -966,6 +1236,8 @@ void glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1iv(ctx, program, location, count, value);
 }
 
@@ -973,6 +1245,8 @@ void glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2iv(ctx, program, location, count, value);
 }
 
@@ -980,6 +1254,8 @@ void glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3iv(ctx, program, location, count, value);
 }
 
@@ -987,6 +1263,8 @@ void glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4iv(ctx, program, location, count, value);
 }
 
@@ -994,6 +1272,8 @@ void glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1uiv(ctx, program, location, count, value);
 }
 
@@ -1001,6 +1281,8 @@ void glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2uiv(ctx, program, location, count, value);
 }
 
@@ -1008,6 +1290,8 @@ void glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3uiv(ctx, program, location, count, value);
 }
 
@@ -1015,6 +1299,8 @@ void glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const G
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4uiv(ctx, program, location, count, value);
 }
 
@@ -1022,6 +1308,8 @@ void glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform1fv(ctx, program, location, count, value);
 }
 
@@ -1029,6 +1317,8 @@ void glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform2fv(ctx, program, location, count, value);
 }
 
@@ -1036,6 +1326,8 @@ void glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform3fv(ctx, program, location, count, value);
 }
 
@@ -1043,6 +1335,8 @@ void glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform4fv(ctx, program, location, count, value);
 }
 
@@ -1050,6 +1344,8 @@ void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1057,6 +1353,8 @@ void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1064,6 +1362,8 @@ void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GL
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1071,6 +1371,8 @@ void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix2x3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1078,6 +1380,8 @@ void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix3x2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1085,6 +1389,8 @@ void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix2x4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1092,6 +1398,8 @@ void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix4x2fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1099,6 +1407,8 @@ void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix3x4fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1106,6 +1416,8 @@ void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.program_uniform_matrix4x3fv(ctx, program, location, count, transpose, value);
 }
 
@@ -1113,6 +1425,8 @@ void glValidateProgramPipeline(GLuint pipeline)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.validate_program_pipeline(ctx, pipeline);
 }
 
@@ -1120,6 +1434,8 @@ void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *leng
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_program_pipeline_info_log(ctx, pipeline, bufSize, length, infoLog);
 }
 
@@ -1127,6 +1443,8 @@ void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean laye
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_image_texture(ctx, unit, texture, level, layered, layer, access, format);
 }
 
@@ -1134,6 +1452,8 @@ void glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_booleani_v(ctx, target, index, data);
 }
 
@@ -1141,6 +1461,8 @@ void glMemoryBarrier(GLbitfield barriers)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.memory_barrier(ctx, barriers);
 }
 
@@ -1148,6 +1470,8 @@ void glMemoryBarrierByRegion(GLbitfield barriers)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.memory_barrier_by_region(ctx, barriers);
 }
 
@@ -1155,6 +1479,8 @@ void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_storage2_d_multisample(ctx, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -1162,6 +1488,8 @@ void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_multisamplefv(ctx, pname, index, val);
 }
 
@@ -1169,6 +1497,8 @@ void glSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sample_maski(ctx, maskNumber, mask);
 }
 
@@ -1176,6 +1506,8 @@ void glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *p
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_tex_level_parameteriv(ctx, target, level, pname, params);
 }
 
@@ -1183,6 +1515,8 @@ void glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_tex_level_parameterfv(ctx, target, level, pname, params);
 }
 
@@ -1190,6 +1524,8 @@ void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLs
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.bind_vertex_buffer(ctx, bindingindex, buffer, offset, stride);
 }
 
@@ -1197,6 +1533,8 @@ void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_format(ctx, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -1204,6 +1542,8 @@ void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint r
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_i_format(ctx, attribindex, size, type, relativeoffset);
 }
 
@@ -1211,6 +1551,8 @@ void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_attrib_binding(ctx, attribindex, bindingindex);
 }
 
@@ -1218,6 +1560,8 @@ void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.vertex_binding_divisor(ctx, bindingindex, divisor);
 }
 
@@ -1225,6 +1569,8 @@ void glBlendBarrier()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blend_barrier(ctx);
 }
 
@@ -1232,6 +1578,8 @@ void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.copy_image_sub_data(ctx, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -1239,6 +1587,8 @@ void glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.debug_message_control(ctx, source, type, severity, count, ids, enabled);
 }
 
@@ -1246,6 +1596,8 @@ void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.debug_message_insert(ctx, source, type, id, severity, length, buf);
 }
 
@@ -1253,6 +1605,8 @@ void glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.debug_message_callback(ctx, callback, userParam);
 }
 
@@ -1260,6 +1614,8 @@ GLuint  glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLe
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_debug_message_log(ctx, count, bufSize, sources, types, ids, severities, lengths, messageLog);
 }
 
@@ -1267,6 +1623,8 @@ void glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *me
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.push_debug_group(ctx, source, id, length, message);
 }
 
@@ -1274,6 +1632,8 @@ void glPopDebugGroup()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.pop_debug_group(ctx);
 }
 
@@ -1281,6 +1641,8 @@ void glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.object_label(ctx, identifier, name, length, label);
 }
 
@@ -1288,6 +1650,8 @@ void glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_object_label(ctx, identifier, name, bufSize, length, label);
 }
 
@@ -1295,6 +1659,8 @@ void glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.object_ptr_label(ctx, ptr, length, label);
 }
 
@@ -1302,6 +1668,8 @@ void glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLch
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_object_ptr_label(ctx, ptr, bufSize, length, label);
 }
 
@@ -1309,6 +1677,8 @@ void glGetPointerv(GLenum pname, void **params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_pointerv(ctx, pname, params);
 }
 
@@ -1316,6 +1686,8 @@ void glEnablei(GLenum target, GLuint index)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.enablei(ctx, target, index);
 }
 
@@ -1323,6 +1695,8 @@ void glDisablei(GLenum target, GLuint index)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.disablei(ctx, target, index);
 }
 
@@ -1330,6 +1704,8 @@ void glBlendEquationi(GLuint buf, GLenum mode)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blend_equationi(ctx, buf, mode);
 }
 
@@ -1337,6 +1713,8 @@ void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blend_equation_separatei(ctx, buf, modeRGB, modeAlpha);
 }
 
@@ -1344,6 +1722,8 @@ void glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blend_funci(ctx, buf, src, dst);
 }
 
@@ -1351,6 +1731,8 @@ void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAl
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.blend_func_separatei(ctx, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -1358,6 +1740,8 @@ void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.color_maski(ctx, index, r, g, b, a);
 }
 
@@ -1365,6 +1749,8 @@ GLboolean  glIsEnabledi(GLenum target, GLuint index)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.is_enabledi(ctx, target, index);
 }
 
@@ -1372,6 +1758,8 @@ void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const voi
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_elements_base_vertex(ctx, mode, count, type, indices, basevertex);
 }
 
@@ -1379,6 +1767,8 @@ void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsize
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_range_elements_base_vertex(ctx, mode, start, end, count, type, indices, basevertex);
 }
 
@@ -1386,6 +1776,8 @@ void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type,
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.draw_elements_instanced_base_vertex(ctx, mode, count, type, indices, instancecount, basevertex);
 }
 
@@ -1393,6 +1785,8 @@ void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLin
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.framebuffer_texture(ctx, target, attachment, texture, level);
 }
 
@@ -1400,6 +1794,8 @@ void glPrimitiveBoundingBox(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat mi
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.primitive_bounding_box(ctx, minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
 }
 
@@ -1407,6 +1803,8 @@ GLenum  glGetGraphicsResetStatus()
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	return ctx->dispatch.get_graphics_reset_status(ctx);
 }
 
@@ -1414,6 +1812,8 @@ void glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum forma
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.readn_pixels(ctx, x, y, width, height, format, type, bufSize, data);
 }
 
@@ -1421,6 +1821,8 @@ void glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *p
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.getn_uniformfv(ctx, program, location, bufSize, params);
 }
 
@@ -1428,6 +1830,8 @@ void glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *par
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.getn_uniformiv(ctx, program, location, bufSize, params);
 }
 
@@ -1435,6 +1839,8 @@ void glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *p
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.getn_uniformuiv(ctx, program, location, bufSize, params);
 }
 
@@ -1442,6 +1848,8 @@ void glMinSampleShading(GLfloat value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.min_sample_shading(ctx, value);
 }
 
@@ -1449,6 +1857,8 @@ void glPatchParameteri(GLenum pname, GLint value)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.patch_parameteri(ctx, pname, value);
 }
 
@@ -1456,6 +1866,8 @@ void glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_parameter_iiv(ctx, target, pname, params);
 }
 
@@ -1463,6 +1875,8 @@ void glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_parameter_iuiv(ctx, target, pname, params);
 }
 
@@ -1470,6 +1884,8 @@ void glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_tex_parameter_iiv(ctx, target, pname, params);
 }
 
@@ -1477,6 +1893,8 @@ void glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_tex_parameter_iuiv(ctx, target, pname, params);
 }
 
@@ -1484,6 +1902,8 @@ void glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameter_iiv(ctx, sampler, pname, param);
 }
 
@@ -1491,6 +1911,8 @@ void glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.sampler_parameter_iuiv(ctx, sampler, pname, param);
 }
 
@@ -1498,6 +1920,8 @@ void glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_sampler_parameter_iiv(ctx, sampler, pname, params);
 }
 
@@ -1505,6 +1929,8 @@ void glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.get_sampler_parameter_iuiv(ctx, sampler, pname, params);
 }
 
@@ -1512,6 +1938,8 @@ void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_buffer(ctx, target, internalformat, buffer);
 }
 
@@ -1519,6 +1947,8 @@ void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLint
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_buffer_range(ctx, target, internalformat, buffer, offset, size);
 }
 
@@ -1526,6 +1956,8 @@ void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 {
 	GLMContext ctx = GET_CONTEXT();
 
+	TRACE_GL_CALL();
+
 	ctx->dispatch.tex_storage3_d_multisample(ctx, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
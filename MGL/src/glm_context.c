@@ -31,9 +31,11 @@
 #include "vertex_arrays.h"
 #include "MGLRenderer.h"
 #include "error.h"
+#include "capture.h"
 
 extern void getMacOSDefaults(GLMContext glm_ctx);
 extern void init_dispatch(GLMContext ctx);
+extern void init_no_error_dispatch(GLMContext ctx);
 
 GLMContext _ctx = NULL;
 
@@ -76,6 +78,14 @@ GLMContext mglGetContext(void)
 GLMContext createGLMContext(GLenum format, GLenum type,
                             GLenum depth_format, GLenum depth_type,
                             GLenum stencil_format, GLenum stencil_type)
+{
+    return createGLMContextWithFlags(format, type, depth_format, depth_type, stencil_format, stencil_type, 0);
+}
+
+GLMContext createGLMContextWithFlags(GLenum format, GLenum type,
+                                     GLenum depth_format, GLenum depth_type,
+                                     GLenum stencil_format, GLenum stencil_type,
+                                     GLuint flags)
 {
     GLMContext ctx = (GLMContext)malloc(sizeof(GLMContextRec));
     GLMContext save = _ctx;
@@ -113,6 +123,9 @@ GLMContext createGLMContext(GLenum format, GLenum type,
     // use a CGL context to read guestimates of gl params for installed GPU
     getMacOSDefaults(ctx);
 
+    ctx->context_flags = flags;
+    STATE_VAR(context_flags) |= flags;
+
     assert(STATE(max_color_attachments) <= MAX_COLOR_ATTACHMENTS);
     assert(STATE(max_vertex_attribs) <= MAX_ATTRIBS);
 
@@ -257,7 +270,15 @@ GLMContext createGLMContext(GLenum format, GLenum type,
 
     STATE(var.cull_face_mode) = GL_BACK;
 
-    STATE(sync_name) = 1;
+    initRenderPass(&STATE(render_pass));
+    initSamplerCache(&STATE(sampler_cache));
+    initDrawQueue(&STATE(draw_queue));
+    initUploadRing(&STATE(upload_ring), UPLOAD_RING_SIZE);
+    initQueryPool(&STATE(query_pool));
+    initFramePacing(&STATE(frame_pacing), getenv("MGL_MAX_FRAMES_IN_FLIGHT"), getenv("MGL_LOW_LATENCY"));
+
+    // chrome trace json of gl calls and backend work, chrome://tracing or ui.perfetto.dev open it
+    initTrace(getenv("MGL_TRACE"));
 
     STATE(dirty_bits) = DIRTY_ALL;
 
@@ -269,9 +290,28 @@ GLMContext createGLMContext(GLenum format, GLenum type,
     initHashTable(&STATE(renderbuffer_table), 32);
     initHashTable(&STATE(framebuffer_table), 32);
     initHashTable(&STATE(sampler_table), 32);
+    initHashTable(&STATE(query_table), 32);
     
     init_dispatch(ctx);
 
+#ifdef MGL_GL_CORE
+    if (flags & GL_CONTEXT_FLAG_NO_ERROR_BIT)
+    {
+        init_no_error_dispatch(ctx);
+    }
+
+    // binary gl call stream for mgl_replay, only the first context so captures don't share a file
+    {
+        static int captured;
+
+        if (captured == 0 && getenv("MGL_CAPTURE"))
+        {
+            captured = 1;
+            captureStart(ctx, getenv("MGL_CAPTURE"));
+        }
+    }
+#endif
+
     ctx->assert_on_error = GL_TRUE;
     ctx->error_func = error_func;
 
@@ -312,11 +352,109 @@ void MGLget(GLMContext ctx, GLenum param, GLuint *data)
         case MGL_STENCIL_FORMAT: *data = ctx->stencil_format.format; break;
         case MGL_STENCIL_TYPE: *data = ctx->stencil_format.type; break;
         case MGL_CONTEXT_FLAGS: *data = ctx->context_flags; break;
+        case MGL_SAMPLERS_UNIQUE: *data = ctx->state.sampler_cache.unique; break;
+        case MGL_SAMPLERS_REQUESTED: *data = (GLuint)ctx->state.sampler_cache.requested; break;
+        case MGL_BINDING_CALLS: *data = ctx->state.binding_calls; break;
+        case MGL_VALIDATIONS: *data = (GLuint)ctx->state.validations; break;
+        case MGL_VALIDATIONS_SKIPPED: *data = (GLuint)ctx->state.validations_skipped; break;
+        case MGL_DRAWS_MERGED: *data = (GLuint)ctx->state.draw_queue.merged; break;
+        case MGL_CLIENT_BYTES_STREAMED: *data = (GLuint)ctx->state.upload_ring.bytes_uploaded; break;
+        case MGL_MAX_FRAMES_IN_FLIGHT: *data = ctx->state.frame_pacing.max_frames; break;
+        case MGL_LOW_LATENCY: *data = ctx->state.frame_pacing.low_latency; break;
+        case MGL_FRAME_CPU_TIME_US: *data = (GLuint)(ctx->state.frame_pacing.cpu_time / 1000); break;
+        case MGL_FRAME_GPU_TIME_US: *data = (GLuint)(ctx->state.frame_pacing.gpu_time / 1000); break;
+        case MGL_FRAME_WAIT_TIME_US: *data = (GLuint)(ctx->state.frame_pacing.wait_time / 1000); break;
+        case MGL_FRAMES_DROPPED: *data = (GLuint)ctx->state.frame_pacing.frames_dropped; break;
+        case MGL_DRAWS_BATCHED: *data = (GLuint)ctx->state.draw_queue.batched; break;
+        default:
+            assert(0);
+    }
+}
+
+void MGLset(GLMContext ctx, GLenum param, GLuint data)
+{
+    if (ctx == NULL)
+        ctx = _ctx;
+
+    if (ctx == NULL)
+        return;
+
+    switch(param)
+    {
+        case MGL_MAX_FRAMES_IN_FLIGHT: framePacingSetMaxFrames(&ctx->state.frame_pacing, data); break;
+        case MGL_LOW_LATENCY: ctx->state.frame_pacing.low_latency = data != 0; break;
         default:
             assert(0);
     }
 }
 
+#define STATS_COUNTERS  (sizeof(MGLStats) / sizeof(GLuint64))
+
+// counters only go up, a relaxed load of each is all a reader needs
+static void loadStats(GLMContext ctx, MGLStats *stats)
+{
+    const GLuint64 *src;
+    GLuint64 *dst;
+
+    src = (const GLuint64 *)&ctx->state.stats;
+    dst = (GLuint64 *)stats;
+
+    for(size_t i=0; i<STATS_COUNTERS; i++)
+        dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+}
+
+static void statsEndFrame(GLMContext ctx)
+{
+    MGLStats now;
+    const GLuint64 *start, *end;
+    GLuint64 *frame;
+
+    loadStats(ctx, &now);
+
+    start = (const GLuint64 *)&ctx->state.stats_frame_start;
+    end = (const GLuint64 *)&now;
+    frame = (GLuint64 *)&ctx->state.stats_last_frame;
+
+    for(size_t i=0; i<STATS_COUNTERS; i++)
+        frame[i] = end[i] - start[i];
+
+    ctx->state.stats_frame_start = now;
+}
+
+void MGLGetStats(GLMContext ctx, MGLStats *stats, MGLStats *frame_stats)
+{
+    if (ctx == NULL)
+        ctx = _ctx;
+
+    if (ctx == NULL)
+        return;
+
+    if (stats)
+        loadStats(ctx, stats);
+
+    if (frame_stats)
+        *frame_stats = ctx->state.stats_last_frame;
+}
+
+void MGLResetStats(GLMContext ctx)
+{
+    GLuint64 *counters;
+
+    if (ctx == NULL)
+        ctx = _ctx;
+
+    if (ctx == NULL)
+        return;
+
+    counters = (GLuint64 *)&ctx->state.stats;
+
+    for(size_t i=0; i<STATS_COUNTERS; i++)
+        __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+
+    bzero(&ctx->state.stats_frame_start, sizeof(MGLStats));
+    bzero(&ctx->state.stats_last_frame, sizeof(MGLStats));
+}
+
 void MGLswapBuffers(GLMContext ctx)
 {
     if (ctx == NULL)
@@ -325,7 +463,43 @@ void MGLswapBuffers(GLMContext ctx)
     if (ctx == NULL)
         return;
 
+#ifdef MGL_GL_CORE
+    if (ctx->capture)
+        captureFrame(ctx);
+#endif
+
     ctx->mtl_funcs.mtlSwapBuffers(ctx);
+
+    statsEndFrame(ctx);
+}
+
+GLboolean MGLStartCapture(GLMContext ctx, const char *path)
+{
+    if (ctx == NULL)
+        ctx = _ctx;
+
+    if (ctx == NULL)
+        return GL_FALSE;
+
+#ifdef MGL_GL_CORE
+    return captureStart(ctx, path);
+#else
+    fprintf(stderr, "MGL WARNING: MGLStartCapture only captures core contexts\n");
+    return GL_FALSE;
+#endif
+}
+
+void MGLStopCapture(GLMContext ctx)
+{
+    if (ctx == NULL)
+        ctx = _ctx;
+
+    if (ctx == NULL)
+        return;
+
+#ifdef MGL_GL_CORE
+    captureStop(ctx);
+#endif
 }
 
 // CRITICAL FIX: Proper context destruction to prevent memory leaks
@@ -336,6 +510,10 @@ void destroyGLMContext(GLMContext ctx)
 
     fprintf(stderr, "MGL INFO: Destroying GLMContext\n");
 
+#ifdef MGL_GL_CORE
+    captureStop(ctx);
+#endif
+
     // CRITICAL FIX: Implement basic cleanup of context resources to prevent major memory leaks
     // Clean up critical hash tables to prevent memory corruption
 
@@ -1067,6 +1067,25 @@ void init_dispatch(GLMContext ctx)
     ctx->dispatch.multi_draw_elements_indirect_count = mglMultiDrawElementsIndirectCount;
     ctx->dispatch.polygon_offset_clamp = mglPolygonOffsetClamp;
 };
+
+void init_no_error_dispatch(GLMContext ctx)
+{
+    ctx->dispatch.draw_arrays = mglDrawArrays_no_error;
+    ctx->dispatch.draw_elements = mglDrawElements_no_error;
+    ctx->dispatch.draw_range_elements = mglDrawRangeElements_no_error;
+    ctx->dispatch.bind_buffer = mglBindBuffer_no_error;
+    ctx->dispatch.buffer_sub_data = mglBufferSubData_no_error;
+    ctx->dispatch.use_program = mglUseProgram_no_error;
+    ctx->dispatch.uniform1f = mglUniform1f_no_error;
+    ctx->dispatch.uniform4f = mglUniform4f_no_error;
+    ctx->dispatch.uniform1i = mglUniform1i_no_error;
+    ctx->dispatch.uniform4fv = mglUniform4fv_no_error;
+    ctx->dispatch.uniform_matrix4fv = mglUniformMatrix4fv_no_error;
+    ctx->dispatch.bind_vertex_array = mglBindVertexArray_no_error;
+    ctx->dispatch.draw_arrays_instanced = mglDrawArraysInstanced_no_error;
+    ctx->dispatch.draw_elements_instanced = mglDrawElementsInstanced_no_error;
+    ctx->dispatch.draw_elements_base_vertex = mglDrawElementsBaseVertex_no_error;
+};
 #endif
 
 #ifdef MGL_GL_ES
@@ -142,7 +142,7 @@ void deleteHashElement(HashTable *table, GLuint name)
             // Shader-specific Metal cleanup
             Shader *shader = (Shader *)obj_data;
             if (shader->mtl_data.function || shader->mtl_data.library) {
-                fprintf(stderr, "MGL: Metal cleanup for shader object %u\n", name);
+                DEBUG_PRINT("Metal cleanup for shader object %u\n", name);
                 // In ARC mode, we just need to set the pointers to nil
                 // The memory will be automatically released
                 shader->mtl_data.function = NULL;
@@ -154,7 +154,7 @@ void deleteHashElement(HashTable *table, GLuint name)
             // Program-specific Metal cleanup
             Program *program = (Program *)obj_data;
             if (program->mtl_data) {
-                fprintf(stderr, "MGL: Metal cleanup for program object %u\n", name);
+                DEBUG_PRINT("Metal cleanup for program object %u\n", name);
                 // In ARC mode, we just need to set the pointer to nil
                 // The memory will be automatically released
                 program->mtl_data = NULL;
@@ -165,7 +165,7 @@ void deleteHashElement(HashTable *table, GLuint name)
             // Texture-specific Metal cleanup
             Texture *texture = (Texture *)obj_data;
             if (texture->mtl_data) {
-                fprintf(stderr, "MGL: Metal cleanup for texture object %u\n", name);
+                DEBUG_PRINT("Metal cleanup for texture object %u\n", name);
                 // In ARC mode, we just need to set the pointer to nil
                 // The memory will be automatically released
                 texture->mtl_data = NULL;
@@ -176,7 +176,7 @@ void deleteHashElement(HashTable *table, GLuint name)
             // Buffer-specific Metal cleanup
             Buffer *buffer = (Buffer *)obj_data;
             if (buffer->data.mtl_data) {
-                fprintf(stderr, "MGL: Metal cleanup for buffer object %u\n", name);
+                DEBUG_PRINT("Metal cleanup for buffer object %u\n", name);
                 // In ARC mode, we just need to set the pointer to nil
                 // The memory will be automatically released
                 buffer->data.mtl_data = NULL;
@@ -184,7 +184,7 @@ void deleteHashElement(HashTable *table, GLuint name)
         }
         else {
             // Generic cleanup for unknown object types
-            fprintf(stderr, "MGL: deleteHashElement called for object %u (Metal cleanup implemented)\n", name);
+            DEBUG_PRINT("deleteHashElement called for object %u\n", name);
         }
     }
 
@@ -0,0 +1,584 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * index_translate.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "index_translate.h"
+#include "simd_utils.h"
+
+#define OUT_RESTART(_type_)     ((_type_) == GL_UNSIGNED_INT ? 0xFFFFFFFFu : 0xFFFFu)
+
+static GLuint typeMax(GLenum type)
+{
+    switch(type)
+    {
+        case GL_UNSIGNED_BYTE: return 0xFF;
+        case GL_UNSIGNED_SHORT: return 0xFFFF;
+    }
+
+    return 0xFFFFFFFF;
+}
+
+static GLboolean isStrip(GLenum mode)
+{
+    return (mode == GL_LINE_STRIP || mode == GL_TRIANGLE_STRIP);
+}
+
+static GLuint listPrimitiveSize(GLenum mode)
+{
+    switch(mode)
+    {
+        case GL_POINTS: return 1;
+        case GL_LINES: return 2;
+        case GL_TRIANGLES: return 3;
+    }
+
+    return 0;
+}
+
+GLboolean indexTranslationNeeded(GLenum mode, GLenum type, GLboolean restart, GLuint restart_index)
+{
+    switch(mode)
+    {
+        case GL_TRIANGLE_FAN:
+        case GL_LINE_LOOP:
+        case GL_LINES_ADJACENCY:
+        case GL_LINE_STRIP_ADJACENCY:
+        case GL_TRIANGLES_ADJACENCY:
+        case GL_TRIANGLE_STRIP_ADJACENCY:
+            return GL_TRUE;
+    }
+
+    // array draws never restart
+    if (type == 0)
+        return GL_FALSE;
+
+    if (type == GL_UNSIGNED_BYTE)
+        return GL_TRUE;
+
+    if (restart == GL_FALSE)
+        return GL_FALSE;
+
+    // metal restarts strips on the all ones index, lists have to be split by hand
+    if (isStrip(mode))
+        return (restart_index != typeMax(type));
+
+    return (listPrimitiveSize(mode) != 0);
+}
+
+static inline GLuint fetchIndex(const IndexSource *src, GLuint i)
+{
+    switch(src->type)
+    {
+        case GL_UNSIGNED_BYTE: return ((const GLubyte *)src->indices)[i];
+        case GL_UNSIGNED_SHORT: return ((const GLushort *)src->indices)[i];
+        case GL_UNSIGNED_INT: return ((const GLuint *)src->indices)[i];
+    }
+
+    return src->first + i;
+}
+
+// dst NULL only counts
+typedef struct IndexWriter_t {
+    void        *dst;
+    GLenum      type;
+    GLuint      count;
+} IndexWriter;
+
+static inline void putIndex(IndexWriter *w, GLuint index)
+{
+    if (w->dst)
+    {
+        if (w->type == GL_UNSIGNED_INT)
+            ((GLuint *)w->dst)[w->count] = index;
+        else
+            ((GLushort *)w->dst)[w->count] = (GLushort)index;
+    }
+
+    w->count++;
+}
+
+// strips from more than one segment are joined with a restart
+static inline void putSeparator(IndexWriter *w)
+{
+    if (w->count)
+    {
+        putIndex(w, OUT_RESTART(w->type));
+    }
+}
+
+static void translateSegment(const IndexSource *src, GLenum mode, GLuint s, GLuint len, IndexWriter *w)
+{
+    GLuint prim_size;
+
+    switch(mode)
+    {
+        case GL_POINTS:
+        case GL_LINES:
+        case GL_TRIANGLES:
+            // a partial primitive at the end of a segment is dropped
+            prim_size = listPrimitiveSize(mode);
+            len -= len % prim_size;
+
+            for(GLuint i=0; i<len; i++)
+                putIndex(w, fetchIndex(src, s + i));
+            break;
+
+        case GL_LINE_LOOP:
+            // the strip plus the closing segment back to the first vertex
+            if (len < 2)
+                break;
+
+            putSeparator(w);
+            for(GLuint i=0; i<len; i++)
+                putIndex(w, fetchIndex(src, s + i));
+            putIndex(w, fetchIndex(src, s));
+            break;
+
+        case GL_TRIANGLE_FAN:
+            for(GLuint i=1; i+1<len; i++)
+            {
+                putIndex(w, fetchIndex(src, s));
+                putIndex(w, fetchIndex(src, s + i));
+                putIndex(w, fetchIndex(src, s + i + 1));
+            }
+            break;
+
+        // no geometry shaders, the adjacent vertices are dropped
+        case GL_LINES_ADJACENCY:
+            for(GLuint i=0; i+4<=len; i+=4)
+            {
+                putIndex(w, fetchIndex(src, s + i + 1));
+                putIndex(w, fetchIndex(src, s + i + 2));
+            }
+            break;
+
+        case GL_LINE_STRIP_ADJACENCY:
+            if (len < 4)
+                break;
+
+            putSeparator(w);
+            for(GLuint i=1; i+1<len; i++)
+                putIndex(w, fetchIndex(src, s + i));
+            break;
+
+        case GL_TRIANGLES_ADJACENCY:
+            for(GLuint i=0; i+6<=len; i+=6)
+            {
+                putIndex(w, fetchIndex(src, s + i));
+                putIndex(w, fetchIndex(src, s + i + 2));
+                putIndex(w, fetchIndex(src, s + i + 4));
+            }
+            break;
+
+        case GL_TRIANGLE_STRIP_ADJACENCY:
+            if (len < 6)
+                break;
+
+            // odd triangles swap the first two to keep the winding
+            for(GLuint i=0; i<(len - 4) / 2; i++)
+            {
+                if (i & 0x1)
+                {
+                    putIndex(w, fetchIndex(src, s + 2*i + 2));
+                    putIndex(w, fetchIndex(src, s + 2*i));
+                }
+                else
+                {
+                    putIndex(w, fetchIndex(src, s + 2*i));
+                    putIndex(w, fetchIndex(src, s + 2*i + 2));
+                }
+                putIndex(w, fetchIndex(src, s + 2*i + 4));
+            }
+            break;
+    }
+}
+
+// indices one segment produces, without the separator in front of it
+static GLuint segmentCount(GLenum mode, GLuint len)
+{
+    switch(mode)
+    {
+        case GL_POINTS:
+        case GL_LINES:
+        case GL_TRIANGLES:
+            return len - len % listPrimitiveSize(mode);
+
+        case GL_LINE_LOOP:
+            return (len < 2) ? 0 : len + 1;
+
+        case GL_TRIANGLE_FAN:
+            return (len < 3) ? 0 : (len - 2) * 3;
+
+        case GL_LINES_ADJACENCY:
+            return (len / 4) * 2;
+
+        case GL_LINE_STRIP_ADJACENCY:
+            return (len < 4) ? 0 : len - 2;
+
+        case GL_TRIANGLES_ADJACENCY:
+            return (len / 6) * 3;
+
+        case GL_TRIANGLE_STRIP_ADJACENCY:
+            return (len < 6) ? 0 : ((len - 4) / 2) * 3;
+    }
+
+    return 0;
+}
+
+static GLboolean usesSeparator(GLenum mode)
+{
+    return (mode == GL_LINE_LOOP || mode == GL_LINE_STRIP_ADJACENCY);
+}
+
+static GLenum translatedMode(GLenum mode)
+{
+    switch(mode)
+    {
+        case GL_LINE_LOOP: return GL_LINE_STRIP;
+        case GL_TRIANGLE_FAN: return GL_TRIANGLES;
+        case GL_LINES_ADJACENCY: return GL_LINES;
+        case GL_LINE_STRIP_ADJACENCY: return GL_LINE_STRIP;
+        case GL_TRIANGLES_ADJACENCY: return GL_TRIANGLES;
+        case GL_TRIANGLE_STRIP_ADJACENCY: return GL_TRIANGLES;
+    }
+
+    return mode;
+}
+
+static inline GLboolean isRestart(const IndexSource *src, GLuint index)
+{
+    return (src->restart && index == src->restart_index);
+}
+
+// strips keep their indices one for one, only the restart value changes, strips from
+// segments are never built here
+static GLboolean isStraightCopy(const IndexSource *src)
+{
+    if (src->type == 0)
+        return GL_FALSE;
+
+    if (isStrip(src->mode))
+        return GL_TRUE;
+
+    return (listPrimitiveSize(src->mode) && src->restart == GL_FALSE);
+}
+
+void indexTranslationPlan(const IndexSource *src, IndexTranslation *out)
+{
+    GLuint count, start, segments;
+
+    out->mode = translatedMode(src->mode);
+
+    if (src->type == GL_UNSIGNED_INT ||
+        (src->type == 0 && (GLuint64)src->first + src->count > 0xFFFF))
+    {
+        out->type = GL_UNSIGNED_INT;
+    }
+    else
+    {
+        out->type = GL_UNSIGNED_SHORT;
+    }
+
+    if (isStraightCopy(src))
+    {
+        out->count = src->count;
+        return;
+    }
+
+    if (src->type == 0 || src->restart == GL_FALSE)
+    {
+        out->count = segmentCount(src->mode, src->count);
+        return;
+    }
+
+    // only the restart positions are needed to size the output
+    count = 0;
+    segments = 0;
+    start = 0;
+
+    for(GLuint i=0; i<=src->count; i++)
+    {
+        GLuint len, n;
+
+        if (i < src->count && isRestart(src, fetchIndex(src, i)) == GL_FALSE)
+            continue;
+
+        len = i - start;
+        start = i + 1;
+
+        n = segmentCount(src->mode, len);
+        if (n == 0)
+            continue;
+
+        count += n;
+        segments++;
+    }
+
+    if (usesSeparator(src->mode) && segments > 1)
+    {
+        count += segments - 1;
+    }
+
+    out->count = count;
+}
+
+static void widenIndices(const GLubyte *src, GLushort *dst, GLuint count, GLboolean restart, GLuint restart_index)
+{
+    const u16x8 from = (u16x8){0} + (GLushort)restart_index;
+    GLuint i;
+
+    i = 0;
+
+    for(; i+16<=count; i+=16)
+    {
+        u8x16 b;
+        u16x16 w;
+        u16x8 lo, hi;
+
+        memcpy(&b, src + i, sizeof(b));
+        w = __builtin_convertvector(b, u16x16);
+        memcpy(&lo, &w, sizeof(lo));
+        memcpy(&hi, (GLushort *)&w + 8, sizeof(hi));
+
+        if (restart)
+        {
+            // compares give all ones lanes, which is the 16 bit restart index
+            lo |= (u16x8)(lo == from);
+            hi |= (u16x8)(hi == from);
+        }
+
+        memcpy(dst + i, &lo, sizeof(lo));
+        memcpy(dst + i + 8, &hi, sizeof(hi));
+    }
+
+    for(; i<count; i++)
+    {
+        dst[i] = (restart && src[i] == restart_index) ? 0xFFFF : src[i];
+    }
+}
+
+static void remapRestart16(const GLushort *src, GLushort *dst, GLuint count, GLushort restart_index)
+{
+    const u16x8 from = (u16x8){0} + restart_index;
+    GLuint i;
+
+    for(i=0; i+8<=count; i+=8)
+    {
+        u16x8 v;
+
+        memcpy(&v, src + i, sizeof(v));
+        v |= (u16x8)(v == from);
+        memcpy(dst + i, &v, sizeof(v));
+    }
+
+    for(; i<count; i++)
+    {
+        dst[i] = (src[i] == restart_index) ? 0xFFFF : src[i];
+    }
+}
+
+static void remapRestart32(const GLuint *src, GLuint *dst, GLuint count, GLuint restart_index)
+{
+    const u32x4 from = (u32x4){0} + restart_index;
+    GLuint i;
+
+    for(i=0; i+4<=count; i+=4)
+    {
+        u32x4 v;
+
+        memcpy(&v, src + i, sizeof(v));
+        v |= (u32x4)(v == from);
+        memcpy(dst + i, &v, sizeof(v));
+    }
+
+    for(; i<count; i++)
+    {
+        dst[i] = (src[i] == restart_index) ? 0xFFFFFFFF : src[i];
+    }
+}
+
+static GLuint copyIndices(const IndexSource *src, void *dst)
+{
+    GLboolean restart;
+
+    // a restart index bigger than the type never matches
+    restart = (src->restart && src->restart_index <= typeMax(src->type));
+
+    switch(src->type)
+    {
+        case GL_UNSIGNED_BYTE:
+            widenIndices(src->indices, dst, src->count, restart, src->restart_index);
+            break;
+
+        case GL_UNSIGNED_SHORT:
+            if (restart)
+                remapRestart16(src->indices, dst, src->count, src->restart_index);
+            else
+                memcpy(dst, src->indices, src->count * sizeof(GLushort));
+            break;
+
+        case GL_UNSIGNED_INT:
+            if (restart)
+                remapRestart32(src->indices, dst, src->count, src->restart_index);
+            else
+                memcpy(dst, src->indices, src->count * sizeof(GLuint));
+            break;
+    }
+
+    return src->count;
+}
+
+GLuint translateIndices(const IndexSource *src, const IndexTranslation *out, void *dst)
+{
+    IndexWriter w;
+    GLuint start;
+
+    if (isStraightCopy(src))
+        return copyIndices(src, dst);
+
+    w.dst = dst;
+    w.type = out->type;
+    w.count = 0;
+
+    if (src->type == 0 || src->restart == GL_FALSE)
+    {
+        translateSegment(src, src->mode, 0, src->count, &w);
+
+        return w.count;
+    }
+
+    start = 0;
+
+    for(GLuint i=0; i<=src->count; i++)
+    {
+        if (i < src->count && isRestart(src, fetchIndex(src, i)) == GL_FALSE)
+            continue;
+
+        translateSegment(src, src->mode, start, i - start, &w);
+        start = i + 1;
+    }
+
+    return w.count;
+}
+
+void initIndexCacheKey(IndexCacheKey *key, const void *source, GLuint generation, GLuint64 offset, const IndexSource *src)
+{
+    // hashBytes and memcmp see the padding
+    memset(key, 0, sizeof(IndexCacheKey));
+
+    key->source = source;
+    key->generation = generation;
+    key->count = src->count;
+    key->offset = offset;
+    key->mode = src->mode;
+    key->type = src->type;
+
+    if (src->restart && src->type)
+    {
+        key->restart = GL_TRUE;
+        key->restart_index = src->restart_index;
+    }
+}
+
+void initIndexCache(IndexCache *cache)
+{
+    memset(cache, 0, sizeof(IndexCache));
+}
+
+static IndexCacheEntry *indexCacheSet(IndexCache *cache, const IndexCacheKey *key)
+{
+    GLuint set;
+
+    set = hashBytes(key, sizeof(IndexCacheKey)) & (INDEX_CACHE_SIZE / INDEX_CACHE_WAYS - 1);
+
+    return &cache->entries[set * INDEX_CACHE_WAYS];
+}
+
+IndexCacheEntry *indexCacheFind(IndexCache *cache, const IndexCacheKey *key)
+{
+    IndexCacheEntry *set;
+
+    set = indexCacheSet(cache, key);
+
+    for(int i=0; i<INDEX_CACHE_WAYS; i++)
+    {
+        if (set[i].data && memcmp(&set[i].key, key, sizeof(IndexCacheKey)) == 0)
+        {
+            set[i].last_used = ++cache->clock;
+            cache->hits++;
+
+            return &set[i];
+        }
+    }
+
+    cache->misses++;
+
+    return NULL;
+}
+
+IndexCacheEntry *indexCacheInsert(IndexCache *cache, const IndexCacheKey *key, const IndexTranslation *result,
+                                  void *data, void (*release)(void *data))
+{
+    IndexCacheEntry *set, *entry;
+
+    set = indexCacheSet(cache, key);
+    entry = &set[0];
+
+    // an empty way, or the one used longest ago
+    for(int i=0; i<INDEX_CACHE_WAYS; i++)
+    {
+        if (set[i].data == NULL)
+        {
+            entry = &set[i];
+            break;
+        }
+
+        if (set[i].last_used < entry->last_used)
+            entry = &set[i];
+    }
+
+    if (entry->data && release)
+    {
+        release(entry->data);
+    }
+
+    entry->key = *key;
+    entry->result = *result;
+    entry->data = data;
+    entry->last_used = ++cache->clock;
+
+    cache->indices_translated += result->count;
+
+    return entry;
+}
+
+void indexCacheClear(IndexCache *cache, void (*release)(void *data))
+{
+    for(int i=0; i<INDEX_CACHE_SIZE; i++)
+    {
+        if (cache->entries[i].data && release)
+        {
+            release(cache->entries[i].data);
+        }
+
+        memset(&cache->entries[i], 0, sizeof(IndexCacheEntry));
+    }
+}
@@ -33,21 +33,6 @@ void mglBeginConditionalRender(GLMContext ctx, GLuint id, GLenum mode)
 	(void)mode;
 }
 
-void mglBeginQuery(GLMContext ctx, GLenum target, GLuint id)
-{
-	// Query - no-op, basic stub
-	(void)target;
-	(void)id;
-}
-
-void mglBeginQueryIndexed(GLMContext ctx, GLenum target, GLuint index, GLuint id)
-{
-	// Indexed query - no-op, basic stub
-	(void)target;
-	(void)index;
-	(void)id;
-}
-
 void mglBeginTransformFeedback(GLMContext ctx, GLenum primitiveMode)
 {
 	if (!STATE(transform_feedback))
@@ -217,15 +202,6 @@ void mglCreateProgramPipelines(GLMContext ctx, GLsizei n, GLuint *pipelines)
 	}
 }
 
-void mglCreateQueries(GLMContext ctx, GLenum target, GLsizei n, GLuint *ids)
-{
-	for (GLsizei i = 0; i < n; i++)
-	{
-		mglGenQueries(ctx, 1, &ids[i]);
-	}
-	(void)target;
-}
-
 GLuint  mglCreateShaderProgramv(GLMContext ctx, GLenum type, GLsizei count, const GLchar *const*strings)
 {
 	GLuint shader = mglCreateShader(ctx, type);
@@ -285,13 +261,6 @@ void mglDebugMessageInsert(GLMContext ctx, GLenum source, GLenum type, GLuint id
 	(void)buf;
 }
 
-void mglDeleteQueries(GLMContext ctx, GLsizei n, const GLuint *ids)
-{
-	// Query deletion - no-op, basic stub
-	(void)n;
-	(void)ids;
-}
-
 void mglDeleteTransformFeedbacks(GLMContext ctx, GLsizei n, const GLuint *ids)
 {
     for (GLsizei i = 0; i < n; i++)
@@ -380,19 +349,6 @@ void mglEndConditionalRender(GLMContext ctx)
 	(void)ctx;
 }
 
-void mglEndQuery(GLMContext ctx, GLenum target)
-{
-	// End query - no-op
-	(void)target;
-}
-
-void mglEndQueryIndexed(GLMContext ctx, GLenum target, GLuint index)
-{
-	// End indexed query - no-op
-	(void)target;
-	(void)index;
-}
-
 void mglEndTransformFeedback(GLMContext ctx)
 {
 	if (!STATE(transform_feedback) || !STATE(transform_feedback)->active)
@@ -405,13 +361,6 @@ void mglEndTransformFeedback(GLMContext ctx)
 	STATE(transform_feedback)->paused = GL_FALSE;
 }
 
-void mglGenQueries(GLMContext ctx, GLsizei n, GLuint *ids)
-{
-	// Generate query IDs - simple sequential IDs
-	for (GLsizei i = 0; i < n; i++)
-		ids[i] = i + 1;
-}
-
 void mglGenTransformFeedbacks(GLMContext ctx, GLsizei n, GLuint *ids)
 {
     for (GLsizei i = 0; i < n; i++)
@@ -616,66 +565,6 @@ void mglGetProgramStageiv(GLMContext ctx, GLuint program, GLenum shadertype, GLe
 	(void)ctx;
 }
 
-void mglGetQueryBufferObjecti64v(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryBufferObjectiv(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryBufferObjectui64v(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryBufferObjectuiv(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryIndexediv(GLMContext ctx, GLenum target, GLuint index, GLenum pname, GLint *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryObjecti64v(GLMContext ctx, GLuint id, GLenum pname, GLint64 *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryObjectiv(GLMContext ctx, GLuint id, GLenum pname, GLint *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryObjectui64v(GLMContext ctx, GLuint id, GLenum pname, GLuint64 *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryObjectuiv(GLMContext ctx, GLuint id, GLenum pname, GLuint *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglGetQueryiv(GLMContext ctx, GLenum target, GLenum pname, GLint *params)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
 void mglGetShaderPrecisionFormat(GLMContext ctx, GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
 {
 	// Return shader precision format - full precision for all types
@@ -829,13 +718,6 @@ void mglGetnUniformuiv(GLMContext ctx, GLuint program, GLint location, GLsizei b
 	(void)ctx;
 }
 
-GLboolean mglIsQuery(GLMContext ctx, GLuint id)
-{
-	// TODO: Implement
-	(void)ctx;
-	return GL_FALSE;
-}
-
 GLboolean mglIsTransformFeedback(GLMContext ctx, GLuint id)
 {
 	TransformFeedback *ptr = findTransformFeedback(ctx, id);
@@ -848,18 +730,6 @@ void mglMinSampleShading(GLMContext ctx, GLfloat value)
 	(void)value;
 }
 
-void mglMultiDrawArraysIndirectCount(GLMContext ctx, GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglMultiDrawElementsIndirectCount(GLMContext ctx, GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
 void mglNormalP3ui(GLMContext ctx, GLenum type, GLuint coords)
 {
 	// TODO: Implement
@@ -923,12 +793,6 @@ void mglPopDebugGroup(GLMContext ctx)
 	// Pop debug group - no-op
 }
 
-void mglPrimitiveRestartIndex(GLMContext ctx, GLuint index)
-{
-	// Set primitive restart index - no-op
-	(void)index;
-}
-
 void mglProgramBinary(GLMContext ctx, GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
 {
 	// TODO: Implement
@@ -1260,12 +1124,6 @@ void mglPushDebugGroup(GLMContext ctx, GLenum source, GLuint id, GLsizei length,
 	(void)message;
 }
 
-void mglQueryCounter(GLMContext ctx, GLuint id, GLenum target)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
 void mglReadnPixels(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
 {
 	// TODO: Implement
@@ -1342,18 +1200,6 @@ void mglSpecializeShader(GLMContext ctx, GLuint shader, const GLchar *pEntryPoin
 	(void)ctx;
 }
 
-void mglTexBuffer(GLMContext ctx, GLenum target, GLenum internalformat, GLuint buffer)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
-void mglTexBufferRange(GLMContext ctx, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
-{
-	// TODO: Implement
-	(void)ctx;
-}
-
 void mglTexStorage2DMultisample(GLMContext ctx, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
     // For multisample textures, we need to create storage but Apple Silicon 
@@ -0,0 +1,940 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mipmaps.c
+ * MGL
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "glm_context.h"
+#include "mipmaps.h"
+#include "pixel_formats.h"
+
+// one texel, all channels in a single simd register
+typedef float   mip_float4 __attribute__((vector_size(16)));
+typedef int64_t mip_long4  __attribute__((vector_size(32)));
+
+// 16 channels of an 8 bit row, widened for the vertical sum
+typedef uint8_t  mip_uchar16  __attribute__((vector_size(16)));
+typedef uint16_t mip_ushort16 __attribute__((vector_size(32)));
+
+enum {
+    _MIP_UNORM8 = 0,
+    _MIP_SNORM8,
+    _MIP_UINT8,
+    _MIP_SINT8,
+    _MIP_UNORM16,
+    _MIP_SNORM16,
+    _MIP_UINT16,
+    _MIP_SINT16,
+    _MIP_UINT32,
+    _MIP_SINT32,
+    _MIP_HALF,
+    _MIP_FLOAT,
+    _MIP_PACKED_565,
+    _MIP_PACKED_4444,
+    _MIP_PACKED_5551,
+    _MIP_PACKED_1010102,
+    _MIP_PACKED_1010102UI,
+    _MIP_PACKED_11_11_10F,
+    _MIP_PACKED_999E5,
+    _MIP_INVALID
+};
+
+typedef struct MipFormat_t {
+    GLuint      kind;
+    GLuint      components;
+    GLboolean   srgb;
+} MipFormat;
+
+static const GLuint mip_kind_size[_MIP_INVALID] = {
+    1, 1, 1, 1,     // 8 bit channels
+    2, 2, 2, 2,     // 16 bit channels
+    4, 4,           // 32 bit integer channels
+    2, 4,           // half, float channels
+    2, 2, 2,        // 16 bit packed
+    4, 4, 4, 4      // 32 bit packed
+};
+
+static GLboolean mipFormatForInternalFormat(GLenum internalformat, MipFormat *fmt)
+{
+    const PixelFormatDesc *desc;
+    GLuint kind, bits;
+
+    fmt->kind = _MIP_INVALID;
+    fmt->components = 0;
+    fmt->srgb = false;
+
+    desc = pixelFormatDesc(internalformat);
+    if (desc == NULL)
+        return false;
+
+    if (desc->flags & (PIXEL_FORMAT_COMPRESSED | PIXEL_FORMAT_DEPTH | PIXEL_FORMAT_STENCIL))
+        return false;
+
+    if (desc->flags & PIXEL_FORMAT_PACKED)
+    {
+        switch(internalformat)
+        {
+            case GL_RGB565: kind = _MIP_PACKED_565; break;
+            case GL_RGBA4: kind = _MIP_PACKED_4444; break;
+            case GL_RGB5_A1: kind = _MIP_PACKED_5551; break;
+            case GL_RGB10_A2: kind = _MIP_PACKED_1010102; break;
+            case GL_RGB10_A2UI: kind = _MIP_PACKED_1010102UI; break;
+            case GL_R11F_G11F_B10F: kind = _MIP_PACKED_11_11_10F; break;
+            case GL_RGB9_E5: kind = _MIP_PACKED_999E5; break;
+            default:
+                return false;
+        }
+    }
+    else
+    {
+        // unsized formats are stored as 8 bit unorm, alpha formats only have alpha bits
+        bits = desc->bits[PIXEL_BITS_RED] ? desc->bits[PIXEL_BITS_RED] : desc->bits[PIXEL_BITS_ALPHA];
+        if (bits == 0)
+            bits = 8;
+
+        switch(desc->flags & (PIXEL_FORMAT_UNORM | PIXEL_FORMAT_SNORM | PIXEL_FORMAT_INTEGER | PIXEL_FORMAT_FLOAT))
+        {
+            case PIXEL_FORMAT_UNORM: kind = (bits == 8 ? _MIP_UNORM8 : bits == 16 ? _MIP_UNORM16 : _MIP_INVALID); break;
+            case PIXEL_FORMAT_SNORM: kind = (bits == 8 ? _MIP_SNORM8 : bits == 16 ? _MIP_SNORM16 : _MIP_INVALID); break;
+            case PIXEL_FORMAT_UINT: kind = (bits == 8 ? _MIP_UINT8 : bits == 16 ? _MIP_UINT16 : _MIP_UINT32); break;
+            case PIXEL_FORMAT_SINT: kind = (bits == 8 ? _MIP_SINT8 : bits == 16 ? _MIP_SINT16 : _MIP_SINT32); break;
+            case PIXEL_FORMAT_FLOAT: kind = (bits == 16 ? _MIP_HALF : _MIP_FLOAT); break;
+            default:
+                return false;
+        }
+
+        if (kind == _MIP_INVALID)
+            return false;
+
+        fmt->srgb = (desc->flags & PIXEL_FORMAT_SRGB) ? true : false;
+    }
+
+    fmt->kind = kind;
+    fmt->components = desc->components;
+
+    return true;
+}
+
+static GLuint mipPixelSize(const MipFormat *fmt)
+{
+    if (fmt->kind >= _MIP_PACKED_565)
+        return mip_kind_size[fmt->kind];
+
+    return mip_kind_size[fmt->kind] * fmt->components;
+}
+
+static GLboolean mipKindIsInteger(GLuint kind)
+{
+    switch(kind)
+    {
+        case _MIP_UINT8:
+        case _MIP_SINT8:
+        case _MIP_UINT16:
+        case _MIP_SINT16:
+        case _MIP_UINT32:
+        case _MIP_SINT32:
+        case _MIP_PACKED_1010102UI:
+            return true;
+    }
+
+    return false;
+}
+
+GLboolean mipmapFormatSupported(GLenum internalformat, size_t pixel_size)
+{
+    MipFormat fmt;
+
+    if (mipFormatForInternalFormat(internalformat, &fmt) == false)
+        return false;
+
+    // the level was stored with a different layout than the format implies
+    return (mipPixelSize(&fmt) == pixel_size);
+}
+
+GLboolean mipmapFormatIsInteger(GLenum internalformat)
+{
+    MipFormat fmt;
+
+    if (mipFormatForInternalFormat(internalformat, &fmt) == false)
+        return false;
+
+    return mipKindIsInteger(fmt.kind);
+}
+
+#pragma mark float conversions
+
+static inline float halfToFloat(uint16_t h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t bits;
+    float f;
+
+    if (exp == 0)
+    {
+        // zero / denormal
+        f = (float)mant * (1.0f / 16777216.0f);
+
+        return sign ? -f : f;
+    }
+
+    if (exp == 31)
+        bits = sign | 0x7f800000 | (mant << 13);
+    else
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+
+    memcpy(&f, &bits, sizeof(f));
+
+    return f;
+}
+
+static inline uint16_t floatToHalf(float f)
+{
+    uint32_t bits;
+    uint32_t sign;
+    int32_t exp;
+    uint32_t mant;
+
+    memcpy(&bits, &f, sizeof(bits));
+
+    sign = (bits >> 16) & 0x8000;
+    exp = (int32_t)((bits >> 23) & 0xff) - 112;
+    mant = bits & 0x7fffff;
+
+    if (exp >= 31)
+    {
+        // inf / nan / overflow
+        if (((bits >> 23) & 0xff) == 0xff && mant)
+            return (uint16_t)(sign | 0x7e00);
+
+        return (uint16_t)(sign | 0x7c00);
+    }
+
+    if (exp <= 0)
+    {
+        // denormal or zero
+        if (exp < -10)
+            return (uint16_t)sign;
+
+        mant |= 0x800000;
+
+        return (uint16_t)(sign | ((mant >> (14 - exp)) + ((mant >> (13 - exp)) & 1)));
+    }
+
+    // round to nearest, carry into the exponent is correct behavior
+    return (uint16_t)((sign | ((uint32_t)exp << 10) | (mant >> 13)) + ((mant >> 12) & 1));
+}
+
+// unsigned 5 bit exponent floats used by R11F_G11F_B10F
+static inline float unpackUFloat(uint32_t v, int mant_bits)
+{
+    uint32_t exp = (v >> mant_bits) & 0x1f;
+    uint32_t mant = v & ((1u << mant_bits) - 1);
+
+    if (exp == 0)
+        return ldexpf((float)mant, -14 - mant_bits);
+
+    if (exp == 31)
+        return mant ? NAN : INFINITY;
+
+    return ldexpf((float)(mant | (1u << mant_bits)), (int)exp - 15 - mant_bits);
+}
+
+static inline uint32_t packUFloat(float f, int mant_bits)
+{
+    uint32_t max_mant = (1u << mant_bits) - 1;
+    int exp;
+    float frac;
+
+    if (!(f > 0.0f))
+        return 0;   // negative and nan clamp to zero
+
+    if (isinf(f))
+        return 31u << mant_bits;
+
+    frac = frexpf(f, &exp);  // f = frac * 2^exp, frac in [0.5, 1)
+    exp += 14;          // biased exponent for 1.m form
+
+    if (exp <= 0)
+    {
+        // denormal
+        uint32_t mant = (uint32_t)lrintf(ldexpf(f, 14 + mant_bits));
+
+        if (mant > max_mant)
+            return 1u << mant_bits;
+
+        return mant;
+    }
+
+    uint32_t mant = (uint32_t)lrintf((frac * 2.0f - 1.0f) * (float)(1u << mant_bits));
+
+    if (mant > max_mant)
+    {
+        mant = 0;
+        exp++;
+    }
+
+    if (exp >= 31)
+        return (30u << mant_bits) | max_mant;
+
+    return ((uint32_t)exp << mant_bits) | mant;
+}
+
+static inline mip_float4 unpackRGB9E5(uint32_t v)
+{
+    float scale = ldexpf(1.0f, (int)(v >> 27) - 15 - 9);
+    mip_float4 r = {(float)(v & 0x1ff), (float)((v >> 9) & 0x1ff), (float)((v >> 18) & 0x1ff), 1.0f};
+
+    r *= (mip_float4){scale, scale, scale, 1.0f};
+
+    return r;
+}
+
+static inline uint32_t packRGB9E5(mip_float4 c)
+{
+    const float max_val = ldexpf(511.0f / 512.0f, 16);
+    float r, g, b, max_c;
+    int exp_shared, exp;
+    uint32_t rm, gm, bm;
+    float denom;
+
+    r = fminf(fmaxf(c[0], 0.0f), max_val);
+    g = fminf(fmaxf(c[1], 0.0f), max_val);
+    b = fminf(fmaxf(c[2], 0.0f), max_val);
+
+    max_c = fmaxf(r, fmaxf(g, b));
+
+    frexpf(max_c, &exp);
+    // frexpf leaves max_c in [0.5, 1) * 2^exp, floor(log2(max_c)) is exp - 1, clamped to -B - 1
+    exp_shared = (exp - 1 < -16 ? -16 : exp - 1) + 1 + 15;
+    if (max_c == 0.0f)
+        exp_shared = 0;
+
+    denom = ldexpf(1.0f, exp_shared - 15 - 9);
+
+    if ((uint32_t)lrintf(max_c / denom) == 512)
+    {
+        denom *= 2.0f;
+        exp_shared++;
+    }
+
+    rm = (uint32_t)lrintf(r / denom);
+    gm = (uint32_t)lrintf(g / denom);
+    bm = (uint32_t)lrintf(b / denom);
+
+    return ((uint32_t)exp_shared << 27) | (bm << 18) | (gm << 9) | rm;
+}
+
+#pragma mark srgb tables
+
+#define SRGB_ENCODE_TABLE_SIZE  16384
+
+static float srgb_decode_table[256];
+static uint8_t srgb_encode_table[SRGB_ENCODE_TABLE_SIZE];
+static pthread_once_t srgb_tables_once = PTHREAD_ONCE_INIT;
+
+static void buildSRGBTables(void)
+{
+    for(int i=0; i<256; i++)
+    {
+        float c = (float)i / 255.0f;
+
+        srgb_decode_table[i] = (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+    }
+
+    for(int i=0; i<SRGB_ENCODE_TABLE_SIZE; i++)
+    {
+        float l = (float)i / (float)(SRGB_ENCODE_TABLE_SIZE - 1);
+        float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * powf(l, 1.0f / 2.4f) - 0.055f;
+
+        srgb_encode_table[i] = (uint8_t)lrintf(fminf(fmaxf(c, 0.0f), 1.0f) * 255.0f);
+    }
+}
+
+// mipmaps can be built from several threads at once
+static void initSRGBTables(void)
+{
+    pthread_once(&srgb_tables_once, buildSRGBTables);
+}
+
+static inline uint8_t linearToSRGB8(float l)
+{
+    l = fminf(fmaxf(l, 0.0f), 1.0f);
+
+    return srgb_encode_table[(int)(l * (float)(SRGB_ENCODE_TABLE_SIZE - 1) + 0.5f)];
+}
+
+#pragma mark row decode / encode
+
+static inline float unorm(uint32_t v, uint32_t max)
+{
+    return (float)v / (float)max;
+}
+
+static inline uint32_t toUnorm(float f, uint32_t max)
+{
+    return (uint32_t)lrintf(fminf(fmaxf(f, 0.0f), 1.0f) * (float)max);
+}
+
+static inline int32_t toSnorm(float f, int32_t max)
+{
+    return (int32_t)lrintf(fminf(fmaxf(f, -1.0f), 1.0f) * (float)max);
+}
+
+static void decodeRowFloat(const MipFormat *fmt, const GLubyte *src, GLuint width, mip_float4 *dst)
+{
+    GLuint n = fmt->components;
+
+    for(GLuint x=0; x<width; x++)
+    {
+        mip_float4 t = {0.0f, 0.0f, 0.0f, 1.0f};
+
+        switch(fmt->kind)
+        {
+            case _MIP_UNORM8:
+            {
+                const uint8_t *p = src + x * n;
+
+                if (fmt->srgb)
+                {
+                    // alpha stays linear
+                    for(GLuint c=0; c<n; c++)
+                        t[c] = (c < 3) ? srgb_decode_table[p[c]] : unorm(p[c], 255);
+                }
+                else
+                {
+                    for(GLuint c=0; c<n; c++)
+                        t[c] = unorm(p[c], 255);
+                }
+                break;
+            }
+
+            case _MIP_SNORM8:
+            {
+                const int8_t *p = (const int8_t *)src + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    t[c] = fmaxf((float)p[c] / 127.0f, -1.0f);
+                break;
+            }
+
+            case _MIP_UNORM16:
+            {
+                const uint16_t *p = (const uint16_t *)src + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    t[c] = unorm(p[c], 65535);
+                break;
+            }
+
+            case _MIP_SNORM16:
+            {
+                const int16_t *p = (const int16_t *)src + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    t[c] = fmaxf((float)p[c] / 32767.0f, -1.0f);
+                break;
+            }
+
+            case _MIP_HALF:
+            {
+                const uint16_t *p = (const uint16_t *)src + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    t[c] = halfToFloat(p[c]);
+                break;
+            }
+
+            case _MIP_FLOAT:
+            {
+                const float *p = (const float *)src + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    t[c] = p[c];
+                break;
+            }
+
+            case _MIP_PACKED_565:
+            {
+                uint16_t v = ((const uint16_t *)src)[x];
+
+                t[0] = unorm(v >> 11, 31);
+                t[1] = unorm((v >> 5) & 0x3f, 63);
+                t[2] = unorm(v & 0x1f, 31);
+                break;
+            }
+
+            case _MIP_PACKED_4444:
+            {
+                uint16_t v = ((const uint16_t *)src)[x];
+
+                t[0] = unorm(v >> 12, 15);
+                t[1] = unorm((v >> 8) & 0xf, 15);
+                t[2] = unorm((v >> 4) & 0xf, 15);
+                t[3] = unorm(v & 0xf, 15);
+                break;
+            }
+
+            case _MIP_PACKED_5551:
+            {
+                uint16_t v = ((const uint16_t *)src)[x];
+
+                t[0] = unorm(v >> 11, 31);
+                t[1] = unorm((v >> 6) & 0x1f, 31);
+                t[2] = unorm((v >> 1) & 0x1f, 31);
+                t[3] = (float)(v & 0x1);
+                break;
+            }
+
+            case _MIP_PACKED_1010102:
+            {
+                uint32_t v = ((const uint32_t *)src)[x];
+
+                t[0] = unorm(v & 0x3ff, 1023);
+                t[1] = unorm((v >> 10) & 0x3ff, 1023);
+                t[2] = unorm((v >> 20) & 0x3ff, 1023);
+                t[3] = unorm(v >> 30, 3);
+                break;
+            }
+
+            case _MIP_PACKED_11_11_10F:
+            {
+                uint32_t v = ((const uint32_t *)src)[x];
+
+                t[0] = unpackUFloat(v & 0x7ff, 6);
+                t[1] = unpackUFloat((v >> 11) & 0x7ff, 6);
+                t[2] = unpackUFloat(v >> 22, 5);
+                break;
+            }
+
+            case _MIP_PACKED_999E5:
+                t = unpackRGB9E5(((const uint32_t *)src)[x]);
+                break;
+        }
+
+        dst[x] = t;
+    }
+}
+
+static void encodeRowFloat(const MipFormat *fmt, const mip_float4 *src, GLuint width, GLubyte *dst)
+{
+    GLuint n = fmt->components;
+
+    for(GLuint x=0; x<width; x++)
+    {
+        mip_float4 t = src[x];
+
+        switch(fmt->kind)
+        {
+            case _MIP_UNORM8:
+            {
+                uint8_t *p = dst + x * n;
+
+                if (fmt->srgb)
+                {
+                    for(GLuint c=0; c<n; c++)
+                        p[c] = (c < 3) ? linearToSRGB8(t[c]) : (uint8_t)toUnorm(t[c], 255);
+                }
+                else
+                {
+                    for(GLuint c=0; c<n; c++)
+                        p[c] = (uint8_t)toUnorm(t[c], 255);
+                }
+                break;
+            }
+
+            case _MIP_SNORM8:
+            {
+                int8_t *p = (int8_t *)dst + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    p[c] = (int8_t)toSnorm(t[c], 127);
+                break;
+            }
+
+            case _MIP_UNORM16:
+            {
+                uint16_t *p = (uint16_t *)dst + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    p[c] = (uint16_t)toUnorm(t[c], 65535);
+                break;
+            }
+
+            case _MIP_SNORM16:
+            {
+                int16_t *p = (int16_t *)dst + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    p[c] = (int16_t)toSnorm(t[c], 32767);
+                break;
+            }
+
+            case _MIP_HALF:
+            {
+                uint16_t *p = (uint16_t *)dst + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    p[c] = floatToHalf(t[c]);
+                break;
+            }
+
+            case _MIP_FLOAT:
+            {
+                float *p = (float *)dst + x * n;
+
+                for(GLuint c=0; c<n; c++)
+                    p[c] = t[c];
+                break;
+            }
+
+            case _MIP_PACKED_565:
+                ((uint16_t *)dst)[x] = (uint16_t)((toUnorm(t[0], 31) << 11) |
+                                                  (toUnorm(t[1], 63) << 5) |
+                                                  toUnorm(t[2], 31));
+                break;
+
+            case _MIP_PACKED_4444:
+                ((uint16_t *)dst)[x] = (uint16_t)((toUnorm(t[0], 15) << 12) |
+                                                  (toUnorm(t[1], 15) << 8) |
+                                                  (toUnorm(t[2], 15) << 4) |
+                                                  toUnorm(t[3], 15));
+                break;
+
+            case _MIP_PACKED_5551:
+                ((uint16_t *)dst)[x] = (uint16_t)((toUnorm(t[0], 31) << 11) |
+                                                  (toUnorm(t[1], 31) << 6) |
+                                                  (toUnorm(t[2], 31) << 1) |
+                                                  toUnorm(t[3], 1));
+                break;
+
+            case _MIP_PACKED_1010102:
+                ((uint32_t *)dst)[x] = toUnorm(t[0], 1023) |
+                                       (toUnorm(t[1], 1023) << 10) |
+                                       (toUnorm(t[2], 1023) << 20) |
+                                       (toUnorm(t[3], 3) << 30);
+                break;
+
+            case _MIP_PACKED_11_11_10F:
+                ((uint32_t *)dst)[x] = packUFloat(t[0], 6) |
+                                       (packUFloat(t[1], 6) << 11) |
+                                       (packUFloat(t[2], 5) << 22);
+                break;
+
+            case _MIP_PACKED_999E5:
+                ((uint32_t *)dst)[x] = packRGB9E5(t);
+                break;
+        }
+    }
+}
+
+static void decodeRowInt(const MipFormat *fmt, const GLubyte *src, GLuint width, mip_long4 *dst)
+{
+    GLuint n = fmt->components;
+
+    for(GLuint x=0; x<width; x++)
+    {
+        mip_long4 t = {0, 0, 0, 0};
+
+        switch(fmt->kind)
+        {
+            case _MIP_UINT8:
+                for(GLuint c=0; c<n; c++) t[c] = ((const uint8_t *)src)[x * n + c];
+                break;
+
+            case _MIP_SINT8:
+                for(GLuint c=0; c<n; c++) t[c] = ((const int8_t *)src)[x * n + c];
+                break;
+
+            case _MIP_UINT16:
+                for(GLuint c=0; c<n; c++) t[c] = ((const uint16_t *)src)[x * n + c];
+                break;
+
+            case _MIP_SINT16:
+                for(GLuint c=0; c<n; c++) t[c] = ((const int16_t *)src)[x * n + c];
+                break;
+
+            case _MIP_UINT32:
+                for(GLuint c=0; c<n; c++) t[c] = ((const uint32_t *)src)[x * n + c];
+                break;
+
+            case _MIP_SINT32:
+                for(GLuint c=0; c<n; c++) t[c] = ((const int32_t *)src)[x * n + c];
+                break;
+
+            case _MIP_PACKED_1010102UI:
+            {
+                uint32_t v = ((const uint32_t *)src)[x];
+
+                t[0] = v & 0x3ff;
+                t[1] = (v >> 10) & 0x3ff;
+                t[2] = (v >> 20) & 0x3ff;
+                t[3] = v >> 30;
+                break;
+            }
+        }
+
+        dst[x] = t;
+    }
+}
+
+static void encodeRowInt(const MipFormat *fmt, const mip_long4 *src, GLuint width, GLubyte *dst)
+{
+    GLuint n = fmt->components;
+
+    for(GLuint x=0; x<width; x++)
+    {
+        mip_long4 t = src[x];
+
+        switch(fmt->kind)
+        {
+            case _MIP_UINT8:
+                for(GLuint c=0; c<n; c++) ((uint8_t *)dst)[x * n + c] = (uint8_t)t[c];
+                break;
+
+            case _MIP_SINT8:
+                for(GLuint c=0; c<n; c++) ((int8_t *)dst)[x * n + c] = (int8_t)t[c];
+                break;
+
+            case _MIP_UINT16:
+                for(GLuint c=0; c<n; c++) ((uint16_t *)dst)[x * n + c] = (uint16_t)t[c];
+                break;
+
+            case _MIP_SINT16:
+                for(GLuint c=0; c<n; c++) ((int16_t *)dst)[x * n + c] = (int16_t)t[c];
+                break;
+
+            case _MIP_UINT32:
+                for(GLuint c=0; c<n; c++) ((uint32_t *)dst)[x * n + c] = (uint32_t)t[c];
+                break;
+
+            case _MIP_SINT32:
+                for(GLuint c=0; c<n; c++) ((int32_t *)dst)[x * n + c] = (int32_t)t[c];
+                break;
+
+            case _MIP_PACKED_1010102UI:
+                ((uint32_t *)dst)[x] = (uint32_t)(t[0] | (t[1] << 10) | (t[2] << 20) | (t[3] << 30));
+                break;
+        }
+    }
+}
+
+#pragma mark filter kernels
+
+// 8 bit unorm / uint 2D fast path, vertical sum is done 16 channels at a time
+static void downsampleRowBytes(const GLubyte *r0, const GLubyte *r1, GLuint src_width, GLuint dst_width, GLuint pixel_size, uint16_t *scratch, GLubyte *dst)
+{
+    size_t row_bytes = (size_t)src_width * pixel_size;
+    size_t i = 0;
+
+    for(; i + 16 <= row_bytes; i += 16)
+    {
+        mip_uchar16 a, b;
+        mip_ushort16 sum;
+
+        memcpy(&a, r0 + i, sizeof(a));
+        memcpy(&b, r1 + i, sizeof(b));
+
+        sum = __builtin_convertvector(a, mip_ushort16) + __builtin_convertvector(b, mip_ushort16);
+
+        memcpy(scratch + i, &sum, sizeof(sum));
+    }
+
+    for(; i < row_bytes; i++)
+    {
+        scratch[i] = (uint16_t)r0[i] + (uint16_t)r1[i];
+    }
+
+    for(GLuint x=0; x<dst_width; x++)
+    {
+        GLuint x0 = 2 * x;
+        GLuint x1 = (x0 + 1 < src_width) ? x0 + 1 : x0;
+        const uint16_t *a = scratch + x0 * pixel_size;
+        const uint16_t *b = scratch + x1 * pixel_size;
+
+        for(GLuint c=0; c<pixel_size; c++)
+        {
+            dst[x * pixel_size + c] = (GLubyte)((a[c] + b[c] + 2) >> 2);
+        }
+    }
+}
+
+static void downsampleRowsFloat(mip_float4 **rows, GLuint num_rows, GLuint src_width, GLuint dst_width, mip_float4 *dst)
+{
+    float s = 1.0f / (float)(num_rows * 2);
+    mip_float4 scale = {s, s, s, s};
+
+    for(GLuint x=0; x<dst_width; x++)
+    {
+        GLuint x0 = 2 * x;
+        GLuint x1 = (x0 + 1 < src_width) ? x0 + 1 : x0;
+        mip_float4 acc = rows[0][x0] + rows[0][x1];
+
+        for(GLuint r=1; r<num_rows; r++)
+        {
+            acc += rows[r][x0] + rows[r][x1];
+        }
+
+        dst[x] = acc * scale;
+    }
+}
+
+static void downsampleRowsInt(mip_long4 **rows, GLuint num_rows, GLuint src_width, GLuint dst_width, mip_long4 *dst)
+{
+    int64_t n = num_rows * 2;
+    mip_long4 bias = {n / 2, n / 2, n / 2, n / 2};
+
+    for(GLuint x=0; x<dst_width; x++)
+    {
+        GLuint x0 = 2 * x;
+        GLuint x1 = (x0 + 1 < src_width) ? x0 + 1 : x0;
+        mip_long4 acc = rows[0][x0] + rows[0][x1];
+
+        for(GLuint r=1; r<num_rows; r++)
+        {
+            acc += rows[r][x0] + rows[r][x1];
+        }
+
+        dst[x] = (acc + bias) / n;
+    }
+}
+
+GLboolean generateMipmapLevel(GLenum internalformat, GLboolean filter_y, GLboolean filter_z, const TextureLevel *src, TextureLevel *dst)
+{
+    MipFormat fmt;
+    GLuint pixel_size;
+    size_t src_image_size, dst_image_size;
+    GLuint num_rows;
+
+    if (mipFormatForInternalFormat(internalformat, &fmt) == false)
+        return false;
+
+    pixel_size = mipPixelSize(&fmt);
+
+    if (src->data == 0 || dst->data == 0)
+        return false;
+
+    if (src->pitch < (size_t)src->width * pixel_size || dst->pitch < (size_t)dst->width * pixel_size)
+        return false;
+
+    src_image_size = src->pitch * src->height;
+    dst_image_size = dst->pitch * dst->height;
+
+    num_rows = (filter_y ? 2 : 1) * (filter_z ? 2 : 1);
+
+    if ((fmt.kind == _MIP_UNORM8 || fmt.kind == _MIP_UINT8) && fmt.srgb == false && num_rows == 2 && filter_y)
+    {
+        uint16_t *scratch;
+
+        scratch = (uint16_t *)malloc((size_t)src->width * pixel_size * sizeof(uint16_t));
+        if (scratch == NULL)
+            return false;
+
+        for(GLuint z=0; z<dst->depth; z++)
+        {
+            const GLubyte *src_image = (const GLubyte *)src->data + z * src_image_size;
+            GLubyte *dst_image = (GLubyte *)dst->data + z * dst_image_size;
+
+            for(GLuint y=0; y<dst->height; y++)
+            {
+                GLuint y0 = 2 * y;
+                GLuint y1 = (y0 + 1 < src->height) ? y0 + 1 : y0;
+
+                downsampleRowBytes(src_image + y0 * src->pitch, src_image + y1 * src->pitch,
+                                   src->width, dst->width, pixel_size, scratch,
+                                   dst_image + y * dst->pitch);
+            }
+        }
+
+        free(scratch);
+
+        return true;
+    }
+
+    GLboolean is_integer = mipKindIsInteger(fmt.kind);
+    size_t texel_size = is_integer ? sizeof(mip_long4) : sizeof(mip_float4);
+    GLubyte *scratch;
+
+    // num_rows decoded source rows plus one filtered destination row
+    scratch = (GLubyte *)malloc(texel_size * ((size_t)src->width * num_rows + dst->width));
+    if (scratch == NULL)
+        return false;
+
+    if (fmt.srgb)
+        initSRGBTables();
+
+    for(GLuint z=0; z<dst->depth; z++)
+    {
+        GLuint zs[2];
+
+        zs[0] = filter_z ? 2 * z : z;
+        zs[1] = (filter_z && zs[0] + 1 < src->depth) ? zs[0] + 1 : zs[0];
+
+        for(GLuint y=0; y<dst->height; y++)
+        {
+            GLuint ys[2];
+            void *rows[4];
+            GLuint r = 0;
+
+            ys[0] = filter_y ? 2 * y : y;
+            ys[1] = (filter_y && ys[0] + 1 < src->height) ? ys[0] + 1 : ys[0];
+
+            for(GLuint iz=0; iz<(filter_z ? 2 : 1); iz++)
+            {
+                for(GLuint iy=0; iy<(filter_y ? 2 : 1); iy++)
+                {
+                    const GLubyte *row;
+
+                    row = (const GLubyte *)src->data + zs[iz] * src_image_size + ys[iy] * src->pitch;
+                    rows[r] = scratch + texel_size * src->width * r;
+
+                    if (is_integer)
+                        decodeRowInt(&fmt, row, src->width, (mip_long4 *)rows[r]);
+                    else
+                        decodeRowFloat(&fmt, row, src->width, (mip_float4 *)rows[r]);
+
+                    r++;
+                }
+            }
+
+            void *filtered = scratch + texel_size * src->width * num_rows;
+            GLubyte *dst_row = (GLubyte *)dst->data + z * dst_image_size + y * dst->pitch;
+
+            if (is_integer)
+            {
+                downsampleRowsInt((mip_long4 **)rows, num_rows, src->width, dst->width, (mip_long4 *)filtered);
+                encodeRowInt(&fmt, (mip_long4 *)filtered, dst->width, dst_row);
+            }
+            else
+            {
+                downsampleRowsFloat((mip_float4 **)rows, num_rows, src->width, dst->width, (mip_float4 *)filtered);
+                encodeRowFloat(&fmt, (mip_float4 *)filtered, dst->width, dst_row);
+            }
+        }
+    }
+
+    free(scratch);
+
+    return true;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mipmaps.h
+ * MGL
+ *
+ */
+
+#ifndef mipmaps_h
+#define mipmaps_h
+
+#include "glcorearb.h"
+#include "glm_context.h"
+
+// textures at or below this many texels per face are filtered on the cpu,
+// building the chain is cheaper than breaking the render encoder for a blit
+#define MIPMAP_CPU_MAX_TEXELS   (256 * 256)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// true if the cpu kernels understand internalformat stored at pixel_size bytes per texel
+GLboolean mipmapFormatSupported(GLenum internalformat, size_t pixel_size);
+
+// integer formats can't be filtered by the metal blit encoder
+GLboolean mipmapFormatIsInteger(GLenum internalformat);
+
+// 2x2(x2) box filter src into dst, dst width / height / depth / pitch / data must be set
+// filter_y is false for 1D arrays, filter_z is false for everything but 3D textures
+GLboolean generateMipmapLevel(GLenum internalformat, GLboolean filter_y, GLboolean filter_z, const TextureLevel *src, TextureLevel *dst);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* mipmaps_h */
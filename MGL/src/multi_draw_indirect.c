@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * multi_draw_indirect.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "multi_draw_indirect.h"
+
+GLuint multiDrawIndirectCommandSize(GLenum type)
+{
+    // count, instanceCount, first, [baseVertex,] baseInstance
+    return type ? 5 * sizeof(GLuint) : 4 * sizeof(GLuint);
+}
+
+void initMultiDrawIndirect(MultiDrawIndirect *mdi, GLenum mode, GLenum type, GLuint64 offset,
+                           GLuint drawcount, GLuint stride)
+{
+    memset(mdi, 0, sizeof(MultiDrawIndirect));
+
+    mdi->mode = mode;
+    mdi->type = type;
+    mdi->offset = offset;
+    mdi->stride = stride ? stride : multiDrawIndirectCommandSize(type);
+    mdi->drawcount = drawcount;
+    mdi->count_offset = MDI_NO_COUNT_BUFFER;
+}
+
+void multiDrawIndirectSetCountBuffer(MultiDrawIndirect *mdi, GLuint64 offset)
+{
+    mdi->count_offset = offset;
+}
+
+GLuint64 multiDrawIndirectCommandOffset(const MultiDrawIndirect *mdi, GLuint i)
+{
+    return mdi->offset + (GLuint64)i * mdi->stride;
+}
+
+GLuint64 multiDrawIndirectEnd(const MultiDrawIndirect *mdi)
+{
+    if (mdi->drawcount == 0)
+        return mdi->offset;
+
+    // the last command is read whole, the stride past it isn't
+    return multiDrawIndirectCommandOffset(mdi, mdi->drawcount - 1) + multiDrawIndirectCommandSize(mdi->type);
+}
+
+GLuint multiDrawIndirectCount(const MultiDrawIndirect *mdi, const void *count_data)
+{
+    GLuint count;
+
+    if (mdi->count_offset == MDI_NO_COUNT_BUFFER)
+        return mdi->drawcount;
+
+    memcpy(&count, (const char *)count_data + mdi->count_offset, sizeof(count));
+
+    return count < mdi->drawcount ? count : mdi->drawcount;
+}
+
+GLboolean multiDrawIndirectParams(const MultiDrawIndirect *mdi, GLuint primitive, MultiDrawIndirectParams *params)
+{
+    if (multiDrawIndirectEnd(mdi) > 0xFFFFFFFF)
+        return GL_FALSE;
+
+    if (mdi->count_offset != MDI_NO_COUNT_BUFFER && mdi->count_offset >= 0xFFFFFFFF)
+        return GL_FALSE;
+
+    memset(params, 0, sizeof(MultiDrawIndirectParams));
+
+    params->command_offset = (GLuint)mdi->offset;
+    params->stride = mdi->stride;
+    params->max_count = mdi->drawcount;
+    params->count_offset = (GLuint)mdi->count_offset;
+    params->primitive = primitive;
+
+    return GL_TRUE;
+}
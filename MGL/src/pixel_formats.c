@@ -0,0 +1,411 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * pixel_formats.c
+ * MGL
+ *
+ */
+
+#include <stdint.h>
+#include <assert.h>
+
+#include "pixel_utils.h"
+#include "pixel_formats.h"
+
+// Legacy format defines not in core profile headers
+#ifndef GL_LUMINANCE
+#define GL_LUMINANCE                      0x1909
+#endif
+#ifndef GL_LUMINANCE_ALPHA
+#define GL_LUMINANCE_ALPHA                0x190A
+#endif
+#ifndef GL_ALPHA8
+#define GL_ALPHA8                         0x803C
+#endif
+#ifndef GL_ALPHA16
+#define GL_ALPHA16                        0x803E
+#endif
+#ifndef GL_LUMINANCE8
+#define GL_LUMINANCE8                     0x8040
+#endif
+#ifndef GL_LUMINANCE16
+#define GL_LUMINANCE16                    0x8042
+#endif
+#ifndef GL_LUMINANCE8_ALPHA8
+#define GL_LUMINANCE8_ALPHA8              0x8045
+#endif
+#ifndef GL_LUMINANCE16_ALPHA16
+#define GL_LUMINANCE16_ALPHA16            0x8048
+#endif
+#ifndef GL_ALPHA32F_ARB
+#define GL_ALPHA32F_ARB                   0x8816
+#endif
+#ifndef GL_LUMINANCE32F_ARB
+#define GL_LUMINANCE32F_ARB               0x8818
+#endif
+#ifndef GL_LUMINANCE_ALPHA32F_ARB
+#define GL_LUMINANCE_ALPHA32F_ARB         0x8819
+#endif
+#ifndef GL_ALPHA16F_ARB
+#define GL_ALPHA16F_ARB                   0x881C
+#endif
+#ifndef GL_LUMINANCE16F_ARB
+#define GL_LUMINANCE16F_ARB               0x881E
+#endif
+#ifndef GL_LUMINANCE_ALPHA16F_ARB
+#define GL_LUMINANCE_ALPHA16F_ARB         0x881F
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT        0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT  0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT  0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT  0x8C4F
+#endif
+#ifndef GL_ALPHA32UI_EXT
+#define GL_ALPHA32UI_EXT                  0x8D72
+#define GL_LUMINANCE32UI_EXT              0x8D74
+#define GL_LUMINANCE_ALPHA32UI_EXT        0x8D75
+#define GL_ALPHA16UI_EXT                  0x8D78
+#define GL_LUMINANCE16UI_EXT              0x8D7A
+#define GL_LUMINANCE_ALPHA16UI_EXT        0x8D7B
+#define GL_ALPHA8UI_EXT                   0x8D7E
+#define GL_LUMINANCE8UI_EXT               0x8D80
+#define GL_LUMINANCE_ALPHA8UI_EXT         0x8D81
+#define GL_ALPHA32I_EXT                   0x8D84
+#define GL_LUMINANCE32I_EXT               0x8D86
+#define GL_LUMINANCE_ALPHA32I_EXT         0x8D87
+#define GL_ALPHA16I_EXT                   0x8D8A
+#define GL_LUMINANCE16I_EXT               0x8D8C
+#define GL_LUMINANCE_ALPHA16I_EXT         0x8D8D
+#define GL_ALPHA8I_EXT                    0x8D90
+#define GL_LUMINANCE8I_EXT                0x8D92
+#define GL_LUMINANCE_ALPHA8I_EXT          0x8D93
+#endif
+#ifndef GL_ALPHA8_SNORM
+#define GL_ALPHA8_SNORM                   0x9014
+#define GL_LUMINANCE8_SNORM               0x9015
+#define GL_LUMINANCE8_ALPHA8_SNORM        0x9016
+#define GL_ALPHA16_SNORM                  0x9018
+#define GL_LUMINANCE16_SNORM              0x9019
+#define GL_LUMINANCE16_ALPHA16_SNORM      0x901A
+#endif
+#ifndef GL_SR8_EXT
+#define GL_SR8_EXT                        0x8FBD
+#endif
+#ifndef GL_SRG8_EXT
+#define GL_SRG8_EXT                       0x8FBE
+#endif
+
+#define FMT_COMPONENTS(_base_) \
+    ((_base_) == GL_RGBA ? 4 : (_base_) == GL_RGB ? 3 : \
+     ((_base_) == GL_RG || (_base_) == GL_LUMINANCE_ALPHA || (_base_) == GL_DEPTH_STENCIL) ? 2 : 1)
+
+// sized / unsized formats, bits are red green blue alpha depth stencil
+#define FMT(_fmt_, _base_, _size_, _r_, _g_, _b_, _a_, _d_, _s_, _flags_, _mtl_) \
+    {_fmt_, _base_, _size_, FMT_COMPONENTS(_base_), {_r_, _g_, _b_, _a_, _d_, _s_}, \
+     (_flags_) | ((_size_) ? PIXEL_FORMAT_SIZED : 0), 0, 0, 0, _mtl_}
+
+// block compressed formats
+#define CFMT(_fmt_, _base_, _bw_, _bh_, _bsize_, _flags_, _mtl_) \
+    {_fmt_, _base_, 0, FMT_COMPONENTS(_base_), {0, 0, 0, 0, 0, 0}, \
+     (_flags_) | PIXEL_FORMAT_COMPRESSED | PIXEL_FORMAT_SIZED, _bw_, _bh_, _bsize_, _mtl_}
+
+#define UNORM       PIXEL_FORMAT_UNORM
+#define SNORM       PIXEL_FORMAT_SNORM
+#define UINT        PIXEL_FORMAT_UINT
+#define SINT        PIXEL_FORMAT_SINT
+#define FLOAT       PIXEL_FORMAT_FLOAT
+#define SRGB        PIXEL_FORMAT_SRGB
+#define PACKED      PIXEL_FORMAT_PACKED
+#define DEPTH       PIXEL_FORMAT_DEPTH
+#define STENCIL     PIXEL_FORMAT_STENCIL
+#define MACOS11     PIXEL_FORMAT_MACOS11
+
+// the metal enum carries availability, use of macOS 11 formats is gated on PIXEL_FORMAT_MACOS11
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunguarded-availability"
+#pragma clang diagnostic ignored "-Wunguarded-availability-new"
+
+const PixelFormatDesc pixel_format_table[] = {
+    // id 0, unknown format
+    {0, 0, 0, 0, {0, 0, 0, 0, 0, 0}, 0, 0, 0, 0, MTLPixelFormatInvalid},
+
+    // unsized, the size comes from the client format / type
+    FMT(GL_RED,                 GL_RED,             0, 0, 0, 0, 0, 0, 0, UNORM, MTLPixelFormatR8Unorm),
+    FMT(GL_RG,                  GL_RG,              0, 0, 0, 0, 0, 0, 0, UNORM, MTLPixelFormatRG8Unorm),
+    FMT(GL_RGB,                 GL_RGB,             0, 0, 0, 0, 0, 0, 0, UNORM, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGBA,                GL_RGBA,            0, 0, 0, 0, 0, 0, 0, UNORM, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_SRGB,                GL_RGB,             0, 0, 0, 0, 0, 0, 0, UNORM | SRGB, MTLPixelFormatRGBA8Unorm_sRGB),
+    FMT(GL_SRGB_ALPHA,          GL_RGBA,            0, 0, 0, 0, 0, 0, 0, UNORM | SRGB, MTLPixelFormatRGBA8Unorm_sRGB),
+    FMT(GL_DEPTH_COMPONENT,     GL_DEPTH_COMPONENT, 0, 0, 0, 0, 0, 0, 0, FLOAT | DEPTH, MTLPixelFormatDepth32Float),
+    FMT(GL_DEPTH_STENCIL,       GL_DEPTH_STENCIL,   0, 0, 0, 0, 0, 0, 0, FLOAT | DEPTH | STENCIL, MTLPixelFormatDepth32Float_Stencil8),
+    FMT(GL_STENCIL_INDEX,       GL_STENCIL_INDEX,   0, 0, 0, 0, 0, 0, 0, UINT | STENCIL, MTLPixelFormatStencil8),
+
+    // normalized, metal has no 3 component formats so rgb is stored as rgba
+    FMT(GL_R8,                  GL_RED,     1,  8,  0,  0,  0, 0, 0, UNORM, MTLPixelFormatR8Unorm),
+    FMT(GL_RG8,                 GL_RG,      2,  8,  8,  0,  0, 0, 0, UNORM, MTLPixelFormatRG8Unorm),
+    FMT(GL_RGB8,                GL_RGB,     3,  8,  8,  8,  0, 0, 0, UNORM, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGBA8,               GL_RGBA,    4,  8,  8,  8,  8, 0, 0, UNORM, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_R16,                 GL_RED,     2, 16,  0,  0,  0, 0, 0, UNORM, MTLPixelFormatR16Unorm),
+    FMT(GL_RG16,                GL_RG,      4, 16, 16,  0,  0, 0, 0, UNORM, MTLPixelFormatRG16Unorm),
+    FMT(GL_RGB16,               GL_RGB,     6, 16, 16, 16,  0, 0, 0, UNORM, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGBA16,              GL_RGBA,    8, 16, 16, 16, 16, 0, 0, UNORM, MTLPixelFormatRGBA16Unorm),
+    FMT(GL_R8_SNORM,            GL_RED,     1,  8,  0,  0,  0, 0, 0, SNORM, MTLPixelFormatR8Snorm),
+    FMT(GL_RG8_SNORM,           GL_RG,      2,  8,  8,  0,  0, 0, 0, SNORM, MTLPixelFormatRG8Snorm),
+    FMT(GL_RGB8_SNORM,          GL_RGB,     3,  8,  8,  8,  0, 0, 0, SNORM, MTLPixelFormatRGBA8Snorm),
+    FMT(GL_RGBA8_SNORM,         GL_RGBA,    4,  8,  8,  8,  8, 0, 0, SNORM, MTLPixelFormatRGBA8Snorm),
+    FMT(GL_R16_SNORM,           GL_RED,     2, 16,  0,  0,  0, 0, 0, SNORM, MTLPixelFormatR16Snorm),
+    FMT(GL_RG16_SNORM,          GL_RG,      4, 16, 16,  0,  0, 0, 0, SNORM, MTLPixelFormatRG16Snorm),
+    FMT(GL_RGB16_SNORM,         GL_RGB,     6, 16, 16, 16,  0, 0, 0, SNORM, MTLPixelFormatRGBA16Snorm),
+    FMT(GL_RGBA16_SNORM,        GL_RGBA,    8, 16, 16, 16, 16, 0, 0, SNORM, MTLPixelFormatRGBA16Snorm),
+    FMT(GL_SR8_EXT,             GL_RED,     1,  8,  0,  0,  0, 0, 0, UNORM | SRGB, MTLPixelFormatR8Unorm_sRGB),
+    FMT(GL_SRG8_EXT,            GL_RG,      2,  8,  8,  0,  0, 0, 0, UNORM | SRGB, MTLPixelFormatRG8Unorm_sRGB),
+    FMT(GL_SRGB8,               GL_RGB,     3,  8,  8,  8,  0, 0, 0, UNORM | SRGB, MTLPixelFormatRGBA8Unorm_sRGB),
+    FMT(GL_SRGB8_ALPHA8,        GL_RGBA,    4,  8,  8,  8,  8, 0, 0, UNORM | SRGB, MTLPixelFormatRGBA8Unorm_sRGB),
+
+    // packed and legacy precisions, upconverted where metal has no match
+    FMT(GL_R3_G3_B2,            GL_RGB,     1,  3,  3,  2,  0, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGB4,                GL_RGB,     2,  4,  4,  4,  0, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGB5,                GL_RGB,     2,  5,  5,  5,  0, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGB565,              GL_RGB,     2,  5,  6,  5,  0, 0, 0, UNORM | PACKED, MTLPixelFormatB5G6R5Unorm),
+    FMT(GL_RGB10,               GL_RGB,     4, 10, 10, 10,  0, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGB12,               GL_RGB,     6, 12, 12, 12,  0, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGBA2,               GL_RGBA,    1,  2,  2,  2,  2, 0, 0, UNORM | PACKED, MTLPixelFormatRGBA8Unorm),
+    FMT(GL_RGBA4,               GL_RGBA,    2,  4,  4,  4,  4, 0, 0, UNORM | PACKED, MTLPixelFormatABGR4Unorm),
+    FMT(GL_RGB5_A1,             GL_RGBA,    2,  5,  5,  5,  1, 0, 0, UNORM | PACKED, MTLPixelFormatBGR5A1Unorm),
+    FMT(GL_RGB10_A2,            GL_RGBA,    4, 10, 10, 10,  2, 0, 0, UNORM | PACKED, MTLPixelFormatRGB10A2Unorm),
+    FMT(GL_RGB10_A2UI,          GL_RGBA,    4, 10, 10, 10,  2, 0, 0, UINT | PACKED, MTLPixelFormatRGB10A2Uint),
+    FMT(GL_RGBA12,              GL_RGBA,    8, 12, 12, 12, 12, 0, 0, UNORM | PACKED, MTLPixelFormatInvalid),
+    FMT(GL_R11F_G11F_B10F,      GL_RGB,     4, 11, 11, 10,  0, 0, 0, FLOAT | PACKED, MTLPixelFormatRG11B10Float),
+    FMT(GL_RGB9_E5,             GL_RGB,     4,  9,  9,  9,  0, 0, 0, FLOAT | PACKED, MTLPixelFormatRGB9E5Float),
+
+    // float
+    FMT(GL_R16F,                GL_RED,     2, 16,  0,  0,  0, 0, 0, FLOAT, MTLPixelFormatR16Float),
+    FMT(GL_RG16F,               GL_RG,      4, 16, 16,  0,  0, 0, 0, FLOAT, MTLPixelFormatRG16Float),
+    FMT(GL_RGB16F,              GL_RGB,     6, 16, 16, 16,  0, 0, 0, FLOAT, MTLPixelFormatRGBA16Float),
+    FMT(GL_RGBA16F,             GL_RGBA,    8, 16, 16, 16, 16, 0, 0, FLOAT, MTLPixelFormatRGBA16Float),
+    FMT(GL_R32F,                GL_RED,     4, 32,  0,  0,  0, 0, 0, FLOAT, MTLPixelFormatR32Float),
+    FMT(GL_RG32F,               GL_RG,      8, 32, 32,  0,  0, 0, 0, FLOAT, MTLPixelFormatRG32Float),
+    FMT(GL_RGB32F,              GL_RGB,    12, 32, 32, 32,  0, 0, 0, FLOAT, MTLPixelFormatRGBA32Float),
+    FMT(GL_RGBA32F,             GL_RGBA,   16, 32, 32, 32, 32, 0, 0, FLOAT, MTLPixelFormatRGBA32Float),
+
+    // integer
+    FMT(GL_R8UI,                GL_RED,     1,  8,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR8Uint),
+    FMT(GL_RG8UI,               GL_RG,      2,  8,  8,  0,  0, 0, 0, UINT, MTLPixelFormatRG8Uint),
+    FMT(GL_RGB8UI,              GL_RGB,     3,  8,  8,  8,  0, 0, 0, UINT, MTLPixelFormatRGBA8Uint),
+    FMT(GL_RGBA8UI,             GL_RGBA,    4,  8,  8,  8,  8, 0, 0, UINT, MTLPixelFormatRGBA8Uint),
+    FMT(GL_R16UI,               GL_RED,     2, 16,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR16Uint),
+    FMT(GL_RG16UI,              GL_RG,      4, 16, 16,  0,  0, 0, 0, UINT, MTLPixelFormatRG16Uint),
+    FMT(GL_RGB16UI,             GL_RGB,     6, 16, 16, 16,  0, 0, 0, UINT, MTLPixelFormatRGBA16Uint),
+    FMT(GL_RGBA16UI,            GL_RGBA,    8, 16, 16, 16, 16, 0, 0, UINT, MTLPixelFormatRGBA16Uint),
+    FMT(GL_R32UI,               GL_RED,     4, 32,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR32Uint),
+    FMT(GL_RG32UI,              GL_RG,      8, 32, 32,  0,  0, 0, 0, UINT, MTLPixelFormatRG32Uint),
+    FMT(GL_RGB32UI,             GL_RGB,    12, 32, 32, 32,  0, 0, 0, UINT, MTLPixelFormatRGBA32Uint),
+    FMT(GL_RGBA32UI,            GL_RGBA,   16, 32, 32, 32, 32, 0, 0, UINT, MTLPixelFormatRGBA32Uint),
+    FMT(GL_R8I,                 GL_RED,     1,  8,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR8Sint),
+    FMT(GL_RG8I,                GL_RG,      2,  8,  8,  0,  0, 0, 0, SINT, MTLPixelFormatRG8Sint),
+    FMT(GL_RGB8I,               GL_RGB,     3,  8,  8,  8,  0, 0, 0, SINT, MTLPixelFormatRGBA8Sint),
+    FMT(GL_RGBA8I,              GL_RGBA,    4,  8,  8,  8,  8, 0, 0, SINT, MTLPixelFormatRGBA8Sint),
+    FMT(GL_R16I,                GL_RED,     2, 16,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR16Sint),
+    FMT(GL_RG16I,               GL_RG,      4, 16, 16,  0,  0, 0, 0, SINT, MTLPixelFormatRG16Sint),
+    FMT(GL_RGB16I,              GL_RGB,     6, 16, 16, 16,  0, 0, 0, SINT, MTLPixelFormatRGBA16Sint),
+    FMT(GL_RGBA16I,             GL_RGBA,    8, 16, 16, 16, 16, 0, 0, SINT, MTLPixelFormatRGBA16Sint),
+    FMT(GL_R32I,                GL_RED,     4, 32,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR32Sint),
+    FMT(GL_RG32I,               GL_RG,      8, 32, 32,  0,  0, 0, 0, SINT, MTLPixelFormatRG32Sint),
+    FMT(GL_RGB32I,              GL_RGB,    12, 32, 32, 32,  0, 0, 0, SINT, MTLPixelFormatRGBA32Sint),
+    FMT(GL_RGBA32I,             GL_RGBA,   16, 32, 32, 32, 32, 0, 0, SINT, MTLPixelFormatRGBA32Sint),
+
+    // depth / stencil, metal has no 24 bit depth on apple silicon
+    FMT(GL_DEPTH_COMPONENT16,   GL_DEPTH_COMPONENT, 2, 0, 0, 0, 0, 16, 0, UNORM | DEPTH, MTLPixelFormatDepth16Unorm),
+    FMT(GL_DEPTH_COMPONENT24,   GL_DEPTH_COMPONENT, 4, 0, 0, 0, 0, 24, 0, UNORM | DEPTH, MTLPixelFormatDepth32Float),
+    FMT(GL_DEPTH_COMPONENT32,   GL_DEPTH_COMPONENT, 4, 0, 0, 0, 0, 32, 0, UNORM | DEPTH, MTLPixelFormatDepth32Float),
+    FMT(GL_DEPTH_COMPONENT32F,  GL_DEPTH_COMPONENT, 4, 0, 0, 0, 0, 32, 0, FLOAT | DEPTH, MTLPixelFormatDepth32Float),
+    FMT(GL_DEPTH24_STENCIL8,    GL_DEPTH_STENCIL,   4, 0, 0, 0, 0, 24, 8, UNORM | DEPTH | STENCIL, MTLPixelFormatDepth32Float_Stencil8),
+    FMT(GL_DEPTH32F_STENCIL8,   GL_DEPTH_STENCIL,   8, 0, 0, 0, 0, 32, 8, FLOAT | DEPTH | STENCIL, MTLPixelFormatDepth32Float_Stencil8),
+    FMT(GL_STENCIL_INDEX1,      GL_STENCIL_INDEX,   1, 0, 0, 0, 0, 0,  1, UINT | STENCIL, MTLPixelFormatInvalid),
+    FMT(GL_STENCIL_INDEX4,      GL_STENCIL_INDEX,   1, 0, 0, 0, 0, 0,  4, UINT | STENCIL, MTLPixelFormatInvalid),
+    FMT(GL_STENCIL_INDEX8,      GL_STENCIL_INDEX,   1, 0, 0, 0, 0, 0,  8, UINT | STENCIL, MTLPixelFormatStencil8),
+    FMT(GL_STENCIL_INDEX16,     GL_STENCIL_INDEX,   2, 0, 0, 0, 0, 0, 16, UINT | STENCIL, MTLPixelFormatInvalid),
+
+    // legacy alpha / luminance, stored in the red / green channels
+    FMT(GL_ALPHA8,                      GL_ALPHA,           1,  0,  0,  0,  8, 0, 0, UNORM, MTLPixelFormatR8Unorm),
+    FMT(GL_ALPHA16,                     GL_ALPHA,           2,  0,  0,  0, 16, 0, 0, UNORM, MTLPixelFormatR16Unorm),
+    FMT(GL_LUMINANCE8,                  GL_LUMINANCE,       1,  8,  0,  0,  0, 0, 0, UNORM, MTLPixelFormatR8Unorm),
+    FMT(GL_LUMINANCE16,                 GL_LUMINANCE,       2, 16,  0,  0,  0, 0, 0, UNORM, MTLPixelFormatR16Unorm),
+    FMT(GL_LUMINANCE8_ALPHA8,           GL_LUMINANCE_ALPHA, 2,  8,  0,  0,  8, 0, 0, UNORM, MTLPixelFormatRG8Unorm),
+    FMT(GL_LUMINANCE16_ALPHA16,         GL_LUMINANCE_ALPHA, 4, 16,  0,  0, 16, 0, 0, UNORM, MTLPixelFormatRG16Unorm),
+    FMT(GL_ALPHA8_SNORM,                GL_ALPHA,           1,  0,  0,  0,  8, 0, 0, SNORM, MTLPixelFormatR8Snorm),
+    FMT(GL_ALPHA16_SNORM,               GL_ALPHA,           2,  0,  0,  0, 16, 0, 0, SNORM, MTLPixelFormatR16Snorm),
+    FMT(GL_LUMINANCE8_SNORM,            GL_LUMINANCE,       1,  8,  0,  0,  0, 0, 0, SNORM, MTLPixelFormatR8Snorm),
+    FMT(GL_LUMINANCE16_SNORM,           GL_LUMINANCE,       2, 16,  0,  0,  0, 0, 0, SNORM, MTLPixelFormatR16Snorm),
+    FMT(GL_LUMINANCE8_ALPHA8_SNORM,     GL_LUMINANCE_ALPHA, 2,  8,  0,  0,  8, 0, 0, SNORM, MTLPixelFormatRG8Snorm),
+    FMT(GL_LUMINANCE16_ALPHA16_SNORM,   GL_LUMINANCE_ALPHA, 4, 16,  0,  0, 16, 0, 0, SNORM, MTLPixelFormatRG16Snorm),
+    FMT(GL_ALPHA16F_ARB,                GL_ALPHA,           2,  0,  0,  0, 16, 0, 0, FLOAT, MTLPixelFormatR16Float),
+    FMT(GL_ALPHA32F_ARB,                GL_ALPHA,           4,  0,  0,  0, 32, 0, 0, FLOAT, MTLPixelFormatR32Float),
+    FMT(GL_LUMINANCE16F_ARB,            GL_LUMINANCE,       2, 16,  0,  0,  0, 0, 0, FLOAT, MTLPixelFormatR16Float),
+    FMT(GL_LUMINANCE32F_ARB,            GL_LUMINANCE,       4, 32,  0,  0,  0, 0, 0, FLOAT, MTLPixelFormatR32Float),
+    FMT(GL_LUMINANCE_ALPHA16F_ARB,      GL_LUMINANCE_ALPHA, 4, 16,  0,  0, 16, 0, 0, FLOAT, MTLPixelFormatRG16Float),
+    FMT(GL_LUMINANCE_ALPHA32F_ARB,      GL_LUMINANCE_ALPHA, 8, 32,  0,  0, 32, 0, 0, FLOAT, MTLPixelFormatRG32Float),
+    FMT(GL_ALPHA8UI_EXT,                GL_ALPHA,           1,  0,  0,  0,  8, 0, 0, UINT, MTLPixelFormatR8Uint),
+    FMT(GL_ALPHA16UI_EXT,               GL_ALPHA,           2,  0,  0,  0, 16, 0, 0, UINT, MTLPixelFormatR16Uint),
+    FMT(GL_ALPHA32UI_EXT,               GL_ALPHA,           4,  0,  0,  0, 32, 0, 0, UINT, MTLPixelFormatR32Uint),
+    FMT(GL_LUMINANCE8UI_EXT,            GL_LUMINANCE,       1,  8,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR8Uint),
+    FMT(GL_LUMINANCE16UI_EXT,           GL_LUMINANCE,       2, 16,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR16Uint),
+    FMT(GL_LUMINANCE32UI_EXT,           GL_LUMINANCE,       4, 32,  0,  0,  0, 0, 0, UINT, MTLPixelFormatR32Uint),
+    FMT(GL_LUMINANCE_ALPHA8UI_EXT,      GL_LUMINANCE_ALPHA, 2,  8,  0,  0,  8, 0, 0, UINT, MTLPixelFormatRG8Uint),
+    FMT(GL_LUMINANCE_ALPHA16UI_EXT,     GL_LUMINANCE_ALPHA, 4, 16,  0,  0, 16, 0, 0, UINT, MTLPixelFormatRG16Uint),
+    FMT(GL_LUMINANCE_ALPHA32UI_EXT,     GL_LUMINANCE_ALPHA, 8, 32,  0,  0, 32, 0, 0, UINT, MTLPixelFormatRG32Uint),
+    FMT(GL_ALPHA8I_EXT,                 GL_ALPHA,           1,  0,  0,  0,  8, 0, 0, SINT, MTLPixelFormatR8Sint),
+    FMT(GL_ALPHA16I_EXT,                GL_ALPHA,           2,  0,  0,  0, 16, 0, 0, SINT, MTLPixelFormatR16Sint),
+    FMT(GL_ALPHA32I_EXT,                GL_ALPHA,           4,  0,  0,  0, 32, 0, 0, SINT, MTLPixelFormatR32Sint),
+    FMT(GL_LUMINANCE8I_EXT,             GL_LUMINANCE,       1,  8,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR8Sint),
+    FMT(GL_LUMINANCE16I_EXT,            GL_LUMINANCE,       2, 16,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR16Sint),
+    FMT(GL_LUMINANCE32I_EXT,            GL_LUMINANCE,       4, 32,  0,  0,  0, 0, 0, SINT, MTLPixelFormatR32Sint),
+    FMT(GL_LUMINANCE_ALPHA8I_EXT,       GL_LUMINANCE_ALPHA, 2,  8,  0,  0,  8, 0, 0, SINT, MTLPixelFormatRG8Sint),
+    FMT(GL_LUMINANCE_ALPHA16I_EXT,      GL_LUMINANCE_ALPHA, 4, 16,  0,  0, 16, 0, 0, SINT, MTLPixelFormatRG16Sint),
+    FMT(GL_LUMINANCE_ALPHA32I_EXT,      GL_LUMINANCE_ALPHA, 8, 32,  0,  0, 32, 0, 0, SINT, MTLPixelFormatRG32Sint),
+
+    // generic compressed, backed by ETC2 / EAC
+    CFMT(GL_COMPRESSED_RED,         GL_RED,  4, 4,  8, UNORM | MACOS11, MTLPixelFormatEAC_R11Unorm),
+    CFMT(GL_COMPRESSED_RG,          GL_RG,   4, 4, 16, UNORM | MACOS11, MTLPixelFormatEAC_RG11Unorm),
+    CFMT(GL_COMPRESSED_RGB,         GL_RGB,  4, 4,  8, UNORM | MACOS11, MTLPixelFormatETC2_RGB8),
+    CFMT(GL_COMPRESSED_RGBA,        GL_RGBA, 4, 4, 16, UNORM | MACOS11, MTLPixelFormatEAC_RGBA8),
+    CFMT(GL_COMPRESSED_SRGB,        GL_RGB,  4, 4,  8, UNORM | SRGB | MACOS11, MTLPixelFormatETC2_RGB8_sRGB),
+    CFMT(GL_COMPRESSED_SRGB_ALPHA,  GL_RGBA, 4, 4, 16, UNORM | SRGB | MACOS11, MTLPixelFormatEAC_RGBA8_sRGB),
+
+    // RGTC / BPTC / S3TC
+    CFMT(GL_COMPRESSED_RED_RGTC1,                   GL_RED,  4, 4,  8, UNORM, MTLPixelFormatBC4_RUnorm),
+    CFMT(GL_COMPRESSED_SIGNED_RED_RGTC1,            GL_RED,  4, 4,  8, SNORM, MTLPixelFormatBC4_RSnorm),
+    CFMT(GL_COMPRESSED_RG_RGTC2,                    GL_RG,   4, 4, 16, UNORM, MTLPixelFormatBC5_RGUnorm),
+    CFMT(GL_COMPRESSED_SIGNED_RG_RGTC2,             GL_RG,   4, 4, 16, SNORM, MTLPixelFormatBC5_RGSnorm),
+    CFMT(GL_COMPRESSED_RGBA_BPTC_UNORM,             GL_RGBA, 4, 4, 16, UNORM, MTLPixelFormatBC7_RGBAUnorm),
+    CFMT(GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,       GL_RGBA, 4, 4, 16, UNORM | SRGB, MTLPixelFormatBC7_RGBAUnorm_sRGB),
+    CFMT(GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,       GL_RGB,  4, 4, 16, FLOAT, MTLPixelFormatBC6H_RGBFloat),
+    CFMT(GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,     GL_RGB,  4, 4, 16, FLOAT, MTLPixelFormatBC6H_RGBUfloat),
+    CFMT(GL_COMPRESSED_RGB_S3TC_DXT1_EXT,           GL_RGB,  4, 4,  8, UNORM, MTLPixelFormatBC1_RGBA),
+    CFMT(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,          GL_RGBA, 4, 4,  8, UNORM, MTLPixelFormatBC1_RGBA),
+    CFMT(GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,          GL_RGBA, 4, 4, 16, UNORM, MTLPixelFormatBC2_RGBA),
+    CFMT(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,          GL_RGBA, 4, 4, 16, UNORM, MTLPixelFormatBC3_RGBA),
+    CFMT(GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,          GL_RGB,  4, 4,  8, UNORM | SRGB, MTLPixelFormatBC1_RGBA_sRGB),
+    CFMT(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,    GL_RGBA, 4, 4,  8, UNORM | SRGB, MTLPixelFormatBC1_RGBA_sRGB),
+    CFMT(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,    GL_RGBA, 4, 4, 16, UNORM | SRGB, MTLPixelFormatBC2_RGBA_sRGB),
+    CFMT(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,    GL_RGBA, 4, 4, 16, UNORM | SRGB, MTLPixelFormatBC3_RGBA_sRGB),
+
+    // ETC2 / EAC
+    CFMT(GL_COMPRESSED_R11_EAC,                         GL_RED,  4, 4,  8, UNORM | MACOS11, MTLPixelFormatEAC_R11Unorm),
+    CFMT(GL_COMPRESSED_SIGNED_R11_EAC,                  GL_RED,  4, 4,  8, SNORM | MACOS11, MTLPixelFormatEAC_R11Snorm),
+    CFMT(GL_COMPRESSED_RG11_EAC,                        GL_RG,   4, 4, 16, UNORM | MACOS11, MTLPixelFormatEAC_RG11Unorm),
+    CFMT(GL_COMPRESSED_SIGNED_RG11_EAC,                 GL_RG,   4, 4, 16, SNORM | MACOS11, MTLPixelFormatEAC_RG11Snorm),
+    CFMT(GL_COMPRESSED_RGB8_ETC2,                       GL_RGB,  4, 4,  8, UNORM | MACOS11, MTLPixelFormatETC2_RGB8),
+    CFMT(GL_COMPRESSED_SRGB8_ETC2,                      GL_RGB,  4, 4,  8, UNORM | SRGB | MACOS11, MTLPixelFormatETC2_RGB8_sRGB),
+    CFMT(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,   GL_RGBA, 4, 4,  8, UNORM | MACOS11, MTLPixelFormatETC2_RGB8A1),
+    CFMT(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_RGBA, 4, 4,  8, UNORM | SRGB | MACOS11, MTLPixelFormatETC2_RGB8A1_sRGB),
+    CFMT(GL_COMPRESSED_RGBA8_ETC2_EAC,                  GL_RGBA, 4, 4, 16, UNORM | MACOS11, MTLPixelFormatEAC_RGBA8),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,           GL_RGBA, 4, 4, 16, UNORM | SRGB | MACOS11, MTLPixelFormatEAC_RGBA8_sRGB),
+
+    // ASTC LDR
+    CFMT(GL_COMPRESSED_RGBA_ASTC_4x4_KHR,   GL_RGBA,  4,  4, 16, UNORM | MACOS11, MTLPixelFormatASTC_4x4_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_5x4_KHR,   GL_RGBA,  5,  4, 16, UNORM | MACOS11, MTLPixelFormatASTC_5x4_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_5x5_KHR,   GL_RGBA,  5,  5, 16, UNORM | MACOS11, MTLPixelFormatASTC_5x5_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_6x5_KHR,   GL_RGBA,  6,  5, 16, UNORM | MACOS11, MTLPixelFormatASTC_6x5_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_6x6_KHR,   GL_RGBA,  6,  6, 16, UNORM | MACOS11, MTLPixelFormatASTC_6x6_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_8x5_KHR,   GL_RGBA,  8,  5, 16, UNORM | MACOS11, MTLPixelFormatASTC_8x5_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_8x6_KHR,   GL_RGBA,  8,  6, 16, UNORM | MACOS11, MTLPixelFormatASTC_8x6_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_8x8_KHR,   GL_RGBA,  8,  8, 16, UNORM | MACOS11, MTLPixelFormatASTC_8x8_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_10x5_KHR,  GL_RGBA, 10,  5, 16, UNORM | MACOS11, MTLPixelFormatASTC_10x5_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_10x6_KHR,  GL_RGBA, 10,  6, 16, UNORM | MACOS11, MTLPixelFormatASTC_10x6_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_10x8_KHR,  GL_RGBA, 10,  8, 16, UNORM | MACOS11, MTLPixelFormatASTC_10x8_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_10x10_KHR, GL_RGBA, 10, 10, 16, UNORM | MACOS11, MTLPixelFormatASTC_10x10_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_12x10_KHR, GL_RGBA, 12, 10, 16, UNORM | MACOS11, MTLPixelFormatASTC_12x10_LDR),
+    CFMT(GL_COMPRESSED_RGBA_ASTC_12x12_KHR, GL_RGBA, 12, 12, 16, UNORM | MACOS11, MTLPixelFormatASTC_12x12_LDR),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR,   GL_RGBA,  4,  4, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_4x4_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR,   GL_RGBA,  5,  4, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_5x4_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR,   GL_RGBA,  5,  5, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_5x5_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR,   GL_RGBA,  6,  5, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_6x5_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR,   GL_RGBA,  6,  6, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_6x6_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR,   GL_RGBA,  8,  5, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_8x5_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR,   GL_RGBA,  8,  6, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_8x6_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR,   GL_RGBA,  8,  8, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_8x8_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR,  GL_RGBA, 10,  5, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_10x5_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR,  GL_RGBA, 10,  6, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_10x6_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR,  GL_RGBA, 10,  8, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_10x8_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR, GL_RGBA, 10, 10, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_10x10_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR, GL_RGBA, 12, 10, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_12x10_sRGB),
+    CFMT(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR, GL_RGBA, 12, 12, 16, UNORM | SRGB | MACOS11, MTLPixelFormatASTC_12x12_sRGB),
+};
+
+#pragma clang diagnostic pop
+
+#undef UNORM
+#undef SNORM
+#undef UINT
+#undef SINT
+#undef FLOAT
+#undef SRGB
+#undef PACKED
+#undef DEPTH
+#undef STENCIL
+#undef MACOS11
+
+const GLuint pixel_format_count = sizeof(pixel_format_table) / sizeof(pixel_format_table[0]);
+
+// open addressed enum -> id index, ids fit in a byte and the table stays under 1/3 full
+#define PIXEL_FORMAT_HASH_BITS  9
+#define PIXEL_FORMAT_HASH_SIZE  (1 << PIXEL_FORMAT_HASH_BITS)
+#define PIXEL_FORMAT_HASH_MASK  (PIXEL_FORMAT_HASH_SIZE - 1)
+
+static uint8_t pixel_format_hash[PIXEL_FORMAT_HASH_SIZE];
+
+static inline GLuint pixelFormatHash(GLenum internalformat)
+{
+    return (GLuint)((internalformat * 2654435761u) >> (32 - PIXEL_FORMAT_HASH_BITS));
+}
+
+__attribute__((constructor))
+static void buildPixelFormatHash(void)
+{
+    assert(pixel_format_count <= 256);
+
+    for(GLuint id=1; id<pixel_format_count; id++)
+    {
+        GLuint slot = pixelFormatHash(pixel_format_table[id].internalformat);
+
+        while(pixel_format_hash[slot])
+        {
+            // a format listed twice is a table bug
+            assert(pixel_format_table[pixel_format_hash[slot]].internalformat != pixel_format_table[id].internalformat);
+
+            slot = (slot + 1) & PIXEL_FORMAT_HASH_MASK;
+        }
+
+        pixel_format_hash[slot] = id;
+    }
+}
+
+GLuint pixelFormatID(GLenum internalformat)
+{
+    GLuint slot = pixelFormatHash(internalformat);
+    GLuint id;
+
+    while((id = pixel_format_hash[slot]))
+    {
+        if (pixel_format_table[id].internalformat == internalformat)
+            return id;
+
+        slot = (slot + 1) & PIXEL_FORMAT_HASH_MASK;
+    }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * pixel_formats.h
+ * MGL
+ *
+ */
+
+#ifndef pixel_formats_h
+#define pixel_formats_h
+
+#include <stddef.h>
+
+#include "glcorearb.h"
+
+// component encoding, exactly one of these is set for color formats
+#define PIXEL_FORMAT_UNORM          0x0001
+#define PIXEL_FORMAT_SNORM          0x0002
+#define PIXEL_FORMAT_UINT           0x0004
+#define PIXEL_FORMAT_SINT           0x0008
+#define PIXEL_FORMAT_FLOAT          0x0010
+#define PIXEL_FORMAT_SRGB           0x0020
+// channels are not whole 8 / 16 / 32 bit values
+#define PIXEL_FORMAT_PACKED         0x0040
+#define PIXEL_FORMAT_COMPRESSED     0x0080
+#define PIXEL_FORMAT_DEPTH          0x0100
+#define PIXEL_FORMAT_STENCIL        0x0200
+#define PIXEL_FORMAT_SIZED          0x0400
+// the metal format needs macOS 11 (ETC2 / EAC / ASTC on apple silicon)
+#define PIXEL_FORMAT_MACOS11        0x0800
+
+#define PIXEL_FORMAT_INTEGER        (PIXEL_FORMAT_UINT | PIXEL_FORMAT_SINT)
+
+// indices into PixelFormatDesc.bits
+enum {
+    PIXEL_BITS_RED = 0,
+    PIXEL_BITS_GREEN,
+    PIXEL_BITS_BLUE,
+    PIXEL_BITS_ALPHA,
+    PIXEL_BITS_DEPTH,
+    PIXEL_BITS_STENCIL,
+    PIXEL_BITS_MAX
+};
+
+typedef struct PixelFormatDesc_t {
+    GLenum      internalformat;
+    GLenum      base_format;        // GL_RED, GL_RGBA, GL_LUMINANCE_ALPHA, GL_DEPTH_STENCIL...
+    GLubyte     pixel_size;         // bytes per texel, 0 for unsized and compressed formats
+    GLubyte     components;
+    GLubyte     bits[PIXEL_BITS_MAX];
+    GLushort    flags;
+    GLubyte     block_width;        // compressed formats only
+    GLubyte     block_height;
+    GLubyte     block_size;         // bytes per block
+    GLushort    mtl_format;         // MTLPixelFormat, checked against PIXEL_FORMAT_MACOS11
+} PixelFormatDesc;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// compact id for an internal format, 0 if the format is unknown
+GLuint pixelFormatID(GLenum internalformat);
+
+// descriptor for a compact id, pixel_format_table[0] is the unknown format
+extern const PixelFormatDesc pixel_format_table[];
+extern const GLuint pixel_format_count;
+
+// NULL if the internal format is unknown
+static inline const PixelFormatDesc *pixelFormatDesc(GLenum internalformat)
+{
+    GLuint id = pixelFormatID(internalformat);
+
+    return id ? &pixel_format_table[id] : NULL;
+}
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* pixel_formats_h */
@@ -0,0 +1,455 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * pixel_store.c
+ * MGL
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <dispatch/dispatch.h>
+
+#include "pixel_utils.h"
+#include "pixel_store.h"
+
+#ifndef __has_builtin
+#define __has_builtin(x) 0
+#endif
+
+// size of the element alignment and swap_bytes operate on, packed types are a single element
+static size_t elementSizeForType(GLenum type)
+{
+    switch(type)
+    {
+        case GL_UNSIGNED_BYTE:
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE_3_3_2:
+        case GL_UNSIGNED_BYTE_2_3_3_REV:
+            return 1;
+
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT:
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            return 2;
+
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+        case GL_FLOAT:
+        case GL_UNSIGNED_INT_8_8_8_8:
+        case GL_UNSIGNED_INT_8_8_8_8_REV:
+        case GL_UNSIGNED_INT_10_10_10_2:
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_24_8:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV:
+        case GL_UNSIGNED_INT_5_9_9_9_REV:
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:  // float depth + packed stencil word
+            return 4;
+    }
+
+    return 0;
+}
+
+GLboolean pixelStoreLayout(const PixelStore *store, GLuint dims, GLenum format, GLenum type, GLsizei width, GLsizei height, PixelStoreLayout *layout)
+{
+    size_t pixel_size, element_size;
+    size_t row_length, image_height;
+    size_t alignment;
+
+    pixel_size = sizeForFormatType(format, type);
+    element_size = elementSizeForType(type);
+
+    if (pixel_size == 0 || element_size == 0)
+        return false;
+
+    row_length = (store->row_length > 0) ? (size_t)store->row_length : (size_t)width;
+    image_height = (dims > 2 && store->image_height > 0) ? (size_t)store->image_height : (size_t)height;
+    alignment = (store->alignment > 0) ? (size_t)store->alignment : 1;
+
+    layout->pixel_size = pixel_size;
+    layout->row_pitch = pixel_size * row_length;
+
+    // alignment only pads rows when components are smaller than the alignment
+    if (element_size < alignment)
+    {
+        layout->row_pitch = (layout->row_pitch + alignment - 1) & ~(alignment - 1);
+    }
+
+    layout->image_pitch = layout->row_pitch * image_height;
+
+    layout->skip_bytes = (size_t)store->skip_pixels * pixel_size;
+
+    if (dims > 1)
+        layout->skip_bytes += (size_t)store->skip_rows * layout->row_pitch;
+
+    if (dims > 2)
+        layout->skip_bytes += (size_t)store->skip_images * layout->image_pitch;
+
+    // lsb_first only applies to GL_BITMAP which the core profile doesn't have
+    layout->swap_size = (store->swap_bytes && element_size > 1) ? element_size : 0;
+
+    return true;
+}
+
+size_t pixelStoreSpan(const PixelStoreLayout *layout, GLsizei width, GLsizei height, GLsizei depth)
+{
+    if (width <= 0 || height <= 0 || depth <= 0)
+        return 0;
+
+    return layout->skip_bytes +
+           (size_t)(depth - 1) * layout->image_pitch +
+           (size_t)(height - 1) * layout->row_pitch +
+           (size_t)width * layout->pixel_size;
+}
+
+#pragma mark byte swap
+
+#if __has_builtin(__builtin_shufflevector)
+typedef uint8_t ps_uchar16 __attribute__((vector_size(16)));
+#endif
+
+static void swapSpan(GLubyte *dst, const GLubyte *src, size_t size, size_t swap_size)
+{
+    size_t i = 0;
+
+#if __has_builtin(__builtin_shufflevector)
+    // 16 bytes per iteration, memcpy keeps unaligned client pointers legal
+    for(; i + 16 <= size; i += 16)
+    {
+        ps_uchar16 v;
+
+        memcpy(&v, src + i, sizeof(v));
+
+        switch(swap_size)
+        {
+            case 2:
+                v = __builtin_shufflevector(v, v, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+                break;
+
+            case 4:
+                v = __builtin_shufflevector(v, v, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+                break;
+
+            case 8:
+                v = __builtin_shufflevector(v, v, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+                break;
+        }
+
+        memcpy(dst + i, &v, sizeof(v));
+    }
+#endif
+
+    for(; i + swap_size <= size; i += swap_size)
+    {
+        switch(swap_size)
+        {
+            case 2:
+            {
+                uint16_t v;
+
+                memcpy(&v, src + i, 2);
+                v = __builtin_bswap16(v);
+                memcpy(dst + i, &v, 2);
+                break;
+            }
+
+            case 4:
+            {
+                uint32_t v;
+
+                memcpy(&v, src + i, 4);
+                v = __builtin_bswap32(v);
+                memcpy(dst + i, &v, 4);
+                break;
+            }
+
+            case 8:
+            {
+                uint64_t v;
+
+                memcpy(&v, src + i, 8);
+                v = __builtin_bswap64(v);
+                memcpy(dst + i, &v, 8);
+                break;
+            }
+        }
+    }
+}
+
+static inline void copySpan(GLubyte *dst, const GLubyte *src, size_t size, size_t swap_size)
+{
+    if (swap_size > 1)
+        swapSpan(dst, src, size, swap_size);
+    else
+        memcpy(dst, src, size);
+}
+
+#pragma mark strided copy
+
+typedef struct CopyImageArgs_t {
+    GLubyte *dst;
+    size_t dst_row_pitch;
+    size_t dst_image_pitch;
+    const GLubyte *src;
+    size_t src_row_pitch;
+    size_t src_image_pitch;
+    size_t row_bytes;
+    size_t height;
+    size_t swap_size;
+} CopyImageArgs;
+
+static void copySlice(void *context, size_t z)
+{
+    CopyImageArgs *args = (CopyImageArgs *)context;
+    GLubyte *dst;
+    const GLubyte *src;
+
+    dst = args->dst + z * args->dst_image_pitch;
+    src = args->src + z * args->src_image_pitch;
+
+    // tightly packed rows on both sides collapse into one span
+    if (args->src_row_pitch == args->row_bytes && args->dst_row_pitch == args->row_bytes)
+    {
+        copySpan(dst, src, args->row_bytes * args->height, args->swap_size);
+
+        return;
+    }
+
+    for(size_t y=0; y<args->height; y++)
+    {
+        copySpan(dst, src, args->row_bytes, args->swap_size);
+
+        src += args->src_row_pitch;
+        dst += args->dst_row_pitch;
+    }
+}
+
+void copyImage3D(void *dst, size_t dst_row_pitch, size_t dst_image_pitch,
+                 const void *src, size_t src_row_pitch, size_t src_image_pitch,
+                 size_t row_bytes, size_t height, size_t depth, size_t swap_size)
+{
+    CopyImageArgs args;
+    size_t slice_bytes;
+
+    if (row_bytes == 0 || height == 0 || depth == 0)
+        return;
+
+    slice_bytes = row_bytes * height;
+
+    // whole block is contiguous on both sides
+    if (src_row_pitch == row_bytes && dst_row_pitch == row_bytes &&
+        (depth == 1 || (src_image_pitch == slice_bytes && dst_image_pitch == slice_bytes)))
+    {
+        copySpan((GLubyte *)dst, (const GLubyte *)src, slice_bytes * depth, swap_size);
+
+        return;
+    }
+
+    args.dst = (GLubyte *)dst;
+    args.dst_row_pitch = dst_row_pitch;
+    args.dst_image_pitch = dst_image_pitch;
+    args.src = (const GLubyte *)src;
+    args.src_row_pitch = src_row_pitch;
+    args.src_image_pitch = src_image_pitch;
+    args.row_bytes = row_bytes;
+    args.height = height;
+    args.swap_size = swap_size;
+
+    if (depth > 1 && slice_bytes * depth >= PIXEL_STORE_THREADED_MIN_BYTES)
+    {
+        dispatch_apply_f(depth, DISPATCH_APPLY_AUTO, &args, copySlice);
+
+        return;
+    }
+
+    for(size_t z=0; z<depth; z++)
+    {
+        copySlice(&args, z);
+    }
+}
+
+#pragma mark readback conversion
+
+typedef float ps_float4 __attribute__((vector_size(16)));
+typedef uint8_t ps_uchar4 __attribute__((vector_size(4)));
+
+// component order in client memory, 0 = R, 1 = G, 2 = B, 3 = A
+static GLuint componentsForReadbackFormat(GLenum format, GLuint comps[4])
+{
+    switch(format)
+    {
+        case GL_RGBA: comps[0] = 0; comps[1] = 1; comps[2] = 2; comps[3] = 3; return 4;
+        case GL_BGRA: comps[0] = 2; comps[1] = 1; comps[2] = 0; comps[3] = 3; return 4;
+        case GL_RGB: comps[0] = 0; comps[1] = 1; comps[2] = 2; return 3;
+        case GL_BGR: comps[0] = 2; comps[1] = 1; comps[2] = 0; return 3;
+        case GL_RED: comps[0] = 0; return 1;
+        case GL_GREEN: comps[0] = 1; return 1;
+        case GL_BLUE: comps[0] = 2; return 1;
+        case GL_ALPHA: comps[0] = 3; return 1;
+    }
+
+    return 0;
+}
+
+GLboolean readbackFormatSupported(GLenum format, GLenum type)
+{
+    GLuint comps[4];
+    GLuint n;
+
+    n = componentsForReadbackFormat(format, comps);
+
+    if (n == 0)
+        return false;
+
+    switch(type)
+    {
+        case GL_UNSIGNED_BYTE:
+        case GL_FLOAT:
+            return true;
+
+        case GL_UNSIGNED_INT_8_8_8_8:
+        case GL_UNSIGNED_INT_8_8_8_8_REV:
+            return (n == 4);
+    }
+
+    return false;
+}
+
+static void convertRowBytes(GLubyte *dst, const GLubyte *src, GLsizei width, GLuint n, const GLuint map[4])
+{
+    GLsizei x = 0;
+
+    if (n == 4 && map[0] == 0 && map[1] == 1 && map[2] == 2 && map[3] == 3)
+    {
+        memcpy(dst, src, (size_t)width * 4);
+
+        return;
+    }
+
+#if __has_builtin(__builtin_shufflevector)
+    // the common case, bgra drawable read as rgba, 4 pixels per iteration
+    if (n == 4 && map[0] == 2 && map[1] == 1 && map[2] == 0 && map[3] == 3)
+    {
+        for(; x + 4 <= width; x += 4)
+        {
+            ps_uchar16 v;
+
+            memcpy(&v, src + x * 4, sizeof(v));
+
+            v = __builtin_shufflevector(v, v, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            memcpy(dst + x * 4, &v, sizeof(v));
+        }
+    }
+#endif
+
+    for(; x < width; x++)
+    {
+        for(GLuint c=0; c<n; c++)
+        {
+            dst[x * n + c] = src[x * 4 + map[c]];
+        }
+    }
+}
+
+static void convertRowFloat(float *dst, const GLubyte *src, GLsizei width, GLuint n, const GLuint map[4])
+{
+    const ps_float4 scale = {1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f};
+
+    for(GLsizei x=0; x<width; x++)
+    {
+        ps_uchar4 p;
+        ps_float4 f;
+
+        memcpy(&p, src + x * 4, sizeof(p));
+
+        f = __builtin_convertvector(p, ps_float4) * scale;
+
+        for(GLuint c=0; c<n; c++)
+        {
+            dst[x * n + c] = f[map[c]];
+        }
+    }
+}
+
+GLboolean convertReadbackPixels(void *dst, const PixelStoreLayout *layout, GLenum format, GLenum type,
+                                const void *src, size_t src_pitch, GLuint src_mtl_format,
+                                GLsizei width, GLsizei height)
+{
+    GLuint src_pos[4];
+    GLuint comps[4];
+    GLuint map[4];
+    GLuint n;
+
+    switch(src_mtl_format)
+    {
+        case MTLPixelFormatBGRA8Unorm:
+        case MTLPixelFormatBGRA8Unorm_sRGB:
+            src_pos[0] = 2; src_pos[1] = 1; src_pos[2] = 0; src_pos[3] = 3;
+            break;
+
+        case MTLPixelFormatRGBA8Unorm:
+        case MTLPixelFormatRGBA8Unorm_sRGB:
+            src_pos[0] = 0; src_pos[1] = 1; src_pos[2] = 2; src_pos[3] = 3;
+            break;
+
+        default:
+            return false;
+    }
+
+    if (readbackFormatSupported(format, type) == false)
+        return false;
+
+    n = componentsForReadbackFormat(format, comps);
+
+    for(GLuint c=0; c<n; c++)
+    {
+        map[c] = src_pos[comps[c]];
+    }
+
+    // 8_8_8_8 is packed msb first, the byte order in memory is reversed
+    if (type == GL_UNSIGNED_INT_8_8_8_8)
+    {
+        GLuint t;
+
+        t = map[0]; map[0] = map[3]; map[3] = t;
+        t = map[1]; map[1] = map[2]; map[2] = t;
+    }
+
+    for(GLsizei y=0; y<height; y++)
+    {
+        const GLubyte *src_row;
+        GLubyte *dst_row;
+
+        src_row = (const GLubyte *)src + (size_t)(height - 1 - y) * src_pitch;
+        dst_row = (GLubyte *)dst + layout->skip_bytes + (size_t)y * layout->row_pitch;
+
+        if (type == GL_FLOAT)
+            convertRowFloat((float *)dst_row, src_row, width, n, map);
+        else
+            convertRowBytes(dst_row, src_row, width, n, map);
+
+        if (layout->swap_size)
+            swapSpan(dst_row, dst_row, (size_t)width * layout->pixel_size, layout->swap_size);
+    }
+
+    return true;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * pixel_store.h
+ * MGL
+ *
+ */
+
+#ifndef pixel_store_h
+#define pixel_store_h
+
+#include "glcorearb.h"
+#include "glm_context.h"
+
+// 3D copies larger than this are split across cores one slice per job
+#define PIXEL_STORE_THREADED_MIN_BYTES  (4 * 1024 * 1024)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// client memory layout described by a GL_PACK_* / GL_UNPACK_* state block
+typedef struct PixelStoreLayout_t {
+    size_t pixel_size;      // bytes per pixel in client memory
+    size_t row_pitch;       // bytes between rows, row_length and alignment applied
+    size_t image_pitch;     // bytes between images, image_height applied
+    size_t skip_bytes;      // skip_pixels / skip_rows / skip_images as a byte offset
+    size_t swap_size;       // element size for swap_bytes, 0 if no swap
+} PixelStoreLayout;
+
+// dims is the dimensionality of the call, skip_rows is ignored for 1, skip_images / image_height for 1 and 2
+// returns false for a format / type combination with no known size
+GLboolean pixelStoreLayout(const PixelStore *store, GLuint dims, GLenum format, GLenum type, GLsizei width, GLsizei height, PixelStoreLayout *layout);
+
+// bytes of client memory touched from the base pointer, used for pixel buffer bounds checks
+size_t pixelStoreSpan(const PixelStoreLayout *layout, GLsizei width, GLsizei height, GLsizei depth);
+
+// strided copy of a width x height x depth block, swap_size 2 / 4 / 8 byte swaps each element
+void copyImage3D(void *dst, size_t dst_row_pitch, size_t dst_image_pitch,
+                 const void *src, size_t src_row_pitch, size_t src_image_pitch,
+                 size_t row_bytes, size_t height, size_t depth, size_t swap_size);
+
+// format / type combinations convertReadbackPixels can produce
+GLboolean readbackFormatSupported(GLenum format, GLenum type);
+
+// convert rgba8 / bgra8 pixels read back from metal into format / type laid out by
+// the pack state, rows are flipped from metal's top left origin to gl's bottom left
+GLboolean convertReadbackPixels(void *dst, const PixelStoreLayout *layout, GLenum format, GLenum type,
+                                const void *src, size_t src_pitch, GLuint src_mtl_format,
+                                GLsizei width, GLsizei height);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* pixel_store_h */
@@ -109,6 +109,7 @@ Program *newProgram(GLMContext ctx, GLuint program)
     bzero(ptr, sizeof(Program));
 
     ptr->name = program;
+    BUMP_GENERATION(ptr);
 
     return ptr;
 }
@@ -163,6 +164,11 @@ GLuint mglCreateProgram(GLMContext ctx)
 
 void mglFreeProgram(GLMContext ctx, Program *ptr)
 {
+    if (ptr->info_log)
+    {
+        free(ptr->info_log);
+    }
+
     if (ptr->linked_glsl_program)
     {
         glslang_program_delete(ptr->linked_glsl_program);
@@ -285,6 +291,7 @@ void mglAttachShader(GLMContext ctx, GLuint program, GLuint shader)
     pptr->shader_slots[index] = sptr;
     sptr->refcount++;
     pptr->dirty_bits |= DIRTY_PROGRAM;
+    BUMP_GENERATION(pptr);
 }
 
 void mglDetachShader(GLMContext ctx, GLuint program, GLuint shader)
@@ -339,6 +346,7 @@ void mglDetachShader(GLMContext ctx, GLuint program, GLuint shader)
     }
     
     pptr->dirty_bits |= DIRTY_PROGRAM;
+    BUMP_GENERATION(pptr);
 }
 
 void error_callback(void *userdata, const char *error)
@@ -381,6 +389,8 @@ char *parseSPIRVShaderToMetal(GLMContext ctx, Program *ptr, int stage)
     char *str_ret;
     int parse_res;
 
+    TRACE_SCOPE("spirv-cross msl", TRACE_SHADER);
+
     spvc_context context = NULL;
     spvc_parsed_ir ir = NULL;
     spvc_compiler compiler_msl = NULL;
@@ -435,6 +445,12 @@ char *parseSPIRVShaderToMetal(GLMContext ctx, Program *ptr, int stage)
         ERROR_RETURN(GL_INVALID_OPERATION);
     }
 
+    // samplerBuffer / imageBuffer map to texture_buffer, glTexBuffer binds metal texture buffers
+    if (spvc_compiler_options_set_bool(options, SPVC_COMPILER_OPTION_MSL_TEXTURE_BUFFER_NATIVE, SPVC_TRUE) != SPVC_SUCCESS) {
+        fprintf(stderr, "MGL Error: spvc_compiler_options_set_bool(SPVC_COMPILER_OPTION_MSL_TEXTURE_BUFFER_NATIVE) failed\n");
+        ERROR_RETURN(GL_INVALID_OPERATION);
+    }
+
     //ERROR_CHECK_RETURN(spvc_compiler_options_set_uint(options, SPVC_COMPILER_OPTION_GLSL_VERSION, 4.5) == SPVC_SUCCESS, GL_INVALID_OPERATION);
     // ERROR_CHECK_RETURN(spvc_compiler_install_compiler_options(compiler_msl, options) == SPVC_SUCCESS, GL_INVALID_OPERATION);
     if (spvc_compiler_install_compiler_options(compiler_msl, options) != SPVC_SUCCESS) {
@@ -607,6 +623,8 @@ bool linkAndCompileProgramToMetal(GLMContext ctx, Program *pptr, int stage)
     glslang_program_t *glsl_program;
     int err;
 
+    TRACE_SCOPE("linkAndCompileProgramToMetal", TRACE_SHADER);
+
     /* Safety check: ensure we have a shader for this stage */
     if (!pptr->shader_slots[stage]) {
         return false;
@@ -646,7 +664,11 @@ bool linkAndCompileProgramToMetal(GLMContext ctx, Program *pptr, int stage)
 
     // link
     fprintf(stderr, "MGL DEBUG: About to link program\n");
-    err = glslang_program_link(glsl_program, GLSLANG_MSG_DEFAULT_BIT);
+    {
+        TRACE_SCOPE("glslang link", TRACE_SHADER);
+
+        err = glslang_program_link(glsl_program, GLSLANG_MSG_DEFAULT_BIT);
+    }
     fprintf(stderr, "MGL DEBUG: Program link returned %d\n", err);
     if (!err)
     {
@@ -661,7 +683,11 @@ bool linkAndCompileProgramToMetal(GLMContext ctx, Program *pptr, int stage)
 
     // generate SPIVR
     fprintf(stderr, "MGL DEBUG: Generating SPIRV for stage %d\n", stage);
-    glslang_program_SPIRV_generate(glsl_program, stage);
+    {
+        TRACE_SCOPE("glslang spirv", TRACE_SHADER);
+
+        glslang_program_SPIRV_generate(glsl_program, stage);
+    }
     fprintf(stderr, "MGL DEBUG: SPIRV generated\n");
 
     if (glslang_program_SPIRV_get_messages(glsl_program))
@@ -711,9 +737,69 @@ bool linkAndCompileProgramToMetal(GLMContext ctx, Program *pptr, int stage)
     return true;
 }
 
+static bool buildProgramBindingTables(Program *ptr)
+{
+    struct {
+        int spvc_type;
+        GLuint max_binding;
+    } binding_types[_MAX_BINDING_TYPES] = {
+        {SPVC_RESOURCE_TYPE_UNIFORM_BUFFER, MAX_BINDABLE_BUFFERS},
+        {SPVC_RESOURCE_TYPE_UNIFORM_CONSTANT, MAX_BINDABLE_BUFFERS},
+        {SPVC_RESOURCE_TYPE_STORAGE_BUFFER, MAX_BINDABLE_BUFFERS},
+        {SPVC_RESOURCE_TYPE_ATOMIC_COUNTER, MAX_BINDABLE_BUFFERS},
+        {SPVC_RESOURCE_TYPE_SAMPLED_IMAGE, TEXTURE_UNITS},
+        {SPVC_RESOURCE_TYPE_STORAGE_IMAGE, TEXTURE_UNITS}
+    };
+
+    bzero(ptr->binding_tables, sizeof(ptr->binding_tables));
+
+    for (int stage=0; stage<_MAX_SHADER_TYPES; stage++)
+    {
+        for (int type=0; type<_MAX_BINDING_TYPES; type++)
+        {
+            SpirvResourceList *res;
+            ProgramBindingTable *table;
+
+            res = &ptr->spirv_resources_list[stage][binding_types[type].spvc_type];
+            table = &ptr->binding_tables[stage][type];
+
+            if (res->list == NULL)
+                continue;
+
+            for (GLuint i=0; i<res->count; i++)
+            {
+                GLuint binding;
+
+                binding = res->list[i].binding;
+
+                // the binders index gl state arrays with this, a binding they can't reach fails the link
+                if (binding >= binding_types[type].max_binding || table->count >= TEXTURE_UNITS)
+                {
+                    char log[128];
+
+                    snprintf(log, sizeof(log), "%s binding %u out of range (max %u)\n",
+                             res->list[i].name ? res->list[i].name : "resource", binding, binding_types[type].max_binding - 1);
+
+                    fprintf(stderr, "MGL ERROR: program %d stage %d %s", ptr->name, stage, log);
+
+                    ptr->info_log = strdup(log);
+
+                    return false;
+                }
+
+                table->slots[table->count++] = binding;
+                table->used[binding / 64] |= (0x1ULL << (binding % 64));
+            }
+        }
+    }
+
+    return true;
+}
+
 void mglLinkProgram(GLMContext ctx, GLuint program)
 {
     Program *pptr;
+    GLuint64 start;
 
     pptr = findProgram(ctx, program);
 
@@ -726,6 +812,9 @@ void mglLinkProgram(GLMContext ctx, GLuint program)
         return;
     }
 
+    // link time covers spirv, the msl translation and the metal library built by mtlBindProgram
+    start = STATS_TIME();
+
     for (int stage=0; stage<_MAX_SHADER_TYPES; stage++)
     {
         pptr->spirv[stage].msl_str = 0;
@@ -736,6 +825,23 @@ void mglLinkProgram(GLMContext ctx, GLuint program)
         }
     }
 
+    if (pptr->info_log)
+    {
+        free(pptr->info_log);
+        pptr->info_log = NULL;
+    }
+
+    pptr->link_status = buildProgramBindingTables(pptr);
+    BUMP_GENERATION(pptr);
+
+    if (pptr->link_status == GL_FALSE)
+    {
+        STATS_ADD(program_links, 1);
+        STATS_ADD(program_link_ns, STATS_TIME() - start);
+
+        return;
+    }
+
     /* Only call mtlBindProgram if Metal functions are initialized */
     if (ctx->mtl_funcs.mtlBindProgram) {
         ctx->mtl_funcs.mtlBindProgram(ctx, pptr);
@@ -743,9 +849,38 @@ void mglLinkProgram(GLMContext ctx, GLuint program)
         fprintf(stderr, "WARNING: Metal functions not initialized, skipping mtlBindProgram\n");
     }
 
+    STATS_ADD(program_links, 1);
+    STATS_ADD(program_link_ns, STATS_TIME() - start);
+
     //ERROR_CHECK_RETURN(pptr->mtl_data, GL_INVALID_OPERATION);
 }
 
+static void useProgram(GLMContext ctx, Program *pptr)
+{
+    if (ctx->state.program != pptr)
+    {
+        if (ctx->state.program)
+        {
+            ctx->state.program->refcount--;
+            if (ctx->state.program->refcount == 0 && ctx->state.program->delete_status)
+            {
+                mglFreeProgram(ctx, ctx->state.program);
+            }
+        }
+
+        ctx->state.program = pptr;
+
+        if (ctx->state.program)
+        {
+            ctx->state.program->refcount++;
+            // Only mark dirty when binding a valid program
+            // Don't mark dirty when unbinding (pptr=NULL) to preserve existing pipeline
+            ctx->state.dirty_bits |= DIRTY_PROGRAM;
+        }
+        // When unbinding (pptr=NULL), don't mark dirty - keep existing pipeline state
+    }
+}
+
 void mglUseProgram(GLMContext ctx, GLuint program)
 {
     Program *pptr;
@@ -765,34 +900,24 @@ void mglUseProgram(GLMContext ctx, GLuint program)
         }
 
         ERROR_CHECK_RETURN(pptr->linked_glsl_program, GL_INVALID_OPERATION);
+
+        if (pptr->link_status == GL_FALSE)
+        {
+            ERROR_RETURN(GL_INVALID_OPERATION);
+            return;
+        }
     }
     else
     {
         pptr = NULL;
     }
 
-    if (ctx->state.program != pptr)
-    {
-        if (ctx->state.program)
-        {
-            ctx->state.program->refcount--;
-            if (ctx->state.program->refcount == 0 && ctx->state.program->delete_status)
-            {
-                mglFreeProgram(ctx, ctx->state.program);
-            }
-        }
-
-        ctx->state.program = pptr;
+    useProgram(ctx, pptr);
+}
 
-        if (ctx->state.program)
-        {
-            ctx->state.program->refcount++;
-            // Only mark dirty when binding a valid program
-            // Don't mark dirty when unbinding (pptr=NULL) to preserve existing pipeline
-            ctx->state.dirty_bits |= DIRTY_PROGRAM;
-        }
-        // When unbinding (pptr=NULL), don't mark dirty - keep existing pipeline state
-    }
+void mglUseProgram_no_error(GLMContext ctx, GLuint program)
+{
+    useProgram(ctx, program ? findProgram(ctx, program) : NULL);
 }
 
 void mglBindAttribLocation(GLMContext ctx, GLuint program, GLuint index, const GLchar *name)
@@ -879,8 +1004,7 @@ void mglGetProgramiv(GLMContext ctx, GLuint program, GLenum pname, GLint *params
     
     switch (pname) {
         case GL_LINK_STATUS:
-            /* If we got here after mglLinkProgram, linking succeeded */
-            *params = GL_TRUE;
+            *params = pptr->link_status;
             break;
         case GL_DELETE_STATUS:
             *params = GL_FALSE;  /* Programs are not deleted by default */
@@ -889,7 +1013,7 @@ void mglGetProgramiv(GLMContext ctx, GLuint program, GLenum pname, GLint *params
             *params = GL_TRUE;  /* Assume valid */
             break;
         case GL_INFO_LOG_LENGTH:
-            *params = 0;  /* No info log for now */
+            *params = pptr->info_log ? (GLint)strlen(pptr->info_log) + 1 : 0;
             break;
         case GL_ATTACHED_SHADERS:
             {
@@ -929,11 +1053,19 @@ void mglGetProgramInfoLog(GLMContext ctx, GLuint program, GLsizei bufSize, GLsiz
     Program *pptr = findProgram(ctx, program);
     ERROR_CHECK_RETURN(pptr, GL_INVALID_VALUE);
     
-    /* For now, always return an empty info log */
     if (bufSize > 0 && infoLog) {
-        infoLog[0] = '\0';
+        GLsizei len = 0;
+
+        if (pptr->info_log) {
+            len = (GLsizei)strlen(pptr->info_log);
+            if (len > bufSize - 1)
+                len = bufSize - 1;
+            memcpy(infoLog, pptr->info_log, len);
+        }
+
+        infoLog[len] = '\0';
         if (length) {
-            *length = 0;
+            *length = len;
         }
     }
 }
@@ -981,14 +1113,16 @@ void mglDeleteProgramPipelines(GLMContext ctx, GLsizei n, const GLuint *pipeline
 
 void mglBindProgramPipeline(GLMContext ctx, GLuint pipeline)
 {
-    if (pipeline == 0)
+    ProgramPipeline *ptr = NULL;
+
+    if (pipeline)
     {
-        STATE(program_pipeline) = NULL;
-        STATE(dirty_bits) |= DIRTY_PROGRAM;
-        return;
+        ptr = getProgramPipeline(ctx, pipeline);
     }
-    
-    ProgramPipeline *ptr = getProgramPipeline(ctx, pipeline);
+
+    if (STATE(program_pipeline) == ptr)
+        return;
+
     STATE(program_pipeline) = ptr;
     STATE(dirty_bits) |= DIRTY_PROGRAM;
 }
@@ -0,0 +1,512 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * queries.c
+ * MGL
+ *
+ */
+
+#include <strings.h>
+
+#include "glm_context.h"
+#include "buffers.h"
+#include "queries.h"
+
+static GLint queryTargetIndex(GLenum target)
+{
+    switch(target)
+    {
+        case GL_SAMPLES_PASSED: return _SAMPLES_PASSED_QUERY;
+        case GL_ANY_SAMPLES_PASSED: return _ANY_SAMPLES_PASSED_QUERY;
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE: return _ANY_SAMPLES_PASSED_CONSERVATIVE_QUERY;
+        case GL_PRIMITIVES_GENERATED: return _PRIMITIVES_GENERATED_QUERY;
+        case GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN: return _TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_QUERY;
+        case GL_TIME_ELAPSED: return _TIME_ELAPSED_QUERY;
+    }
+
+    return -1;
+}
+
+static Query *newQuery(GLMContext ctx, GLuint name)
+{
+    Query *ptr;
+
+    ptr = (Query *)malloc(sizeof(Query));
+    assert(ptr);
+
+    bzero(ptr, sizeof(Query));
+
+    ptr->name = name;
+
+    return ptr;
+}
+
+Query *findQuery(GLMContext ctx, GLuint name)
+{
+    return (Query *)searchHashTable(&STATE(query_table), name);
+}
+
+// gen only reserves the name, the object comes with the first begin
+static Query *getQuery(GLMContext ctx, GLuint name)
+{
+    Query *ptr;
+
+    if (name == 0 || name >= STATE(query_table).current_name)
+        return NULL;
+
+    ptr = findQuery(ctx, name);
+
+    if (ptr == NULL)
+    {
+        ptr = newQuery(ctx, name);
+
+        insertHashElement(&STATE(query_table), name, ptr);
+    }
+
+    return ptr;
+}
+
+void countPrimitives(GLMContext ctx, GLenum mode, GLsizei count, GLsizei instancecount)
+{
+    GLuint64 primitives;
+    Query *query;
+
+    primitives = primitiveCount(mode, count) * instancecount;
+
+    query = STATE(active_queries[_PRIMITIVES_GENERATED_QUERY]);
+    if (query)
+        query->primitives += primitives;
+
+    query = STATE(active_queries[_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_QUERY]);
+    if (query && STATE(transform_feedback) && STATE(transform_feedback)->active && STATE(transform_feedback)->paused == GL_FALSE)
+        query->primitives += primitives;
+}
+
+void mglGenQueries(GLMContext ctx, GLsizei n, GLuint *ids)
+{
+    if (n < 0)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
+
+    while(n--)
+    {
+        *ids++ = getNewName(&STATE(query_table));
+    }
+}
+
+void mglCreateQueries(GLMContext ctx, GLenum target, GLsizei n, GLuint *ids)
+{
+    if (queryTargetIndex(target) < 0 && target != GL_TIMESTAMP)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    if (n < 0)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
+
+    mglGenQueries(ctx, n, ids);
+
+    while(n--)
+    {
+        Query *ptr;
+
+        ptr = getQuery(ctx, *ids++);
+        assert(ptr);
+
+        ptr->target = target;
+    }
+}
+
+GLboolean mglIsQuery(GLMContext ctx, GLuint id)
+{
+    if (id == 0 || id >= STATE(query_table).current_name)
+        return GL_FALSE;
+
+    return findQuery(ctx, id) != NULL;
+}
+
+void mglDeleteQueries(GLMContext ctx, GLsizei n, const GLuint *ids)
+{
+    if (n < 0)
+    {
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
+    }
+
+    while(n--)
+    {
+        Query *ptr;
+
+        ptr = findQuery(ctx, *ids);
+
+        if (ptr)
+        {
+            if (ptr->active)
+            {
+                STATE(active_queries[queryTargetIndex(ptr->target)]) = NULL;
+                ptr->active = GL_FALSE;
+
+                ctx->mtl_funcs.mtlEndQuery(ctx, ptr);
+            }
+
+            ctx->mtl_funcs.mtlDeleteQuery(ctx, ptr);
+
+            deleteHashElement(&STATE(query_table), *ids);
+
+            free(ptr);
+        }
+
+        ids++;
+    }
+}
+
+void mglBeginQuery(GLMContext ctx, GLenum target, GLuint id)
+{
+    GLint index;
+    Query *ptr;
+
+    index = queryTargetIndex(target);
+
+    if (index < 0)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    ptr = getQuery(ctx, id);
+
+    if (ptr == NULL || ptr->active || STATE(active_queries[index]))
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    if (ptr->target && ptr->target != target)
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    ptr->target = target;
+    ptr->active = GL_TRUE;
+    ptr->available = GL_FALSE;
+    ptr->result = 0;
+    ptr->primitives = 0;
+
+    STATE(active_queries[index]) = ptr;
+
+    ctx->mtl_funcs.mtlBeginQuery(ctx, ptr);
+}
+
+void mglEndQuery(GLMContext ctx, GLenum target)
+{
+    GLint index;
+    Query *ptr;
+
+    index = queryTargetIndex(target);
+
+    if (index < 0)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    ptr = STATE(active_queries[index]);
+
+    if (ptr == NULL)
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    STATE(active_queries[index]) = NULL;
+    ptr->active = GL_FALSE;
+
+    ctx->mtl_funcs.mtlEndQuery(ctx, ptr);
+}
+
+// only stream 0, there is no geometry stage to emit to the others
+void mglBeginQueryIndexed(GLMContext ctx, GLenum target, GLuint index, GLuint id)
+{
+    ERROR_CHECK_RETURN(index == 0, GL_INVALID_VALUE);
+
+    if (index == 0)
+        mglBeginQuery(ctx, target, id);
+}
+
+void mglEndQueryIndexed(GLMContext ctx, GLenum target, GLuint index)
+{
+    ERROR_CHECK_RETURN(index == 0, GL_INVALID_VALUE);
+
+    if (index == 0)
+        mglEndQuery(ctx, target);
+}
+
+void mglQueryCounter(GLMContext ctx, GLuint id, GLenum target)
+{
+    Query *ptr;
+
+    if (target != GL_TIMESTAMP)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    ptr = getQuery(ctx, id);
+
+    if (ptr == NULL || ptr->active || (ptr->target && ptr->target != GL_TIMESTAMP))
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    ptr->target = GL_TIMESTAMP;
+    ptr->available = GL_FALSE;
+    ptr->result = 0;
+
+    ctx->mtl_funcs.mtlEndQuery(ctx, ptr);
+}
+
+void mglGetQueryiv(GLMContext ctx, GLenum target, GLenum pname, GLint *params)
+{
+    GLint index;
+
+    index = queryTargetIndex(target);
+
+    if (index < 0 && target != GL_TIMESTAMP)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    switch(pname)
+    {
+        case GL_CURRENT_QUERY:
+            *params = (index >= 0 && STATE(active_queries[index])) ? STATE(active_queries[index])->name : 0;
+            break;
+
+        case GL_QUERY_COUNTER_BITS:
+            *params = 64;
+            break;
+
+        default:
+            ERROR_RETURN(GL_INVALID_ENUM);
+            break;
+    }
+}
+
+void mglGetQueryIndexediv(GLMContext ctx, GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    ERROR_CHECK_RETURN(index == 0, GL_INVALID_VALUE);
+
+    if (index == 0)
+        mglGetQueryiv(ctx, target, pname, params);
+}
+
+// the value pname asks for, false when it isn't there yet and nothing should be written
+static bool queryValue(GLMContext ctx, Query *ptr, GLenum pname, GLuint64 *value)
+{
+    switch(pname)
+    {
+        case GL_QUERY_RESULT:
+            ctx->mtl_funcs.mtlGetQueryResult(ctx, ptr, GL_TRUE);
+            *value = ptr->result;
+            return true;
+
+        case GL_QUERY_RESULT_NO_WAIT:
+            if (ctx->mtl_funcs.mtlGetQueryResult(ctx, ptr, GL_FALSE) == GL_FALSE)
+                return false;
+            *value = ptr->result;
+            return true;
+
+        case GL_QUERY_RESULT_AVAILABLE:
+            *value = ctx->mtl_funcs.mtlGetQueryResult(ctx, ptr, GL_FALSE);
+            return true;
+
+        case GL_QUERY_TARGET:
+            *value = ptr->target;
+            return true;
+    }
+
+    return false;
+}
+
+static bool checkQueryPname(GLenum pname)
+{
+    switch(pname)
+    {
+        case GL_QUERY_RESULT:
+        case GL_QUERY_RESULT_NO_WAIT:
+        case GL_QUERY_RESULT_AVAILABLE:
+        case GL_QUERY_TARGET:
+            return true;
+    }
+
+    return false;
+}
+
+static GLuint64 clampQueryValue(GLuint64 value, GLenum type)
+{
+    switch(type)
+    {
+        case GL_INT: return value > 0x7FFFFFFF ? 0x7FFFFFFF : value;
+        case GL_UNSIGNED_INT: return value > 0xFFFFFFFF ? 0xFFFFFFFF : value;
+        case GL_INT64_ARB: return value > 0x7FFFFFFFFFFFFFFFull ? 0x7FFFFFFFFFFFFFFFull : value;
+    }
+
+    return value;
+}
+
+// with a query buffer the result lands in the buffer at offset, occlusion results the
+// cpu doesn't have yet are copied there on the gpu so nothing waits
+static void queryObject(GLMContext ctx, GLuint id, Buffer *buf, GLenum pname, GLintptr offset, void *params, GLenum type)
+{
+    GLuint64 value;
+    GLsizeiptr size;
+    Query *ptr;
+
+    if (checkQueryPname(pname) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
+
+    ptr = findQuery(ctx, id);
+
+    if (ptr == NULL || ptr->active || ptr->target == 0)
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
+    size = (type == GL_INT || type == GL_UNSIGNED_INT) ? sizeof(GLuint) : sizeof(GLuint64);
+
+    if (buf)
+    {
+        if (offset < 0 || offset % size || offset + size > buf->size)
+        {
+            ERROR_RETURN(GL_INVALID_VALUE);
+            return;
+        }
+
+        if (pname == GL_QUERY_RESULT &&
+            (ptr->target == GL_SAMPLES_PASSED || ptr->target == GL_ANY_SAMPLES_PASSED ||
+             ptr->target == GL_ANY_SAMPLES_PASSED_CONSERVATIVE) &&
+            ctx->mtl_funcs.mtlGetQueryResult(ctx, ptr, GL_FALSE) == GL_FALSE)
+        {
+            ctx->mtl_funcs.mtlQueryResultToBuffer(ctx, ptr, buf, offset, size == sizeof(GLuint64));
+            return;
+        }
+    }
+
+    if (queryValue(ctx, ptr, pname, &value) == false)
+        return;
+
+    value = clampQueryValue(value, type);
+
+    if (buf)
+    {
+        if (size == sizeof(GLuint))
+        {
+            GLuint value32 = (GLuint)value;
+
+            writeBufferSubData(ctx, buf, offset, size, &value32);
+        }
+        else
+        {
+            writeBufferSubData(ctx, buf, offset, size, &value);
+        }
+    }
+    else if (size == sizeof(GLuint))
+    {
+        *(GLuint *)params = (GLuint)value;
+    }
+    else
+    {
+        *(GLuint64 *)params = value;
+    }
+}
+
+void mglGetQueryObjectiv(GLMContext ctx, GLuint id, GLenum pname, GLint *params)
+{
+    queryObject(ctx, id, STATE(buffers[_QUERY_BUFFER]), pname, (GLintptr)params, params, GL_INT);
+}
+
+void mglGetQueryObjectuiv(GLMContext ctx, GLuint id, GLenum pname, GLuint *params)
+{
+    queryObject(ctx, id, STATE(buffers[_QUERY_BUFFER]), pname, (GLintptr)params, params, GL_UNSIGNED_INT);
+}
+
+void mglGetQueryObjecti64v(GLMContext ctx, GLuint id, GLenum pname, GLint64 *params)
+{
+    queryObject(ctx, id, STATE(buffers[_QUERY_BUFFER]), pname, (GLintptr)params, params, GL_INT64_ARB);
+}
+
+void mglGetQueryObjectui64v(GLMContext ctx, GLuint id, GLenum pname, GLuint64 *params)
+{
+    queryObject(ctx, id, STATE(buffers[_QUERY_BUFFER]), pname, (GLintptr)params, params, GL_UNSIGNED_INT64_ARB);
+}
+
+static Buffer *queryBuffer(GLMContext ctx, GLuint buffer)
+{
+    Buffer *buf;
+
+    buf = (Buffer *)searchHashTable(&STATE(buffer_table), buffer);
+
+    if (buf == NULL)
+    {
+        ERROR_RETURN_VALUE(GL_INVALID_OPERATION, NULL);
+    }
+
+    return buf;
+}
+
+void mglGetQueryBufferObjectiv(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    Buffer *buf = queryBuffer(ctx, buffer);
+
+    if (buf)
+        queryObject(ctx, id, buf, pname, offset, NULL, GL_INT);
+}
+
+void mglGetQueryBufferObjectuiv(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    Buffer *buf = queryBuffer(ctx, buffer);
+
+    if (buf)
+        queryObject(ctx, id, buf, pname, offset, NULL, GL_UNSIGNED_INT);
+}
+
+void mglGetQueryBufferObjecti64v(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    Buffer *buf = queryBuffer(ctx, buffer);
+
+    if (buf)
+        queryObject(ctx, id, buf, pname, offset, NULL, GL_INT64_ARB);
+}
+
+void mglGetQueryBufferObjectui64v(GLMContext ctx, GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    Buffer *buf = queryBuffer(ctx, buffer);
+
+    if (buf)
+        queryObject(ctx, id, buf, pname, offset, NULL, GL_UNSIGNED_INT64_ARB);
+}
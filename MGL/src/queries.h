@@ -0,0 +1,16 @@
+//
+//  queries.h
+//  MGL
+//
+
+#ifndef queries_h
+#define queries_h
+
+#include "glm_context.h"
+
+Query *findQuery(GLMContext ctx, GLuint name);
+
+// adds a draw to the active primitives generated / transform feedback written queries
+void countPrimitives(GLMContext ctx, GLenum mode, GLsizei count, GLsizei instancecount);
+
+#endif /* queries_h */
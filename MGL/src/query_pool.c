@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * query_pool.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "query_pool.h"
+
+void initQueryPool(QueryPool *pool)
+{
+    memset(pool, 0, sizeof(QueryPool));
+
+    // handed out from slot 0 up
+    for(GLuint i=0; i<QUERY_POOL_SLOTS; i++)
+        pool->free[i] = QUERY_POOL_SLOTS - 1 - i;
+
+    pool->free_count = QUERY_POOL_SLOTS;
+}
+
+GLboolean queryPoolAlloc(QueryPool *pool, GLuint64 completed, GLuint *slot)
+{
+    while(pool->retired_count)
+    {
+        QueryPoolRetired *retired;
+
+        retired = &pool->retired[pool->first_retired];
+
+        if (retired->serial > completed)
+            break;
+
+        pool->free[pool->free_count++] = retired->slot;
+
+        pool->first_retired = (pool->first_retired + 1) % QUERY_POOL_SLOTS;
+        pool->retired_count--;
+    }
+
+    if (pool->free_count == 0)
+    {
+        pool->exhausted++;
+
+        return GL_FALSE;
+    }
+
+    *slot = pool->free[--pool->free_count];
+    pool->refs[*slot] = 1;
+
+    pool->allocations++;
+
+    return GL_TRUE;
+}
+
+void queryPoolRetain(QueryPool *pool, GLuint slot)
+{
+    pool->refs[slot]++;
+}
+
+void queryPoolRelease(QueryPool *pool, GLuint slot, GLuint64 serial)
+{
+    QueryPoolRetired *retired;
+
+    if (--pool->refs[slot])
+        return;
+
+    // every slot is either free, retired or referenced so this never overflows
+    retired = &pool->retired[(pool->first_retired + pool->retired_count) % QUERY_POOL_SLOTS];
+    retired->slot = slot;
+    retired->serial = serial;
+
+    pool->retired_count++;
+}
+
+GLuint64 primitiveCount(GLenum mode, GLuint count)
+{
+    switch(mode)
+    {
+        case GL_POINTS: return count;
+        case GL_LINES: return count / 2;
+        case GL_LINE_LOOP: return count > 1 ? count : 0;
+        case GL_LINE_STRIP: return count > 1 ? count - 1 : 0;
+        case GL_TRIANGLES: return count / 3;
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN: return count > 2 ? count - 2 : 0;
+        case GL_LINES_ADJACENCY: return count / 4;
+        case GL_LINE_STRIP_ADJACENCY: return count > 3 ? count - 3 : 0;
+        case GL_TRIANGLES_ADJACENCY: return count / 6;
+        case GL_TRIANGLE_STRIP_ADJACENCY: return count > 5 ? (count - 4) / 2 : 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * render_pass.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "render_pass.h"
+
+void initRenderPass(RenderPass *pass)
+{
+    memset(pass, 0, sizeof(RenderPass));
+
+    pass->clear_depth = 1.0;
+}
+
+void renderPassClearColor(RenderPass *pass, GLbitfield slots, const GLfloat color[4])
+{
+    slots &= RENDER_PASS_COLOR_MASK;
+
+    for (int i=0; slots; i++, slots >>= 1)
+    {
+        if ((slots & 0x1) == 0)
+            continue;
+
+        // a clear after an invalidate defines the contents again
+        pass->pending[i] = (pass->pending[i] & ~RENDER_PASS_INVALIDATED) | RENDER_PASS_CLEARED;
+
+        memcpy(pass->clear_color[i], color, sizeof(pass->clear_color[i]));
+    }
+}
+
+void renderPassClearDepth(RenderPass *pass, GLdouble depth)
+{
+    pass->pending[RENDER_PASS_DEPTH] = RENDER_PASS_CLEARED;
+    pass->clear_depth = depth;
+}
+
+void renderPassClearStencil(RenderPass *pass, GLuint stencil)
+{
+    pass->pending[RENDER_PASS_STENCIL] = RENDER_PASS_CLEARED;
+    pass->clear_stencil = stencil;
+}
+
+void renderPassInvalidate(RenderPass *pass, GLbitfield slots)
+{
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        if ((slots & (0x1 << i)) == 0)
+            continue;
+
+        // the next pass doesn't need the old contents, a pending clear is discarded as well
+        pass->pending[i] = RENDER_PASS_INVALIDATED;
+
+        // and the active pass doesn't need to write back what it drew so far
+        if (pass->active)
+        {
+            pass->current[i] = RENDER_PASS_INVALIDATED;
+        }
+    }
+}
+
+void renderPassDraw(RenderPass *pass)
+{
+    if (pass->active == GL_FALSE)
+        return;
+
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        if ((pass->attachments & (0x1 << i)) == 0)
+            continue;
+
+        // we don't know which attachments a draw writes, assume all of them
+        pass->current[i] = RENDER_PASS_DRAWN;
+        pass->pending[i] &= ~RENDER_PASS_INVALIDATED;
+    }
+}
+
+void renderPassSetResolve(RenderPass *pass, GLbitfield slots)
+{
+    pass->resolve = slots;
+}
+
+GLboolean renderPassNeedsRestart(const RenderPass *pass)
+{
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        if (pass->pending[i] & RENDER_PASS_CLEARED)
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+void renderPassDropPending(RenderPass *pass)
+{
+    memset(pass->pending, 0, sizeof(pass->pending));
+}
+
+void renderPassBegin(RenderPass *pass, GLbitfield attachments, RenderPassActions *actions)
+{
+    memset(actions, 0, sizeof(RenderPassActions));
+
+    actions->attachments = attachments;
+
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        GLubyte history;
+
+        history = pass->pending[i];
+
+        // clears and invalidates on attachments not in this pass have nothing to apply to
+        pass->pending[i] = 0;
+        pass->current[i] = 0;
+
+        if ((attachments & (0x1 << i)) == 0)
+            continue;
+
+        if (history & RENDER_PASS_CLEARED)
+        {
+            actions->load[i] = RENDER_PASS_LOAD_CLEAR;
+            pass->loads_skipped++;
+        }
+        else if (history & RENDER_PASS_INVALIDATED)
+        {
+            actions->load[i] = RENDER_PASS_LOAD_DONT_CARE;
+            pass->loads_skipped++;
+
+            // nothing worth storing unless something is drawn
+            pass->current[i] = RENDER_PASS_INVALIDATED;
+        }
+        else
+        {
+            actions->load[i] = RENDER_PASS_LOAD_LOAD;
+        }
+    }
+
+    memcpy(actions->clear_color, pass->clear_color, sizeof(actions->clear_color));
+    actions->clear_depth = pass->clear_depth;
+    actions->clear_stencil = pass->clear_stencil;
+
+    pass->attachments = attachments;
+    pass->active = GL_TRUE;
+    pass->passes++;
+    pass->frame_passes++;
+}
+
+void renderPassEnd(RenderPass *pass, RenderPassActions *actions)
+{
+    if (pass->active == GL_FALSE)
+    {
+        actions->attachments = 0;
+        return;
+    }
+
+    actions->attachments = pass->attachments;
+
+    for (int i=0; i<RENDER_PASS_ATTACHMENTS; i++)
+    {
+        GLboolean store, resolve;
+
+        if ((pass->attachments & (0x1 << i)) == 0)
+            continue;
+
+        // anything loaded, cleared or drawn is kept unless it was invalidated afterwards
+        store = (pass->current[i] & RENDER_PASS_INVALIDATED) == 0;
+        resolve = (pass->resolve & (0x1 << i)) != 0;
+
+        if (resolve)
+        {
+            actions->store[i] = store ? RENDER_PASS_STORE_STORE_AND_RESOLVE : RENDER_PASS_STORE_RESOLVE;
+        }
+        else
+        {
+            actions->store[i] = store ? RENDER_PASS_STORE_STORE : RENDER_PASS_STORE_DONT_CARE;
+        }
+
+        if (store == GL_FALSE)
+            pass->stores_skipped++;
+
+        pass->current[i] = 0;
+    }
+
+    pass->active = GL_FALSE;
+}
+
+void renderPassEndFrame(RenderPass *pass)
+{
+    pass->last_frame_passes = pass->frame_passes;
+    pass->frame_passes = 0;
+}
@@ -29,6 +29,8 @@
 
 #include "pixel_utils.h"
 #include "glm_context.h"
+#include "pixel_store.h"
+#include "buffers.h"
 
 void mglClear(GLMContext ctx, GLbitfield mask)
 {
@@ -36,9 +38,18 @@ void mglClear(GLMContext ctx, GLbitfield mask)
     {
         fprintf(stderr, "MGL Error: mglClear: invalid mask 0x%x\n", mask);
         ERROR_RETURN(GL_INVALID_VALUE);
+        return;
     }
 
-    ctx->state.clear_bitmask = mask;
+    // clears become load actions on the next render pass
+    if (mask & GL_COLOR_BUFFER_BIT)
+        renderPassClearColor(&STATE(render_pass), RENDER_PASS_COLOR_MASK, STATE(color_clear_value));
+
+    if (mask & GL_DEPTH_BUFFER_BIT)
+        renderPassClearDepth(&STATE(render_pass), STATE_VAR(depth_clear_value));
+
+    if (mask & GL_STENCIL_BUFFER_BIT)
+        renderPassClearStencil(&STATE(render_pass), STATE_VAR(stencil_clear_value));
 }
 
 void mglClearColor(GLMContext ctx, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
@@ -47,47 +58,34 @@ void mglClearColor(GLMContext ctx, GLfloat red, GLfloat green, GLfloat blue, GLf
     ctx->state.color_clear_value[1] = green;
     ctx->state.color_clear_value[2] = blue;
     ctx->state.color_clear_value[3] = alpha;
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
 }
 
 void mglClearStencil(GLMContext ctx, GLint s)
 {
     ctx->state.var.stencil_clear_value = s;
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
 }
 
 void mglClearDepth(GLMContext ctx, GLdouble depth)
 {
     ctx->state.var.depth_clear_value = depth;
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
 }
 
 void mglClearBufferfv(GLMContext ctx, GLenum buffer, GLint drawbuffer, const GLfloat *value)
 {
-    Framebuffer * fbo = ctx->state.framebuffer;
-    FBOAttachment * fboa;
-
     switch (buffer) {
         case GL_COLOR:
-            fboa = &fbo->color_attachments[drawbuffer];
-            fboa->clear_bitmask |= GL_COLOR_BUFFER_BIT;
-            fboa->clear_color[0] = value[0];
-            fboa->clear_color[1] = value[1];
-            fboa->clear_color[2] = value[2];
-            fboa->clear_color[3] = value[3];
+            if (drawbuffer < 0 || drawbuffer >= MAX_COLOR_ATTACHMENTS)
+            {
+                ERROR_RETURN(GL_INVALID_VALUE);
+                return;
+            }
+            renderPassClearColor(&STATE(render_pass), 0x1 << drawbuffer, value);
             break;
         case GL_DEPTH:
-            fboa = &fbo->depth;
-            fboa->clear_bitmask |= GL_DEPTH_BUFFER_BIT;
-            fboa->clear_color[0] = value[0];
+            renderPassClearDepth(&STATE(render_pass), value[0]);
             break;
         case GL_STENCIL:
-            fboa = &fbo->stencil;
-            fboa->clear_bitmask |= GL_STENCIL_BUFFER_BIT;
-            fboa->clear_color[0] = value[0];
+            renderPassClearStencil(&STATE(render_pass), (GLuint)value[0]);
             break;
         default:
             fprintf(stderr, "MGL Error: mglClearBufferfv: invalid buffer 0x%x\n", buffer);
@@ -98,18 +96,10 @@ void mglClearBufferfv(GLMContext ctx, GLenum buffer, GLint drawbuffer, const GLf
 
 void mglClearBufferfi(GLMContext ctx, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
-    Framebuffer * fbo = ctx->state.framebuffer;
-    FBOAttachment * fboa;
-
     switch (buffer) {
         case GL_DEPTH_STENCIL:
-            fboa = &fbo->depth;
-            fboa->clear_bitmask |= GL_DEPTH_BUFFER_BIT;
-            fboa->clear_color[0] = depth;
-
-            fboa = &fbo->stencil;
-            fboa->clear_bitmask |= GL_STENCIL_BUFFER_BIT;
-            fboa->clear_color[0] = stencil;
+            renderPassClearDepth(&STATE(render_pass), depth);
+            renderPassClearStencil(&STATE(render_pass), stencil);
             break;
         default:
             fprintf(stderr, "MGL Error: mglClearBufferfi: invalid buffer 0x%x\n", buffer);
@@ -180,8 +170,11 @@ void mglDrawBuffer(GLMContext ctx, GLenum buf)
         fbo->color_attachments[buf-GL_COLOR_ATTACHMENT0].buf.rbo->is_draw_buffer = GL_TRUE;
     }
 
+    if (STATE(draw_buffer) == buf)
+        return;
+
     STATE(draw_buffer) = buf;
-    STATE(dirty_bits) |= DIRTY_STATE;
+    STATE(dirty_bits) |= DIRTY_RENDER_PASS;
 }
 
 void mglReadBuffer(GLMContext ctx, GLenum buf)
@@ -219,7 +212,6 @@ void mglReadBuffer(GLMContext ctx, GLenum buf)
     }
 
     STATE(read_buffer) = buf;
-    STATE(dirty_bits) |= DIRTY_STATE;
 }
 
 void mglPixelStorei(GLMContext ctx, GLenum pname, GLint param)
@@ -356,29 +348,19 @@ void mglReadPixels(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei heig
         return;
     }
 
-    size_t row_length;
-    size_t pitch_size;
-    GLuint pitch;
-    size_t buffer_size;
+    PixelStoreLayout layout;
+    size_t pack_size;
 
-    row_length = (STATE(pack.row_length) ? (size_t)STATE(pack.row_length) : (size_t)width);
-    pitch_size = row_length * (size_t)pixel_size;
-    if (pitch_size > UINT_MAX)
+    if (pixelStoreLayout(&STATE(pack), 2, format, type, width, height, &layout) == false)
     {
-        fprintf(stderr, "MGL Error: mglReadPixels: pitch overflow (row_length=%zu pixel_size=%u)\n", row_length, pixel_size);
-        ERROR_RETURN(GL_OUT_OF_MEMORY);
+        fprintf(stderr, "MGL Error: mglReadPixels: invalid format/type combination (format=0x%x type=0x%x)\n", format, type);
+        ERROR_RETURN(GL_INVALID_ENUM);
     }
-    pitch = (GLuint)pitch_size;
 
-    if (pitch_size > 0 && (size_t)height > (SIZE_MAX / pitch_size))
-    {
-        fprintf(stderr, "MGL Error: mglReadPixels: buffer_size overflow (pitch=%zu height=%d)\n", pitch_size, height);
-        ERROR_RETURN(GL_OUT_OF_MEMORY);
-    }
-    buffer_size = pitch_size * (size_t)height;
-    if (buffer_size > UINT_MAX)
+    pack_size = pixelStoreSpan(&layout, width, height, 1);
+    if (pack_size > UINT_MAX)
     {
-        fprintf(stderr, "MGL Error: mglReadPixels: buffer_size exceeds API limit (%zu)\n", buffer_size);
+        fprintf(stderr, "MGL Error: mglReadPixels: buffer_size exceeds API limit (%zu)\n", pack_size);
         ERROR_RETURN(GL_OUT_OF_MEMORY);
     }
 
@@ -467,20 +449,31 @@ void mglReadPixels(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei heig
             ERROR_RETURN(GL_INVALID_OPERATION);
         }
 
-        if ((size_t)ptr->size < offset || (size_t)ptr->size - offset < buffer_size)
+        if ((size_t)ptr->size < offset || (size_t)ptr->size - offset < pack_size)
         {
             fprintf(stderr, "MGL Error: mglReadPixels: pixel pack buffer too small (size=%ld offset=%lu req=%zu)\n",
-                    (long)ptr->size, (unsigned long)offset, buffer_size);
+                    (long)ptr->size, (unsigned long)offset, pack_size);
             ERROR_RETURN(GL_INVALID_OPERATION);
         }
 
+        // queue a gpu copy, conversion and y flip happen when the buffer is mapped
+        if (readbackFormatSupported(format, type) &&
+            queueBufferReadback(ctx, ptr, (size_t)offset, x, y, width, height, format, type))
+        {
+            return;
+        }
+
         base = (uint8_t *)(uintptr_t)ptr->data.buffer_data;
         if (!base)
         {
             fprintf(stderr, "MGL Error: mglReadPixels: pixel pack buffer has no CPU storage\n");
             ERROR_RETURN(GL_INVALID_OPERATION);
+            return;
         }
 
+        // an earlier queued read lands first
+        resolveBufferReadback(ctx, ptr, true);
+
         pixels = (void *)(base + offset);
     }
 
@@ -488,24 +481,22 @@ void mglReadPixels(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei heig
     {
         fprintf(stderr, "MGL Error: mglReadPixels: pixels is NULL with no pixel pack buffer bound\n");
         ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    kern_return_t err;
-    vm_address_t buffer_data;
-
-    err = vm_allocate((vm_map_t) mach_task_self(),
-                      (vm_address_t*) &buffer_data,
-                      (vm_size_t)buffer_size,
-                      VM_FLAGS_ANYWHERE);
-    if (err)
+    if (readDrawablePixels(ctx, pixels, &layout, x, y, width, height, format, type) == false)
     {
-        ERROR_RETURN(GL_OUT_OF_MEMORY);
+        fprintf(stderr, "MGL Error: mglReadPixels: cannot read back read buffer as format/type (format=0x%x type=0x%x)\n", format, type);
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
     }
 
-    ctx->mtl_funcs.mtlReadDrawable(ctx, (void *)buffer_data, pitch, (GLuint)buffer_size, x, y, width, height);
-
-    memcpy(pixels, (void *)buffer_data, buffer_size);
-    
-    vm_deallocate(mach_host_self(), buffer_data, buffer_size);
+    // a pack buffer written in place, bindings of it need the new contents
+    if (STATE(buffers[_PIXEL_PACK_BUFFER]))
+    {
+        BUMP_GENERATION(STATE(buffers[_PIXEL_PACK_BUFFER]));
+        STATE(buffers[_PIXEL_PACK_BUFFER])->data.dirty_bits |= DIRTY_BUFFER_DATA;
+        STATE(dirty_bits) |= DIRTY_BUFFER;
+    }
 }
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * sampler_cache.c
+ * MGL
+ *
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "glm_context.h"
+#include "sampler_cache.h"
+#include "simd_utils.h"
+
+void initSamplerKey(SamplerKey *key, const TextureParameter *params, GLenum target)
+{
+    // padding is part of the hash and compare
+    memset(key, 0, sizeof(SamplerKey));
+
+    key->min_filter = params->min_filter;
+    key->mag_filter = params->mag_filter;
+    key->wrap_s = params->wrap_s;
+    key->wrap_t = params->wrap_t;
+    key->wrap_r = params->wrap_r;
+    key->compare_mode = params->compare_mode;
+    key->compare_func = params->compare_func;
+    key->min_lod = params->min_lod;
+    key->max_lod = params->max_lod;
+    key->lod_bias = params->lod_bias;
+
+    // anything up to 1 is no anisotropic filtering
+    key->max_anisotropy = (params->max_anisotropy > 1.0) ? params->max_anisotropy : 1.0;
+
+    memcpy(key->border_color, params->border_color, sizeof(key->border_color));
+
+    key->normalized_coords = samplerNormalizedCoords(params, target);
+}
+
+GLboolean samplerNormalizedCoords(const TextureParameter *params, GLenum target)
+{
+    if (target == GL_TEXTURE_RECTANGLE &&
+        params->wrap_s == GL_CLAMP_TO_EDGE &&
+        params->wrap_t == GL_CLAMP_TO_EDGE &&
+        params->wrap_r == GL_CLAMP_TO_EDGE)
+    {
+        return GL_FALSE;
+    }
+
+    return GL_TRUE;
+}
+
+void initSamplerCache(SamplerCache *cache)
+{
+    memset(cache, 0, sizeof(SamplerCache));
+}
+
+SamplerCacheEntry *samplerCacheAcquire(SamplerCache *cache, const SamplerKey *key)
+{
+    SamplerCacheEntry *entry;
+    GLuint hash;
+
+    cache->requested++;
+
+    hash = hashBytes(key, sizeof(SamplerKey));
+
+    for(entry = cache->buckets[hash % SAMPLER_CACHE_BUCKETS]; entry; entry = entry->next)
+    {
+        if (entry->hash == hash &&
+            memcmp(&entry->key, key, sizeof(SamplerKey)) == 0)
+        {
+            entry->refcount++;
+
+            return entry;
+        }
+    }
+
+    entry = (SamplerCacheEntry *)malloc(sizeof(SamplerCacheEntry));
+    if (entry == NULL)
+    {
+        fprintf(stderr, "MGL ERROR: samplerCacheAcquire failed to allocate entry\n");
+        return NULL;
+    }
+
+    entry->key = *key;
+    entry->hash = hash;
+    entry->refcount = 1;
+    entry->mtl_data = NULL;
+
+    entry->next = cache->buckets[hash % SAMPLER_CACHE_BUCKETS];
+    cache->buckets[hash % SAMPLER_CACHE_BUCKETS] = entry;
+
+    cache->unique++;
+    cache->created++;
+
+    return entry;
+}
+
+void *samplerCacheRelease(SamplerCache *cache, SamplerCacheEntry *entry)
+{
+    SamplerCacheEntry **link;
+    void *mtl_data;
+
+    assert(entry->refcount);
+
+    entry->refcount--;
+    if (entry->refcount)
+        return NULL;
+
+    for(link = &cache->buckets[entry->hash % SAMPLER_CACHE_BUCKETS]; *link; link = &(*link)->next)
+    {
+        if (*link == entry)
+        {
+            *link = entry->next;
+            break;
+        }
+    }
+
+    mtl_data = entry->mtl_data;
+
+    free(entry);
+
+    cache->unique--;
+
+    return mtl_data;
+}
+
+void releaseTexParamSampler(GLMContext ctx, TextureParameter *params)
+{
+    void *mtl_data;
+
+    if (params->sampler_entry == NULL)
+        return;
+
+    mtl_data = samplerCacheRelease(&STATE(sampler_cache), params->sampler_entry);
+    params->sampler_entry = NULL;
+
+    if (mtl_data)
+    {
+        ctx->mtl_funcs.mtlDeleteMTLObj(ctx, mtl_data);
+    }
+}
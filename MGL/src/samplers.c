@@ -176,10 +176,7 @@ void mglDeleteSamplers(GLMContext ctx, GLsizei count, const GLuint *samplers)
 
             deleteHashElement(&ctx->state.sampler_table, sampler);
 
-            if (ptr->mtl_data)
-            {
-                ctx->mtl_funcs.mtlDeleteMTLObj(ctx, ptr->mtl_data);
-            }
+            releaseTexParamSampler(ctx, &ptr->params);
 
             free(ptr);
         }
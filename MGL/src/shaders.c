@@ -415,13 +415,15 @@ void mglShaderSource(GLMContext ctx, GLuint shader, GLsizei count, const GLchar
     ptr->dirty_bits |= DIRTY_SHADER;
 }
 
-void mglCompileShader(GLMContext ctx, GLuint shader)
+static void compileShader(GLMContext ctx, GLuint shader)
 {
     Shader *ptr;
     glslang_input_t glsl_input;
     glslang_shader_t *glsl_shader;
     int err;
 
+    TRACE_SCOPE("glslang compile", TRACE_SHADER);
+
     ERROR_CHECK_RETURN(isShader(ctx, shader), GL_INVALID_VALUE);
 
     ptr = findShader(ctx, shader);
@@ -549,6 +551,18 @@ void mglCompileShader(GLMContext ctx, GLuint shader)
     ptr->compiled_glsl_shader = glsl_shader;
 }
 
+void mglCompileShader(GLMContext ctx, GLuint shader)
+{
+    GLuint64 start;
+
+    start = STATS_TIME();
+
+    compileShader(ctx, shader);
+
+    STATS_ADD(shader_compiles, 1);
+    STATS_ADD(shader_compile_ns, STATS_TIME() - start);
+}
+
 void mglGetShaderiv(GLMContext ctx, GLuint shader, GLenum pname, GLint *params)
 {
     Shader *ptr;
@@ -21,8 +21,50 @@
 #include "mgl.h"
 #include "glm_context.h"
 
-#define ENABLE_CAP(_cap_)   ctx->state.caps._cap_ = true; break
-#define DISABLE_CAP(_cap_)   ctx->state.caps._cap_ = false; break
+// engines set the same caps over and over, only a change dirties anything
+#define SET_CAP(_cap_, _val_)   if (ctx->state.caps._cap_ == _val_) return; ctx->state.caps._cap_ = _val_; break
+#define ENABLE_CAP(_cap_)   SET_CAP(_cap_, true)
+#define DISABLE_CAP(_cap_)   SET_CAP(_cap_, false)
+
+// most caps are dynamic state on the render encoder, only a few need a new pipeline or pass
+static GLuint dirtyBitsForCap(GLMContext ctx, GLenum cap)
+{
+    switch(cap)
+    {
+        case GL_CULL_FACE:
+        case GL_DEPTH_CLAMP:
+        case GL_POLYGON_OFFSET_POINT:
+        case GL_POLYGON_OFFSET_LINE:
+        case GL_POLYGON_OFFSET_FILL:
+            return DIRTY_RASTER;
+
+        case GL_SCISSOR_TEST:
+            return DIRTY_VIEWPORT;
+
+        case GL_DEPTH_TEST:
+        case GL_STENCIL_TEST:
+            // the default framebuffer only attaches depth / stencil while the test is enabled
+            if (ctx->state.framebuffer == NULL)
+                return DIRTY_DEPTH_STENCIL | DIRTY_RENDER_PASS;
+
+            return DIRTY_DEPTH_STENCIL;
+
+        case GL_BLEND:
+            return DIRTY_ALPHA_STATE;
+
+        case GL_COLOR_LOGIC_OP:
+        case GL_MULTISAMPLE:
+        case GL_SAMPLE_ALPHA_TO_COVERAGE:
+        case GL_SAMPLE_ALPHA_TO_ONE:
+        case GL_RASTERIZER_DISCARD:
+        case GL_FRAMEBUFFER_SRGB:
+        case GL_PROGRAM_POINT_SIZE:
+            return DIRTY_PIPELINE_STATE;
+    }
+
+    // hints, debug output, smoothing.. nothing the metal side looks at
+    return 0;
+}
 
 void mglDisable(GLMContext ctx, GLenum cap)
 {
@@ -66,7 +108,7 @@ void mglDisable(GLMContext ctx, GLenum cap)
             break;
     }
 
-    ctx->state.dirty_bits |= DIRTY_STATE | DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= dirtyBitsForCap(ctx, cap);
 }
 
 void mglEnable(GLMContext ctx, GLenum cap)
@@ -112,7 +154,13 @@ void mglEnable(GLMContext ctx, GLenum cap)
             break;
     }
 
-    ctx->state.dirty_bits |= DIRTY_STATE | DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= dirtyBitsForCap(ctx, cap);
+}
+
+void mglPrimitiveRestartIndex(GLMContext ctx, GLuint index)
+{
+    // read at draw time, indices are translated when metal's all ones index doesn't match
+    ctx->state.var.primitive_restart_index = index;
 }
 
 void mglCullFace(GLMContext ctx, GLenum mode)
@@ -122,14 +170,19 @@ void mglCullFace(GLMContext ctx, GLenum mode)
         case GL_FRONT:
         case GL_BACK:
         case GL_FRONT_AND_BACK:
-            ctx->state.var.cull_face_mode = mode;
             break;
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    if (ctx->state.var.cull_face_mode == mode)
+        return;
+
+    ctx->state.var.cull_face_mode = mode;
+
+    ctx->state.dirty_bits |= DIRTY_RASTER;
 }
 
 void mglFrontFace(GLMContext ctx, GLenum mode)
@@ -138,14 +191,19 @@ void mglFrontFace(GLMContext ctx, GLenum mode)
     {
         case GL_CW:
         case GL_CCW:
-            ctx->state.var.front_face = mode;
             break;
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    if (ctx->state.var.front_face == mode)
+        return;
+
+    ctx->state.var.front_face = mode;
+
+    ctx->state.dirty_bits |= DIRTY_RASTER;
 }
 
 #define HINT(_target_) ctx->state.hints._target_ = mode; break;
@@ -161,27 +219,32 @@ void mglHint(GLMContext ctx, GLenum target, GLenum mode)
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
 }
 
 void mglLineWidth(GLMContext ctx, GLfloat width)
 {
     ERROR_CHECK_RETURN(width <= 0, GL_INVALID_VALUE);
 
+    if (ctx->state.var.line_width == width)
+        return;
+
     ctx->state.var.line_width = width;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= DIRTY_RASTER;
 }
 
 void mglPointSize(GLMContext ctx, GLfloat size)
 {
     ERROR_CHECK_RETURN(size <= 0, GL_INVALID_VALUE);
 
+    if (ctx->state.var.point_size == size)
+        return;
+
     ctx->state.var.point_size = size;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= DIRTY_RASTER;
 }
 
 void mglPolygonMode(GLMContext ctx, GLenum face, GLenum mode)
@@ -193,14 +256,19 @@ void mglPolygonMode(GLMContext ctx, GLenum face, GLenum mode)
         case GL_POINT:
         case GL_LINE:
         case GL_FILL:
-            ctx->state.var.polygon_mode = mode;
             break;
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    if (ctx->state.var.polygon_mode == mode)
+        return;
+
+    ctx->state.var.polygon_mode = mode;
+
+    ctx->state.dirty_bits |= DIRTY_RASTER;
 }
 
 void mglScissor(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei height)
@@ -208,12 +276,18 @@ void mglScissor(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei height)
     ERROR_CHECK_RETURN(width >= 0, GL_INVALID_VALUE);
     ERROR_CHECK_RETURN(height >= 0, GL_INVALID_VALUE);
 
+    if (ctx->state.var.scissor_box[0] == x &&
+        ctx->state.var.scissor_box[1] == y &&
+        ctx->state.var.scissor_box[2] == width &&
+        ctx->state.var.scissor_box[3] == height)
+        return;
+
     ctx->state.var.scissor_box[0] = x;
     ctx->state.var.scissor_box[1] = y;
     ctx->state.var.scissor_box[2] = width;
     ctx->state.var.scissor_box[3] = height;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= DIRTY_VIEWPORT;
 }
 
 void mglLogicOp(GLMContext ctx, GLenum opcode)
@@ -235,17 +309,22 @@ void mglLogicOp(GLMContext ctx, GLenum opcode)
         case GL_AND_INVERTED:
         case GL_OR_REVERSE:
         case GL_OR_INVERTED:
-            ctx->state.var.logic_op = opcode;
             break;
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    if (ctx->state.var.logic_op == opcode)
+        return;
+
+    ctx->state.var.logic_op = opcode;
+
+    ctx->state.dirty_bits |= DIRTY_PIPELINE_STATE;
 }
 
-void mglStencilFunc(GLMContext ctx, GLenum func, GLint ref, GLuint mask)
+static bool validStencilFunc(GLenum func)
 {
     switch(func)
     {
@@ -257,19 +336,10 @@ void mglStencilFunc(GLMContext ctx, GLenum func, GLint ref, GLuint mask)
         case GL_NOTEQUAL:
         case GL_ALWAYS:
         case GL_NEVER:
-            ctx->state.var.stencil_func = func;
-            ctx->state.var.stencil_back_func = func;
-            ctx->state.var.stencil_ref = ref;
-            ctx->state.var.stencil_back_ref = ref;
-            ctx->state.var.stencil_writemask = mask;
-            ctx->state.var.stencil_back_writemask = mask;
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+            return true;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    return false;
 }
 
 static bool validStencilOpSeparate(GLMContext ctx, GLenum op)
@@ -290,166 +360,184 @@ static bool validStencilOpSeparate(GLMContext ctx, GLenum op)
     return false;
 }
 
-void mglStencilOp(GLMContext ctx, GLenum fail, GLenum zfail, GLenum zpass)
+static bool validStencilFace(GLenum face)
 {
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, fail), GL_INVALID_ENUM);
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, zfail), GL_INVALID_ENUM);
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, zpass), GL_INVALID_ENUM);
+    return (face == GL_FRONT || face == GL_BACK || face == GL_FRONT_AND_BACK);
+}
 
-    ctx->state.var.stencil_fail = fail;
-    ctx->state.var.stencil_pass_depth_fail = zfail;
-    ctx->state.var.stencil_pass_depth_pass = zpass;
+// the stencil setters share these, face is already validated
+static void setStencilFunc(GLMContext ctx, GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    if (face != GL_BACK &&
+        (ctx->state.var.stencil_func != func ||
+         ctx->state.var.stencil_ref != (GLuint)ref ||
+         ctx->state.var.stencil_value_mask != mask))
+    {
+        ctx->state.var.stencil_func = func;
+        ctx->state.var.stencil_ref = ref;
+        ctx->state.var.stencil_value_mask = mask;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
-}
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+    }
 
+    if (face != GL_FRONT &&
+        (ctx->state.var.stencil_back_func != func ||
+         ctx->state.var.stencil_back_ref != (GLuint)ref ||
+         ctx->state.var.stencil_back_value_mask != mask))
+    {
+        ctx->state.var.stencil_back_func = func;
+        ctx->state.var.stencil_back_ref = ref;
+        ctx->state.var.stencil_back_value_mask = mask;
 
-void mglStencilMask(GLMContext ctx, GLuint mask)
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+    }
+}
+
+static void setStencilOp(GLMContext ctx, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
 {
-    ctx->state.var.stencil_value_mask = mask;
+    if (face != GL_BACK &&
+        (ctx->state.var.stencil_fail != sfail ||
+         ctx->state.var.stencil_pass_depth_fail != dpfail ||
+         ctx->state.var.stencil_pass_depth_pass != dppass))
+    {
+        ctx->state.var.stencil_fail = sfail;
+        ctx->state.var.stencil_pass_depth_fail = dpfail;
+        ctx->state.var.stencil_pass_depth_pass = dppass;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+    }
+
+    if (face != GL_FRONT &&
+        (ctx->state.var.stencil_back_fail != sfail ||
+         ctx->state.var.stencil_back_pass_depth_fail != dpfail ||
+         ctx->state.var.stencil_back_pass_depth_pass != dppass))
+    {
+        ctx->state.var.stencil_back_fail = sfail;
+        ctx->state.var.stencil_back_pass_depth_fail = dpfail;
+        ctx->state.var.stencil_back_pass_depth_pass = dppass;
+
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+    }
 }
 
-void mglColorMask(GLMContext ctx, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+static void setStencilWriteMask(GLMContext ctx, GLenum face, GLuint mask)
 {
-    if (red == false || green == false  || blue == false  || alpha == false)
+    if (face != GL_BACK && ctx->state.var.stencil_writemask != mask)
     {
-        for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
-        {
-            STATE(caps.use_color_mask[i]) = true;
+        ctx->state.var.stencil_writemask = mask;
 
-            ctx->state.var.color_writemask[i][0] = red;
-            ctx->state.var.color_writemask[i][1] = green;
-            ctx->state.var.color_writemask[i][2] = blue;
-            ctx->state.var.color_writemask[i][3] = alpha;
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+    }
 
-        }
+    if (face != GL_FRONT && ctx->state.var.stencil_back_writemask != mask)
+    {
+        ctx->state.var.stencil_back_writemask = mask;
+
+        ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
     }
-    else
+}
+
+void mglStencilFunc(GLMContext ctx, GLenum func, GLint ref, GLuint mask)
+{
+    if (validStencilFunc(func) == false)
     {
-        for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
-        {
-            STATE(caps.use_color_mask[i]) = false;
-        }
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    setStencilFunc(ctx, GL_FRONT_AND_BACK, func, ref, mask);
 }
 
-void mglDepthMask(GLMContext ctx, GLboolean flag)
+void mglStencilOp(GLMContext ctx, GLenum fail, GLenum zfail, GLenum zpass)
 {
-    ctx->state.var.depth_writemask = flag;
+    if (validStencilOpSeparate(ctx, fail) == false ||
+        validStencilOpSeparate(ctx, zfail) == false ||
+        validStencilOpSeparate(ctx, zpass) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    setStencilOp(ctx, GL_FRONT_AND_BACK, fail, zfail, zpass);
 }
 
-void mglStencilOpSeparate(GLMContext ctx, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+
+void mglStencilMask(GLMContext ctx, GLuint mask)
 {
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, sfail), GL_INVALID_ENUM);
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, dpfail), GL_INVALID_ENUM);
-    ERROR_CHECK_RETURN(validStencilOpSeparate(ctx, dppass), GL_INVALID_ENUM);
+    setStencilWriteMask(ctx, GL_FRONT_AND_BACK, mask);
+}
+
+void mglColorMask(GLMContext ctx, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    bool use_color_mask;
+
+    use_color_mask = (red == false || green == false  || blue == false  || alpha == false);
 
-    switch(face)
+    for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
     {
-        case GL_FRONT:
-            ctx->state.var.stencil_fail = sfail;
-            ctx->state.var.stencil_pass_depth_fail = dpfail;
-            ctx->state.var.stencil_pass_depth_pass = dppass;
-            break;
+        if (STATE(caps.use_color_mask[i]) == use_color_mask &&
+            ctx->state.var.color_writemask[i][0] == red &&
+            ctx->state.var.color_writemask[i][1] == green &&
+            ctx->state.var.color_writemask[i][2] == blue &&
+            ctx->state.var.color_writemask[i][3] == alpha)
+            continue;
 
-        case GL_BACK:
-            ctx->state.var.stencil_back_fail = sfail;
-            ctx->state.var.stencil_back_pass_depth_fail = dpfail;
-            ctx->state.var.stencil_back_pass_depth_pass = dppass;
-            break;
+        STATE(caps.use_color_mask[i]) = use_color_mask;
 
-        case GL_FRONT_AND_BACK:
-            ctx->state.var.stencil_fail = sfail;
-            ctx->state.var.stencil_pass_depth_fail = dpfail;
-            ctx->state.var.stencil_pass_depth_pass = dppass;
-            ctx->state.var.stencil_back_fail = sfail;
-            ctx->state.var.stencil_back_pass_depth_fail = dpfail;
-            ctx->state.var.stencil_back_pass_depth_pass = dppass;
-            break;
+        ctx->state.var.color_writemask[i][0] = red;
+        ctx->state.var.color_writemask[i][1] = green;
+        ctx->state.var.color_writemask[i][2] = blue;
+        ctx->state.var.color_writemask[i][3] = alpha;
 
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ctx->state.dirty_bits |= DIRTY_ALPHA_STATE;
     }
-
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
 }
 
-void mglStencilFuncSeparate(GLMContext ctx, GLenum face, GLenum func, GLint ref, GLuint mask)
+void mglDepthMask(GLMContext ctx, GLboolean flag)
 {
-    switch(func)
-    {
-        case GL_LEQUAL:
-        case GL_GEQUAL:
-        case GL_LESS:
-        case GL_GREATER:
-        case GL_EQUAL:
-        case GL_NOTEQUAL:
-        case GL_ALWAYS:
-        case GL_NEVER:
-            break;
+    if (ctx->state.var.depth_writemask == flag)
+        return;
 
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
-    }
+    ctx->state.var.depth_writemask = flag;
 
-    switch(face)
-    {
-        case GL_FRONT:
-            ctx->state.var.stencil_func = func;
-            ctx->state.var.stencil_ref = ref;
-            ctx->state.var.stencil_writemask = mask;
-            break;
+    ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
+}
 
-        case GL_BACK:
-            ctx->state.var.stencil_back_func = func;
-            ctx->state.var.stencil_back_ref = ref;
-            ctx->state.var.stencil_back_writemask = mask;
-            break;
+void mglStencilOpSeparate(GLMContext ctx, GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    if (validStencilOpSeparate(ctx, sfail) == false ||
+        validStencilOpSeparate(ctx, dpfail) == false ||
+        validStencilOpSeparate(ctx, dppass) == false ||
+        validStencilFace(face) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
 
-        case GL_FRONT_AND_BACK:
-            ctx->state.var.stencil_func = func;
-            ctx->state.var.stencil_ref = ref;
-            ctx->state.var.stencil_writemask = mask;
-            ctx->state.var.stencil_back_func = func;
-            ctx->state.var.stencil_back_ref = ref;
-            ctx->state.var.stencil_back_writemask = mask;
-            break;
+    setStencilOp(ctx, face, sfail, dpfail, dppass);
+}
 
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+void mglStencilFuncSeparate(GLMContext ctx, GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    if (validStencilFunc(func) == false ||
+        validStencilFace(face) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    setStencilFunc(ctx, face, func, ref, mask);
 }
 
 void mglStencilMaskSeparate(GLMContext ctx, GLenum face, GLuint mask)
 {
-    switch(face)
+    if (validStencilFace(face) == false)
     {
-        case GL_FRONT:
-            ctx->state.var.stencil_writemask = mask;
-            break;
-
-        case GL_BACK:
-            ctx->state.var.stencil_back_writemask = mask;
-            break;
-
-        case GL_FRONT_AND_BACK:
-            ctx->state.var.stencil_writemask = mask;
-            ctx->state.var.stencil_back_writemask = mask;
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    setStencilWriteMask(ctx, face, mask);
 }
 
 void mglDepthFunc(GLMContext ctx, GLenum func)
@@ -464,14 +552,19 @@ void mglDepthFunc(GLMContext ctx, GLenum func)
         case GL_NOTEQUAL:
         case GL_ALWAYS:
         case GL_NEVER:
-            ctx->state.var.depth_func = func;
             break;
 
         default:
             ERROR_RETURN(GL_INVALID_ENUM);
+            return;
     }
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    if (ctx->state.var.depth_func == func)
+        return;
+
+    ctx->state.var.depth_func = func;
+
+    ctx->state.dirty_bits |= DIRTY_DEPTH_STENCIL;
 }
 
 static GLdouble _clamp(GLdouble a)
@@ -489,10 +582,14 @@ void mglDepthRange(GLMContext ctx, GLdouble n, GLdouble f)
     n = _clamp(n);
     f = _clamp(f);
 
+    if (ctx->state.var.depth_range[0] == n &&
+        ctx->state.var.depth_range[1] == f)
+        return;
+
     ctx->state.var.depth_range[0] = n;
     ctx->state.var.depth_range[1] = f;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= DIRTY_VIEWPORT;
 }
 
 void mglViewport(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei height)
@@ -500,12 +597,18 @@ void mglViewport(GLMContext ctx, GLint x, GLint y, GLsizei width, GLsizei height
     ERROR_CHECK_RETURN(width > 0, GL_INVALID_VALUE);
     ERROR_CHECK_RETURN(height > 0, GL_INVALID_VALUE);
 
+    if (ctx->state.viewport[0] == x &&
+        ctx->state.viewport[1] == y &&
+        ctx->state.viewport[2] == width &&
+        ctx->state.viewport[3] == height)
+        return;
+
     ctx->state.viewport[0] = x;
     ctx->state.viewport[1] = y;
     ctx->state.viewport[2] = width;
     ctx->state.viewport[3] = height;
 
-    ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+    ctx->state.dirty_bits |= DIRTY_VIEWPORT;
 }
 
 #define RET_VAR(_VAR_, _DEFAULT_)  return (ctx->state.var._VAR_ == _DEFAULT_)
@@ -555,9 +658,12 @@ void mglEnablei(GLMContext ctx, GLenum target, GLuint index)
         if (index >= 0 &&
             index < ctx->state.var.max_clip_distances)
         {
-            ctx->state.caps.clip_distances[index] = true;
+            if (ctx->state.caps.clip_distances[index] != true)
+            {
+                ctx->state.caps.clip_distances[index] = true;
 
-            ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+                ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+            }
 
             return;
         }
@@ -576,9 +682,12 @@ void mglDisablei(GLMContext ctx, GLenum target, GLuint index)
         if (index >= 0 &&
             index < ctx->state.var.max_clip_distances)
         {
-            ctx->state.caps.clip_distances[index] = false;
+            if (ctx->state.caps.clip_distances[index] != false)
+            {
+                ctx->state.caps.clip_distances[index] = false;
 
-            ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+                ctx->state.dirty_bits |= DIRTY_RENDER_STATE;
+            }
 
             return;
         }
@@ -613,15 +722,21 @@ void mglClearDepthf(GLMContext ctx, GLfloat d)
 
 void mglBlendColor(GLMContext ctx, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    if (ctx->state.var.blend_color[0] == red &&
+        ctx->state.var.blend_color[1] == green &&
+        ctx->state.var.blend_color[2] == blue &&
+        ctx->state.var.blend_color[3] == alpha)
+        return;
+
     ctx->state.var.blend_color[0] = red;
     ctx->state.var.blend_color[1] = green;
     ctx->state.var.blend_color[2] = blue;
     ctx->state.var.blend_color[3] = alpha;
 
-    ctx->state.dirty_bits |= DIRTY_STATE;
+    ctx->state.dirty_bits |= DIRTY_BLEND_COLOR;
 }
 
-void mglBlendEquation(GLMContext ctx, GLenum mode)
+static bool validBlendEquation(GLenum mode)
 {
     switch(mode)
     {
@@ -630,206 +745,155 @@ void mglBlendEquation(GLMContext ctx, GLenum mode)
         case GL_FUNC_REVERSE_SUBTRACT:
         case GL_MIN:
         case GL_MAX:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+            return true;
     }
 
-    for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
+    return false;
+}
+
+static bool validBlendFactor(GLenum factor)
+{
+    switch(factor)
     {
-        ctx->state.var.blend_equation_rgb[i] = mode;
-        ctx->state.var.blend_equation_alpha[i] = mode;
+        case GL_ZERO:
+        case GL_ONE:
+        case GL_SRC_COLOR:
+        case GL_ONE_MINUS_SRC_COLOR:
+        case GL_DST_COLOR:
+        case GL_ONE_MINUS_DST_COLOR:
+        case GL_SRC_ALPHA:
+        case GL_ONE_MINUS_SRC_ALPHA:
+        case GL_DST_ALPHA:
+        case GL_ONE_MINUS_DST_ALPHA:
+        case GL_CONSTANT_COLOR:
+        case GL_ONE_MINUS_CONSTANT_COLOR:
+        case GL_CONSTANT_ALPHA:
+        case GL_ONE_MINUS_CONSTANT_ALPHA:
+            return true;
     }
 
-    ctx->state.dirty_bits |= DIRTY_STATE;
+    return false;
 }
 
-void mglBlendEquationi(GLMContext ctx, GLuint buf, GLenum mode)
+// blend state is baked into the pipeline, only a change is worth a new one
+static void setBlendEquation(GLMContext ctx, GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
-    switch(mode)
-    {
-        case GL_FUNC_ADD:
-        case GL_FUNC_SUBTRACT:
-        case GL_FUNC_REVERSE_SUBTRACT:
-        case GL_MIN:
-        case GL_MAX:
-            break;
+    if (ctx->state.var.blend_equation_rgb[buf] == modeRGB &&
+        ctx->state.var.blend_equation_alpha[buf] == modeAlpha)
+        return;
 
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
-    }
+    ctx->state.var.blend_equation_rgb[buf] = modeRGB;
+    ctx->state.var.blend_equation_alpha[buf] = modeAlpha;
+
+    ctx->state.dirty_bits |= DIRTY_ALPHA_STATE;
+}
 
-    ERROR_CHECK_RETURN(buf >=0 && buf < MAX_COLOR_ATTACHMENTS, GL_INVALID_VALUE);
+static void setBlendFunc(GLMContext ctx, GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    if (ctx->state.var.blend_src_rgb[buf] == srcRGB &&
+        ctx->state.var.blend_dst_rgb[buf] == dstRGB &&
+        ctx->state.var.blend_src_alpha[buf] == srcAlpha &&
+        ctx->state.var.blend_dst_alpha[buf] == dstAlpha)
+        return;
+
+    ctx->state.var.blend_src_rgb[buf] = srcRGB;
+    ctx->state.var.blend_dst_rgb[buf] = dstRGB;
+    ctx->state.var.blend_src_alpha[buf] = srcAlpha;
+    ctx->state.var.blend_dst_alpha[buf] = dstAlpha;
 
-    ctx->state.var.blend_equation_rgb[buf] = mode;
-    ctx->state.var.blend_equation_alpha[buf] = mode;
+    ctx->state.dirty_bits |= DIRTY_ALPHA_STATE;
+}
+
+void mglBlendEquation(GLMContext ctx, GLenum mode)
+{
+    mglBlendEquationSeparate(ctx, mode, mode);
+}
 
-    ctx->state.dirty_bits |= DIRTY_STATE;
+void mglBlendEquationi(GLMContext ctx, GLuint buf, GLenum mode)
+{
+    mglBlendEquationSeparatei(ctx, buf, mode, mode);
 }
 
 void mglBlendEquationSeparatei(GLMContext ctx, GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
-    switch(modeRGB)
+    if (validBlendEquation(modeRGB) == false ||
+        validBlendEquation(modeAlpha) == false)
     {
-        case GL_FUNC_ADD:
-        case GL_FUNC_SUBTRACT:
-        case GL_FUNC_REVERSE_SUBTRACT:
-        case GL_MIN:
-        case GL_MAX:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
-    switch(modeAlpha)
+    if (buf >= MAX_COLOR_ATTACHMENTS)
     {
-        case GL_FUNC_ADD:
-        case GL_FUNC_SUBTRACT:
-        case GL_FUNC_REVERSE_SUBTRACT:
-        case GL_MIN:
-        case GL_MAX:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
     }
 
-    ERROR_CHECK_RETURN(buf >= 0 && buf < MAX_COLOR_ATTACHMENTS, GL_INVALID_VALUE);
-
-    ctx->state.var.blend_equation_rgb[buf] = modeRGB;
-    ctx->state.var.blend_equation_alpha[buf] = modeAlpha;
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
+    setBlendEquation(ctx, buf, modeRGB, modeAlpha);
 }
 
-void mglBlendFunc(GLMContext ctx, GLenum sfactor, GLenum dfactor)
+void mglBlendEquationSeparate(GLMContext ctx, GLenum modeRGB, GLenum modeAlpha)
 {
-    switch(sfactor)
-    {
-        case GL_ZERO:
-        case GL_ONE:
-        case GL_SRC_COLOR:
-        case GL_ONE_MINUS_SRC_COLOR:
-        case GL_DST_COLOR:
-        case GL_ONE_MINUS_DST_COLOR:
-        case GL_SRC_ALPHA:
-        case GL_ONE_MINUS_SRC_ALPHA:
-        case GL_DST_ALPHA:
-        case GL_ONE_MINUS_DST_ALPHA:
-        case GL_CONSTANT_COLOR:
-        case GL_ONE_MINUS_CONSTANT_COLOR:
-        case GL_CONSTANT_ALPHA:
-        case GL_ONE_MINUS_CONSTANT_ALPHA:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
-    }
-
-    switch(dfactor)
+    if (validBlendEquation(modeRGB) == false ||
+        validBlendEquation(modeAlpha) == false)
     {
-        case GL_ZERO:
-        case GL_ONE:
-        case GL_SRC_COLOR:
-        case GL_ONE_MINUS_SRC_COLOR:
-        case GL_DST_COLOR:
-        case GL_ONE_MINUS_DST_COLOR:
-        case GL_SRC_ALPHA:
-        case GL_ONE_MINUS_SRC_ALPHA:
-        case GL_DST_ALPHA:
-        case GL_ONE_MINUS_DST_ALPHA:
-        case GL_CONSTANT_COLOR:
-        case GL_ONE_MINUS_CONSTANT_COLOR:
-        case GL_CONSTANT_ALPHA:
-        case GL_ONE_MINUS_CONSTANT_ALPHA:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
     for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
     {
-        ctx->state.var.blend_src_rgb[i] = sfactor;
-        ctx->state.var.blend_src_alpha[i] = sfactor;
-        ctx->state.var.blend_dst_rgb[i] = dfactor;
-        ctx->state.var.blend_dst_alpha[i] = dfactor;
+        setBlendEquation(ctx, i, modeRGB, modeAlpha);
     }
+}
 
-    ctx->state.dirty_bits |= DIRTY_STATE;
+void mglBlendFunc(GLMContext ctx, GLenum sfactor, GLenum dfactor)
+{
+    mglBlendFuncSeparate(ctx, sfactor, dfactor, sfactor, dfactor);
 }
 
 void mglBlendFunci(GLMContext ctx, GLuint buf, GLenum sfactor, GLenum dfactor)
 {
-    switch(sfactor)
-    {
-        case GL_ZERO:
-        case GL_ONE:
-        case GL_SRC_COLOR:
-        case GL_ONE_MINUS_SRC_COLOR:
-        case GL_DST_COLOR:
-        case GL_ONE_MINUS_DST_COLOR:
-        case GL_SRC_ALPHA:
-        case GL_ONE_MINUS_SRC_ALPHA:
-        case GL_DST_ALPHA:
-        case GL_ONE_MINUS_DST_ALPHA:
-        case GL_CONSTANT_COLOR:
-        case GL_ONE_MINUS_CONSTANT_COLOR:
-        case GL_CONSTANT_ALPHA:
-        case GL_ONE_MINUS_CONSTANT_ALPHA:
-            break;
+    mglBlendFuncSeparatei(ctx, buf, sfactor, dfactor, sfactor, dfactor);
+}
 
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+void mglBlendFuncSeparatei(GLMContext ctx, GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    if (validBlendFactor(srcRGB) == false ||
+        validBlendFactor(dstRGB) == false ||
+        validBlendFactor(srcAlpha) == false ||
+        validBlendFactor(dstAlpha) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
     }
 
-    switch(dfactor)
+    if (buf >= MAX_COLOR_ATTACHMENTS)
     {
-        case GL_ZERO:
-        case GL_ONE:
-        case GL_SRC_COLOR:
-        case GL_ONE_MINUS_SRC_COLOR:
-        case GL_DST_COLOR:
-        case GL_ONE_MINUS_DST_COLOR:
-        case GL_SRC_ALPHA:
-        case GL_ONE_MINUS_SRC_ALPHA:
-        case GL_DST_ALPHA:
-        case GL_ONE_MINUS_DST_ALPHA:
-        case GL_CONSTANT_COLOR:
-        case GL_ONE_MINUS_CONSTANT_COLOR:
-        case GL_CONSTANT_ALPHA:
-        case GL_ONE_MINUS_CONSTANT_ALPHA:
-            break;
-
-        default:
-            ERROR_RETURN(GL_INVALID_ENUM);
+        ERROR_RETURN(GL_INVALID_VALUE);
+        return;
     }
 
-    ERROR_CHECK_RETURN(buf >=0 && buf < MAX_COLOR_ATTACHMENTS, GL_INVALID_VALUE);
-
-    ctx->state.var.blend_src_rgb[buf] = sfactor;
-    ctx->state.var.blend_src_alpha[buf] = sfactor;
-    ctx->state.var.blend_dst_rgb[buf] = dfactor;
-    ctx->state.var.blend_dst_alpha[buf] = dfactor;
-
-    ctx->state.dirty_bits |= DIRTY_STATE;
+    setBlendFunc(ctx, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
-void mglBlendFuncSeparatei(GLMContext ctx, GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+void mglBlendFuncSeparate(GLMContext ctx, GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
 {
-    // Unimplemented function
-    assert(0);
-}
+    if (validBlendFactor(sfactorRGB) == false ||
+        validBlendFactor(dfactorRGB) == false ||
+        validBlendFactor(sfactorAlpha) == false ||
+        validBlendFactor(dfactorAlpha) == false)
+    {
+        ERROR_RETURN(GL_INVALID_ENUM);
+        return;
+    }
 
-void mglBlendEquationSeparate(GLMContext ctx, GLenum modeRGB, GLenum modeAlpha)
-{
-    // Unimplemented function
-    assert(0);
+    for(int i=0; i<MAX_COLOR_ATTACHMENTS; i++)
+    {
+        setBlendFunc(ctx, i, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    }
 }
 
-
 void mglGetPointerv(GLMContext ctx, GLenum pname, void **params)
 {
     // Unimplemented function
@@ -842,12 +906,6 @@ void mglPolygonOffset(GLMContext ctx, GLfloat factor, GLfloat units)
     assert(0);
 }
 
-void mglBlendFuncSeparate(GLMContext ctx, GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
-{
-    // Unimplemented function
-    assert(0);
-}
-
 void mglPointParameterf(GLMContext ctx, GLenum pname, GLfloat param)
 {
     // Unimplemented function
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * sync_table.c
+ * MGL
+ *
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sync_table.h"
+
+void initSyncTable(SyncTable *table, GLuint size)
+{
+    memset(table, 0, sizeof(SyncTable));
+
+    table->entries = (SyncTableEntry *)calloc(size, sizeof(SyncTableEntry));
+    table->size = table->entries ? size : 0;
+
+    for(GLuint i=0; i<table->size; i++)
+    {
+        table->entries[i].generation = 1;
+        table->entries[i].next_free = (i + 1 < table->size) ? i + 2 : 0;
+    }
+
+    table->first_free = table->size ? 1 : 0;
+}
+
+static GLsync syncHandle(GLuint index, GLuint generation)
+{
+    return (GLsync)(uintptr_t)(((GLuint64)generation << 32) | (index + 1));
+}
+
+static SyncTableEntry *syncEntry(SyncTable *table, GLsync handle)
+{
+    GLuint64 value;
+    GLuint index;
+    SyncTableEntry *entry;
+
+    value = (GLuint64)(uintptr_t)handle;
+    index = (GLuint)value;
+
+    if (index == 0 || index > table->size)
+        return NULL;
+
+    entry = &table->entries[index - 1];
+
+    if (entry->sync == NULL || entry->generation != (GLuint)(value >> 32))
+        return NULL;
+
+    return entry;
+}
+
+GLsync syncTableInsert(SyncTable *table, void *sync)
+{
+    SyncTableEntry *entry;
+    GLuint index;
+
+    if (table->first_free == 0)
+    {
+        SyncTableEntry *entries;
+        GLuint size;
+
+        size = table->size ? table->size * 2 : 64;
+
+        if (size < table->size || size > 0x7FFFFFFF)
+            return NULL;
+
+        entries = (SyncTableEntry *)realloc(table->entries, size * sizeof(SyncTableEntry));
+        if (entries == NULL)
+            return NULL;
+
+        for(GLuint i=table->size; i<size; i++)
+        {
+            entries[i].sync = NULL;
+            entries[i].generation = 1;
+            entries[i].next_free = (i + 1 < size) ? i + 2 : 0;
+        }
+
+        table->first_free = table->size + 1;
+        table->entries = entries;
+        table->size = size;
+    }
+
+    index = table->first_free - 1;
+    entry = &table->entries[index];
+
+    table->first_free = entry->next_free;
+
+    entry->sync = sync;
+    entry->next_free = 0;
+
+    table->count++;
+
+    return syncHandle(index, entry->generation);
+}
+
+void *syncTableLookup(SyncTable *table, GLsync handle)
+{
+    SyncTableEntry *entry;
+
+    entry = syncEntry(table, handle);
+
+    return entry ? entry->sync : NULL;
+}
+
+void *syncTableRemove(SyncTable *table, GLsync handle)
+{
+    SyncTableEntry *entry;
+    void *sync;
+
+    entry = syncEntry(table, handle);
+
+    if (entry == NULL)
+        return NULL;
+
+    sync = entry->sync;
+
+    entry->sync = NULL;
+
+    // a generation of 0 would never match, skip it on wrap
+    if (++entry->generation == 0)
+        entry->generation = 1;
+
+    entry->next_free = table->first_free;
+    table->first_free = (GLuint)(entry - table->entries) + 1;
+
+    table->count--;
+
+    return sync;
+}
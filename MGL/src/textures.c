@@ -27,10 +27,15 @@
 #include <Accelerate/Accelerate.h>
 
 #include "pixel_utils.h"
+#include "pixel_formats.h"
 #include "utils.h"
 #include "glm_context.h"
+#include "buffers.h"
+#include "mipmaps.h"
+#include "pixel_store.h"
 
 extern void *getBufferData(GLMContext ctx, Buffer *ptr);
+extern Buffer *findBuffer(GLMContext ctx, GLuint buffer);
 
 bool texSubImage(GLMContext ctx, Texture *tex, GLuint face, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void *pixels);
 
@@ -388,6 +393,39 @@ void mglBindImageTexture(GLMContext ctx, GLuint unit, GLuint texture, GLint leve
     ctx->state.dirty_bits |= DIRTY_IMAGE_UNIT_STATE;
 }
 
+// detach a view from its parent, the parent's storage goes with its last view once it was deleted
+static void releaseTextureView(GLMContext ctx, Texture *tex)
+{
+    Texture *parent;
+
+    parent = tex->view_parent;
+
+    // the view levels point into the parent's memory
+    for(int face=0; face<_CUBE_MAP_MAX_FACE; face++)
+    {
+        for(int i=0; tex->faces[face].levels && i<tex->num_levels; i++)
+        {
+            tex->faces[face].levels[i].data = 0;
+        }
+    }
+
+    tex->view_parent = NULL;
+
+    assert(parent->view_refcount);
+    parent->view_refcount--;
+
+    if (parent->view_refcount == 0 && parent->delete_status)
+    {
+        if (parent->mtl_data)
+        {
+            ctx->mtl_funcs.mtlDeleteMTLObj(ctx, parent->mtl_data);
+            parent->mtl_data = NULL;
+        }
+
+        parent->delete_status = false;
+    }
+}
+
 void mglDeleteTextures(GLMContext ctx, GLsizei n, const GLuint *textures)
 {
     while(n--)
@@ -422,10 +460,29 @@ void mglDeleteTextures(GLMContext ctx, GLsizei n, const GLuint *textures)
                 }
             }
 
-            if (tex->mtl_data)
+            if (tex->view_parent)
+            {
+                releaseTextureView(ctx, tex);
+            }
+
+            if (tex->tex_buffer)
+            {
+                releaseBuffer(ctx, tex->tex_buffer);
+                tex->tex_buffer = NULL;
+            }
+
+            // views still alias the storage, the last one to go deletes it
+            if (tex->view_refcount)
+            {
+                tex->delete_status = true;
+            }
+            else if (tex->mtl_data)
             {
                 ctx->mtl_funcs.mtlDeleteMTLObj(ctx, tex->mtl_data);
+                tex->mtl_data = NULL;
             }
+
+            releaseTexParamSampler(ctx, &tex->params);
         }
     }
 }
@@ -540,9 +597,107 @@ void mglBindTextureUnit(GLMContext ctx, GLuint unit, GLuint texture)
     STATE(texture_units[unit].textures[target]) = ptr;
 }
 
+static size_t page_size_align(size_t size);
+
+static GLboolean useCPUMipmaps(GLMContext ctx, Texture *tex, GLuint num_faces)
+{
+    TextureLevel *base;
+
+    // render targets and private storage only live on the gpu
+    if (tex->is_render_target || tex->mtl_requires_private_storage)
+        return false;
+
+    if (tex->mipmap_levels < 2)
+        return false;
+
+    base = &tex->faces[0].levels[0];
+
+    if (base->width == 0 || mipmapFormatSupported(tex->internalformat, base->pitch / base->width) == false)
+        return false;
+
+    for(GLuint face=0; face<num_faces; face++)
+    {
+        if (tex->faces[face].levels[0].complete == false || tex->faces[face].levels[0].data == 0)
+            return false;
+    }
+
+    // blit encoder can't filter integer formats
+    if (mipmapFormatIsInteger(tex->internalformat))
+        return true;
+
+    if (ctx->mtl_funcs.mtlGenerateMipmaps == NULL)
+        return true;
+
+    return ((size_t)base->width * base->height <= MIPMAP_CPU_MAX_TEXELS);
+}
+
+static GLboolean generateCPUMipmaps(GLMContext ctx, Texture *tex, GLuint num_faces)
+{
+    GLboolean filter_y, filter_z;
+    size_t pixel_size;
+
+    filter_y = (tex->target != GL_TEXTURE_1D_ARRAY);
+    filter_z = (tex->target == GL_TEXTURE_3D);
+
+    pixel_size = tex->faces[0].levels[0].pitch / tex->faces[0].levels[0].width;
+
+    for(GLuint face=0; face<num_faces; face++)
+    {
+        for(GLuint level=1; level<tex->mipmap_levels; level++)
+        {
+            TextureLevel *src, *dst;
+            size_t size;
+
+            src = &tex->faces[face].levels[level-1];
+            dst = &tex->faces[face].levels[level];
+
+            dst->width = MAX(src->width >> 1, 1);
+            dst->height = filter_y ? MAX(src->height >> 1, 1) : src->height;
+            dst->depth = filter_z ? MAX(src->depth >> 1, 1) : src->depth;
+            dst->pitch = pixel_size * dst->width;
+            dst->mtl_format = src->mtl_format;
+
+            size = page_size_align(dst->pitch * dst->height * dst->depth);
+
+            // tex storage preallocates every level, reuse it when it fits
+            if (dst->data && dst->data_size < size)
+            {
+                vm_deallocate((vm_map_t) mach_task_self(), dst->data, dst->data_size);
+
+                dst->data = 0;
+            }
+
+            if (dst->data == 0)
+            {
+                kern_return_t err;
+
+                err = vm_allocate((vm_map_t) mach_task_self(), &dst->data, size, VM_FLAGS_ANYWHERE);
+
+                if (err)
+                {
+                    dst->data = 0;
+                    return false;
+                }
+
+                dst->data_size = size;
+            }
+
+            if (generateMipmapLevel(tex->internalformat, filter_y, filter_z, src, dst) == false)
+                return false;
+
+            dst->complete = true;
+        }
+    }
+
+    tex->num_levels = tex->mipmap_levels;
+
+    return true;
+}
+
 void generateMipmaps(GLMContext ctx, GLuint texture, GLenum target)
 {
     Texture *ptr;
+    GLuint num_faces;
 
     ptr = getTex(ctx, texture, target);
 
@@ -552,6 +707,24 @@ void generateMipmaps(GLMContext ctx, GLuint texture, GLenum target)
     ERROR_CHECK_RETURN(ptr->faces[0].levels[0].complete, GL_INVALID_OPERATION);
 
     ptr->mipmapped = true;
+
+    num_faces = (ptr->target == GL_TEXTURE_CUBE_MAP) ? 6 : 1;
+
+    // small and integer textures are filtered here, keeps the render encoder alive
+    if (useCPUMipmaps(ctx, ptr, num_faces) &&
+        generateCPUMipmaps(ctx, ptr, num_faces))
+    {
+        ptr->genmipmaps = false;
+
+        ptr->dirty_bits |= DIRTY_TEXTURE_LEVEL | DIRTY_TEXTURE_DATA;
+
+        STATE(dirty_bits) |= DIRTY_TEX;
+
+        return;
+    }
+
+    ERROR_CHECK_RETURN(ctx->mtl_funcs.mtlGenerateMipmaps, GL_INVALID_OPERATION);
+
     ptr->genmipmaps = true;
 
     ptr->dirty_bits |= DIRTY_TEXTURE_LEVEL;
@@ -605,7 +778,10 @@ void invalidateTexture(GLMContext ctx, Texture *tex)
         ctx->mtl_funcs.mtlDeleteMTLObj(ctx, tex->mtl_data);
     }
 
-    for(int face=0; face<_CUBE_MAP_MAX_FACE; face++)
+    releaseTexParamSampler(ctx, &tex->params);
+
+    // views don't own their level data
+    for(int face=0; face<_CUBE_MAP_MAX_FACE && tex->view_parent == NULL; face++)
     {
         for(int i=0; i<tex->num_levels; i++)
         {
@@ -728,230 +904,32 @@ bool checkTexLevelParams(GLMContext ctx, Texture *tex, GLint level, GLuint inter
 
 bool verifyInternalFormatAndFormatType(GLMContext ctx, GLint internalformat, GLenum format, GLenum type)
 {
-    switch(internalformat)
-    {
-        // unsized formats
-        case GL_DEPTH_COMPONENT:
-        case GL_DEPTH_STENCIL:
-        case GL_RED:
-        case GL_RG:
-        case GL_RGB:
-        case GL_RGBA:
-            break;
-
-        // sized formats
-        case GL_R8:
-        case GL_R8_SNORM:
-        case GL_R16:
-        case GL_R16_SNORM:
-        case GL_RG8:
-        case GL_RG8_SNORM:
-        case GL_RG16:
-        case GL_RG16_SNORM:
-        case GL_R3_G3_B2:
-        case GL_RGB4:
-        case GL_RGB5:
-        case GL_RGB8:
-        case GL_RGB8_SNORM:
-        case GL_RGB10:
-        case GL_RGB12:
-        case GL_RGB16_SNORM:
-        case GL_RGBA2:
-        case GL_RGBA4:
-        case GL_RGB5_A1:
-        case GL_RGBA8:
-        case GL_RGBA8_SNORM:
-        case GL_RGB10_A2:
-        case GL_RGB10_A2UI:
-        case GL_RGBA12:
-        case GL_RGBA16:
-        case GL_SRGB8:
-        case GL_SRGB8_ALPHA8:
-        case GL_R16F:
-        case GL_RG16F:
-        case GL_RGB16F:
-        case GL_RGBA16F:
-        case GL_R32F:
-        case GL_RG32F:
-        case GL_RGB32F:
-        case GL_RGBA32F:
-        case GL_R11F_G11F_B10F:
-        case GL_RGB9_E5:
-        case GL_R8I:
-        case GL_R8UI:
-        case GL_R16I:
-        case GL_R16UI:
-        case GL_R32I:
-        case GL_R32UI:
-        case GL_RG8I:
-        case GL_RG8UI:
-        case GL_RG16I:
-        case GL_RG16UI:
-        case GL_RG32I:
-        case GL_RG32UI:
-        case GL_RGB8I:
-        case GL_RGB8UI:
-        case GL_RGB16I:
-        case GL_RGB16UI:
-        case GL_RGB32I:
-        case GL_RGB32UI:
-        case GL_RGBA8I:
-        case GL_RGBA8UI:
-        case GL_RGBA16I:
-        case GL_RGBA16UI:
-        case GL_RGBA32I:
-        case GL_RGBA32UI:
-        // Missing SNORM/UI formats used by virgl
-        case 0x9014: // GL_ALPHA8_SNORM
-        case 0x9016: // GL_LUMINANCE8_ALPHA8_SNORM
-        case 0x9018: // GL_ALPHA16_SNORM
-        case 0x901a: // GL_LUMINANCE16_ALPHA16_SNORM
-        case 0x8d7e: // GL_ALPHA8UI_EXT
-            break;
+    const PixelFormatDesc *desc;
 
-        // compressed types
-        case GL_COMPRESSED_RED:
-        case GL_COMPRESSED_RG:
-        case GL_COMPRESSED_RGB:
-        case GL_COMPRESSED_RGBA:
-        case GL_COMPRESSED_SRGB:
-        case GL_COMPRESSED_SRGB_ALPHA:
-        case GL_COMPRESSED_RED_RGTC1:
-        case GL_COMPRESSED_SIGNED_RED_RGTC1:
-        case GL_COMPRESSED_RG_RGTC2:
-        case GL_COMPRESSED_SIGNED_RG_RGTC2:
-        case GL_COMPRESSED_RGBA_BPTC_UNORM:
-        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
-        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
-        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
-            break;
-
-        // Legacy alpha/luminance formats (deprecated but still used)
-        case 0x803c: // GL_ALPHA8
-        case 0x803e: // GL_ALPHA16
-        case 0x8040: // GL_LUMINANCE8
-        case 0x8042: // GL_LUMINANCE16
-        case 0x8045: // GL_LUMINANCE8_ALPHA8
-        case 0x8048: // GL_LUMINANCE16_ALPHA16
-        case 0x8816: // GL_ALPHA16F_ARB
-        case 0x8818: // GL_LUMINANCE16F_ARB
-        case 0x8819: // GL_LUMINANCE_ALPHA16F_ARB
-        case 0x881c: // GL_ALPHA32F_ARB
-        case 0x881e: // GL_LUMINANCE32F_ARB
-        case 0x881f: // GL_LUMINANCE_ALPHA32F_ARB
-            break;
-
-        // ASTC compressed formats
-        case 0x93b0: // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
-        case 0x93b1: // GL_COMPRESSED_RGBA_ASTC_5x4_KHR
-        case 0x93b2: // GL_COMPRESSED_RGBA_ASTC_5x5_KHR
-        case 0x93b3: // GL_COMPRESSED_RGBA_ASTC_6x5_KHR
-        case 0x93b4: // GL_COMPRESSED_RGBA_ASTC_6x6_KHR
-        case 0x93b5: // GL_COMPRESSED_RGBA_ASTC_8x5_KHR
-        case 0x93b6: // GL_COMPRESSED_RGBA_ASTC_8x6_KHR
-        case 0x93b7: // GL_COMPRESSED_RGBA_ASTC_8x8_KHR
-        case 0x93b8: // GL_COMPRESSED_RGBA_ASTC_10x5_KHR
-        case 0x93b9: // GL_COMPRESSED_RGBA_ASTC_10x6_KHR
-        case 0x93ba: // GL_COMPRESSED_RGBA_ASTC_10x8_KHR
-        case 0x93bb: // GL_COMPRESSED_RGBA_ASTC_10x10_KHR
-        case 0x93bc: // GL_COMPRESSED_RGBA_ASTC_12x10_KHR
-        case 0x93bd: // GL_COMPRESSED_RGBA_ASTC_12x12_KHR
-        case 0x93d0: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR
-        case 0x93d1: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR
-        case 0x93d2: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR
-        case 0x93d3: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR
-        case 0x93d4: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR
-        case 0x93d5: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR
-        case 0x93d6: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR
-        case 0x93d7: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR
-        case 0x93d8: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR
-        case 0x93d9: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR
-        case 0x93da: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR
-        case 0x93db: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR
-        case 0x93dc: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR
-        case 0x93dd: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR
-            break;
-
-        // ETC2/EAC compressed formats
-        case 0x9270: // GL_COMPRESSED_R11_EAC
-        case 0x9271: // GL_COMPRESSED_SIGNED_R11_EAC
-        case 0x9272: // GL_COMPRESSED_RG11_EAC
-        case 0x9273: // GL_COMPRESSED_SIGNED_RG11_EAC
-        case 0x9274: // GL_COMPRESSED_RGB8_ETC2
-        case 0x9275: // GL_COMPRESSED_SRGB8_ETC2
-        case 0x9276: // GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2
-        case 0x9277: // GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
-        case 0x9278: // GL_COMPRESSED_RGBA8_ETC2_EAC
-        case 0x9279: // GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
-            break;
-
-        // S3TC/DXT compressed formats
-        case 0x83f0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
-        case 0x83f1: // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
-        case 0x83f2: // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
-        case 0x83f3: // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
-        case 0x8c4c: // GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
-        case 0x8c4d: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
-        case 0x8c4e: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT
-        case 0x8c4f: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
-            break;
+    desc = pixelFormatDesc(internalformat);
 
-        // Additional integer formats (alternate enum values used by some implementations)
-        case 0x8d72: // alternate GL_RGBA8I
-        case 0x8d75: // alternate GL_RGB8I
-        case 0x8d78: // alternate GL_RGBA8UI
-        case 0x8d7a: // alternate GL_RGB8UI
-        case 0x8d7b: // GL_ALPHA8I_EXT
-        // case 0x8d7e: // alternate GL_RGBA32UI - Duplicate of GL_ALPHA8UI_EXT
-        case 0x8d80: // alternate GL_RGB32UI
-        case 0x8d81: // GL_ALPHA32I_EXT
-        case 0x8d84: // alternate GL_RGBA16I
-        case 0x8d86: // alternate GL_RGB16I
-        case 0x8d87: // GL_ALPHA16I_EXT
-        case 0x8d8a: // alternate GL_RGBA32I
-        case 0x8d8c: // alternate GL_RGB32I
-        case 0x8d8d: // GL_ALPHA32I_EXT
-        case 0x8d90: // alternate GL_RGBA16UI
-        case 0x8d92: // alternate GL_RGB16UI
-        case 0x8d93: // GL_ALPHA16UI_EXT
-            break;
-
-        // SNORM formats
-        case 0x8f9b: // GL_SIGNED_NORMALIZED
-        case 0x8fbd: // GL_RGB10_A2UI (alternate)
-        case 0x8fbe: // GL_RGBA16_SNORM
-            break;
+    if (desc == NULL)
+    {
+        // Log warning but don't error - many formats work even if not explicitly listed
+        fprintf(stderr, "MGL WARNING: verifyInternalFormat unknown internalformat 0x%x\n", internalformat);
+    }
+    else if (desc->flags & PIXEL_FORMAT_SIZED)
+    {
+        // sized depth / stencil formats need a matching client format
+        switch(desc->base_format)
+        {
+            case GL_DEPTH_COMPONENT:
+                ERROR_CHECK_RETURN_VALUE(format == GL_DEPTH_COMPONENT, GL_INVALID_OPERATION, false);
+                break;
 
-        // Depth/stencil special formats
-        // case 0x9014: // GL_DEPTH_COMPONENT16_NONLINEAR_NV - Duplicate of GL_ALPHA8_SNORM
-        // case 0x9016: // GL_TEXTURE_2D_MULTISAMPLE - Duplicate of GL_LUMINANCE8_ALPHA8_SNORM
-        // case 0x9018: // GL_TEXTURE_2D_MULTISAMPLE_ARRAY - Duplicate of GL_ALPHA16_SNORM
-        // case 0x901a: // GL_PROXY_TEXTURE_2D_MULTISAMPLE_ARRAY - Duplicate of GL_LUMINANCE16_ALPHA16_SNORM
-            break;
+            case GL_DEPTH_STENCIL:
+                ERROR_CHECK_RETURN_VALUE(format == GL_DEPTH_STENCIL, GL_INVALID_OPERATION, false);
+                break;
 
-        case GL_DEPTH_COMPONENT16:
-        case GL_DEPTH_COMPONENT24:
-        case GL_DEPTH_COMPONENT32:
-        case GL_DEPTH_COMPONENT32F:
-            ERROR_CHECK_RETURN_VALUE(format == GL_DEPTH_COMPONENT, GL_INVALID_OPERATION, false);
-            break;
-            
-        case GL_DEPTH24_STENCIL8:
-        case GL_DEPTH32F_STENCIL8:
-            ERROR_CHECK_RETURN_VALUE(format == GL_DEPTH_STENCIL, GL_INVALID_OPERATION, false);
-            break;
-            
-        case GL_STENCIL_INDEX8:
-            ERROR_CHECK_RETURN_VALUE(format == GL_STENCIL_INDEX, GL_INVALID_OPERATION, false);
-            break;
-            
-        case GL_RGB565:
-            break;
-
-        default:
-            // Log warning but don't error - many formats work even if not explicitly listed
-            fprintf(stderr, "MGL WARNING: verifyInternalFormat unknown internalformat 0x%x\n", internalformat);
-            break;
+            case GL_STENCIL_INDEX:
+                ERROR_CHECK_RETURN_VALUE(format == GL_STENCIL_INDEX, GL_INVALID_OPERATION, false);
+                break;
+        }
     }
 
     switch(format)
@@ -1042,56 +1020,52 @@ bool verifyInternalFormatAndFormatType(GLMContext ctx, GLint internalformat, GLe
 }
 
 
-void unpackTexture(GLMContext ctx, Texture *tex, GLuint face, GLuint level, void *src_data, void *dst_data, size_t src_pitch, size_t pixel_size, size_t xoffset, size_t yoffset, size_t zoffset, size_t width, size_t height, size_t depth)
+// dimensionality of the tex image call, decides which pixel store skips apply
+static GLuint texImageDims(Texture *tex)
 {
-    GLubyte *src, *dst;
-    size_t dst_pitch;
+    switch(tex->target)
+    {
+        case GL_TEXTURE_1D:
+            return 1;
+
+        case GL_TEXTURE_3D:
+        case GL_TEXTURE_2D_ARRAY:
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+            return 3;
+    }
 
-    src = (GLubyte *)src_data;
-    dst = (GLubyte *)dst_data;
+    return 2;
+}
+
+void unpackTexture(GLMContext ctx, Texture *tex, GLuint face, GLuint level, const void *src_data, void *dst_data, const PixelStoreLayout *layout, size_t xoffset, size_t yoffset, size_t zoffset, size_t width, size_t height, size_t depth)
+{
+    TextureLevel *tex_level;
+    const GLubyte *src;
+    GLubyte *dst;
+    size_t dst_pitch, dst_image_pitch;
+    size_t dst_pixel_size;
+    size_t row_bytes;
 
     assert(tex);
-    dst_pitch = tex->faces[face].levels[level].pitch;
+    tex_level = &tex->faces[face].levels[level];
+
+    dst_pitch = tex_level->pitch;
     assert(dst_pitch);
 
-    if (xoffset || yoffset || zoffset)
-    {
-        size_t xoffset_bytes = xoffset * pixel_size; // num pixels
-        size_t yoffset_bytes = yoffset * dst_pitch; // num lines (rows * bytes_per_row)
-        size_t zoffset_bytes = zoffset * dst_pitch * height; // num planes
+    // 3d and array levels are stored as height rows per image
+    dst_image_pitch = dst_pitch * tex_level->height;
+    dst_pixel_size = dst_pitch / tex_level->width;
 
-        dst += xoffset_bytes;
-        dst += yoffset_bytes;
-        dst += zoffset_bytes;
-    }
+    src = (const GLubyte *)src_data + layout->skip_bytes;
+    dst = (GLubyte *)dst_data + xoffset * dst_pixel_size + yoffset * dst_pitch + zoffset * dst_image_pitch;
 
-    if (depth > 1)
-    {
-        // 3d texture
-        for(int y=0; y<depth; y++)
-        {
-            memcpy(dst, src, dst_pitch);
-            src += src_pitch;
-            dst += dst_pitch;
-        }
-    }
-    else if (height > 1)
-    {
-        // 2d texture
-        size_t copy_size = width * pixel_size;
-        
-        for(int y=0; y<height; y++)
-        {
-            memcpy(dst, src, copy_size);
-            src += src_pitch;
-            dst += dst_pitch;
-        }
-    }
-    else
-    {
-        // 1d texture
-        memcpy(dst, src, width * pixel_size);
-    }
+    // never write past the end of a destination row
+    row_bytes = MIN(width * layout->pixel_size, dst_pitch - xoffset * dst_pixel_size);
+
+    copyImage3D(dst, dst_pitch, dst_image_pitch,
+                src, layout->row_pitch, layout->image_pitch,
+                row_bytes, height, depth, layout->swap_size);
 }
 
 #pragma mark texImage 1D/2D/3D
@@ -1188,7 +1162,6 @@ bool createTextureLevel(GLMContext ctx, Texture *tex, GLuint face, GLint level,
     size_t pixel_size;
     size_t internal_size;
     size_t texture_size;
-    size_t src_pitch;
 
     pixel_size = sizeForInternalFormat(internalformat, format, type);
     ERROR_CHECK_RETURN_VALUE(pixel_size, GL_INVALID_ENUM, false);
@@ -1247,81 +1220,21 @@ bool createTextureLevel(GLMContext ctx, Texture *tex, GLuint face, GLint level,
 
         if (pixels)
         {
-            GLsizei src_size;
-
-            src_size = width * sizeForFormatType(format, type);
-
-            if (ctx->state.unpack.row_length)
-            {
-                size_t alignment;
-
-                if (ctx->state.unpack.row_length < width) {
-                    ERROR_RETURN_VALUE(GL_INVALID_VALUE, false);
-                }
+            PixelStoreLayout layout;
 
-                alignment = ctx->state.unpack.alignment;
-                if (alignment)
-                {
-                    /* row_length is in pixels, so multiply by pixel_size to get bytes per row */
-                    size_t row_bytes = ctx->state.unpack.row_length * pixel_size;
-                    if (row_bytes >= alignment)
-                    {
-                        src_pitch = row_bytes;
-                        assert(src_pitch);
-                    }
-                    else if (depth > 1)
-                    {
-                        // 3d texture
-                        src_pitch = alignment / src_size;
-
-                        src_pitch = src_pitch * src_size * ctx->state.unpack.row_length * height;
-
-                        src_pitch = src_pitch / alignment;
-                        assert(src_pitch);
-                    }
-                    else
-                    {
-                        src_pitch = alignment / src_size;
-
-                        src_pitch = src_pitch * src_size * ctx->state.unpack.row_length;
-
-                        src_pitch = src_pitch / alignment;
-                        assert(src_pitch);
-                    }
-                }
-                else
-                {
-                    src_pitch = src_size * ctx->state.unpack.row_length;
-                    assert(src_pitch);
-                }
-            }
-            else
-            {
-                src_pitch = tex->faces[face].levels[level].pitch;
-                assert(src_pitch);
+            if (ctx->state.unpack.row_length && ctx->state.unpack.row_length < width) {
+                ERROR_RETURN_VALUE(GL_INVALID_VALUE, false);
             }
 
-            // unpack from pixel buffer
-            if (STATE(buffers[_PIXEL_UNPACK_BUFFER]))
+            if (pixelStoreLayout(&ctx->state.unpack, texImageDims(tex), format, type, width, height, &layout) == false)
             {
-                Buffer *ptr;
-
-                ptr = STATE(buffers[_PIXEL_UNPACK_BUFFER]);
-
-                ERROR_CHECK_RETURN(ptr->mapped == false, GL_INVALID_OPERATION);
-
-                GLubyte *buffer_data;
-                buffer_data = getBufferData(ctx, ptr);
-
-                // if a pixel buffer is the src, pixels is the offset
-                // need to check offset against size
-                size_t offset;
-                offset = (size_t)pixels;
-
-                pixels = &buffer_data[offset];
+                ERROR_RETURN_VALUE(GL_INVALID_ENUM, false);
             }
 
-            unpackTexture(ctx, tex, face, level, (void *)pixels, (void *)texture_data, src_pitch, pixel_size, 0, 0, 0, width, height, depth);
+            // pixel unpack buffer offsets were resolved to a pointer above
+            unpackTexture(ctx, tex, face, level, pixels, (void *)texture_data, &layout, 0, 0, 0, width, height, depth);
+
+            STATS_ADD(bytes_uploaded, pixelStoreSpan(&layout, width, height, depth) - layout.skip_bytes);
 
             tex->dirty_bits |= DIRTY_TEXTURE_DATA;
         };
@@ -1515,12 +1428,9 @@ void mglTexImage3DMultisample(GLMContext ctx, GLenum target, GLsizei samples, GL
 #pragma mark texSubImage
 bool texSubImage(GLMContext ctx, Texture *tex, GLuint face, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void *pixels)
 {
-    // Debug: Log large texture uploads (VM framebuffer size)
-    if (width >= 640 && height >= 400) {
-        fprintf(stderr, "MGL DEBUG: texSubImage tex_id=%u %dx%d at (%d,%d) pixels=%p\n",
+    DEBUG_PRINT("texSubImage tex_id=%u %dx%d at (%d,%d) pixels=%p\n",
                 tex ? tex->name : 0, width, height, xoffset, yoffset, pixels);
-    }
-    
+
     // ERROR_CHECK_RETURN_VALUE(tex != NULL, GL_INVALID_OPERATION, false);
     if (tex == NULL) {
         fprintf(stderr, "MGL Error: texSubImage: tex is NULL\n");
@@ -1571,70 +1481,25 @@ bool texSubImage(GLMContext ctx, Texture *tex, GLuint face, GLint level, GLint x
     // no src data.. return
     ERROR_CHECK_RETURN(pixels, GL_INVALID_OPERATION);
 
-    size_t pixel_size;
-    size_t src_size;
-    size_t src_pitch;
-
-    pixel_size = sizeForFormatType(format, type);
-    src_size = width * pixel_size;
-
-    if (ctx->state.unpack.row_length)
-    {
-        size_t alignment;
-
-        // ERROR_CHECK_RETURN((ctx->state.unpack.row_length >> level) >= width, GL_INVALID_VALUE);
-        // Fix: row_length applies to the source data for the current level, do not shift by level
-        if (ctx->state.unpack.row_length < width) {
-             ERROR_RETURN_VALUE(GL_INVALID_VALUE, false);
-        }
-
-        alignment = ctx->state.unpack.alignment;
-        if (alignment)
-        {
-            if (src_size >= alignment)
-            {
-                size_t row_bytes = (ctx->state.unpack.row_length >> level) * pixel_size;
-                src_pitch = row_bytes;
-                assert(src_pitch);
-            }
-            else if (depth > 1)
-            {
-                // 3d texture
-                src_pitch = alignment / src_size;
-
-                src_pitch = src_pitch * src_size * ctx->state.unpack.row_length * height;
-
-                src_pitch = src_pitch / alignment;
-                assert(src_pitch);
-            }
-            else
-            {
-                src_pitch = alignment / src_size;
-
-                src_pitch = src_pitch * src_size * ctx->state.unpack.row_length;
+    PixelStoreLayout layout;
 
-                src_pitch = src_pitch / alignment;
-                assert(src_pitch);
-            }
-        }
-        else
-        {
-            size_t row_bytes = (ctx->state.unpack.row_length >> level) * pixel_size;
-            src_pitch = row_bytes;
-            assert(src_pitch);
-        }
+    // row_length applies to the source data for the current level, do not shift by level
+    if (ctx->state.unpack.row_length && ctx->state.unpack.row_length < width) {
+         ERROR_RETURN_VALUE(GL_INVALID_VALUE, false);
     }
-    else
+
+    if (pixelStoreLayout(&ctx->state.unpack, texImageDims(tex), format, type, width, height, &layout) == false)
     {
-        src_pitch = src_size;
-        assert(src_pitch);
+        ERROR_RETURN_VALUE(GL_INVALID_ENUM, false);
     }
 
+    STATS_ADD(bytes_uploaded, pixelStoreSpan(&layout, width, height, depth) - layout.skip_bytes);
+
     void *texture_data;
 
     texture_data = (void *)tex->faces[face].levels[level].data;
     
-    unpackTexture(ctx, tex, face, level, pixels, texture_data, src_pitch, pixel_size, xoffset, yoffset, zoffset, width, height, depth);
+    unpackTexture(ctx, tex, face, level, pixels, texture_data, &layout, xoffset, yoffset, zoffset, width, height, depth);
 
     // use a blit command to update data
     do
@@ -1649,23 +1514,30 @@ bool texSubImage(GLMContext ctx, Texture *tex, GLuint face, GLint level, GLint x
         if (tex->mtl_data == NULL)
             continue;
 
+        // the blit engine can't swap bytes
+        if (layout.swap_size)
+            continue;
+
         size_t src_offset;
-        size_t src_image_size;
         size_t src_size;
 
-        src_offset = (size_t)0;
-
-        src_image_size = src_pitch * height;
+        src_offset = (size_t)((GLubyte *)pixels - (GLubyte *)getBufferData(ctx, buf)) + layout.skip_bytes;
 
-        src_size = src_image_size * depth;
+        src_size = pixelStoreSpan(&layout, width, height, depth) - layout.skip_bytes;
 
-        ctx->mtl_funcs.mtlTexSubImage(ctx, tex, buf, src_offset, src_pitch, src_image_size, src_size, zoffset, level, width, height, depth, xoffset, yoffset, zoffset);
+        ctx->mtl_funcs.mtlTexSubImage(ctx, tex, buf, src_offset, layout.row_pitch, layout.image_pitch, src_size, zoffset, level, width, height, depth, xoffset, yoffset, zoffset);
 
         return true;
     } while(false);
 
     // use process gl to upload texture data
     tex->dirty_bits |= DIRTY_TEXTURE_DATA;
+
+    // a view wrote into its parent's memory, the parent's metal texture has to pick it up
+    if (tex->view_parent)
+    {
+        tex->view_parent->dirty_bits |= DIRTY_TEXTURE_DATA;
+    }
     
     return true;
 }
@@ -2394,19 +2266,386 @@ void mglGetCompressedTextureSubImage(GLMContext ctx, GLuint texture, GLint level
     fprintf(stderr, "MGL WARNING: glGetCompressedTextureSubImage called (stub) - compressed textures not supported\n");
 }
 
+#pragma mark texture views
+static GLboolean viewTargetCompatible(GLenum orig_target, GLenum target)
+{
+    switch(orig_target)
+    {
+        case GL_TEXTURE_1D:
+        case GL_TEXTURE_1D_ARRAY:
+            return (target == GL_TEXTURE_1D || target == GL_TEXTURE_1D_ARRAY);
+
+        case GL_TEXTURE_2D:
+            return (target == GL_TEXTURE_2D || target == GL_TEXTURE_2D_ARRAY);
+
+        case GL_TEXTURE_2D_ARRAY:
+        case GL_TEXTURE_CUBE_MAP:
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+            return (target == GL_TEXTURE_2D || target == GL_TEXTURE_2D_ARRAY ||
+                    target == GL_TEXTURE_CUBE_MAP || target == GL_TEXTURE_CUBE_MAP_ARRAY);
+
+        case GL_TEXTURE_3D:
+        case GL_TEXTURE_RECTANGLE:
+            return (target == orig_target);
+    }
+
+    return false;
+}
+
+// layers of a texture and the bytes between them in a level
+// cube map faces are separate allocations so they have no layer stride
+static GLuint textureLayers(Texture *tex, GLuint level, size_t *layer_bytes)
+{
+    TextureLevel *tex_level;
+
+    tex_level = &tex->faces[0].levels[level];
+
+    *layer_bytes = 0;
+
+    switch(tex->target)
+    {
+        case GL_TEXTURE_1D_ARRAY:
+            *layer_bytes = tex_level->pitch;
+            return tex_level->height;
+
+        case GL_TEXTURE_2D_ARRAY:
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+            *layer_bytes = tex_level->pitch * tex_level->height;
+            return tex_level->depth;
+
+        case GL_TEXTURE_CUBE_MAP:
+            return _CUBE_MAP_MAX_FACE;
+    }
+
+    return 1;
+}
+
 void mglTextureView(GLMContext ctx, GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
 {
-    fprintf(stderr, "MGL WARNING: glTextureView called (stub) - texture views not supported\n");
+    Texture *orig, *tex, *parent;
+    GLuint orig_layers, view_faces;
+    size_t layer_bytes;
+
+    ERROR_CHECK_RETURN(texture, GL_INVALID_VALUE);
+
+    orig = findTexture(ctx, origtexture);
+    ERROR_CHECK_RETURN(orig, GL_INVALID_VALUE);
+
+    // only immutable storage can be viewed, it can never be reallocated under the view
+    ERROR_CHECK_RETURN(orig->immutable_storage, GL_INVALID_OPERATION);
+
+    // a view is made from a name that was never bound
+    ERROR_CHECK_RETURN(findTexture(ctx, texture) == NULL, GL_INVALID_OPERATION);
+
+    ERROR_CHECK_RETURN(viewTargetCompatible(orig->target, target), GL_INVALID_OPERATION);
+
+    // formats have to be in the same view class, for metal that is the same texel size
+    ERROR_CHECK_RETURN(checkInternalFormatForMetal(ctx, internalformat), GL_INVALID_OPERATION);
+    ERROR_CHECK_RETURN(sizeForInternalFormat(internalformat, 0, 0) == sizeForInternalFormat(orig->internalformat, 0, 0), GL_INVALID_OPERATION);
+
+    ERROR_CHECK_RETURN(minlevel < orig->num_levels, GL_INVALID_VALUE);
+
+    orig_layers = textureLayers(orig, minlevel, &layer_bytes);
+    ERROR_CHECK_RETURN(minlayer < orig_layers, GL_INVALID_VALUE);
+
+    numlevels = MIN(numlevels, orig->num_levels - minlevel);
+    numlayers = MIN(numlayers, orig_layers - minlayer);
+    ERROR_CHECK_RETURN(numlevels && numlayers, GL_INVALID_VALUE);
+
+    view_faces = 1;
+
+    switch(target)
+    {
+        case GL_TEXTURE_CUBE_MAP:
+            ERROR_CHECK_RETURN(numlayers == _CUBE_MAP_MAX_FACE, GL_INVALID_VALUE);
+            view_faces = _CUBE_MAP_MAX_FACE;
+            break;
+
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+            ERROR_CHECK_RETURN((numlayers % _CUBE_MAP_MAX_FACE) == 0, GL_INVALID_VALUE);
+            break;
+
+        case GL_TEXTURE_1D_ARRAY:
+        case GL_TEXTURE_2D_ARRAY:
+            break;
+
+        default:
+            ERROR_CHECK_RETURN(numlayers == 1, GL_INVALID_VALUE);
+            break;
+    }
+
+    // the faces of a cube map aren't contiguous, they can't be aliased as one array
+    if (orig->target == GL_TEXTURE_CUBE_MAP && view_faces == 1 && numlayers > 1)
+    {
+        fprintf(stderr, "MGL Error: glTextureView: array views of more than one cube map face not supported\n");
+        ERROR_RETURN(GL_INVALID_OPERATION);
+    }
+
+    tex = newTexture(ctx, target, texture);
+    ERROR_CHECK_RETURN(tex, GL_OUT_OF_MEMORY);
+
+    for(int face=0; face<_CUBE_MAP_MAX_FACE; face++)
+    {
+        tex->faces[face].levels = (TextureLevel *)calloc(numlevels, sizeof(TextureLevel));
+
+        if (!tex->faces[face].levels)
+        {
+            invalidateTexture(ctx, tex);
+            free(tex);
+            ERROR_RETURN(GL_OUT_OF_MEMORY);
+        }
+    }
+
+    // point each view level at the parent's memory, nothing is copied
+    for(int face=0; face<view_faces; face++)
+    {
+        GLuint orig_face, layer;
+
+        orig_face = 0;
+        layer = minlayer + face;
+
+        if (orig->target == GL_TEXTURE_CUBE_MAP)
+        {
+            orig_face = layer;
+            layer = 0;
+        }
+
+        for(int level=0; level<numlevels; level++)
+        {
+            TextureLevel *tex_level;
+
+            tex_level = &tex->faces[face].levels[level];
+
+            *tex_level = orig->faces[orig_face].levels[minlevel + level];
+
+            textureLayers(orig, minlevel + level, &layer_bytes);
+
+            if (tex_level->data)
+            {
+                tex_level->data += layer * layer_bytes;
+            }
+
+            switch(target)
+            {
+                case GL_TEXTURE_1D:
+                case GL_TEXTURE_1D_ARRAY:
+                    tex_level->height = (target == GL_TEXTURE_1D_ARRAY ? numlayers : 1);
+                    tex_level->data_size = tex_level->pitch * tex_level->height;
+                    break;
+
+                case GL_TEXTURE_2D_ARRAY:
+                case GL_TEXTURE_CUBE_MAP_ARRAY:
+                    tex_level->depth = numlayers;
+                    tex_level->data_size = tex_level->pitch * tex_level->height * tex_level->depth;
+                    break;
+
+                case GL_TEXTURE_2D:
+                case GL_TEXTURE_CUBE_MAP:
+                    tex_level->depth = 1;
+                    tex_level->data_size = tex_level->pitch * tex_level->height;
+                    break;
+            }
+
+            tex_level->mtl_format = mtlFormatForGLInternalFormat(internalformat);
+        }
+    }
+
+    // views of views point straight at the texture that owns the storage
+    parent = orig->view_parent ? orig->view_parent : orig;
+
+    tex->view_parent = parent;
+    parent->view_refcount++;
+    tex->view_min_level = orig->view_min_level + minlevel;
+    tex->view_min_layer = orig->view_min_layer + minlayer;
+    tex->view_num_layers = numlayers;
+
+    tex->internalformat = internalformat;
+    tex->width = tex->faces[0].levels[0].width;
+    tex->height = tex->faces[0].levels[0].height;
+    tex->depth = tex->faces[0].levels[0].depth;
+    tex->is_array = (target == GL_TEXTURE_1D_ARRAY || target == GL_TEXTURE_2D_ARRAY || target == GL_TEXTURE_CUBE_MAP_ARRAY);
+    tex->num_levels = numlevels;
+    tex->mipmap_levels = numlevels;
+    tex->access = orig->access;
+    tex->mtl_requires_private_storage = orig->mtl_requires_private_storage;
+    tex->immutable_storage = BUFFER_IMMUTABLE_STORAGE_FLAG;
+    tex->complete = true;
+
+    // reinterpreting the format needs a parent created with pixel format view usage
+    if (mtlFormatForGLInternalFormat(internalformat) != mtlFormatForGLInternalFormat(parent->internalformat) &&
+        parent->has_format_views == false)
+    {
+        parent->has_format_views = true;
+        parent->dirty_bits |= DIRTY_TEXTURE_LEVEL | DIRTY_TEXTURE_DATA;
+    }
+
+    tex->dirty_bits |= DIRTY_TEXTURE_LEVEL;
+
+    insertHashElement(&STATE(texture_table), texture, tex);
+
+    STATE(dirty_bits) |= DIRTY_TEX;
+}
+
+#pragma mark texture buffers
+static void texBufferRange(GLMContext ctx, Texture *tex, GLenum internalformat, Buffer *buf, GLintptr offset, GLsizeiptr size)
+{
+    size_t pixel_size;
+    GLuint width;
+
+    // a zero buffer detaches the old one
+    if (buf == NULL)
+    {
+        if (tex->tex_buffer)
+            releaseBuffer(ctx, tex->tex_buffer);
+
+        tex->tex_buffer = NULL;
+        tex->tex_buffer_offset = 0;
+        tex->tex_buffer_size = 0;
+        tex->complete = false;
+
+        tex->dirty_bits |= DIRTY_TEXTURE_LEVEL;
+        STATE(dirty_bits) |= DIRTY_TEX;
+
+        return;
+    }
+
+    pixel_size = sizeForInternalFormat(internalformat, 0, 0);
+    ERROR_CHECK_RETURN(pixel_size, GL_INVALID_ENUM);
+    ERROR_CHECK_RETURN(checkInternalFormatForMetal(ctx, internalformat), GL_INVALID_ENUM);
+
+    ERROR_CHECK_RETURN(offset >= 0, GL_INVALID_VALUE);
+    ERROR_CHECK_RETURN(size > 0, GL_INVALID_VALUE);
+    ERROR_CHECK_RETURN(offset + size <= buf->size, GL_INVALID_VALUE);
+
+    if (STATE(var.texture_buffer_offset_alignment))
+    {
+        ERROR_CHECK_RETURN((offset % STATE(var.texture_buffer_offset_alignment)) == 0, GL_INVALID_VALUE);
+    }
+
+    width = (GLuint)(size / pixel_size);
+
+    if (STATE(var.max_texture_buffer_size))
+    {
+        width = MIN(width, STATE(var.max_texture_buffer_size));
+    }
+
+    ERROR_CHECK_RETURN(width, GL_INVALID_VALUE);
+
+    // a single level describing the range, data stays in the buffer
+    for(int face=0; face<_CUBE_MAP_MAX_FACE; face++)
+    {
+        if (tex->faces[face].levels == NULL)
+        {
+            tex->faces[face].levels = (TextureLevel *)calloc(1, sizeof(TextureLevel));
+
+            ERROR_CHECK_RETURN(tex->faces[face].levels, GL_OUT_OF_MEMORY);
+        }
+    }
+
+    TextureLevel *tex_level;
+
+    tex_level = &tex->faces[0].levels[0];
+
+    bzero(tex_level, sizeof(TextureLevel));
+    tex_level->complete = true;
+    tex_level->width = width;
+    tex_level->height = 1;
+    tex_level->depth = 1;
+    tex_level->pitch = width * pixel_size;
+    tex_level->mtl_format = mtlFormatForGLInternalFormat(internalformat);
+    tex_level->data_size = size;
+
+    tex->internalformat = internalformat;
+    tex->width = width;
+    tex->height = 1;
+    tex->depth = 1;
+    tex->num_levels = 1;
+    tex->mipmap_levels = 1;
+    tex->access = GL_READ_WRITE;
+    tex->complete = true;
+
+    // retain first, the texture may be reattached to the same buffer
+    retainBuffer(ctx, buf);
+
+    if (tex->tex_buffer)
+        releaseBuffer(ctx, tex->tex_buffer);
+
+    tex->tex_buffer = buf;
+    tex->tex_buffer_offset = offset;
+    tex->tex_buffer_size = size;
+
+    tex->dirty_bits |= DIRTY_TEXTURE_LEVEL;
+    STATE(dirty_bits) |= DIRTY_TEX;
+}
+
+static Buffer *texBufferObject(GLMContext ctx, GLuint buffer)
+{
+    if (buffer == 0)
+        return NULL;
+
+    return findBuffer(ctx, buffer);
+}
+
+void mglTexBuffer(GLMContext ctx, GLenum target, GLenum internalformat, GLuint buffer)
+{
+    Texture *tex;
+    Buffer *buf;
+
+    ERROR_CHECK_RETURN(target == GL_TEXTURE_BUFFER, GL_INVALID_ENUM);
+
+    buf = texBufferObject(ctx, buffer);
+    ERROR_CHECK_RETURN(buf || buffer == 0, GL_INVALID_OPERATION);
+
+    tex = getTex(ctx, 0, target);
+    ERROR_CHECK_RETURN(tex, GL_INVALID_OPERATION);
+
+    texBufferRange(ctx, tex, internalformat, buf, 0, buf ? buf->size : 0);
+}
+
+void mglTexBufferRange(GLMContext ctx, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    Texture *tex;
+    Buffer *buf;
+
+    ERROR_CHECK_RETURN(target == GL_TEXTURE_BUFFER, GL_INVALID_ENUM);
+
+    buf = texBufferObject(ctx, buffer);
+    ERROR_CHECK_RETURN(buf || buffer == 0, GL_INVALID_OPERATION);
+
+    tex = getTex(ctx, 0, target);
+    ERROR_CHECK_RETURN(tex, GL_INVALID_OPERATION);
+
+    texBufferRange(ctx, tex, internalformat, buf, offset, size);
 }
 
 void mglTextureBuffer(GLMContext ctx, GLuint texture, GLenum internalformat, GLuint buffer)
 {
-    fprintf(stderr, "MGL WARNING: glTextureBuffer called (stub)\n");
+    Texture *tex;
+    Buffer *buf;
+
+    tex = findTexture(ctx, texture);
+    ERROR_CHECK_RETURN(tex, GL_INVALID_OPERATION);
+    ERROR_CHECK_RETURN(tex->target == GL_TEXTURE_BUFFER, GL_INVALID_OPERATION);
+
+    buf = texBufferObject(ctx, buffer);
+    ERROR_CHECK_RETURN(buf || buffer == 0, GL_INVALID_OPERATION);
+
+    texBufferRange(ctx, tex, internalformat, buf, 0, buf ? buf->size : 0);
 }
 
 void mglTextureBufferRange(GLMContext ctx, GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    fprintf(stderr, "MGL WARNING: glTextureBufferRange called (stub)\n");
+    Texture *tex;
+    Buffer *buf;
+
+    tex = findTexture(ctx, texture);
+    ERROR_CHECK_RETURN(tex, GL_INVALID_OPERATION);
+    ERROR_CHECK_RETURN(tex->target == GL_TEXTURE_BUFFER, GL_INVALID_OPERATION);
+
+    buf = texBufferObject(ctx, buffer);
+    ERROR_CHECK_RETURN(buf || buffer == 0, GL_INVALID_OPERATION);
+
+    texBufferRange(ctx, tex, internalformat, buf, offset, size);
 }
 
 void mglCompressedTextureSubImage1D(GLMContext ctx, GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
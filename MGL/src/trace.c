@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * trace.c
+ * MGL
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "trace.h"
+
+int mgl_trace_enabled;
+
+static const char *trace_categories[TRACE_CATEGORIES] = {
+    "gl", "state", "shader", "sync", "frame"
+};
+
+static __thread TraceRing *thread_ring;
+
+static TraceRing *trace_rings;          // pushed with a cas, never removed
+static GLuint trace_next_tid;
+
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t trace_thread;
+static int trace_running;
+static FILE *trace_file;
+static GLboolean trace_first_event;
+static GLuint64 trace_start;
+
+GLuint64 traceTime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (GLuint64)ts.tv_sec * 1000000000ull + (GLuint64)ts.tv_nsec;
+}
+
+static TraceRing *newTraceRing(void)
+{
+    TraceRing *ring;
+
+    ring = (TraceRing *)calloc(1, sizeof(TraceRing));
+    if (ring == NULL)
+        return NULL;
+
+    ring->tid = __atomic_add_fetch(&trace_next_tid, 1, __ATOMIC_RELAXED);
+
+    ring->next = __atomic_load_n(&trace_rings, __ATOMIC_RELAXED);
+    while(!__atomic_compare_exchange_n(&trace_rings, &ring->next, ring, GL_TRUE, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+
+    return ring;
+}
+
+void traceRecord(const char *name, GLuint cat, GLuint64 start, GLuint64 end)
+{
+    TraceRing *ring;
+    TraceEvent *event;
+    GLuint64 head;
+
+    ring = thread_ring;
+
+    if (ring == NULL)
+    {
+        ring = thread_ring = newTraceRing();
+
+        if (ring == NULL)
+            return;
+    }
+
+    head = ring->head;
+
+    // the flusher is behind, losing events beats stalling the gl thread
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= TRACE_RING_EVENTS)
+    {
+        ring->dropped++;
+        return;
+    }
+
+    event = &ring->events[head % TRACE_RING_EVENTS];
+    event->name = name;
+    event->cat = cat;
+    event->start = start;
+    event->end = end;
+
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+GLuint64 traceDropped(void)
+{
+    return thread_ring ? thread_ring->dropped : 0;
+}
+
+// events are comma separated, not terminated
+static void beginTraceEvent(void)
+{
+    if (trace_first_event)
+        trace_first_event = GL_FALSE;
+    else
+        fprintf(trace_file, ",\n");
+}
+
+static void drainTraceRing(TraceRing *ring, int pid)
+{
+    GLuint64 head, tail;
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    tail = ring->tail;
+
+    if (head == tail)
+        return;
+
+    if (ring->named == GL_FALSE)
+    {
+        beginTraceEvent();
+        fprintf(trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"mgl thread %u\"}}",
+                pid, ring->tid, ring->tid);
+
+        ring->named = GL_TRUE;
+    }
+
+    for(; tail != head; tail++)
+    {
+        TraceEvent *event;
+        GLuint64 start;
+
+        event = &ring->events[tail % TRACE_RING_EVENTS];
+
+        // scopes opened before the trace started are clamped to it
+        start = event->start > trace_start ? event->start - trace_start : 0;
+
+        beginTraceEvent();
+        fprintf(trace_file, "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                event->name, trace_categories[event->cat], pid, ring->tid,
+                start / 1000.0, (event->end - event->start) / 1000.0);
+    }
+
+    __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+}
+
+void traceFlush(void)
+{
+    TraceRing *ring;
+    int pid;
+
+    pthread_mutex_lock(&trace_lock);
+
+    if (trace_file)
+    {
+        pid = getpid();
+
+        for(ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next)
+            drainTraceRing(ring, pid);
+
+        fflush(trace_file);
+    }
+
+    pthread_mutex_unlock(&trace_lock);
+}
+
+static void *traceThread(void *arg)
+{
+    struct timespec interval = { 0, TRACE_FLUSH_MS * 1000000 };
+
+    while(__atomic_load_n(&trace_running, __ATOMIC_ACQUIRE))
+    {
+        nanosleep(&interval, NULL);
+
+        traceFlush();
+    }
+
+    return NULL;
+}
+
+void initTrace(const char *path)
+{
+    static int registered;
+    FILE *fp;
+
+    if (path == NULL || *path == 0)
+        return;
+
+    pthread_mutex_lock(&trace_lock);
+
+    if (trace_file)
+    {
+        pthread_mutex_unlock(&trace_lock);
+        return;
+    }
+
+    fp = fopen(path, "w");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "MGL ERROR: initTrace couldn't open %s\n", path);
+        pthread_mutex_unlock(&trace_lock);
+        return;
+    }
+
+    // events still in the rings from an earlier trace don't belong in this one
+    for(TraceRing *ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next)
+    {
+        __atomic_store_n(&ring->tail, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+        ring->named = GL_FALSE;
+        ring->dropped = 0;
+    }
+
+    trace_file = fp;
+    trace_first_event = GL_TRUE;
+    trace_start = traceTime();
+
+    fprintf(trace_file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    __atomic_store_n(&trace_running, 1, __ATOMIC_RELEASE);
+
+    if (pthread_create(&trace_thread, NULL, traceThread, NULL))
+    {
+        // still usable, it just all gets written at shutdown
+        fprintf(stderr, "MGL WARNING: initTrace couldn't start the flusher thread\n");
+        __atomic_store_n(&trace_running, 0, __ATOMIC_RELEASE);
+    }
+
+    if (registered == 0)
+    {
+        atexit(traceShutdown);
+        registered = 1;
+    }
+
+    pthread_mutex_unlock(&trace_lock);
+
+    __atomic_store_n(&mgl_trace_enabled, 1, __ATOMIC_RELEASE);
+
+    fprintf(stderr, "MGL INFO: tracing to %s\n", path);
+}
+
+void traceShutdown(void)
+{
+    GLuint64 dropped;
+
+    __atomic_store_n(&mgl_trace_enabled, 0, __ATOMIC_RELEASE);
+
+    if (__atomic_exchange_n(&trace_running, 0, __ATOMIC_ACQ_REL))
+        pthread_join(trace_thread, NULL);
+
+    traceFlush();
+
+    pthread_mutex_lock(&trace_lock);
+
+    if (trace_file)
+    {
+        fprintf(trace_file, "\n]}\n");
+        fclose(trace_file);
+        trace_file = NULL;
+
+        dropped = 0;
+        for(TraceRing *ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next)
+            dropped += ring->dropped;
+
+        if (dropped)
+            fprintf(stderr, "MGL WARNING: trace dropped %llu events, the rings filled faster than they were flushed\n", dropped);
+    }
+
+    pthread_mutex_unlock(&trace_lock);
+}
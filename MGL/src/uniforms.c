@@ -184,10 +184,12 @@ bool checkUniformParams(GLMContext ctx, GLint location)
     return true;
 }
 
-void mglUniform(GLMContext ctx, GLint location, void *ptr, GLsizei size)
+static void uniformData(GLMContext ctx, GLint location, void *ptr, GLsizei size)
 {
-    assert(checkUniformParams(ctx, location));
-    
+    // -1 isn't an error, gl silently ignores it
+    if (location < 0)
+        return;
+
     Buffer *buf = ctx->state.buffer_base[_UNIFORM_CONSTANT].buffers[location].buf;
     
     if(buf == NULL)
@@ -199,6 +201,13 @@ void mglUniform(GLMContext ctx, GLint location, void *ptr, GLsizei size)
     initBufferData(ctx, buf, size, ptr, true);
 }
 
+void mglUniform(GLMContext ctx, GLint location, void *ptr, GLsizei size)
+{
+    assert(checkUniformParams(ctx, location));
+
+    uniformData(ctx, location, ptr, size);
+}
+
 void mglUniform1d(GLMContext ctx, GLint location, GLdouble x)
 {
     mglUniform(ctx, location, &x, sizeof(GLdouble));
@@ -678,3 +687,37 @@ void mglUniformMatrix4x3fv(GLMContext ctx, GLint location, GLsizei count, GLbool
         );
 }
 
+// no error variants, no program / location checks
+void mglUniform1f_no_error(GLMContext ctx, GLint location, GLfloat v0)
+{
+    uniformData(ctx, location, &v0, sizeof(GLfloat));
+}
+
+void mglUniform4f_no_error(GLMContext ctx, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    GLfloat data[] = {v0, v1, v2, v3};
+
+    uniformData(ctx, location, (void *)data, 4 * sizeof(GLfloat));
+}
+
+void mglUniform1i_no_error(GLMContext ctx, GLint location, GLint v0)
+{
+    uniformData(ctx, location, &v0, sizeof(GLint));
+}
+
+void mglUniform4fv_no_error(GLMContext ctx, GLint location, GLsizei count, const GLfloat *value)
+{
+    uniformData(ctx, location, (void *)value, 4 * count * sizeof(GLfloat));
+}
+
+void mglUniformMatrix4fv_no_error(GLMContext ctx, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    // transposed uploads are rare enough to take the checked path
+    if (transpose)
+    {
+        mglUniformMatrix4fv(ctx, location, count, transpose, value);
+        return;
+    }
+
+    uniformData(ctx, location, (void *)value, count * sizeof(Mat4x4fv));
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * upload_ring.c
+ * MGL
+ *
+ */
+
+#include <string.h>
+
+#include "upload_ring.h"
+#include "simd_utils.h"
+
+// restart lanes are forced to all ones for the min and zero for the max so they never win,
+// compares give all ones / zero lanes which double as the select masks
+#define SCAN_KERNEL(_name_, _type_, _vec_)                                                  \
+static GLboolean _name_(const _type_ *src, GLuint count, GLboolean restart, _type_ skip,    \
+                        GLuint *min, GLuint *max)                                           \
+{                                                                                           \
+    const GLuint lanes = sizeof(_vec_) / sizeof(_type_);                                    \
+    const _vec_ skip_v = (_vec_){0} + skip;                                                 \
+    _vec_ vmin, vmax;                                                                       \
+    _type_ lo, hi;                                                                          \
+    GLuint i;                                                                               \
+                                                                                            \
+    vmin = ~(_vec_){0};                                                                     \
+    vmax = (_vec_){0};                                                                      \
+                                                                                            \
+    for(i=0; i+lanes<=count; i+=lanes)                                                      \
+    {                                                                                       \
+        _vec_ v, m, lt, gt;                                                                 \
+                                                                                            \
+        memcpy(&v, src + i, sizeof(v));                                                     \
+        m = restart ? (_vec_)(v == skip_v) : (_vec_){0};                                    \
+                                                                                            \
+        lt = (_vec_)((v | m) < vmin);                                                       \
+        vmin = (vmin & ~lt) | ((v | m) & lt);                                               \
+                                                                                            \
+        gt = (_vec_)((v & ~m) > vmax);                                                      \
+        vmax = (vmax & ~gt) | ((v & ~m) & gt);                                              \
+    }                                                                                       \
+                                                                                            \
+    lo = (_type_)~0;                                                                        \
+    hi = 0;                                                                                 \
+                                                                                            \
+    for(GLuint l=0; l<lanes; l++)                                                           \
+    {                                                                                       \
+        if (vmin[l] < lo) lo = vmin[l];                                                     \
+        if (vmax[l] > hi) hi = vmax[l];                                                     \
+    }                                                                                       \
+                                                                                            \
+    for(; i<count; i++)                                                                     \
+    {                                                                                       \
+        if (restart && src[i] == skip)                                                      \
+            continue;                                                                       \
+                                                                                            \
+        if (src[i] < lo) lo = src[i];                                                       \
+        if (src[i] > hi) hi = src[i];                                                       \
+    }                                                                                       \
+                                                                                            \
+    /* only restart indices leave the min above the max */                                  \
+    if (lo > hi)                                                                            \
+        return GL_FALSE;                                                                    \
+                                                                                            \
+    *min = lo;                                                                              \
+    *max = hi;                                                                              \
+                                                                                            \
+    return GL_TRUE;                                                                         \
+}
+
+SCAN_KERNEL(scanIndexRange8, GLubyte, u8x16)
+SCAN_KERNEL(scanIndexRange16, GLushort, u16x8)
+SCAN_KERNEL(scanIndexRange32, GLuint, u32x4)
+
+GLboolean scanIndexRange(GLenum type, const void *indices, GLuint count, GLboolean restart, GLuint restart_index,
+                         GLuint *min, GLuint *max)
+{
+    switch(type)
+    {
+        case GL_UNSIGNED_BYTE:
+            // a restart index bigger than the type never matches
+            return scanIndexRange8(indices, count, restart && restart_index <= 0xFF, (GLubyte)restart_index, min, max);
+
+        case GL_UNSIGNED_SHORT:
+            return scanIndexRange16(indices, count, restart && restart_index <= 0xFFFF, (GLushort)restart_index, min, max);
+
+        case GL_UNSIGNED_INT:
+            return scanIndexRange32(indices, count, restart, restart_index, min, max);
+    }
+
+    return GL_FALSE;
+}
+
+static void rebaseIndices16(const GLushort *src, GLushort *dst, GLuint count, GLushort bias, GLboolean keep_restart)
+{
+    const u16x8 bias_v = (u16x8){0} + bias;
+    const u16x8 ones = ~(u16x8){0};
+    GLuint i;
+
+    for(i=0; i+8<=count; i+=8)
+    {
+        u16x8 v, r;
+
+        memcpy(&v, src + i, sizeof(v));
+        r = v - bias_v;
+
+        if (keep_restart)
+            r |= (u16x8)(v == ones);
+
+        memcpy(dst + i, &r, sizeof(r));
+    }
+
+    for(; i<count; i++)
+    {
+        dst[i] = (keep_restart && src[i] == 0xFFFF) ? 0xFFFF : (GLushort)(src[i] - bias);
+    }
+}
+
+static void rebaseIndices32(const GLuint *src, GLuint *dst, GLuint count, GLuint bias, GLboolean keep_restart)
+{
+    const u32x4 bias_v = (u32x4){0} + bias;
+    const u32x4 ones = ~(u32x4){0};
+    GLuint i;
+
+    for(i=0; i+4<=count; i+=4)
+    {
+        u32x4 v, r;
+
+        memcpy(&v, src + i, sizeof(v));
+        r = v - bias_v;
+
+        if (keep_restart)
+            r |= (u32x4)(v == ones);
+
+        memcpy(dst + i, &r, sizeof(r));
+    }
+
+    for(; i<count; i++)
+    {
+        dst[i] = (keep_restart && src[i] == 0xFFFFFFFF) ? 0xFFFFFFFF : src[i] - bias;
+    }
+}
+
+void rebaseIndices(GLenum type, const void *src, void *dst, GLuint count, GLuint bias, GLboolean keep_restart)
+{
+    switch(type)
+    {
+        case GL_UNSIGNED_SHORT:
+            if (bias)
+                rebaseIndices16(src, dst, count, (GLushort)bias, keep_restart);
+            else if (src != dst)
+                memcpy(dst, src, count * sizeof(GLushort));
+            break;
+
+        case GL_UNSIGNED_INT:
+            if (bias)
+                rebaseIndices32(src, dst, count, bias, keep_restart);
+            else if (src != dst)
+                memcpy(dst, src, count * sizeof(GLuint));
+            break;
+    }
+}
+
+void initUploadRing(UploadRing *ring, GLuint64 size)
+{
+    memset(ring, 0, sizeof(UploadRing));
+
+    ring->size = size;
+}
+
+void uploadRingReset(UploadRing *ring, GLuint64 size)
+{
+    ring->size = size;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->first_fence = 0;
+    ring->fence_count = 0;
+
+    ring->grows++;
+}
+
+GLboolean uploadRingFence(UploadRing *ring, GLuint64 serial)
+{
+    UploadRingFence *fence;
+
+    if (ring->fence_count)
+    {
+        fence = &ring->fences[(ring->first_fence + ring->fence_count - 1) % UPLOAD_RING_FENCES];
+
+        if (fence->serial == serial)
+            return GL_TRUE;
+    }
+
+    if (ring->fence_count == UPLOAD_RING_FENCES)
+        return GL_FALSE;
+
+    fence = &ring->fences[(ring->first_fence + ring->fence_count) % UPLOAD_RING_FENCES];
+    fence->serial = serial;
+    fence->end = ring->head;
+
+    ring->fence_count++;
+
+    return GL_TRUE;
+}
+
+void uploadRingRetire(UploadRing *ring, GLuint64 completed)
+{
+    while(ring->fence_count)
+    {
+        UploadRingFence *fence;
+
+        fence = &ring->fences[ring->first_fence];
+
+        if (fence->serial > completed)
+            break;
+
+        ring->tail = fence->end;
+
+        ring->first_fence = (ring->first_fence + 1) % UPLOAD_RING_FENCES;
+        ring->fence_count--;
+    }
+}
+
+GLuint64 uploadRingOldestSerial(UploadRing *ring)
+{
+    if (ring->fence_count == 0)
+        return 0;
+
+    return ring->fences[ring->first_fence].serial;
+}
+
+GLboolean uploadRingAlloc(UploadRing *ring, GLuint64 size, GLuint64 *offset)
+{
+    GLuint64 pos;
+
+    if (ring->fence_count == 0 || size > ring->size)
+        return GL_FALSE;
+
+    pos = (ring->head + UPLOAD_RING_ALIGN - 1) & ~(GLuint64)(UPLOAD_RING_ALIGN - 1);
+
+    // allocations don't wrap, the rest of the buffer is skipped instead
+    if ((pos % ring->size) + size > ring->size)
+    {
+        pos = (pos / ring->size + 1) * ring->size;
+    }
+
+    if (pos + size - ring->tail > ring->size)
+        return GL_FALSE;
+
+    ring->head = pos + size;
+    ring->fences[(ring->first_fence + ring->fence_count - 1) % UPLOAD_RING_FENCES].end = ring->head;
+
+    ring->bytes_uploaded += size;
+    ring->allocations++;
+
+    *offset = pos % ring->size;
+
+    return GL_TRUE;
+}
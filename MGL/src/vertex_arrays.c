@@ -77,6 +77,7 @@ VertexArray *newVAO(GLMContext ctx, GLuint vao)
     bzero((void *)ptr, sizeof(VertexArray));
 
     ptr->name = vao;
+    BUMP_GENERATION(ptr);
 
     for(int i=0; i<MAX_ATTRIBS; i++)
     {
@@ -151,6 +152,19 @@ void mglBindVertexArray(GLMContext ctx, GLuint array)
     }
 }
 
+void mglBindVertexArray_no_error(GLMContext ctx, GLuint array)
+{
+    VertexArray *ptr;
+
+    ptr = array ? getVAO(ctx, array) : NULL;
+
+    if (STATE(vao) != ptr)
+    {
+        STATE(vao) = ptr;
+        STATE(dirty_bits) |= DIRTY_VAO;
+    }
+}
+
 void mglDeleteVertexArrays(GLMContext ctx, GLsizei n, const GLuint *arrays)
 {
     GLuint vao;
@@ -309,23 +323,52 @@ void mglGetVertexAttribfv(GLMContext ctx, GLuint index, GLenum pname, GLfloat *p
 
 void setVertexAttrib(GLMContext ctx, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
 {
+    unsigned client_attribs;
 
     if (stride == 0)
         stride = genStrideFromTypeSize(type, size);
 
     ERROR_CHECK_RETURN(stride, GL_INVALID_ENUM);
 
+    // with no array buffer the pointer is client memory, copied at draw time
+    if (STATE(buffers[_ARRAY_BUFFER]) == NULL && pointer == NULL)
+    {
+        ERROR_RETURN(GL_INVALID_OPERATION);
+        return;
+    }
+
     VAO_ATTRIB_STATE(index).size = size;
     VAO_ATTRIB_STATE(index).type = type;
     VAO_ATTRIB_STATE(index).normalized = normalized;
     VAO_ATTRIB_STATE(index).stride = stride;
-    VAO_ATTRIB_STATE(index).relativeoffset = (GLubyte *)pointer - (GLubyte *)NULL;
+
+    client_attribs = VAO_STATE(client_attribs);
 
     // bind current array buffer to attrib
     VAO_ATTRIB_STATE(index).buffer = STATE(buffers[_ARRAY_BUFFER]);
-    ERROR_CHECK_RETURN(VAO_ATTRIB_STATE(index).buffer, GL_INVALID_OPERATION);
+
+    if (VAO_ATTRIB_STATE(index).buffer)
+    {
+        VAO_ATTRIB_STATE(index).relativeoffset = (GLubyte *)pointer - (GLubyte *)NULL;
+        VAO_ATTRIB_STATE(index).ptr = NULL;
+        VAO_STATE(client_attribs) &= ~(0x1 << index);
+    }
+    else
+    {
+        VAO_ATTRIB_STATE(index).relativeoffset = 0;
+        VAO_ATTRIB_STATE(index).ptr = pointer;
+        VAO_STATE(client_attribs) |= (0x1 << index);
+    }
+
+    // moving between a buffer and client memory changes the backend buffer map, a new
+    // client pointer alone doesn't
+    if (client_attribs != VAO_STATE(client_attribs))
+    {
+        STATE(dirty_bits) |= DIRTY_VAO;
+    }
 
     VAO_STATE(dirty_bits) |= DIRTY_VAO;
+    BUMP_GENERATION(VAO());
 }
 
 void mglVertexAttribPointer(GLMContext ctx, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
@@ -336,16 +379,7 @@ void mglVertexAttribPointer(GLMContext ctx, GLuint index, GLint size, GLenum typ
 
     ERROR_CHECK_RETURN(stride >= 0, GL_INVALID_VALUE);
 
-    // GL_INVALID_OPERATION is generated if zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.
-
-    if (pointer != NULL)
-    {
-        Buffer *ptr;
-
-        ptr = STATE(buffers[_ARRAY_BUFFER]);
-
-        ERROR_CHECK_RETURN(ptr, GL_INVALID_OPERATION);
-    }
+    // a pointer with zero bound to GL_ARRAY_BUFFER is a client array, streamed by the backend
 
     switch(type)
     {
@@ -379,16 +413,7 @@ void mglVertexAttribIPointer(GLMContext ctx, GLuint index, GLint size, GLenum ty
 
     ERROR_CHECK_RETURN(stride >= 0, GL_INVALID_VALUE);
 
-    // GL_INVALID_OPERATION is generated if zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.
-
-    if (pointer != NULL)
-    {
-        Buffer *ptr;
-
-        ptr = ctx->state.vao->attrib[index].buffer;
-
-        ERROR_CHECK_RETURN(ptr, GL_INVALID_OPERATION);
-    }
+    // a pointer with zero bound to GL_ARRAY_BUFFER is a client array, streamed by the backend
 
     switch(type)
     {
@@ -423,16 +448,7 @@ void mglVertexAttribLPointer(GLMContext ctx, GLuint index, GLint size, GLenum ty
 
     ERROR_CHECK_RETURN(stride >= 0, GL_INVALID_VALUE);
 
-    // GL_INVALID_OPERATION is generated if zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.
-
-    if (pointer != NULL)
-    {
-        Buffer *ptr;
-
-        ptr = ctx->state.vao->attrib[index].buffer;
-
-        ERROR_CHECK_RETURN(ptr, GL_INVALID_OPERATION);
-    }
+    // a pointer with zero bound to GL_ARRAY_BUFFER is a client array, streamed by the backend
 
     switch(type)
     {
@@ -455,7 +471,10 @@ void mglGetVertexAttribPointerv(GLMContext ctx, GLuint index, GLenum pname, void
     switch(pname)
     {
         case GL_VERTEX_ATTRIB_ARRAY_POINTER:
-            *pointer = (void **)VAO_ATTRIB_STATE(index).relativeoffset;
+            if (VAO_STATE(client_attribs) & (0x1 << index))
+                *pointer = (void *)VAO_ATTRIB_STATE(index).ptr;
+            else
+                *pointer = (void **)VAO_ATTRIB_STATE(index).relativeoffset;
             break;
 
         default:
@@ -487,6 +506,7 @@ void mglEnableVertexArrayAttrib(GLMContext ctx, GLuint vaobj, GLuint index)
     ptr->enabled_attribs |= (0x1 << index);
 
     ptr->dirty_bits |= DIRTY_VAO_ATTRIB;
+    BUMP_GENERATION(ptr);
 }
 
 void mglDisableVertexArrayAttrib(GLMContext ctx, GLuint vaobj, GLuint index)
@@ -502,6 +522,7 @@ void mglDisableVertexArrayAttrib(GLMContext ctx, GLuint vaobj, GLuint index)
     ptr->enabled_attribs &= ~(0x1 << index);
 
     VAO_STATE(dirty_bits) |= DIRTY_VAO;
+    BUMP_GENERATION(VAO());
 }
 
 void mglEnableVertexAttribArray(GLMContext ctx, GLuint index)
@@ -513,6 +534,7 @@ void mglEnableVertexAttribArray(GLMContext ctx, GLuint index)
     STATE(vao)->enabled_attribs |= (0x1 << index);
 
     VAO_STATE(dirty_bits) |= DIRTY_VAO;
+    BUMP_GENERATION(VAO());
 }
 
 void mglDisableVertexAttribArray(GLMContext ctx, GLuint index)
@@ -524,6 +546,7 @@ void mglDisableVertexAttribArray(GLMContext ctx, GLuint index)
     STATE(vao)->enabled_attribs &= ~(0x1 << index);
 
     VAO_STATE(dirty_bits) |= DIRTY_VAO;
+    BUMP_GENERATION(VAO());
 }
 
 /*
@@ -563,6 +586,7 @@ void mglVertexArrayElementBuffer(GLMContext ctx, GLuint vaobj, GLuint buffer)
     if (buffer == 0)
     {
         ptr->element_array.buffer = NULL;
+        BUMP_GENERATION(ptr);
         return;
     }
 
@@ -573,6 +597,7 @@ void mglVertexArrayElementBuffer(GLMContext ctx, GLuint vaobj, GLuint buffer)
 
     buf_ptr->data.dirty_bits |= DIRTY_BUFFER;
     ptr->dirty_bits |= DIRTY_FBO_BINDING;
+    BUMP_GENERATION(ptr);
 }
 
 void setVertexBindingIndex(GLMContext ctx, VertexArray *vao, GLuint attribindex, GLuint bindingindex)
@@ -583,6 +608,7 @@ void setVertexBindingIndex(GLMContext ctx, VertexArray *vao, GLuint attribindex,
     vao->attrib[attribindex].buffer_bindingindex = bindingindex;
 
     vao->dirty_bits |= DIRTY_VAO_ATTRIB | DIRTY_VAO_BUFFER_BASE;
+    BUMP_GENERATION(vao);
 }
 
 void mglVertexAttribBinding(GLMContext ctx, GLuint attribindex, GLuint bindingindex)
@@ -638,6 +664,7 @@ void setAttribFormat(GLMContext ctx, VertexArray *vao, GLuint attribindex, GLint
     vao->attrib[attribindex].relativeoffset = relativeoffset;
 
     vao->dirty_bits |= DIRTY_VAO_ATTRIB;
+    BUMP_GENERATION(vao);
 }
 
 void mglVertexAttribFormat(GLMContext ctx, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
@@ -682,6 +709,7 @@ void setAttribIFormat(GLMContext ctx, VertexArray *vao, GLuint attribindex, GLin
     vao->attrib[attribindex].relativeoffset = relativeoffset;
 
     vao->dirty_bits |= DIRTY_VAO_ATTRIB;
+    BUMP_GENERATION(vao);
 }
 
 void mglVertexAttribIFormat(GLMContext ctx, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
@@ -732,6 +760,7 @@ void setAttribLFormat(GLMContext ctx, VertexArray *vao, GLuint attribindex, GLin
     vao->attrib[attribindex].relativeoffset = relativeoffset;
 
     vao->dirty_bits |= DIRTY_VAO_ATTRIB;
+    BUMP_GENERATION(vao);
 }
 
 void mglVertexAttribLFormat(GLMContext ctx, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
@@ -774,6 +803,7 @@ void setBindingDivisor(GLMContext ctx, VertexArray *vao, GLuint bindingindex, GL
     vao->attrib[bindingindex].divisor = divisor;
 
     vao->dirty_bits |= DIRTY_VAO_ATTRIB | DIRTY_VAO_BUFFER_BASE;
+    BUMP_GENERATION(vao);
 }
 
 void mglVertexBindingDivisor(GLMContext ctx, GLuint bindingindex, GLuint divisor)
@@ -57,10 +57,12 @@ bool bindVertexBuffer(GLMContext ctx, GLuint vaobj, GLuint bindingindex, GLuint
         {
             vao->attrib[i].buffer = buf;
             vao->attrib[i].stride = stride;
+            vao->client_attribs &= ~(0x1 << i);
         }
     }
 
     vao->dirty_bits |= DIRTY_VAO_BUFFER_BASE;
+    BUMP_GENERATION(vao);
 
     return true;
 }
@@ -21,9 +21,45 @@ enum {
     MGL_DEPTH_TYPE,
     MGL_STENCIL_FORMAT,
     MGL_STENCIL_TYPE,
-    MGL_CONTEXT_FLAGS
+    MGL_CONTEXT_FLAGS,
+    MGL_SAMPLERS_UNIQUE,
+    MGL_SAMPLERS_REQUESTED,
+    MGL_BINDING_CALLS,
+    MGL_VALIDATIONS,
+    MGL_VALIDATIONS_SKIPPED,
+    MGL_DRAWS_MERGED,
+    MGL_CLIENT_BYTES_STREAMED,
+    MGL_MAX_FRAMES_IN_FLIGHT,       // settable, 1 to 8, env MGL_MAX_FRAMES_IN_FLIGHT
+    MGL_LOW_LATENCY,                // settable, env MGL_LOW_LATENCY
+    MGL_FRAME_CPU_TIME_US,
+    MGL_FRAME_GPU_TIME_US,
+    MGL_FRAME_WAIT_TIME_US,
+    MGL_FRAMES_DROPPED,
+    MGL_DRAWS_BATCHED               // queued draws sent through one multi draw indirect batch
 };
 
+// MGLGetStats, every counter is a running total
+typedef struct MGLStats_t {
+    GLuint64    draws;                      // multi draws count each draw, indirect draws their max count
+    GLuint64    state_updates;              // processGLState with dirty state
+    GLuint64    render_passes;
+    GLuint64    pipeline_creates;
+    GLuint64    pipeline_create_ns;
+    GLuint64    sampler_creates;
+    GLuint64    sampler_cache_hits;
+    GLuint64    depth_stencil_creates;
+    GLuint64    depth_stencil_cache_hits;
+    GLuint64    bytes_uploaded;             // buffer and texture data, streamed client arrays
+    GLuint64    bytes_flushed;              // mapped ranges handed back to the gpu
+    GLuint64    bytes_read_back;
+    GLuint64    shader_compiles;
+    GLuint64    shader_compile_ns;
+    GLuint64    program_links;
+    GLuint64    program_link_ns;
+    GLuint64    allocations;                // metal buffers and textures backing gl objects
+    GLuint64    bytes_allocated;
+} MGLStats;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -32,6 +68,13 @@ GLMContext createGLMContext(GLenum format, GLenum type,
                             GLenum depth_format, GLenum depth_type,
                             GLenum stencil_format, GLenum stencil_type);
 
+// flags are GL_CONTEXT_FLAG_*, GL_CONTEXT_FLAG_NO_ERROR_BIT drops draw validation and
+// dispatches the hot entry points to variants without argument checks
+GLMContext createGLMContextWithFlags(GLenum format, GLenum type,
+                                     GLenum depth_format, GLenum depth_type,
+                                     GLenum stencil_format, GLenum stencil_type,
+                                     GLuint flags);
+
 GLuint sizeForFormatType(GLenum format, GLenum type);
 GLuint bicountForFormatType(GLenum format, GLenum type, GLenum component);
 
@@ -48,6 +91,23 @@ void MGLswapBuffers(GLMContext ctx);
 // MGLget can take NULL for the ctx, in this case it will use the current ctx
 void MGLget(GLMContext ctx, GLenum param, GLuint *data);
 
+// MGLset can take NULL for the ctx, only MGL_MAX_FRAMES_IN_FLIGHT and MGL_LOW_LATENCY are settable
+void MGLset(GLMContext ctx, GLenum param, GLuint data);
+
+// MGLGetStats can take NULL for the ctx, stats gets the totals and frame_stats what the
+// last frame added, either can be NULL
+void MGLGetStats(GLMContext ctx, MGLStats *stats, MGLStats *frame_stats);
+
+// MGLResetStats can take NULL for the ctx, zeroes the totals and starts a new frame
+void MGLResetStats(GLMContext ctx);
+
+// MGLStartCapture can take NULL for the ctx, records every gl call on it to path until MGLStopCapture,
+// mgl_replay plays it back on a new context. env MGL_CAPTURE=path captures the first context created
+// only fresh contexts capture, objects and state from before the start aren't recorded and it fails
+// once the context has named objects. client arrays are recorded at each draw, the vertices it reads
+GLboolean MGLStartCapture(GLMContext ctx, const char *path);
+void MGLStopCapture(GLMContext ctx);
+
 #ifdef __cplusplus
 };
 #endif
@@ -19,11 +19,16 @@
 #define GL_UNSIGNED_INT_8_8_8_8_REV       0x8367
 #define GL_DEPTH_COMPONENT                0x1902
 #define GL_FLOAT                          0x1406
+#define GL_CONTEXT_FLAG_NO_ERROR_BIT      0x00000008
 
 
 GLMContext createGLMContext(GLenum format, GLenum type,
                         GLenum depth_format, GLenum depth_type,
                         GLenum stencil_format, GLenum stencil_type);
+GLMContext createGLMContextWithFlags(GLenum format, GLenum type,
+                        GLenum depth_format, GLenum depth_type,
+                        GLenum stencil_format, GLenum stencil_type,
+                        GLuint flags);
 
 void MGLsetCurrentContext(GLMContext ctx);
 void MGLswapBuffers(GLMContext ctx);
@@ -143,9 +148,10 @@ GLFWbool _glfwCreateContextMGL(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
-    window->context.mgl.ctx = createGLMContext(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
-                                               GL_DEPTH_COMPONENT, GL_FLOAT,
-                                               0, 0);
+    window->context.mgl.ctx = createGLMContextWithFlags(GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
+                                                        GL_DEPTH_COMPONENT, GL_FLOAT,
+                                                        0, 0,
+                                                        ctxconfig->noerror ? GL_CONTEXT_FLAG_NO_ERROR_BIT : 0);
     assert(window->context.mgl.ctx);
 
     if (window->context.mgl.ctx == nil)
@@ -0,0 +1,1155 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * main.c
+ * mgl_bench
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#define GL_GLEXT_PROTOTYPES 1
+#include <GL/glcorearb.h>
+
+#include "MGLContext.h"
+
+// mgl_bench [-w warmup] [-r runs] [-t min_run_ms] [-f filter] [-s shader_dir] [-o out.json]
+//
+// microbenchmarks for the state tracker on the headless context libmgl creates at load,
+// each case is calibrated until a run takes min_run_ms, warmed up, then timed over runs
+
+#define GLSL(version, shader) "#version " #version "\n" #shader
+
+#define BENCH_DEFAULT_WARMUP        2
+#define BENCH_DEFAULT_RUNS          10
+#define BENCH_DEFAULT_MIN_RUN_MS    20
+
+// calibration stops doubling here, shader links are slow enough to never get close
+#define BENCH_MAX_OPS               (1 << 24)
+
+// swaps keep command buffers and the upload ring from growing without bound
+#define BENCH_DRAWS_PER_FRAME       1000
+#define BENCH_BYTES_PER_FRAME       (64 * 1024 * 1024)
+
+#define BENCH_TEX_SIZE              256
+#define BENCH_MAX_BUFFER            (4 * 1024 * 1024)
+#define BENCH_MAX_SHADERS           64
+
+typedef struct BenchCase_t BenchCase;
+
+struct BenchCase_t {
+    const char  *group;
+    const char  *name;
+    GLboolean   (*setup)(BenchCase *c);     // false skips the case
+    void        (*run)(BenchCase *c, GLuint ops);
+    void        (*teardown)(BenchCase *c);
+    GLuint      param;                      // churn mask, byte size, format index, corpus index..
+    GLuint64    bytes_per_op;               // 0 if the case doesn't move data
+};
+
+typedef struct BenchOptions_t {
+    GLuint      warmup;
+    GLuint      runs;
+    GLuint64    min_run_ns;
+    const char  *filter;
+    const char  *shader_dir;
+    FILE        *out;
+} BenchOptions;
+
+typedef struct BenchShader_t {
+    char    *name;
+    char    *vertex;
+    char    *fragment;
+} BenchShader;
+
+static BenchShader bench_shaders[BENCH_MAX_SHADERS];
+static GLuint bench_shader_count;
+
+// objects the draw, uniform and upload cases share
+static struct {
+    GLuint  vbo[2];
+    GLuint  vao[2];
+    GLuint  program[2];
+    GLuint  tex_program;
+    GLuint  uniform_program;
+    GLuint  tex[2];
+    GLuint  buffer;
+    GLuint  upload_tex;
+    void    *data;
+} bench;
+
+static GLuint64 benchTime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (GLuint64)ts.tv_sec * 1000000000ull + (GLuint64)ts.tv_nsec;
+}
+
+#pragma mark shaders
+
+static const char *color_vs = GLSL(460,
+    layout(location = 0) in vec3 position;
+    void main() {
+        gl_Position = vec4(position, 1.0);
+    }
+);
+
+static const char *color_fs = GLSL(460,
+    layout(location = 0) out vec4 frag_colour;
+    layout(location = 0) uniform vec4 color;
+    void main() {
+        frag_colour = color;
+    }
+);
+
+static const char *inverse_fs = GLSL(460,
+    layout(location = 0) out vec4 frag_colour;
+    layout(location = 0) uniform vec4 color;
+    void main() {
+        frag_colour = vec4(1.0) - color;
+    }
+);
+
+static const char *tex_vs = GLSL(460,
+    layout(location = 0) in vec3 position;
+    layout(location = 0) out vec2 texcoords;
+    void main() {
+        gl_Position = vec4(position, 1.0);
+        texcoords = position.xy * 0.5 + 0.5;
+    }
+);
+
+static const char *tex_fs = GLSL(460,
+    layout(location = 0) in vec2 texcoords;
+    layout(location = 0) out vec4 frag_colour;
+    layout(binding = 0) uniform sampler2D image;
+    layout(location = 0) uniform vec4 color;
+    void main() {
+        frag_colour = texture(image, texcoords) * color;
+    }
+);
+
+// every uniform is used so none of the locations are stripped
+static const char *uniform_vs = GLSL(460,
+    layout(location = 0) in vec3 position;
+    layout(location = 1) uniform mat4 mvp;
+    layout(location = 5) uniform float scale;
+    void main() {
+        gl_Position = mvp * vec4(position * scale, 1.0);
+    }
+);
+
+static const char *uniform_fs = GLSL(460,
+    layout(location = 0) out vec4 frag_colour;
+    layout(location = 0) uniform vec4 color;
+    layout(location = 6) uniform int mode;
+    layout(location = 7) uniform vec4 palette[8];
+    void main() {
+        frag_colour = color * palette[mode & 7];
+    }
+);
+
+static const char *lit_vs = GLSL(460,
+    layout(location = 0) in vec3 position;
+    layout(location = 1) in vec3 normal;
+    layout(location = 2) in vec2 in_texcoords;
+    layout(location = 0) out vec3 world_normal;
+    layout(location = 1) out vec3 world_position;
+    layout(location = 2) out vec2 texcoords;
+    layout(binding = 0) uniform matrices {
+        mat4 model;
+        mat4 view;
+        mat4 projection;
+    };
+    void main() {
+        vec4 world = model * vec4(position, 1.0);
+        world_position = world.xyz;
+        world_normal = mat3(model) * normal;
+        texcoords = in_texcoords;
+        gl_Position = projection * view * world;
+    }
+);
+
+static const char *lit_fs = GLSL(460,
+    layout(location = 0) in vec3 world_normal;
+    layout(location = 1) in vec3 world_position;
+    layout(location = 2) in vec2 texcoords;
+    layout(location = 0) out vec4 frag_colour;
+    layout(binding = 1) uniform lights {
+        vec4 light_position[4];
+        vec4 light_color[4];
+        vec4 eye;
+    };
+    layout(binding = 0) uniform sampler2D albedo;
+    layout(binding = 1) uniform sampler2D specular_map;
+    void main() {
+        vec3 n = normalize(world_normal);
+        vec3 v = normalize(eye.xyz - world_position);
+        vec3 base = texture(albedo, texcoords).rgb;
+        float spec_strength = texture(specular_map, texcoords).r;
+        vec3 result = vec3(0.0);
+        for(int i=0; i<4; i++) {
+            vec3 l = normalize(light_position[i].xyz - world_position);
+            vec3 h = normalize(l + v);
+            float diffuse = max(dot(n, l), 0.0);
+            float spec = pow(max(dot(n, h), 0.0), 32.0) * spec_strength;
+            result += (base * diffuse + spec) * light_color[i].rgb;
+        }
+        frag_colour = vec4(result, 1.0);
+    }
+);
+
+static const char *post_fs = GLSL(460,
+    layout(location = 0) in vec2 texcoords;
+    layout(location = 0) out vec4 frag_colour;
+    layout(binding = 0) uniform sampler2D image;
+    layout(location = 0) uniform vec2 texel;
+    const float weights[5] = float[](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+    void main() {
+        vec3 result = texture(image, texcoords).rgb * weights[0];
+        for(int i=1; i<5; i++) {
+            result += texture(image, texcoords + vec2(texel.x * i, 0.0)).rgb * weights[i];
+            result += texture(image, texcoords - vec2(texel.x * i, 0.0)).rgb * weights[i];
+            result += texture(image, texcoords + vec2(0.0, texel.y * i)).rgb * weights[i];
+            result += texture(image, texcoords - vec2(0.0, texel.y * i)).rgb * weights[i];
+        }
+        frag_colour = vec4(result * 0.5, 1.0);
+    }
+);
+
+static void addShader(const char *name, const char *vertex, const char *fragment)
+{
+    BenchShader *shader;
+
+    if (bench_shader_count == BENCH_MAX_SHADERS)
+        return;
+
+    shader = &bench_shaders[bench_shader_count++];
+    shader->name = strdup(name);
+    shader->vertex = strdup(vertex);
+    shader->fragment = strdup(fragment);
+}
+
+static char *readFile(const char *path)
+{
+    FILE *fp;
+    long size;
+    char *str;
+
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+        return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    str = (char *)malloc(size + 1);
+    if (str && fread(str, 1, size, fp) != (size_t)size)
+    {
+        free(str);
+        str = NULL;
+    }
+
+    if (str)
+        str[size] = 0;
+
+    fclose(fp);
+
+    return str;
+}
+
+// name.vert / name.frag pairs
+static void loadShaderDir(const char *dir)
+{
+    struct dirent *entry;
+    DIR *d;
+
+    d = opendir(dir);
+    if (d == NULL)
+    {
+        fprintf(stderr, "mgl_bench: couldn't open shader dir %s\n", dir);
+        return;
+    }
+
+    while((entry = readdir(d)))
+    {
+        char path[1024], name[256];
+        char *vertex, *fragment;
+        size_t len;
+
+        len = strlen(entry->d_name);
+
+        if (len < 6 || len - 5 >= sizeof(name) || strcmp(entry->d_name + len - 5, ".vert"))
+            continue;
+
+        memcpy(name, entry->d_name, len - 5);
+        name[len - 5] = 0;
+
+        snprintf(path, sizeof(path), "%s/%s.vert", dir, name);
+        vertex = readFile(path);
+
+        snprintf(path, sizeof(path), "%s/%s.frag", dir, name);
+        fragment = readFile(path);
+
+        if (vertex && fragment)
+            addShader(name, vertex, fragment);
+        else
+            fprintf(stderr, "mgl_bench: %s/%s.vert has no matching .frag\n", dir, name);
+
+        free(vertex);
+        free(fragment);
+    }
+
+    closedir(d);
+}
+
+static GLuint compileShader(GLenum type, const char *src)
+{
+    GLuint shader;
+    GLint status;
+
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &src, NULL);
+    glCompileShader(shader);
+
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        char log[1024];
+
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "mgl_bench: shader compile failed\n%s\n", log);
+
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+static GLuint linkProgram(const char *vertex, const char *fragment)
+{
+    GLuint vs, fs, program;
+    GLint status;
+
+    vs = compileShader(GL_VERTEX_SHADER, vertex);
+    fs = compileShader(GL_FRAGMENT_SHADER, fragment);
+
+    if (vs == 0 || fs == 0)
+    {
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+        return 0;
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        fprintf(stderr, "mgl_bench: program link failed\n");
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+#pragma mark shared objects
+
+static GLboolean setupShared(void)
+{
+    static const GLfloat triangle[] = {
+         0.0f,  0.5f, 0.0f,
+         0.5f, -0.5f, 0.0f,
+        -0.5f, -0.5f, 0.0f
+    };
+    GLubyte texels[2][4 * 4 * 4];
+
+    glViewport(0, 0, 64, 64);
+
+    glGenBuffers(2, bench.vbo);
+    glGenVertexArrays(2, bench.vao);
+
+    for(int i=0; i<2; i++)
+    {
+        glBindVertexArray(bench.vao[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, bench.vbo[i]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glEnableVertexAttribArray(0);
+    }
+
+    bench.program[0] = linkProgram(color_vs, color_fs);
+    bench.program[1] = linkProgram(color_vs, inverse_fs);
+    bench.tex_program = linkProgram(tex_vs, tex_fs);
+    bench.uniform_program = linkProgram(uniform_vs, uniform_fs);
+
+    if (!bench.program[0] || !bench.program[1] || !bench.tex_program || !bench.uniform_program)
+        return GL_FALSE;
+
+    memset(texels[0], 0x40, sizeof(texels[0]));
+    memset(texels[1], 0xc0, sizeof(texels[1]));
+
+    glGenTextures(2, bench.tex);
+
+    for(int i=0; i<2; i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, bench.tex[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels[i]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    // biggest upload any case does, buffer and texture cases source from it
+    bench.data = calloc(1, BENCH_MAX_BUFFER);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+static void teardownShared(void)
+{
+    glDeleteProgram(bench.program[0]);
+    glDeleteProgram(bench.program[1]);
+    glDeleteProgram(bench.tex_program);
+    glDeleteProgram(bench.uniform_program);
+    glDeleteTextures(2, bench.tex);
+    glDeleteVertexArrays(2, bench.vao);
+    glDeleteBuffers(2, bench.vbo);
+
+    free(bench.data);
+}
+
+#pragma mark draws
+
+// what changes between draws
+enum {
+    CHURN_UNIFORM   = 1 << 0,
+    CHURN_BLEND     = 1 << 1,
+    CHURN_DEPTH     = 1 << 2,
+    CHURN_PROGRAM   = 1 << 3,
+    CHURN_TEXTURE   = 1 << 4,
+    CHURN_VAO       = 1 << 5
+};
+
+static GLboolean setupDraw(BenchCase *c)
+{
+    glBindVertexArray(bench.vao[0]);
+    glUseProgram(c->param & CHURN_TEXTURE ? bench.tex_program : bench.program[0]);
+    glUniform4f(0, 1.0f, 0.5f, 0.25f, 1.0f);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, bench.tex[0]);
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    return GL_TRUE;
+}
+
+static void runDraw(BenchCase *c, GLuint ops)
+{
+    GLuint churn;
+
+    churn = c->param;
+
+    for(GLuint i=0; i<ops; i++)
+    {
+        GLuint odd = i & 1;
+
+        if (churn & CHURN_PROGRAM)
+        {
+            // texture churn keeps its own program, alternate against it, both have the color uniform
+            if (churn & CHURN_TEXTURE)
+                glUseProgram(odd ? bench.program[0] : bench.tex_program);
+            else
+                glUseProgram(bench.program[odd]);
+        }
+
+        if (churn & CHURN_TEXTURE)
+            glBindTexture(GL_TEXTURE_2D, bench.tex[odd]);
+
+        if (churn & CHURN_VAO)
+            glBindVertexArray(bench.vao[odd]);
+
+        if (churn & CHURN_BLEND)
+        {
+            if (odd)
+                glEnable(GL_BLEND);
+            else
+                glDisable(GL_BLEND);
+        }
+
+        if (churn & CHURN_DEPTH)
+        {
+            if (odd)
+                glEnable(GL_DEPTH_TEST);
+            else
+                glDisable(GL_DEPTH_TEST);
+        }
+
+        if (churn & CHURN_UNIFORM)
+            glUniform4f(0, (GLfloat)(i & 255) / 255.0f, 0.5f, 0.25f, 1.0f);
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        if ((i + 1) % BENCH_DRAWS_PER_FRAME == 0)
+            MGLswapBuffers(NULL);
+    }
+
+    MGLswapBuffers(NULL);
+}
+
+static void teardownDraw(BenchCase *c)
+{
+    glDisable(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glUseProgram(0);
+    glBindVertexArray(0);
+}
+
+#pragma mark uniforms
+
+enum {
+    UNIFORM_1I,
+    UNIFORM_1F,
+    UNIFORM_4F,
+    UNIFORM_4FV,
+    UNIFORM_4FV_ARRAY,
+    UNIFORM_MATRIX4FV
+};
+
+static GLboolean setupUniform(BenchCase *c)
+{
+    glUseProgram(bench.uniform_program);
+
+    return GL_TRUE;
+}
+
+static void runUniform(BenchCase *c, GLuint ops)
+{
+    GLfloat v[32];
+
+    for(int i=0; i<32; i++)
+        v[i] = (GLfloat)i;
+
+    switch(c->param)
+    {
+        case UNIFORM_1I:
+            for(GLuint i=0; i<ops; i++)
+                glUniform1i(6, (GLint)i);
+            break;
+
+        case UNIFORM_1F:
+            for(GLuint i=0; i<ops; i++)
+                glUniform1f(5, (GLfloat)i);
+            break;
+
+        case UNIFORM_4F:
+            for(GLuint i=0; i<ops; i++)
+                glUniform4f(0, (GLfloat)i, 0.0f, 0.0f, 1.0f);
+            break;
+
+        case UNIFORM_4FV:
+            for(GLuint i=0; i<ops; i++)
+            {
+                v[0] = (GLfloat)i;
+                glUniform4fv(0, 1, v);
+            }
+            break;
+
+        case UNIFORM_4FV_ARRAY:
+            for(GLuint i=0; i<ops; i++)
+            {
+                v[0] = (GLfloat)i;
+                glUniform4fv(7, 8, v);
+            }
+            break;
+
+        case UNIFORM_MATRIX4FV:
+            for(GLuint i=0; i<ops; i++)
+            {
+                v[0] = (GLfloat)i;
+                glUniformMatrix4fv(1, 1, GL_FALSE, v);
+            }
+            break;
+    }
+}
+
+static void teardownUniform(BenchCase *c)
+{
+    glUseProgram(0);
+}
+
+#pragma mark buffer uploads
+
+static GLboolean setupBufferSubData(BenchCase *c)
+{
+    glGenBuffers(1, &bench.buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, bench.buffer);
+    glBufferData(GL_ARRAY_BUFFER, BENCH_MAX_BUFFER, NULL, GL_DYNAMIC_DRAW);
+
+    return GL_TRUE;
+}
+
+static void runBufferSubData(BenchCase *c, GLuint ops)
+{
+    GLuint size, slots, per_frame;
+
+    size = c->param;
+    slots = BENCH_MAX_BUFFER / size;
+    per_frame = BENCH_BYTES_PER_FRAME / size;
+
+    for(GLuint i=0; i<ops; i++)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)(i % slots) * size, size, bench.data);
+
+        if ((i + 1) % per_frame == 0)
+            MGLswapBuffers(NULL);
+    }
+
+    MGLswapBuffers(NULL);
+}
+
+static void teardownBufferSubData(BenchCase *c)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &bench.buffer);
+}
+
+#pragma mark texture uploads
+
+static const struct {
+    const char  *name;
+    GLenum      internalformat;
+    GLenum      format;
+    GLenum      type;
+    GLuint      size;
+} upload_formats[] = {
+    { "rgba8",          GL_RGBA8,           GL_RGBA,    GL_UNSIGNED_BYTE,               4 },
+    { "bgra8",          GL_RGBA8,           GL_BGRA,    GL_UNSIGNED_INT_8_8_8_8_REV,    4 },
+    { "srgb8_alpha8",   GL_SRGB8_ALPHA8,    GL_RGBA,    GL_UNSIGNED_BYTE,               4 },
+    { "r8",             GL_R8,              GL_RED,     GL_UNSIGNED_BYTE,               1 },
+    { "rg8",            GL_RG8,             GL_RG,      GL_UNSIGNED_BYTE,               2 },
+    { "rgb565",         GL_RGB565,          GL_RGB,     GL_UNSIGNED_SHORT_5_6_5,        2 },
+    { "rgba16f",        GL_RGBA16F,         GL_RGBA,    GL_HALF_FLOAT,                  8 },
+    { "r32f",           GL_R32F,            GL_RED,     GL_FLOAT,                       4 },
+    { "rgba32f",        GL_RGBA32F,         GL_RGBA,    GL_FLOAT,                       16 },
+};
+
+static GLboolean setupTexUpload(BenchCase *c)
+{
+    glGenTextures(1, &bench.upload_tex);
+    glBindTexture(GL_TEXTURE_2D, bench.upload_tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, upload_formats[c->param].internalformat, BENCH_TEX_SIZE, BENCH_TEX_SIZE, 0,
+                 upload_formats[c->param].format, upload_formats[c->param].type, NULL);
+
+    return GL_TRUE;
+}
+
+static void runTexUpload(BenchCase *c, GLuint ops)
+{
+    GLuint per_frame;
+
+    per_frame = BENCH_BYTES_PER_FRAME / c->bytes_per_op;
+
+    for(GLuint i=0; i<ops; i++)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, BENCH_TEX_SIZE, BENCH_TEX_SIZE,
+                        upload_formats[c->param].format, upload_formats[c->param].type, bench.data);
+
+        if ((i + 1) % per_frame == 0)
+            MGLswapBuffers(NULL);
+    }
+
+    MGLswapBuffers(NULL);
+}
+
+static void teardownTexUpload(BenchCase *c)
+{
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDeleteTextures(1, &bench.upload_tex);
+}
+
+#pragma mark object churn
+
+enum {
+    OBJECT_BUFFER,
+    OBJECT_TEXTURE,
+    OBJECT_VAO,
+    OBJECT_SAMPLER,
+    OBJECT_FRAMEBUFFER,
+    OBJECT_QUERY
+};
+
+// create, bind / give storage so the object is backed, delete
+static void runChurn(BenchCase *c, GLuint ops)
+{
+    static const GLubyte texels[4 * 4 * 4];
+    GLuint name;
+
+    for(GLuint i=0; i<ops; i++)
+    {
+        switch(c->param)
+        {
+            case OBJECT_BUFFER:
+                glGenBuffers(1, &name);
+                glBindBuffer(GL_ARRAY_BUFFER, name);
+                glBufferData(GL_ARRAY_BUFFER, 256, bench.data, GL_STATIC_DRAW);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                glDeleteBuffers(1, &name);
+                break;
+
+            case OBJECT_TEXTURE:
+                glGenTextures(1, &name);
+                glBindTexture(GL_TEXTURE_2D, name);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+                glBindTexture(GL_TEXTURE_2D, 0);
+                glDeleteTextures(1, &name);
+                break;
+
+            case OBJECT_VAO:
+                glGenVertexArrays(1, &name);
+                glBindVertexArray(name);
+                glBindVertexArray(0);
+                glDeleteVertexArrays(1, &name);
+                break;
+
+            case OBJECT_SAMPLER:
+                glGenSamplers(1, &name);
+                glSamplerParameteri(name, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glDeleteSamplers(1, &name);
+                break;
+
+            case OBJECT_FRAMEBUFFER:
+                glGenFramebuffers(1, &name);
+                glBindFramebuffer(GL_FRAMEBUFFER, name);
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glDeleteFramebuffers(1, &name);
+                break;
+
+            case OBJECT_QUERY:
+                glGenQueries(1, &name);
+                glDeleteQueries(1, &name);
+                break;
+        }
+
+        // deletes of gpu backed objects are deferred to the frame end
+        if ((i + 1) % BENCH_DRAWS_PER_FRAME == 0)
+            MGLswapBuffers(NULL);
+    }
+
+    MGLswapBuffers(NULL);
+}
+
+#pragma mark queries
+
+enum {
+    GET_INTEGER_LIMIT,
+    GET_INTEGER_BINDING,
+    GET_FLOAT4,
+    GET_BOOLEAN,
+    GET_IS_ENABLED,
+    GET_ERROR,
+    GET_STRING
+};
+
+static void runGet(BenchCase *c, GLuint ops)
+{
+    volatile GLuint64 sink;
+    GLfloat f[4];
+    GLint v;
+    GLboolean b;
+
+    sink = 0;
+
+    switch(c->param)
+    {
+        case GET_INTEGER_LIMIT:
+            for(GLuint i=0; i<ops; i++) { glGetIntegerv(GL_MAX_TEXTURE_SIZE, &v); sink += v; }
+            break;
+
+        case GET_INTEGER_BINDING:
+            for(GLuint i=0; i<ops; i++) { glGetIntegerv(GL_CURRENT_PROGRAM, &v); sink += v; }
+            break;
+
+        case GET_FLOAT4:
+            for(GLuint i=0; i<ops; i++) { glGetFloatv(GL_COLOR_CLEAR_VALUE, f); sink += (GLuint64)f[0]; }
+            break;
+
+        case GET_BOOLEAN:
+            for(GLuint i=0; i<ops; i++) { glGetBooleanv(GL_DEPTH_WRITEMASK, &b); sink += b; }
+            break;
+
+        case GET_IS_ENABLED:
+            for(GLuint i=0; i<ops; i++) { sink += glIsEnabled(GL_BLEND); }
+            break;
+
+        case GET_ERROR:
+            for(GLuint i=0; i<ops; i++) { sink += glGetError(); }
+            break;
+
+        case GET_STRING:
+            for(GLuint i=0; i<ops; i++) { sink += (uintptr_t)glGetString(GL_RENDERER); }
+            break;
+    }
+
+    (void)sink;
+}
+
+#pragma mark shader links
+
+static GLboolean setupLink(BenchCase *c)
+{
+    GLuint program;
+
+    program = linkProgram(bench_shaders[c->param].vertex, bench_shaders[c->param].fragment);
+    glDeleteProgram(program);
+
+    return program != 0;
+}
+
+static void runLink(BenchCase *c, GLuint ops)
+{
+    const BenchShader *shader;
+
+    shader = &bench_shaders[c->param];
+
+    for(GLuint i=0; i<ops; i++)
+        glDeleteProgram(linkProgram(shader->vertex, shader->fragment));
+}
+
+#pragma mark running
+
+static int compareDouble(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static GLuint64 timeRun(BenchCase *c, GLuint ops)
+{
+    GLuint64 start;
+
+    start = benchTime();
+    c->run(c, ops);
+
+    return benchTime() - start;
+}
+
+static GLboolean matchesFilter(const BenchCase *c, const char *filter)
+{
+    char name[256];
+
+    if (filter == NULL)
+        return GL_TRUE;
+
+    snprintf(name, sizeof(name), "%s/%s", c->group, c->name);
+
+    return strstr(name, filter) != NULL;
+}
+
+static void runCase(BenchCase *c, const BenchOptions *opts, GLboolean *first)
+{
+    MGLStats before, after;
+    double *ns_per_op, sum, mean, var, median;
+    GLuint64 elapsed;
+    GLuint ops;
+    GLenum err;
+
+    if (matchesFilter(c, opts->filter) == GL_FALSE)
+        return;
+
+    fprintf(opts->out, "%s    {\n", *first ? "" : ",\n");
+    fprintf(opts->out, "      \"group\": \"%s\",\n", c->group);
+    fprintf(opts->out, "      \"name\": \"%s\",\n", c->name);
+    *first = GL_FALSE;
+
+    fprintf(stderr, "mgl_bench: %s/%s\n", c->group, c->name);
+
+    if (c->setup && c->setup(c) == GL_FALSE)
+    {
+        fprintf(opts->out, "      \"skipped\": \"setup failed\"\n    }");
+        return;
+    }
+
+    // runs long enough that timer and swap granularity wash out
+    for(ops = 1; ops < BENCH_MAX_OPS; ops *= 2)
+    {
+        if (timeRun(c, ops) >= opts->min_run_ns)
+            break;
+    }
+
+    for(GLuint i=0; i<opts->warmup; i++)
+        timeRun(c, ops);
+
+    // a case the gl rejects times the error path, report it rather than a number
+    if ((err = glGetError()) != GL_NO_ERROR)
+    {
+        fprintf(opts->out, "      \"skipped\": \"gl error 0x%04x\"\n    }", err);
+
+        if (c->teardown)
+            c->teardown(c);
+
+        while(glGetError() != GL_NO_ERROR)
+            ;
+
+        return;
+    }
+
+    ns_per_op = (double *)malloc(opts->runs * sizeof(double));
+
+    MGLGetStats(NULL, &before, NULL);
+
+    sum = 0;
+    for(GLuint i=0; i<opts->runs; i++)
+    {
+        elapsed = timeRun(c, ops);
+
+        ns_per_op[i] = (double)elapsed / ops;
+        sum += ns_per_op[i];
+    }
+
+    MGLGetStats(NULL, &after, NULL);
+
+    if (c->teardown)
+        c->teardown(c);
+
+    mean = sum / opts->runs;
+
+    var = 0;
+    for(GLuint i=0; i<opts->runs; i++)
+        var += (ns_per_op[i] - mean) * (ns_per_op[i] - mean);
+    var = opts->runs > 1 ? var / (opts->runs - 1) : 0;
+
+    qsort(ns_per_op, opts->runs, sizeof(double), compareDouble);
+
+    median = opts->runs & 1 ? ns_per_op[opts->runs / 2] :
+             (ns_per_op[opts->runs / 2 - 1] + ns_per_op[opts->runs / 2]) / 2;
+
+    fprintf(opts->out, "      \"ops_per_run\": %u,\n", ops);
+    fprintf(opts->out, "      \"runs\": %u,\n", opts->runs);
+    fprintf(opts->out, "      \"ns_per_op\": { \"min\": %.2f, \"median\": %.2f, \"mean\": %.2f, \"stddev\": %.2f, \"p95\": %.2f, \"max\": %.2f },\n",
+            ns_per_op[0], median, mean, sqrt(var),
+            ns_per_op[(opts->runs * 95) / 100 < opts->runs ? (opts->runs * 95) / 100 : opts->runs - 1],
+            ns_per_op[opts->runs - 1]);
+    fprintf(opts->out, "      \"ops_per_sec\": %.1f,\n", 1e9 / median);
+
+    if (c->bytes_per_op)
+        fprintf(opts->out, "      \"mb_per_sec\": %.1f,\n", c->bytes_per_op * 1e9 / median / (1024.0 * 1024.0));
+
+    // what the state tracker did for each op, from MGLGetStats
+    {
+        double total_ops = (double)ops * opts->runs;
+
+        fprintf(opts->out, "      \"per_op\": { \"draws\": %.3f, \"state_updates\": %.3f, \"render_passes\": %.3f, \"pipeline_creates\": %.3f, \"bytes_uploaded\": %.1f, \"allocations\": %.3f }\n",
+                (after.draws - before.draws) / total_ops,
+                (after.state_updates - before.state_updates) / total_ops,
+                (after.render_passes - before.render_passes) / total_ops,
+                (after.pipeline_creates - before.pipeline_creates) / total_ops,
+                (after.bytes_uploaded - before.bytes_uploaded) / total_ops,
+                (after.allocations - before.allocations) / total_ops);
+    }
+
+    fprintf(opts->out, "    }");
+    fflush(opts->out);
+
+    free(ns_per_op);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-w warmup] [-r runs] [-t min_run_ms] [-f filter] [-s shader_dir] [-o out.json]\n", name);
+    fprintf(stderr, "  filter matches group/name, shader_dir adds name.vert / name.frag pairs to the link corpus\n");
+}
+
+int main(int argc, char **argv)
+{
+    static const struct { const char *name; GLuint churn; } draw_cases[] = {
+        { "static",     0 },
+        { "uniform",    CHURN_UNIFORM },
+        { "blend",      CHURN_BLEND },
+        { "depth",      CHURN_DEPTH },
+        { "program",    CHURN_PROGRAM },
+        { "texture",    CHURN_TEXTURE },
+        { "vao",        CHURN_VAO },
+        { "all",        CHURN_UNIFORM | CHURN_BLEND | CHURN_DEPTH | CHURN_PROGRAM | CHURN_TEXTURE | CHURN_VAO },
+    };
+    static const struct { const char *name; GLuint param; } uniform_cases[] = {
+        { "uniform1i",          UNIFORM_1I },
+        { "uniform1f",          UNIFORM_1F },
+        { "uniform4f",          UNIFORM_4F },
+        { "uniform4fv",         UNIFORM_4FV },
+        { "uniform4fv_x8",      UNIFORM_4FV_ARRAY },
+        { "uniform_matrix4fv",  UNIFORM_MATRIX4FV },
+    };
+    static const GLuint buffer_sizes[] = { 64, 1024, 16 * 1024, 256 * 1024, BENCH_MAX_BUFFER };
+    static const struct { const char *name; GLuint param; } churn_cases[] = {
+        { "buffer",         OBJECT_BUFFER },
+        { "texture",        OBJECT_TEXTURE },
+        { "vao",            OBJECT_VAO },
+        { "sampler",        OBJECT_SAMPLER },
+        { "framebuffer",    OBJECT_FRAMEBUFFER },
+        { "query",          OBJECT_QUERY },
+    };
+    static const struct { const char *name; GLuint param; } get_cases[] = {
+        { "integer_limit",      GET_INTEGER_LIMIT },
+        { "integer_binding",    GET_INTEGER_BINDING },
+        { "float4",             GET_FLOAT4 },
+        { "boolean",            GET_BOOLEAN },
+        { "is_enabled",         GET_IS_ENABLED },
+        { "error",              GET_ERROR },
+        { "string",             GET_STRING },
+    };
+    BenchOptions opts;
+    GLboolean first;
+    int opt;
+
+    opts.warmup = BENCH_DEFAULT_WARMUP;
+    opts.runs = BENCH_DEFAULT_RUNS;
+    opts.min_run_ns = BENCH_DEFAULT_MIN_RUN_MS * 1000000ull;
+    opts.filter = NULL;
+    opts.shader_dir = NULL;
+    opts.out = stdout;
+
+    while((opt = getopt(argc, argv, "w:r:t:f:s:o:h")) != -1)
+    {
+        switch(opt)
+        {
+            case 'w': opts.warmup = (GLuint)atoi(optarg); break;
+            case 'r': opts.runs = (GLuint)atoi(optarg); break;
+            case 't': opts.min_run_ns = (GLuint64)atoi(optarg) * 1000000ull; break;
+            case 'f': opts.filter = optarg; break;
+            case 's': opts.shader_dir = optarg; break;
+            case 'o':
+                opts.out = fopen(optarg, "w");
+                if (opts.out == NULL)
+                {
+                    fprintf(stderr, "mgl_bench: couldn't open %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (opts.runs < 1)
+        opts.runs = 1;
+
+    if (MGLgetCurrentContext() == NULL)
+    {
+        fprintf(stderr, "mgl_bench: libmgl didn't create a context\n");
+        return 1;
+    }
+
+    if (setupShared() == GL_FALSE)
+    {
+        fprintf(stderr, "mgl_bench: couldn't create the shared objects\n");
+        return 1;
+    }
+
+    addShader("color", color_vs, color_fs);
+    addShader("textured", tex_vs, tex_fs);
+    addShader("uniforms", uniform_vs, uniform_fs);
+    addShader("lit", lit_vs, lit_fs);
+    addShader("blur", tex_vs, post_fs);
+
+    if (opts.shader_dir)
+        loadShaderDir(opts.shader_dir);
+
+    fprintf(opts.out, "{\n");
+    fprintf(opts.out, "  \"version\": 1,\n");
+    fprintf(opts.out, "  \"renderer\": \"%s\",\n", (const char *)glGetString(GL_RENDERER));
+    fprintf(opts.out, "  \"gl_version\": \"%s\",\n", (const char *)glGetString(GL_VERSION));
+    fprintf(opts.out, "  \"warmup\": %u,\n", opts.warmup);
+    fprintf(opts.out, "  \"runs\": %u,\n", opts.runs);
+    fprintf(opts.out, "  \"min_run_ms\": %llu,\n", opts.min_run_ns / 1000000ull);
+    fprintf(opts.out, "  \"benchmarks\": [\n");
+
+    first = GL_TRUE;
+
+    for(size_t i=0; i<sizeof(draw_cases) / sizeof(draw_cases[0]); i++)
+    {
+        BenchCase c = { "draw", draw_cases[i].name, setupDraw, runDraw, teardownDraw, draw_cases[i].churn, 0 };
+        runCase(&c, &opts, &first);
+    }
+
+    for(size_t i=0; i<sizeof(uniform_cases) / sizeof(uniform_cases[0]); i++)
+    {
+        BenchCase c = { "uniform", uniform_cases[i].name, setupUniform, runUniform, teardownUniform, uniform_cases[i].param, 0 };
+        runCase(&c, &opts, &first);
+    }
+
+    for(size_t i=0; i<sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); i++)
+    {
+        char name[32];
+
+        snprintf(name, sizeof(name), "%u", buffer_sizes[i]);
+
+        BenchCase c = { "buffer_sub_data", name, setupBufferSubData, runBufferSubData, teardownBufferSubData, buffer_sizes[i], buffer_sizes[i] };
+        runCase(&c, &opts, &first);
+    }
+
+    for(size_t i=0; i<sizeof(upload_formats) / sizeof(upload_formats[0]); i++)
+    {
+        BenchCase c = { "tex_sub_image", upload_formats[i].name, setupTexUpload, runTexUpload, teardownTexUpload, (GLuint)i,
+                        (GLuint64)BENCH_TEX_SIZE * BENCH_TEX_SIZE * upload_formats[i].size };
+        runCase(&c, &opts, &first);
+    }
+
+    for(size_t i=0; i<sizeof(churn_cases) / sizeof(churn_cases[0]); i++)
+    {
+        BenchCase c = { "create_delete", churn_cases[i].name, NULL, runChurn, NULL, churn_cases[i].param, 0 };
+        runCase(&c, &opts, &first);
+    }
+
+    for(size_t i=0; i<sizeof(get_cases) / sizeof(get_cases[0]); i++)
+    {
+        BenchCase c = { "get", get_cases[i].name, NULL, runGet, NULL, get_cases[i].param, 0 };
+        runCase(&c, &opts, &first);
+    }
+
+    for(GLuint i=0; i<bench_shader_count; i++)
+    {
+        BenchCase c = { "link", bench_shaders[i].name, setupLink, runLink, NULL, i, 0 };
+        runCase(&c, &opts, &first);
+    }
+
+    fprintf(opts.out, "\n  ]\n}\n");
+
+    if (opts.out != stdout)
+        fclose(opts.out);
+
+    teardownShared();
+
+    return 0;
+}
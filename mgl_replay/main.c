@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) Michael Larson on 1/6/2022
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * main.c
+ * mgl_replay
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "glm_context.h"
+#include "capture.h"
+
+// MGLRenderer.m
+extern void *CppCreateMGLRendererHeadless(void *glm_ctx);
+
+// the same formats libmgl's auto init context uses
+static GLMContext newReplayContext(void)
+{
+    GLMContext ctx;
+
+    ctx = createGLMContext(GL_RGBA, GL_UNSIGNED_BYTE,
+                           GL_DEPTH_COMPONENT24, GL_UNSIGNED_INT,
+                           GL_STENCIL_INDEX8, GL_UNSIGNED_BYTE);
+    CppCreateMGLRendererHeadless(ctx);
+
+    return ctx;
+}
+
+// mgl_replay trace [loops]
+//
+// plays a MGL_CAPTURE trace back on the headless context libmgl creates at load and
+// writes per frame and per command timings as json to stdout, each loop starts
+// from a fresh context so object names line up with the capture
+int main(int argc, char **argv)
+{
+    GLMContext ctx;
+    Replay *r;
+    int loops;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s trace [loops]\n", argv[0]);
+        return 1;
+    }
+
+    loops = argc > 2 ? atoi(argv[2]) : 1;
+    if (loops < 1)
+        loops = 1;
+
+    r = replayOpen(argv[1]);
+    if (r == NULL)
+        return 1;
+
+    for(int i=0; i<loops; i++)
+    {
+        ctx = i == 0 ? MGLgetCurrentContext() : newReplayContext();
+
+        if (ctx == NULL)
+        {
+            fprintf(stderr, "mgl_replay: no context to replay on\n");
+            replayClose(r);
+            return 1;
+        }
+
+        if (replayRun(r, ctx) == GL_FALSE)
+        {
+            replayClose(r);
+            return 1;
+        }
+    }
+
+    replayReport(r, stdout);
+
+    replayClose(r);
+
+    return 0;
+}
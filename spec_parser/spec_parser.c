@@ -38,9 +38,49 @@ enum {
     kMGLHeaders,        // mgl.h
     kMGLFuncs,          // mgl.c
     kMGLDispatch,       // glm_dispatch.h
-    kMGLDispatchInit    // glm_dispatch.c
+    kMGLDispatchInit,   // glm_dispatch.c
+    kMGLNoErrorHeaders, // mgl.h, *_no_error prototypes
+    kMGLNoErrorDispatchInit, // glm_dispatch.c, init_no_error_dispatch
+    kMGLCaptureEnum,    // glm_capture.h, command ids
+    kMGLCaptureArgs,    // glm_capture.c, argument descriptors
+    kMGLCaptureCommands,// glm_capture.c, capture_commands table
+    kMGLCaptureFuncs,   // glm_capture.c, dispatch wrappers that record each call
+    kMGLCaptureInit,    // glm_capture.c, init_capture_dispatch
+    kMGLReplay          // glm_capture.c, replay_command
 };
 
+// hot entry points with a hand written *_no_error variant, GL_CONTEXT_FLAG_NO_ERROR_BIT
+// contexts dispatch these straight past argument validation
+static const char *no_error_commands[] = {
+    "glDrawArrays",
+    "glDrawElements",
+    "glDrawRangeElements",
+    "glBindBuffer",
+    "glBufferSubData",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform4fv",
+    "glUniformMatrix4fv",
+    "glBindVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glDrawElementsBaseVertex",
+    NULL
+};
+
+int has_no_error_variant(const char *name)
+{
+    for (int i=0; no_error_commands[i]; i++)
+    {
+        if (!strcmp(no_error_commands[i], name))
+            return 1;
+    }
+
+    return 0;
+}
+
 typedef struct {
     int major, minor;
 } GLVersion;
@@ -321,13 +361,18 @@ void print_command(ezxml_t command, int mode, FILE *fp_out)
 
         free(str);
     }
-    else if (mode == kMGLHeaders || mode == kMGLFuncs)
+    else if (mode == kMGLHeaders || mode == kMGLFuncs || mode == kMGLNoErrorHeaders)
     {
         char *str, *mgl_func;
 
         mgl_func = make_mgl_str(name->txt);
         assert(mgl_func);
 
+        if (mode == kMGLNoErrorHeaders)
+        {
+            strcat(mgl_func, "_no_error");
+        }
+
         str = insert_string(proto->txt, mgl_func, name->off);
         assert(str);
 
@@ -407,7 +452,7 @@ void print_command(ezxml_t command, int mode, FILE *fp_out)
         }
     }
 
-    if (mode == kGLHeaders || mode == kMGLHeaders || mode == kMGLDispatch)
+    if (mode == kGLHeaders || mode == kMGLHeaders || mode == kMGLDispatch || mode == kMGLNoErrorHeaders)
     {
         fprintf(fp_out, ");\n");
     }
@@ -420,6 +465,9 @@ void print_command(ezxml_t command, int mode, FILE *fp_out)
         fprintf(fp_out, ")\n{\n");
         fprintf(fp_out, "\tGLMContext ctx = GET_CONTEXT();\n\n");
 
+        // a MGL_TRACE scope per entry point, a load and a branch when tracing is off
+        fprintf(fp_out, "\tTRACE_GL_CALL();\n\n");
+
         dispatch_name = make_dispatch_str(name->txt);
 
         if (proto_has_return_type(proto))
@@ -546,7 +594,7 @@ void print_command(ezxml_t command, int mode, FILE *fp_out)
     }
 }
 
-void print_init_dispatch_command(ezxml_t command, FILE *fp_out)
+void print_init_dispatch_command(ezxml_t command, int mode, FILE *fp_out)
 {
     ezxml_t proto, name;
     char *dispatch_name, *mgl_name;
@@ -559,12 +607,377 @@ void print_init_dispatch_command(ezxml_t command, FILE *fp_out)
     dispatch_name = make_dispatch_str(name->txt);
     mgl_name = make_mgl_str(name->txt);
 
+    if (mode == kMGLNoErrorDispatchInit)
+    {
+        strcat(mgl_name, "_no_error");
+    }
+
     fprintf(fp_out, "\tctx->dispatch.%s = %s;\n", dispatch_name, mgl_name);
 
     free(dispatch_name);
     free(mgl_name);
 }
 
+// the c type of a param or proto without its name, caller frees
+char *decl_type(ezxml_t node)
+{
+    ezxml_t ptype;
+    char *str;
+    size_t len;
+
+    ptype = ezxml_child(node, "ptype");
+
+    if (ptype)
+    {
+        str = insert_string(node->txt, ptype->txt, ptype->off);
+    }
+    else
+    {
+        str = strdup(node->txt);
+    }
+
+    assert(str);
+
+    // trailing space before the name
+    len = strlen(str);
+    while (len && isspace(str[len-1]))
+    {
+        str[--len] = 0;
+    }
+
+    return str;
+}
+
+int count_stars(const char *str)
+{
+    int stars = 0;
+
+    while(*str)
+    {
+        if (*str++ == '*')
+        {
+            stars++;
+        }
+    }
+
+    return stars;
+}
+
+// how capture.c records a param, values are copied, pointers have their client memory recorded
+const char *capture_kind(ezxml_t param, char *elem_size, size_t elem_len)
+{
+    ezxml_t ptype;
+    char *type;
+    const char *kind;
+    int stars;
+
+    ptype = ezxml_child(param, "ptype");
+    type = decl_type(param);
+    stars = count_stars(type);
+
+    snprintf(elem_size, elem_len, "0");
+
+    if (stars == 0)
+    {
+        if (ptype && !strcmp(ptype->txt, "GLsync"))
+        {
+            kind = "CAPTURE_SYNC";
+        }
+        else if (ptype && strstr(ptype->txt, "PROC"))
+        {
+            kind = "CAPTURE_PROC";
+        }
+        else
+        {
+            kind = "CAPTURE_VALUE";
+        }
+    }
+    else if (!strncmp(type, "const", 5))
+    {
+        if (ptype && !strcmp(ptype->txt, "GLchar"))
+        {
+            kind = stars == 1 ? "CAPTURE_STRING" : "CAPTURE_STRINGS";
+        }
+        else
+        {
+            kind = "CAPTURE_IN";
+        }
+
+        if (stars > 1)
+        {
+            snprintf(elem_size, elem_len, "sizeof(void *)");
+        }
+        else if (ptype)
+        {
+            snprintf(elem_size, elem_len, "sizeof(%s)", ptype->txt);
+        }
+        else
+        {
+            snprintf(elem_size, elem_len, "1");
+        }
+    }
+    else
+    {
+        kind = "CAPTURE_OUT";
+
+        if (stars > 1)
+        {
+            snprintf(elem_size, elem_len, "sizeof(void *)");
+        }
+        else if (ptype)
+        {
+            snprintf(elem_size, elem_len, "sizeof(%s)", ptype->txt);
+        }
+        else
+        {
+            snprintf(elem_size, elem_len, "1");
+        }
+    }
+
+    free(type);
+
+    return kind;
+}
+
+int proto_returns_value(ezxml_t proto)
+{
+    return ezxml_child(proto, "ptype") || strchr(proto->txt, '*');
+}
+
+void print_capture_params(ezxml_t command, FILE *fp_out)
+{
+    ezxml_t param;
+
+    fprintf(fp_out, "GLMContext ctx");
+
+    for (param = ezxml_child(command, "param"); param; param = param->next)
+    {
+        char *type;
+
+        type = decl_type(param);
+
+        if (type[strlen(type)-1] == '*')
+        {
+            fprintf(fp_out, ", %s%s", type, ezxml_child(param, "name")->txt);
+        }
+        else
+        {
+            fprintf(fp_out, ", %s %s", type, ezxml_child(param, "name")->txt);
+        }
+
+        free(type);
+    }
+}
+
+void print_capture_call_args(ezxml_t command, FILE *fp_out)
+{
+    ezxml_t param;
+
+    fprintf(fp_out, "ctx");
+
+    for (param = ezxml_child(command, "param"); param; param = param->next)
+    {
+        fprintf(fp_out, ", %s", ezxml_child(param, "name")->txt);
+    }
+}
+
+void print_capture_command(ezxml_t command, int mode, FILE *fp_out)
+{
+    ezxml_t proto, name, param;
+    char *dispatch_name, *ret_type;
+    int param_count, i;
+
+    proto = ezxml_child(command, string("proto"));
+    assert(proto);
+
+    name = ezxml_child(proto, string("name"));
+    assert(name);
+
+    dispatch_name = make_dispatch_str(name->txt);
+    param_count = get_param_count(command);
+
+    ret_type = decl_type(proto);
+
+    // wrappers and replay use these as locals
+    for (param = ezxml_child(command, "param"); param; param = param->next)
+    {
+        const char *param_name = ezxml_child(param, "name")->txt;
+
+        assert(strcmp(param_name, "ctx") && strcmp(param_name, "args") && strcmp(param_name, "ret"));
+    }
+
+    switch(mode)
+    {
+        case kMGLCaptureEnum:
+            fprintf(fp_out, "\tCAPTURE_%s,\n", name->txt);
+            break;
+
+        case kMGLCaptureArgs:
+            if (param_count == 0)
+            {
+                break;
+            }
+
+            fprintf(fp_out, "static const CaptureArg capture_args_%s[] = {\n", name->txt);
+
+            for (param = ezxml_child(command, "param"); param; param = param->next)
+            {
+                char elem_size[128];
+                const char *kind;
+                char *type;
+
+                kind = capture_kind(param, elem_size, sizeof(elem_size));
+                type = decl_type(param);
+
+                fprintf(fp_out, "\t{ \"%s\", %s, sizeof(%s), %s },\n",
+                        ezxml_child(param, "name")->txt, kind, type, elem_size);
+
+                free(type);
+            }
+
+            fprintf(fp_out, "};\n\n");
+            break;
+
+        case kMGLCaptureCommands:
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\t{ \"%s\", %d, %s%s, %s, sizeof(%s) },\n",
+                        name->txt, param_count,
+                        param_count ? "capture_args_" : "NULL", param_count ? name->txt : "",
+                        strstr(ret_type, "GLsync") ? "CAPTURE_SYNC" : "CAPTURE_VALUE", ret_type);
+            }
+            else
+            {
+                fprintf(fp_out, "\t{ \"%s\", %d, %s%s, CAPTURE_VOID, 0 },\n",
+                        name->txt, param_count,
+                        param_count ? "capture_args_" : "NULL", param_count ? name->txt : "");
+            }
+            break;
+
+        case kMGLCaptureFuncs:
+            fprintf(fp_out, "static %s%scapture_%s(", ret_type, ret_type[strlen(ret_type)-1] == '*' ? "" : " ", dispatch_name);
+            print_capture_params(command, fp_out);
+            fprintf(fp_out, ")\n{\n");
+
+            if (param_count)
+            {
+                fprintf(fp_out, "\tGLuint64 args[%d] = { 0 };\n", param_count);
+            }
+
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\t%s%sret;\n", ret_type, ret_type[strlen(ret_type)-1] == '*' ? "" : " ");
+            }
+
+            if (param_count || proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\n");
+            }
+
+            i = 0;
+            for (param = ezxml_child(command, "param"); param; param = param->next, i++)
+            {
+                const char *param_name = ezxml_child(param, "name")->txt;
+
+                fprintf(fp_out, "\tmemcpy(&args[%d], &%s, sizeof(%s));\n", i, param_name, param_name);
+            }
+
+            if (param_count)
+            {
+                fprintf(fp_out, "\n");
+            }
+
+            fprintf(fp_out, "\tcaptureCall(ctx, CAPTURE_%s, %s);\n\n", name->txt, param_count ? "args" : "NULL");
+
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\tret = ctx->capture_dispatch.%s(", dispatch_name);
+            }
+            else
+            {
+                fprintf(fp_out, "\tctx->capture_dispatch.%s(", dispatch_name);
+            }
+
+            print_capture_call_args(command, fp_out);
+            fprintf(fp_out, ");\n\n");
+
+            fprintf(fp_out, "\tcaptureReturn(ctx, CAPTURE_%s, %s, %s);\n", name->txt,
+                    param_count ? "args" : "NULL", proto_returns_value(proto) ? "&ret" : "NULL");
+
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\n\treturn ret;\n");
+            }
+
+            fprintf(fp_out, "}\n\n");
+            break;
+
+        case kMGLCaptureInit:
+            fprintf(fp_out, "\tctx->dispatch.%s = capture_%s;\n", dispatch_name, dispatch_name);
+            break;
+
+        case kMGLReplay:
+            fprintf(fp_out, "\t\tcase CAPTURE_%s:\n\t\t{\n", name->txt);
+
+            for (param = ezxml_child(command, "param"); param; param = param->next)
+            {
+                char *type;
+
+                type = decl_type(param);
+
+                fprintf(fp_out, "\t\t\t%s%s%s;\n", type, type[strlen(type)-1] == '*' ? "" : " ", ezxml_child(param, "name")->txt);
+
+                free(type);
+            }
+
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\t\t\t%s%sresult;\n", ret_type, ret_type[strlen(ret_type)-1] == '*' ? "" : " ");
+            }
+
+            if (param_count || proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\n");
+            }
+
+            i = 0;
+            for (param = ezxml_child(command, "param"); param; param = param->next, i++)
+            {
+                const char *param_name = ezxml_child(param, "name")->txt;
+
+                fprintf(fp_out, "\t\t\tmemcpy(&%s, &args[%d], sizeof(%s));\n", param_name, i, param_name);
+            }
+
+            if (param_count)
+            {
+                fprintf(fp_out, "\n");
+            }
+
+            if (proto_returns_value(proto))
+            {
+                fprintf(fp_out, "\t\t\tresult = ctx->dispatch.%s(", dispatch_name);
+                print_capture_call_args(command, fp_out);
+                fprintf(fp_out, ");\n");
+                fprintf(fp_out, "\t\t\tmemcpy(ret, &result, sizeof(result));\n");
+            }
+            else
+            {
+                fprintf(fp_out, "\t\t\tctx->dispatch.%s(", dispatch_name);
+                print_capture_call_args(command, fp_out);
+                fprintf(fp_out, ");\n");
+            }
+
+            fprintf(fp_out, "\t\t\tbreak;\n\t\t}\n\n");
+            break;
+
+        default:
+            assert(0);
+    }
+
+    free(ret_type);
+    free(dispatch_name);
+}
+
 ezxml_t find_enum(ezxml_t registry, const char *str)
 {
     ezxml_t nodes, node;
@@ -764,9 +1177,19 @@ void print_required_feature_commands(ezxml_t registry, ezxml_t feature, int mode
             command_node = find_command(registry, name);
             assert(command_node);
 
-            if (mode == kMGLDispatchInit)
+            if ((mode == kMGLNoErrorHeaders || mode == kMGLNoErrorDispatchInit) &&
+                !has_no_error_variant(name))
+            {
+                continue;
+            }
+
+            if (mode == kMGLDispatchInit || mode == kMGLNoErrorDispatchInit)
+            {
+                print_init_dispatch_command(command_node, mode, fout);
+            }
+            else if (mode >= kMGLCaptureEnum)
             {
-                print_init_dispatch_command(command_node, fout);
+                print_capture_command(command_node, mode, fout);
             }
             else
             {
@@ -936,6 +1359,14 @@ void print_mgl_init_dispatch(ezxml_t registry)
         
         fprintf(fp_out, "};\n");
     }
+
+    // core only, patched over init_dispatch for no error contexts
+    fprintf(fp_out, "\nvoid init_no_error_dispatch(GLMContext ctx)\n");
+    fprintf(fp_out, "{\n");
+
+    print_required_commands(registry, kMGLNoErrorDispatchInit, fp_out, 0);
+
+    fprintf(fp_out, "};\n");
     
     fclose(fp_out);
 }
@@ -954,6 +1385,10 @@ void print_mgl_header(ezxml_t registry)
     // print the required commands
     print_required_commands(registry, kMGLHeaders, fp_out, 0);
 
+    // and the validation free variants
+    fprintf(fp_out, "\n// no error variants, skip argument validation\n");
+    print_required_commands(registry, kMGLNoErrorHeaders, fp_out, 0);
+
     fclose(fp_out);
 }
 
@@ -975,6 +1410,76 @@ void print_mgl_functions(ezxml_t registry)
 }
 
 
+void print_mgl_capture_header(ezxml_t registry)
+{
+    FILE *fp_out;
+    const char *filename = "/tmp/glm_capture.h";
+
+    fp_out = fopen(filename, "w");
+    assert(fp_out);
+
+    print_about(fp_out, filename);
+
+    fprintf(fp_out, "#ifndef glm_capture_h\n");
+    fprintf(fp_out, "#define glm_capture_h\n\n");
+
+    // ids are written to the trace, any change to the command list bumps CAPTURE_VERSION
+    fprintf(fp_out, "enum {\n");
+    print_required_commands(registry, kMGLCaptureEnum, fp_out, 0);
+    fprintf(fp_out, "\tCAPTURE_COMMANDS\n");
+    fprintf(fp_out, "};\n\n");
+
+    fprintf(fp_out, "#endif /* glm_capture_h */\n");
+
+    fclose(fp_out);
+}
+
+void print_mgl_capture(ezxml_t registry)
+{
+    FILE *fp_out;
+    const char *filename = "/tmp/glm_capture.c";
+
+    fp_out = fopen(filename, "w");
+    assert(fp_out);
+
+    print_about(fp_out, filename);
+
+    fprintf(fp_out, "#include <string.h>\n\n");
+    fprintf(fp_out, "#include \"glm_context.h\"\n");
+    fprintf(fp_out, "#include \"capture.h\"\n\n");
+
+    // core only, es contexts have their own dispatch table
+    fprintf(fp_out, "#ifdef MGL_GL_CORE\n\n");
+
+    print_required_commands(registry, kMGLCaptureArgs, fp_out, 0);
+
+    fprintf(fp_out, "const CaptureCommand capture_commands[CAPTURE_COMMANDS] = {\n");
+    print_required_commands(registry, kMGLCaptureCommands, fp_out, 0);
+    fprintf(fp_out, "};\n\n");
+
+    print_required_commands(registry, kMGLCaptureFuncs, fp_out, 0);
+
+    fprintf(fp_out, "void init_capture_dispatch(GLMContext ctx)\n");
+    fprintf(fp_out, "{\n");
+    fprintf(fp_out, "\tctx->capture_dispatch = ctx->dispatch;\n\n");
+    print_required_commands(registry, kMGLCaptureInit, fp_out, 0);
+    fprintf(fp_out, "}\n\n");
+
+    fprintf(fp_out, "void replay_command(GLMContext ctx, GLuint command, const GLuint64 *args, GLuint64 *ret)\n");
+    fprintf(fp_out, "{\n");
+    fprintf(fp_out, "\tswitch(command)\n");
+    fprintf(fp_out, "\t{\n");
+    print_required_commands(registry, kMGLReplay, fp_out, 0);
+    fprintf(fp_out, "\t\tdefault:\n");
+    fprintf(fp_out, "\t\t\tassert(0);\n");
+    fprintf(fp_out, "\t}\n");
+    fprintf(fp_out, "}\n\n");
+
+    fprintf(fp_out, "#endif /* MGL_GL_CORE */\n");
+
+    fclose(fp_out);
+}
+
 int main(int argc, char **argv)
 {
     ezxml_t registry;
@@ -1003,5 +1508,9 @@ int main(int argc, char **argv)
     // mgl functions
     print_mgl_functions(registry);
 
+    // mgl capture layer and replay
+    print_mgl_capture_header(registry);
+    print_mgl_capture(registry);
+
     ezxml_free(registry);
 }
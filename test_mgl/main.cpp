@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <stdarg.h>
+#include <time.h>
 
 #define GL_GLEXT_PROTOTYPES 1
 #include <GL/glcorearb.h>
@@ -2540,6 +2541,127 @@ int test_readpixels(GLFWwindow* window, int width, int height)
     return 0;
 }
 
+int test_readpixels_pbo_perf(GLFWwindow* window, int width, int height)
+{
+    const char* vertex_shader =
+    GLSL(450 core,
+        layout(location = 0) in vec3 position;
+        layout(location = 1) in vec3 in_color;
+
+        layout(location = 0) out vec4 out_color;
+
+        void main() {
+            gl_Position = vec4(position, 1.0);
+            out_color = vec4(in_color, 1.0);
+        }
+    );
+
+    const char* fragment_shader =
+    GLSL(450 core,
+        layout(location = 0) in vec4 in_color;
+
+        layout(location = 0) out vec4 frag_colour;
+
+        void main() {
+            frag_colour = in_color;
+        }
+    );
+
+    GLuint vbo = 0, col_vbo = 0;
+
+    float points[] = {
+       0.0f,  0.5f,  0.0f,
+       0.5f, -0.5f,  0.0f,
+      -0.5f, -0.5f,  0.0f
+    };
+
+    float color[] = {
+        1.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 1.0f,
+    };
+
+    vbo = bindDataToVBO(GL_ARRAY_BUFFER, 9 * sizeof(float), points, GL_STATIC_DRAW);
+    col_vbo = bindDataToVBO(GL_ARRAY_BUFFER, 9 * sizeof(float), color, GL_STATIC_DRAW);
+
+    GLuint vao = 0;
+    glCreateVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+    bindAttribute(1, GL_ARRAY_BUFFER, col_vbo, 3, GL_FLOAT, false, 0, NULL);
+
+    GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+    glUseProgram(shader_program);
+
+    // ring of pack buffers, each frame maps the one read NUM_PBOS - 1 frames ago
+#define NUM_PBOS    3
+    GLuint pbos[NUM_PBOS];
+    size_t frame_size = width * height * 4;
+
+    glGenBuffers(NUM_PBOS, pbos);
+    for(int i=0; i<NUM_PBOS; i++)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frame_size, NULL, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    glReadBuffer(GL_BACK);
+
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    uint32_t checksum = 0;
+    int frame = 0;
+
+    while(!glfwWindowShouldClose(window))
+    {
+        glViewport(0, 0, width, height);
+
+        glClearColor(0.0, 0.0, 0.0, 0.0);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[frame % NUM_PBOS]);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+        if (frame >= NUM_PBOS - 1)
+        {
+            GLubyte *pixels;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[(frame + 1) % NUM_PBOS]);
+            pixels = (GLubyte *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frame_size, GL_MAP_READ_BIT);
+
+            // touch the frame like an encoder would
+            if (pixels)
+                checksum += pixels[(height / 2) * width * 4 + (width / 2) * 4];
+
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        SWAP_BUFFERS;
+
+        frame++;
+
+        if ((frame % 120) == 0)
+        {
+            uint64_t now = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+
+            printf("readpixels pbo capture %dx%d: %.1f frames/sec (checksum %u)\n", width, height, 120.0 / ((now - start) / 1e9), checksum);
+
+            start = now;
+        }
+
+        glfwPollEvents();
+    }
+
+    glDeleteBuffers(NUM_PBOS, pbos);
+
+    return 0;
+}
+
 const char* compute_shader1 =
 GLSL(450 core,
      layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
@@ -2640,6 +2762,175 @@ GLSL(450 core,
      }
 );
 
+int test_texture_views(GLFWwindow* window, int width, int height)
+{
+    const char* vertex_shader =
+    GLSL(450 core,
+        layout(location = 0) in vec3 position;
+        layout(location = 1) in vec2 in_texcords;
+
+        layout(location = 0) out vec2 out_texcoords;
+
+        void main() {
+            gl_Position = vec4(position, 1.0);
+            out_texcoords = in_texcords;
+        }
+    );
+
+    // left half samples the view, right half fetches from the texture buffer
+    const char* fragment_shader =
+    GLSL(450 core,
+        layout(location = 0) in vec2 in_texcords;
+
+        layout(location = 0) out vec4 frag_colour;
+
+        layout(binding = 0) uniform sampler2D view_image;
+        layout(binding = 1) uniform samplerBuffer texels;
+
+        void main() {
+            if (in_texcords.x < 0.5)
+                frag_colour = texture(view_image, in_texcords);
+            else
+                frag_colour = texelFetch(texels, 0);
+        }
+    );
+
+    GLuint vbo = 0, tex_vbo = 0;
+
+    float points[] = {
+      -1.0f, -1.0f,  0.0f,
+       1.0f, -1.0f,  0.0f,
+      -1.0f,  1.0f,  0.0f,
+       1.0f,  1.0f,  0.0f,
+    };
+
+    float texcoords[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+
+    vbo = bindDataToVBO(GL_ARRAY_BUFFER, 12 * sizeof(float), points, GL_STATIC_DRAW);
+    tex_vbo = bindDataToVBO(GL_ARRAY_BUFFER, 8 * sizeof(float), texcoords, GL_STATIC_DRAW);
+
+    GLuint vao = 0;
+    glCreateVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    bindAttribute(0, GL_ARRAY_BUFFER, vbo, 3, GL_FLOAT, false, 0, NULL);
+    bindAttribute(1, GL_ARRAY_BUFFER, tex_vbo, 2, GL_FLOAT, false, 0, NULL);
+
+    GLuint shader_program = compileGLSLProgram(2, GL_VERTEX_SHADER, vertex_shader, GL_FRAGMENT_SHADER, fragment_shader);
+    glUseProgram(shader_program);
+
+    int failures = 0;
+
+    // a layer of a 2D array viewed as a 2D texture, writes through the view land in the parent
+    GLuint array_tex, view_tex;
+    const int tex_size = 64, layers = 4, view_layer = 2;
+
+    glGenTextures(1, &array_tex);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array_tex);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, tex_size, tex_size, layers);
+
+    glGenTextures(1, &view_tex);
+    glTextureView(view_tex, GL_TEXTURE_2D, array_tex, GL_RGBA8, 0, 1, view_layer, 1);
+
+    uint32_t *texels = (uint32_t *)malloc(tex_size * tex_size * sizeof(uint32_t));
+    for(int i=0; i<tex_size * tex_size; i++)
+        texels[i] = 0xff00ff00;
+
+    glBindTexture(GL_TEXTURE_2D, view_tex);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, tex_size, tex_size, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    uint32_t *readback = (uint32_t *)calloc(tex_size * tex_size * layers, sizeof(uint32_t));
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array_tex);
+    glGetTexImage(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, GL_UNSIGNED_BYTE, readback);
+
+    if (readback[view_layer * tex_size * tex_size] != 0xff00ff00)
+    {
+        printf("test_texture_views: view write not visible in parent layer %d (0x%08x)\n", view_layer, readback[view_layer * tex_size * tex_size]);
+        failures++;
+    }
+
+    if (readback[0] == 0xff00ff00)
+    {
+        printf("test_texture_views: view write leaked into parent layer 0\n");
+        failures++;
+    }
+
+    // a texture buffer aliasing a buffer object, big enough to be backed by a metal buffer
+    GLuint tbo, buffer_tex;
+    const size_t tbo_size = 16 * 1024;
+    float red[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    float blue[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+
+    glGenBuffers(1, &tbo);
+    glBindBuffer(GL_TEXTURE_BUFFER, tbo);
+    glBufferData(GL_TEXTURE_BUFFER, tbo_size, NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, sizeof(red), red);
+
+    glGenTextures(1, &buffer_tex);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, buffer_tex);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, tbo);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, view_tex);
+
+    int frame = 0;
+    uint8_t pixel[4];
+
+    while(!glfwWindowShouldClose(window))
+    {
+        // alternate the buffer contents, the texture never gets respecified
+        glBindBuffer(GL_TEXTURE_BUFFER, tbo);
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, sizeof(red), (frame & 1) ? blue : red);
+
+        glViewport(0, 0, width, height);
+
+        glClearColor(0.0, 0.0, 0.0, 0.0);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+        glReadBuffer(GL_BACK);
+        glReadPixels(width * 3 / 4, height / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+        if ((frame & 1) ? (pixel[2] != 0xff || pixel[0] != 0) : (pixel[0] != 0xff || pixel[2] != 0))
+        {
+            printf("test_texture_views: frame %d buffer write not visible through texture buffer (%02x %02x %02x %02x)\n",
+                   frame, pixel[0], pixel[1], pixel[2], pixel[3]);
+            failures++;
+        }
+
+        glReadPixels(width / 4, height / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+        if (pixel[1] != 0xff)
+        {
+            printf("test_texture_views: frame %d view sample wrong (%02x %02x %02x %02x)\n",
+                   frame, pixel[0], pixel[1], pixel[2], pixel[3]);
+            failures++;
+        }
+
+        frame++;
+
+        SWAP_BUFFERS;
+
+        glfwPollEvents();
+    }
+
+    printf("test_texture_views: %d frames, %d failures\n", frame, failures);
+
+    free(texels);
+    free(readback);
+
+    return failures;
+}
+
 int test_compute_shader(GLFWwindow* window, int width, int height)
 {
     const char* compute_shader =
@@ -3391,6 +3682,17 @@ int run_test_case(int test_num, int width, int height)
         case 21:
             window = newTestWindow(width, height, "test_draw_arrays_uniform1i");
             test_draw_arrays_uniform1i(window, width, height);
+            break;
+
+        case 22:
+            window = newTestWindow(width, height, "test_readpixels_pbo_perf");
+            test_readpixels_pbo_perf(window, width, height);
+            break;
+
+        case 23:
+            window = newTestWindow(width, height, "test_texture_views");
+            test_texture_views(window, width, height);
+            break;
 
         default:
             return 0;
@@ -3504,6 +3806,7 @@ int main_sdl(int argc, const char * argv[])
     // test_textures(window, width, height, 1, 1, 8, GL_LINEAR_MIPMAP_NEAREST);
     // test_framebuffer(window, width, height);
     // test_readpixels(window, width, height);
+    // test_readpixels_pbo_perf(window, width, height);
     // test_compute_shader(window, width, height);
 
     //test_2D_array_textures_perf_mon(window, width, height);